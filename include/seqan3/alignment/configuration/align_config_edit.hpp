@@ -41,6 +41,10 @@ namespace seqan3::align_cfg
  * The performance of the algorithm can further be improved if the number of maximal errors (edits) is known by using
  * the align_cfg::min_score configuration.
  *
+ * If many sequence pairs are aligned and only the score and the end positions are requested, the
+ * seqan3::align_cfg::vectorised configuration computes several edit distances at once, one sequence pair per lane
+ * of a SIMD register.
+ *
  * \include snippet/alignment/configuration/align_cfg_edit_example.cpp
  *
  * \attention If the edit distance configuration is combined with any other configuration element or setting, the
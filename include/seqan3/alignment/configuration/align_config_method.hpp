@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides global and local alignment configurations.
+ * \brief Provides global, local and extension alignment configurations.
  * \author Joshua Kim <joshua.kim AT fu-berlin.de>
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include <seqan3/alignment/configuration/detail.hpp>
 #include <seqan3/core/algorithm/pipeable_config_element.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -150,4 +152,124 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::global};
 };
 
+/*!\brief A strong type representing the x_drop value of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct x_drop : public seqan3::detail::strong_type<int32_t, x_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, x_drop>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief A strong type representing the z_drop value of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct z_drop : public seqan3::detail::strong_type<int32_t, z_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, z_drop>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief A strong type representing gapped_extension of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct gapped_extension : public seqan3::detail::strong_type<bool, gapped_extension>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<bool, gapped_extension>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief Sets the X-drop extension alignment method.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The extension alignment is the building block of seed-and-extend algorithms. It aligns the two sequences
+ * starting from their first characters, i.e. both alignments start in the origin of the alignment matrix, and
+ * reports the best scoring alignment of any two prefixes of the sequences. In contrast to a semi-global alignment
+ * with free trailing gaps, the computation uses the X-drop heuristic: a cell whose score falls more than
+ * \ref seqan3::align_cfg::x_drop "x_drop" below the best score seen so far is discarded and the computation
+ * stops as soon as an entire column has been discarded. Thus, hopeless extensions terminate after a few columns
+ * instead of filling the whole matrix.
+ *
+ * Alternatively, the Z-drop criterion known from minimap2 can be configured with \ref seqan3::align_cfg::z_drop
+ * "z_drop". It adjusts the drop value to the diagonal distance of a cell to the best cell seen so far: the cell
+ * \f$(i, j)\f$ is discarded if its score falls more than \f$Z + e \cdot |(i - i') - (j - j')|\f$ below the best
+ * score at \f$(i', j')\f$, where \f$e\f$ is the absolute gap extension score. Thus, an alignment that continues
+ * behind a long gap is not dropped only because of the gap costs, while a region of mismatches still ends the
+ * extension. If both values are set, a cell is discarded if it fails any of the two criteria.
+ *
+ * If \ref seqan3::align_cfg::gapped_extension "gapped_extension" is set to `false`, only the main diagonal is
+ * extended, which corresponds to the ungapped X-drop extension known from BLAST. Otherwise, the affine gap
+ * scheme configured with seqan3::align_cfg::gap_cost_affine is used.
+ *
+ * To extend a seed in both directions, align the sequence suffixes starting directly behind the seed and the
+ * reversed sequence prefixes ending directly before the seed (e.g. using std::views::reverse) in two separate
+ * extension alignments. The begin positions of the second alignment are then relative to the reversed sequences.
+ *
+ * The extension alignment cannot be combined with the seqan3::align_cfg::band_fixed_size configuration. If
+ * seqan3::align_cfg::vectorised is configured, the alignments of a batch are extended simultaneously in the lanes of
+ * the vector unit until every lane has been dropped. In this mode, only the score and the end positions can be
+ * computed and the X-drop and Z-drop values must not exceed a quarter of the largest value of the configured score
+ * type.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_method_extension.cpp
+ */
+class method_extension : public pipeable_config_element<method_extension>
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    method_extension() = default; //!< Defaulted.
+    method_extension(method_extension const &) = default; //!< Defaulted.
+    method_extension(method_extension &&) = default; //!< Defaulted.
+    method_extension & operator=(method_extension const &) = default; //!< Defaulted.
+    method_extension & operator=(method_extension &&) = default; //!< Defaulted.
+    ~method_extension() = default; //!< Defaulted.
+
+    /*!\brief Construct method_extension with a specific X-drop value.
+     * \param[in] x_drop_value An instance of seqan3::align_cfg::x_drop that sets the score difference to the best
+     *                         score seen so far at which a cell is discarded; must not be negative.
+     * \param[in] gapped An instance of seqan3::align_cfg::gapped_extension that indicates whether gaps are allowed
+     *                   during the extension.
+     */
+    constexpr method_extension(seqan3::align_cfg::x_drop x_drop_value,
+                               seqan3::align_cfg::gapped_extension gapped = gapped_extension{true}) noexcept :
+        x_drop{x_drop_value.get()},
+        gapped_extension{gapped.get()}
+    {}
+
+    /*!\brief Construct method_extension with a specific Z-drop value.
+     * \param[in] z_drop_value An instance of seqan3::align_cfg::z_drop that sets the score difference to the best
+     *                         score seen so far at which a cell on the same diagonal is discarded; must not be
+     *                         negative.
+     * \param[in] gapped An instance of seqan3::align_cfg::gapped_extension that indicates whether gaps are allowed
+     *                   during the extension.
+     */
+    constexpr method_extension(seqan3::align_cfg::z_drop z_drop_value,
+                               seqan3::align_cfg::gapped_extension gapped = gapped_extension{true}) noexcept :
+        z_drop{z_drop_value.get()},
+        gapped_extension{gapped.get()}
+    {}
+    //!\}
+
+    //!\brief The score difference to the best score seen so far at which a cell is discarded.
+    int32_t x_drop{std::numeric_limits<int32_t>::max()};
+    //!\brief The score difference to the best score seen so far at which a cell on the same diagonal is discarded.
+    //!\details Grows by the absolute gap extension score per diagonal between the cell and the best cell.
+    int32_t z_drop{std::numeric_limits<int32_t>::max()};
+    //!\brief If set to `false`, only the main diagonal is extended.
+    bool gapped_extension{true};
+
+    //!\privatesection
+    //!\brief An internal id used to check for a valid alignment configuration.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::extension};
+};
+
 } // namespace seqan3::align_cfg
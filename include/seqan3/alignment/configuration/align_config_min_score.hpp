@@ -17,17 +17,26 @@
 
 namespace seqan3::align_cfg
 {
-/*!\brief Sets the minimal score (maximal errors) allowed during an distance computation e.g. edit distance.
+/*!\brief Sets the minimal score (maximal errors) allowed during an alignment computation, e.g. the edit distance.
  * \ingroup alignment_configuration
  *
  * \details
  *
- * This configuration can only be used for computing the \ref seqan3::align_cfg::edit_scheme "edit distance".
- * It restricts the number of substitutions, insertions, and deletions within the alignment to the given value and
- * can thereby speed up the edit distance computation.
+ * When computing the \ref seqan3::align_cfg::edit_scheme "edit distance", this configuration restricts the number of
+ * substitutions, insertions, and deletions within the alignment to the given value and can thereby speed up the edit
+ * distance computation.
  * A typical use case is to verify a candidate region during read mapping where the number of maximal errors is given
- * beforehand. If this configuration is used for an alignment algorithm that does not compute the edit distance, a
- * seqan3::invalid_alignment_configuration exception will be thrown.
+ * beforehand.
+ *
+ * For all other global alignments this configuration acts as a filter: only alignments whose score is greater than or
+ * equal to the minimal score are reported, i.e. the callback of seqan3::align_cfg::on_result is not invoked and
+ * the seqan3::alignment_range returned by seqan3::align_pairwise does not contain results for the other sequence
+ * pairs. If the gap scores are not positive, the computation of a sequence pair is stopped as soon as the score
+ * cannot reach the minimal score anymore. In the \ref seqan3::align_cfg::vectorised "vectorised" mode, a batch of
+ * sequence pairs is stopped once this holds for all of its sequence pairs.
+ *
+ * This configuration cannot be combined with seqan3::align_cfg::method_local or
+ * seqan3::align_cfg::method_extension.
  *
  * ### Example
  *
@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::trace_memory_limit.
+ */
+
+#pragma once
+
+#include <limits>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Limits the memory that may be used to store the trace matrix when computing the alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If the alignment is requested via seqan3::align_cfg::output_alignment, the default algorithm stores the complete
+ * trace matrix, which requires memory proportional to the product of both sequence lengths (or the sequence length
+ * times the band size in the banded case). With this configuration one can specify the maximal number of bytes
+ * that may be allocated for the trace matrix of a single alignment. If the estimated size of the trace matrix
+ * exceeds this limit, the alignment is computed with a divide-and-conquer algorithm (Hirschberg's algorithm
+ * generalised to affine gap costs by Myers and Miller), which only needs memory linear in the length of the
+ * second sequence at the cost of roughly doubling the runtime. Sequence pairs whose trace matrix fits into the
+ * limit are still computed with the full trace matrix.
+ *
+ * The linear memory traceback is available for the global alignment with and without a band. It is not used
+ * if any free end gaps are configured, for the local alignment, in the vectorised alignment or in debug mode.
+ * In these cases the configuration element is ignored and the full trace matrix is used.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_trace_memory_limit_example.cpp
+ */
+class trace_memory_limit : public pipeable_config_element<trace_memory_limit>
+{
+public:
+    //!\brief The maximal number of bytes used for the trace matrix [default: no limit].
+    uint64_t bytes{std::numeric_limits<uint64_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr trace_memory_limit() noexcept = default; //!< Defaulted
+    constexpr trace_memory_limit(trace_memory_limit const &) noexcept = default; //!< Defaulted
+    constexpr trace_memory_limit(trace_memory_limit &&) noexcept = default; //!< Defaulted
+    constexpr trace_memory_limit & operator=(trace_memory_limit const &) noexcept = default; //!< Defaulted
+    constexpr trace_memory_limit & operator=(trace_memory_limit &&) noexcept = default; //!< Defaulted
+    ~trace_memory_limit() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the memory limit.
+     *
+     * \param bytes \copybrief bytes
+     */
+    constexpr trace_memory_limit(uint64_t const bytes) noexcept :
+        bytes{bytes}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::trace_memory_limit};
+};
+
+} // namespace seqan3::align_cfg
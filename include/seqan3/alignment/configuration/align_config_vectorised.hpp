@@ -32,6 +32,9 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * Combined with seqan3::align_cfg::edit_scheme, the bit-parallel edit distance is vectorised in the same way, as long
+ * as neither the begin positions nor the alignment are requested.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
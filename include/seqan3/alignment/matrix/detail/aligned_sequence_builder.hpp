@@ -192,6 +192,34 @@ public:
         std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
             std::pair<size_t, size_t>{trace_it.coordinate()};
 
+        return (*this)(trace_segments | std::views::reverse,
+                       res.first_sequence_slice_positions,
+                       res.second_sequence_slice_positions);
+    }
+
+    /*!\brief Builds the aligned sequences from the given trace segments.
+     * \tparam trace_segments_t The type of the trace segments; must model std::ranges::forward_range and its value type
+     *                          must be a pair of seqan3::detail::trace_directions and the number of consecutive steps.
+     * \param[in] trace_segments The trace segments in order from source to sink in the trace matrix.
+     * \param[in] first_sequence_slice_positions The begin and end position of the aligned part of the first sequence.
+     * \param[in] second_sequence_slice_positions The begin and end position of the aligned part of the second
+     *                                            sequence.
+     * \returns seqan3::detail::aligned_sequence_builder::result_type with the built alignment.
+     *
+     * \details
+     *
+     * This interface is used if the trace was not computed with a trace matrix, e.g. by
+     * seqan3::detail::linear_space_traceback, and is already given in run-length encoded form.
+     */
+    template <std::ranges::forward_range trace_segments_t>
+    result_type operator()(trace_segments_t && trace_segments,
+                           std::pair<size_t, size_t> const & first_sequence_slice_positions,
+                           std::pair<size_t, size_t> const & second_sequence_slice_positions)
+    {
+        result_type res{};
+        res.first_sequence_slice_positions = first_sequence_slice_positions;
+        res.second_sequence_slice_positions = second_sequence_slice_positions;
+
         assign_unaligned(std::get<0>(res.alignment),
                          std::views::all(fst_rng) | views::slice(res.first_sequence_slice_positions.first,
                                                                  res.first_sequence_slice_positions.second));
@@ -200,9 +228,7 @@ public:
                                                                  res.second_sequence_slice_positions.second));
 
         // Now we need to insert the values.
-        fill_aligned_sequence(trace_segments | std::views::reverse,
-                              std::get<0>(res.alignment),
-                              std::get<1>(res.alignment));
+        fill_aligned_sequence(trace_segments, std::get<0>(res.alignment), std::get<1>(res.alignment));
 
         return res;
     }
@@ -0,0 +1,309 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::trace_matrix_jagged.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief A trace matrix that only stores a contiguous window of rows for every column.
+ * \ingroup alignment_matrix
+ *
+ * \details
+ *
+ * Alignment algorithms that prune the dynamic programming matrix, e.g. the X-drop extension, only compute a small
+ * and varying part of every column. This matrix stores the traces of these parts one after another in a single
+ * buffer together with the first row index and the offset of each column. The memory consumption is thus
+ * proportional to the number of computed cells instead of the size of the complete matrix.
+ *
+ * Columns are appended with seqan3::detail::trace_matrix_jagged::add_column and filled from top to bottom with
+ * seqan3::detail::trace_matrix_jagged::push_back.
+ *
+ * In contrast to seqan3::detail::trace_matrix_full, every stored trace encodes the state of the cell explicitly:
+ * exactly one of seqan3::detail::trace_directions::diagonal, seqan3::detail::trace_directions::up and
+ * seqan3::detail::trace_directions::left marks the origin of the best score, while
+ * seqan3::detail::trace_directions::up_open and seqan3::detail::trace_directions::left_open mark whether the
+ * vertical, respectively horizontal, gap ending in this cell was opened in the cell above, respectively left of it.
+ * The origin of the matrix stores seqan3::detail::trace_directions::none.
+ */
+class trace_matrix_jagged
+{
+private:
+    //!\brief The traces of all stored columns.
+    std::vector<trace_directions> traces{};
+    //!\brief The offset of every column within the trace buffer.
+    std::vector<size_t> column_offsets{};
+    //!\brief The first stored row of every column.
+    std::vector<size_t> first_rows{};
+
+    class path_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_matrix_jagged() = default; //!< Defaulted.
+    trace_matrix_jagged(trace_matrix_jagged const &) = default; //!< Defaulted.
+    trace_matrix_jagged(trace_matrix_jagged &&) = default; //!< Defaulted.
+    trace_matrix_jagged & operator=(trace_matrix_jagged const &) = default; //!< Defaulted.
+    trace_matrix_jagged & operator=(trace_matrix_jagged &&) = default; //!< Defaulted.
+    ~trace_matrix_jagged() = default; //!< Defaulted.
+    //!\}
+
+    //!\brief Removes all columns but keeps the allocated memory.
+    void clear() noexcept
+    {
+        traces.clear();
+        column_offsets.clear();
+        first_rows.clear();
+    }
+
+    /*!\brief Appends a new column whose first stored cell is in the given row.
+     * \param[in] first_row The row index of the first cell that is stored for this column.
+     */
+    void add_column(size_t const first_row)
+    {
+        column_offsets.push_back(traces.size());
+        first_rows.push_back(first_row);
+    }
+
+    /*!\brief Appends the trace of the next cell to the last column.
+     * \param[in] trace The trace to store.
+     */
+    void push_back(trace_directions const trace)
+    {
+        assert(!column_offsets.empty());
+        traces.push_back(trace);
+    }
+
+    /*!\brief Returns the trace at the given coordinate or seqan3::detail::trace_directions::none if the cell was
+     *        not stored.
+     * \param[in] coordinate The coordinate of the cell.
+     */
+    trace_directions at(matrix_coordinate const & coordinate) const noexcept
+    {
+        size_t const col = coordinate.col;
+        size_t const row = coordinate.row;
+
+        if (col >= column_offsets.size() || row < first_rows[col])
+            return trace_directions::none;
+
+        size_t const position = column_offsets[col] + (row - first_rows[col]);
+        size_t const column_end = (col + 1 < column_offsets.size()) ? column_offsets[col + 1] : traces.size();
+
+        return (position < column_end) ? traces[position] : trace_directions::none;
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the origin of the matrix.
+     * \param[in] trace_begin A seqan3::detail::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the seqan3::detail::trace_directions of the path.
+     * \throws std::invalid_argument if the specified coordinate was not stored in this matrix.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const;
+};
+
+/*!\brief The iterator over a trace path of the seqan3::detail::trace_matrix_jagged.
+ * \implements std::forward_iterator
+ *
+ * \details
+ *
+ * Follows the trace path from the given coordinate back to the origin. The direction of a gap is only changed after
+ * its opening cell was left, which is marked by seqan3::detail::trace_directions::up_open respectively
+ * seqan3::detail::trace_directions::left_open in the trace of the current cell.
+ */
+class trace_matrix_jagged::path_iterator
+{
+private:
+    //!\brief The underlying matrix.
+    trace_matrix_jagged const * host_ptr{nullptr};
+    //!\brief The coordinate of the current cell.
+    matrix_coordinate current_coordinate{};
+    //!\brief The current trace direction.
+    trace_directions current_direction{};
+
+    //!\brief Selects the direction of the best score of the current cell.
+    void set_trace_direction() noexcept
+    {
+        trace_directions const dir = host_ptr->at(current_coordinate);
+
+        if (static_cast<bool>(dir & trace_directions::diagonal))
+            current_direction = trace_directions::diagonal;
+        else if (static_cast<bool>(dir & trace_directions::up))
+            current_direction = trace_directions::up;
+        else if (static_cast<bool>(dir & trace_directions::left))
+            current_direction = trace_directions::left;
+        else
+            current_direction = trace_directions::none;
+    }
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    using value_type = trace_directions; //!< The value type.
+    using reference = trace_directions const &; //!< The reference type.
+    using pointer = value_type const *; //!< The pointer type.
+    using difference_type = std::ptrdiff_t; //!< The difference type.
+    using iterator_category = std::forward_iterator_tag; //!< Forward iterator tag.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    path_iterator() = default; //!< Defaulted.
+    path_iterator(path_iterator const &) = default; //!< Defaulted.
+    path_iterator(path_iterator &&) = default; //!< Defaulted.
+    path_iterator & operator=(path_iterator const &) = default; //!< Defaulted.
+    path_iterator & operator=(path_iterator &&) = default; //!< Defaulted.
+    ~path_iterator() = default; //!< Defaulted.
+
+    /*!\brief Constructs the iterator from the host matrix and the coordinate the trace path starts in.
+     * \param[in] host The underlying trace matrix.
+     * \param[in] trace_begin The coordinate of the first cell of the trace path.
+     */
+    path_iterator(trace_matrix_jagged const & host, matrix_coordinate const & trace_begin) noexcept :
+        host_ptr{std::addressof(host)},
+        current_coordinate{trace_begin}
+    {
+        set_trace_direction();
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the current trace direction.
+    reference operator*() const noexcept
+    {
+        return current_direction;
+    }
+
+    //!\brief Returns a pointer to the current trace direction.
+    pointer operator->() const noexcept
+    {
+        return &current_direction;
+    }
+
+    //!\brief Returns the current coordinate in two-dimensional space.
+    matrix_coordinate coordinate() const noexcept
+    {
+        return current_coordinate;
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\brief Advances the iterator by one.
+    path_iterator & operator++() noexcept
+    {
+        trace_directions const old_dir = host_ptr->at(current_coordinate);
+
+        assert(current_direction != trace_directions::none);
+
+        if (current_direction == trace_directions::up)
+        {
+            --current_coordinate.row;
+            if (static_cast<bool>(old_dir & trace_directions::up_open))
+                set_trace_direction();
+        }
+        else if (current_direction == trace_directions::left)
+        {
+            --current_coordinate.col;
+            if (static_cast<bool>(old_dir & trace_directions::left_open))
+                set_trace_direction();
+        }
+        else
+        {
+            assert(current_direction == trace_directions::diagonal);
+
+            --current_coordinate.row;
+            --current_coordinate.col;
+            set_trace_direction();
+        }
+        return *this;
+    }
+
+    //!\brief Returns an iterator advanced by one.
+    path_iterator operator++(int) noexcept
+    {
+        path_iterator tmp{*this};
+        ++(*this);
+        return tmp;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns `true` if both iterators point to the same cell, `false` otherwise.
+    friend bool operator==(path_iterator const & lhs, path_iterator const & rhs) noexcept
+    {
+        return lhs.current_coordinate.row == rhs.current_coordinate.row &&
+               lhs.current_coordinate.col == rhs.current_coordinate.col;
+    }
+
+    //!\brief Returns `true` if the iterator reached the end of the trace path, `false` otherwise.
+    friend bool operator==(path_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return lhs.current_direction == trace_directions::none;
+    }
+
+    //!\copydoc operator==(path_iterator const &, std::default_sentinel_t const &)
+    friend bool operator==(std::default_sentinel_t const &, path_iterator const & rhs) noexcept
+    {
+        return rhs == std::default_sentinel;
+    }
+
+    //!\brief Returns `true` if both iterators point to different cells, `false` otherwise.
+    friend bool operator!=(path_iterator const & lhs, path_iterator const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Returns `true` if the iterator did not reach the end of the trace path, `false` otherwise.
+    friend bool operator!=(path_iterator const & lhs, std::default_sentinel_t const &) noexcept
+    {
+        return !(lhs == std::default_sentinel);
+    }
+
+    //!\copydoc operator!=(path_iterator const &, std::default_sentinel_t const &)
+    friend bool operator!=(std::default_sentinel_t const &, path_iterator const & rhs) noexcept
+    {
+        return !(rhs == std::default_sentinel);
+    }
+    //!\}
+};
+
+//!\cond
+inline auto trace_matrix_jagged::trace_path(matrix_coordinate const & trace_begin) const
+{
+    bool const is_origin = trace_begin.row == 0 && trace_begin.col == 0;
+
+    if (!is_origin && at(trace_begin) == trace_directions::none)
+        throw std::invalid_argument{"The given coordinates exceed the stored cells of the trace matrix."};
+
+    return std::ranges::subrange<path_iterator, std::default_sentinel_t>{path_iterator{*this, trace_begin},
+                                                                         std::default_sentinel};
+}
+//!\endcond
+
+} // namespace seqan3::detail
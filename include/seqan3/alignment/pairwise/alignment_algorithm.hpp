@@ -13,17 +13,22 @@
 #pragma once
 
 #include <seqan3/std/iterator>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <seqan3/std/ranges>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_trace_memory_limit.hpp>
 #include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/linear_space_traceback.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
 #include <seqan3/core/detail/deferred_crtp_base.hpp>
@@ -105,6 +110,12 @@ private:
                                                   std::allocator<std::optional<trace_directions>>,
                                                   matrix_major_order::column>,
                            empty_type>;
+    //!\brief The type of the traceback used if the trace matrix would exceed the seqan3::align_cfg::trace_memory_limit.
+    using linear_space_traceback_t =
+        std::conditional_t<traits_t::compute_sequence_alignment && traits_t::is_global && !traits_t::is_vectorised &&
+                           !traits_t::is_debug && config_t::template exists<align_cfg::trace_memory_limit>(),
+                           linear_space_traceback<typename traits_t::score_type>,
+                           empty_type>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -178,6 +189,10 @@ public:
      * |space (end positions)   |\f$ O(m) \f$      |\f$ O(k) \f$       |
      * |space (begin positions) |\f$ O(n*m) \f$    |\f$ O(n*k) \f$     |
      * |space (alignment)       |\f$ O(n*m) \f$    |\f$ O(n*k) \f$     |
+     *
+     * If the global alignment is computed with seqan3::align_cfg::trace_memory_limit and the trace matrix of a
+     * sequence pair would exceed the given limit, the alignment is computed in \f$ O(m) \f$ space instead
+     * (see seqan3::detail::linear_space_traceback).
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
     //!\cond
@@ -272,6 +287,8 @@ private:
      * \details
      *
      * Uses the standard dynamic programming algorithm to compute the pairwise sequence alignment.
+     * If the trace matrix would exceed the configured seqan3::align_cfg::trace_memory_limit, the alignment is
+     * computed with seqan3::detail::linear_space_traceback instead.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -283,6 +300,17 @@ private:
     {
         assert(cfg_ptr != nullptr);
 
+        if constexpr (!std::same_as<linear_space_traceback_t, empty_type> &&
+                      std::ranges::random_access_range<sequence1_t> && std::ranges::sized_range<sequence1_t> &&
+                      std::ranges::random_access_range<sequence2_t> && std::ranges::sized_range<sequence2_t>)
+        {
+            if (exceeds_trace_memory_limit(sequence1, sequence2))
+            {
+                compute_alignment_in_linear_space(idx, sequence1, sequence2, callback);
+                return;
+            }
+        }
+
         if constexpr (traits_t::is_debug)
             initialise_debug_matrices(sequence1, sequence2);
 
@@ -307,6 +335,99 @@ private:
         }
     }
 
+    /*!\brief Checks if the trace matrix for the given sequences exceeds the configured memory limit.
+     * \tparam sequence1_t The type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns `true` if the alignment shall be computed with the linear space traceback, otherwise `false`.
+     *
+     * \details
+     *
+     * The linear space traceback is only used for the global alignment without free end gaps. In the banded case
+     * the first and the last cell of the matrix must be covered by the band, such that the sequences do not need to
+     * be sliced.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    bool exceeds_trace_memory_limit(sequence1_t & sequence1, sequence2_t & sequence2) const
+    {
+        using seqan3::get;
+
+        auto const & method = get<align_cfg::method_global>(*cfg_ptr);
+        if (method.free_end_gaps_sequence1_leading || method.free_end_gaps_sequence2_leading ||
+            method.free_end_gaps_sequence1_trailing || method.free_end_gaps_sequence2_trailing)
+            return false;
+
+        uint64_t const column_count = std::ranges::size(sequence1) + 1;
+        uint64_t row_count = std::ranges::size(sequence2) + 1;
+
+        if constexpr (traits_t::is_banded)
+        {
+            auto const & band = get<align_cfg::band_fixed_size>(*cfg_ptr);
+            int64_t const last_diagonal = static_cast<int64_t>(column_count) - static_cast<int64_t>(row_count);
+
+            if (band.lower_diagonal > 0 || band.upper_diagonal < 0 ||
+                band.lower_diagonal > last_diagonal || band.upper_diagonal < last_diagonal)
+                return false;
+
+            int64_t const band_size = static_cast<int64_t>(band.upper_diagonal) - band.lower_diagonal + 1;
+            row_count = std::min<uint64_t>(row_count, band_size);
+        }
+
+        return column_count * row_count * sizeof(trace_directions) > get<align_cfg::trace_memory_limit>(*cfg_ptr).bytes;
+    }
+
+    /*!\brief Computes the global alignment for a single pair of sequences in linear space.
+     * \tparam sequence1_t The type of the first sequence.
+     * \tparam sequence2_t The type of the second sequence.
+     * \tparam callback_t The type of the callback function.
+     *
+     * \param[in] idx The index of the current processed sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     *
+     * \details
+     *
+     * Neither the score matrix nor the trace matrix are allocated. Instead the alignment is computed with
+     * seqan3::detail::linear_space_traceback and the optimum is set to the last cell of the matrix.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename callback_t>
+    void compute_alignment_in_linear_space(size_t const idx,
+                                           sequence1_t & sequence1,
+                                           sequence2_t & sequence2,
+                                           callback_t & callback)
+    {
+        using seqan3::get;
+
+        int64_t lower_diagonal = std::numeric_limits<int32_t>::lowest();
+        int64_t upper_diagonal = std::numeric_limits<int32_t>::max();
+
+        if constexpr (traits_t::is_banded)
+        {
+            auto const & band = get<align_cfg::band_fixed_size>(*cfg_ptr);
+            lower_diagonal = band.lower_diagonal;
+            upper_diagonal = band.upper_diagonal;
+        }
+
+        auto const score = linear_traceback(sequence1,
+                                            sequence2,
+                                            this->scoring_scheme,
+                                            this->alignment_state.gap_open_score -
+                                                this->alignment_state.gap_extension_score,
+                                            this->alignment_state.gap_extension_score,
+                                            lower_diagonal,
+                                            upper_diagonal);
+
+        this->alignment_state.optimum.column_index = std::ranges::size(sequence1);
+        this->alignment_state.optimum.row_index = std::ranges::size(sequence2);
+        this->alignment_state.optimum.score = score;
+
+        make_alignment_result(idx, sequence1, sequence2, callback, true);
+    }
+
     /*!\brief Checks if the band parameters are valid for the given sequences.
      * \tparam sequence1_t The type of the first sequence.
      * \tparam sequence2_t The type of the second sequence.
@@ -575,6 +696,7 @@ private:
      * \param[in] sequence1 The first range to get the alignment for if requested.
      * \param[in] sequence2 The second range to get the alignment for if requested.
      * \param[in] callback The callback function to be invoked with the alignment result.
+     * \param[in] computed_in_linear_space Whether the alignment was computed with the linear space traceback.
      *
      * \details
      *
@@ -589,7 +711,8 @@ private:
      * If the alignment is run in debug mode (see seqan3::align_cfg::detail::debug) the debug score and optionally trace
      * matrix are stored in the alignment result as well.
      *
-     * Finally, the callback is invoked with the computed alignment result.
+     * Finally, the callback is invoked with the computed alignment result. If seqan3::align_cfg::min_score is
+     * configured and the optimal score is less than the minimal score, no result is generated.
      */
     template <typename index_t, typename sequence1_t, typename sequence2_t, typename callback_t>
     //!\cond
@@ -598,7 +721,8 @@ private:
     constexpr void make_alignment_result([[maybe_unused]] index_t const idx,
                                          [[maybe_unused]] sequence1_t & sequence1,
                                          [[maybe_unused]] sequence2_t & sequence2,
-                                         callback_t & callback)
+                                         callback_t & callback,
+                                         [[maybe_unused]] bool const computed_in_linear_space = false)
     {
         using result_value_t = typename alignment_result_value_type_accessor<alignment_result_t>::type;
 
@@ -609,6 +733,13 @@ private:
         static_assert(seqan3::detail::alignment_configuration_traits<config_t>::has_output_configuration,
                       "The configuration must contain at least one align_cfg::output_* element.");
 
+        // Alignments below the minimal score are not reported.
+        if constexpr (traits_t::has_min_score)
+        {
+            if (this->alignment_state.optimum.score < seqan3::get<align_cfg::min_score>(*cfg_ptr).score)
+                return;
+        }
+
         result_value_t res{};
 
         if constexpr (traits_t::output_sequence1_id)
@@ -627,16 +758,31 @@ private:
                                                      row_index_type{this->alignment_state.optimum.row_index}};
             // At some point this needs to be refactored so that it is not necessary to adapt the coordinate.
             if constexpr (traits_t::is_banded)
-                res.end_positions.second += res.end_positions.first - this->trace_matrix.band_col_index;
+            {
+                if (!computed_in_linear_space)
+                    res.end_positions.second += res.end_positions.first - this->trace_matrix.band_col_index;
+            }
         }
 
         if constexpr (traits_t::compute_begin_positions)
         {
             // Get a aligned sequence builder for banded or un-banded case.
             aligned_sequence_builder builder{sequence1, sequence2};
-            auto optimum_coordinate = alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
-                                                           row_index_type{this->alignment_state.optimum.row_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+            auto trace_res = [&] ()
+            {
+                if constexpr (!std::same_as<linear_space_traceback_t, empty_type>)
+                {
+                    if (computed_in_linear_space)
+                        return builder(linear_traceback.trace_segments(),
+                                       {0u, this->alignment_state.optimum.column_index},
+                                       {0u, this->alignment_state.optimum.row_index});
+                }
+
+                auto optimum_coordinate =
+                    alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
+                                         row_index_type{this->alignment_state.optimum.row_index}};
+                return builder(this->trace_matrix.trace_path(optimum_coordinate));
+            }();
             res.begin_positions.first = trace_res.first_sequence_slice_positions.first;
             res.begin_positions.second = trace_res.second_sequence_slice_positions.first;
 
@@ -678,7 +824,8 @@ private:
      * If the alignment is run in debug mode (see seqan3::align_cfg::detail::debug) the debug score and optionally trace
      * matrix are stored in the alignment result as well.
      *
-     * Finally, the callback is invoked with each computed alignment result iteratively.
+     * Finally, the callback is invoked with each computed alignment result iteratively. Alignments whose score is less
+     * than the configured seqan3::align_cfg::min_score are skipped.
      */
     template <typename indexed_sequence_pair_range_t, typename callback_t>
     //!\cond
@@ -693,6 +840,17 @@ private:
         for (auto && [sequence_pairs, alignment_index] : index_sequence_pairs)
         {
             (void) sequence_pairs;
+
+            // Alignments below the minimal score are not reported.
+            if constexpr (traits_t::has_min_score)
+            {
+                if (this->alignment_state.optimum.score[simd_index] < seqan3::get<align_cfg::min_score>(*cfg_ptr).score)
+                {
+                    ++simd_index;
+                    continue;
+                }
+            }
+
             result_value_t res{};
 
             if constexpr (traits_t::output_sequence1_id)
@@ -764,6 +922,8 @@ private:
     score_debug_matrix_t score_debug_matrix{};
     //!\brief The debug matrix for the traces.
     trace_debug_matrix_t trace_debug_matrix{};
+    //!\brief The linear space traceback used if the trace matrix exceeds the configured memory limit.
+    linear_space_traceback_t linear_traceback{};
     //!\brief The maximal size within the first and the second sequence collection.
     std::pair<size_t, size_t> max_size_in_collection{};
 };
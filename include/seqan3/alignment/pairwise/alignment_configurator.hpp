@@ -29,6 +29,7 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_x_drop.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
@@ -121,8 +122,9 @@ public:
     {
         const bool is_global = alignment_config_type::template exists<seqan3::align_cfg::method_global>();
         const bool is_local = alignment_config_type::template exists<seqan3::align_cfg::method_local>();
+        const bool is_extension = alignment_config_type::template exists<seqan3::align_cfg::method_extension>();
 
-        return (is_global || is_local);
+        return (is_global || is_local || is_extension);
     }
 };
 
@@ -351,17 +353,18 @@ public:
             }
         }
 
-        // ----------------------------------------------------------------------------
-        // Check if invalid configuration was used.
-        // ----------------------------------------------------------------------------
-
-        // Do not allow min score configuration for alignments not computing the edit distance.
-        if (config_t::template exists<align_cfg::min_score>())
-            throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
-                                                  "specific edit distance computation."};
-        // Configure the alignment algorithm.
-        return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
-                         config_with_result_type};
+        // Use the X-drop extension algorithm if the extension method was selected.
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_extension>())
+        {
+            return std::pair{configure_extension<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+        }
+        else
+        {
+            // Configure the alignment algorithm.
+            return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+        }
     }
 
 private:
@@ -448,6 +451,77 @@ private:
             return has_free_ends_trailing(std::false_type{});
     }
 
+    /*!\brief Configures the X-drop extension algorithm.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type; must be a specialisation of seqan3::configuration.
+     * \param[in] cfg The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the extension is combined with a band or the debug mode, or
+     *         if more than the score and the end positions shall be computed in vectorised mode.
+     *
+     * \details
+     *
+     * In vectorised mode, the simd scoring scheme of the global alignment is selected. The cells of the padding
+     * symbols lie outside of the alignment matrix of their lane and are discarded by the algorithm, so their score
+     * does not matter.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_extension(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        // ----------------------------------------------------------------------------
+        // Unsupported configurations
+        // ----------------------------------------------------------------------------
+
+        if constexpr (traits_t::is_banded)
+            throw invalid_alignment_configuration{"Banded extension alignments are not supported."};
+        else if constexpr (traits_t::is_vectorised && traits_t::requires_trace_information)
+            throw invalid_alignment_configuration{"Vectorised extension alignments can only compute the score and the "
+                                                  "end positions."};
+        else if constexpr (traits_t::is_debug)
+            throw invalid_alignment_configuration{"Extension alignments cannot be computed in debug mode."};
+        else
+        {
+            using score_t = typename traits_t::score_type;
+            using scoring_scheme_t = typename traits_t::scoring_scheme_type;
+            constexpr bool is_aminoacid_scheme = is_type_specialisation_of_v<scoring_scheme_t, aminoacid_scoring_scheme>;
+
+            using simple_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                            lazy<simd_match_mismatch_scoring_scheme,
+                                                                 score_t,
+                                                                 typename traits_t::scoring_scheme_alphabet_type,
+                                                                 seqan3::align_cfg::method_global>,
+                                                            void>;
+            using matrix_simd_scheme_t = lazy_conditional_t<traits_t::is_vectorised,
+                                                            lazy<simd_matrix_scoring_scheme,
+                                                                 score_t,
+                                                                 typename traits_t::scoring_scheme_alphabet_type,
+                                                                 seqan3::align_cfg::method_global>,
+                                                            void>;
+
+            using alignment_scoring_scheme_t = std::conditional_t<traits_t::is_vectorised,
+                                                                  std::conditional_t<is_aminoacid_scheme,
+                                                                                     matrix_simd_scheme_t,
+                                                                                     simple_simd_scheme_t>,
+                                                                  scoring_scheme_t>;
+
+            using gap_cost_policy_t = typename select_gap_recursion_policy<config_t>::type;
+            using optimum_tracker_policy_t =
+                lazy_conditional_t<traits_t::is_vectorised,
+                                   lazy<policy_optimum_tracker_simd, config_t, max_score_updater_simd_extension>,
+                                   lazy<policy_optimum_tracker, config_t, max_score_updater>>;
+            using result_builder_policy_t = policy_alignment_result_builder<config_t>;
+            using scoring_scheme_policy_t = policy_scoring_scheme<config_t, alignment_scoring_scheme_t>;
+
+            return pairwise_alignment_algorithm_x_drop<config_t,
+                                                       gap_cost_policy_t,
+                                                       optimum_tracker_policy_t,
+                                                       result_builder_policy_t,
+                                                       scoring_scheme_policy_t>{cfg};
+        }
+    }
+
     /*!\brief Configures the scoring scheme to use for the alignment computation.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
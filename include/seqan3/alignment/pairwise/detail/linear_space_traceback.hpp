@@ -0,0 +1,478 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::linear_space_traceback.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes an optimal global alignment with affine gap costs in linear memory.
+ * \ingroup pairwise_alignment
+ * \tparam score_t The score type; must model seqan3::arithmetic.
+ *
+ * \details
+ *
+ * Implements the divide-and-conquer algorithm of Myers and Miller (Optimal alignments in linear space, 1988), which
+ * generalises Hirschberg's algorithm to affine gap costs. The columns of the alignment matrix correspond to the
+ * first sequence and the rows to the second sequence. In every step the current subproblem is split at its middle
+ * column. A forward pass over the left half and a reverse pass over the right half determine the row at which an
+ * optimal alignment crosses the middle column and whether it crosses within a horizontal gap. Then both halves are
+ * solved recursively. Only four score columns over the second sequence are kept in memory, such that the memory is
+ * linear in the length of the second sequence while the runtime is roughly doubled compared to the standard dynamic
+ * programming algorithm with a full trace matrix.
+ *
+ * A band can be given in form of the lower and upper diagonal as defined by seqan3::align_cfg::band_fixed_size.
+ * In this case only the cells within the band are computed, in the forward and reverse passes as well as in the
+ * base cases of the recursion. The first and the last cell of the alignment matrix must be covered by the band.
+ *
+ * The result is stored as a sequence of trace segments, i.e. pairs of a seqan3::detail::trace_directions and the
+ * number of consecutive steps in this direction, ordered from the first cell to the last cell of the matrix.
+ * The segments can be converted into the aligned sequences with seqan3::detail::aligned_sequence_builder.
+ */
+template <typename score_t>
+class linear_space_traceback
+{
+public:
+    //!\brief The type of the trace segments.
+    using trace_segments_type = std::vector<std::pair<trace_directions, size_t>>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    linear_space_traceback() = default; //!< Defaulted.
+    linear_space_traceback(linear_space_traceback const &) = default; //!< Defaulted.
+    linear_space_traceback(linear_space_traceback &&) = default; //!< Defaulted.
+    linear_space_traceback & operator=(linear_space_traceback const &) = default; //!< Defaulted.
+    linear_space_traceback & operator=(linear_space_traceback &&) = default; //!< Defaulted.
+    ~linear_space_traceback() = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief Computes the optimal global alignment of both sequences.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range.
+     * \tparam scoring_scheme_t The type of the scoring scheme.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] scoring_scheme The scoring scheme used to score two aligned characters.
+     * \param[in] gap_open_score The score for opening a gap, excluding the score of the first gap extension.
+     * \param[in] gap_extension_score The score for every gap position.
+     * \param[in] lower_diagonal The lower diagonal of the band.
+     * \param[in] upper_diagonal The upper diagonal of the band.
+     *
+     * \returns The score of the optimal alignment.
+     *
+     * \details
+     *
+     * A gap of length `k` is scored with `gap_open_score + k * gap_extension_score`. The trace segments of the
+     * computed alignment can be accessed via seqan3::detail::linear_space_traceback::trace_segments after this
+     * function returned. Previously computed segments are discarded, while the allocated memory is reused.
+     *
+     * ### Complexity
+     *
+     * Runtime \f$ O(nm) \f$ and memory \f$ O(m) \f$, where \f$ n \f$ is the size of the first sequence and \f$ m \f$
+     * the size of the second sequence. In the banded case the runtime is \f$ O(nk) \f$, with \f$ k \f$ being the
+     * size of the band.
+     */
+    template <std::ranges::random_access_range sequence1_t,
+              std::ranges::random_access_range sequence2_t,
+              typename scoring_scheme_t>
+    //!\cond
+        requires std::ranges::sized_range<sequence1_t> && std::ranges::sized_range<sequence2_t>
+    //!\endcond
+    score_t operator()(sequence1_t && sequence1,
+                       sequence2_t && sequence2,
+                       scoring_scheme_t const & scoring_scheme,
+                       score_t const gap_open_score,
+                       score_t const gap_extension_score,
+                       int64_t const lower_diagonal = std::numeric_limits<int32_t>::lowest(),
+                       int64_t const upper_diagonal = std::numeric_limits<int32_t>::max())
+    {
+        size_t const sequence1_size = std::ranges::size(sequence1);
+        size_t const sequence2_size = std::ranges::size(sequence2);
+
+        assert(lower_diagonal <= 0 && upper_diagonal >= 0);
+        assert(lower_diagonal <= static_cast<int64_t>(sequence1_size) - static_cast<int64_t>(sequence2_size));
+        assert(upper_diagonal >= static_cast<int64_t>(sequence1_size) - static_cast<int64_t>(sequence2_size));
+
+        gap_open = gap_open_score;
+        gap_extension = gap_extension_score;
+        lower = lower_diagonal;
+        upper = upper_diagonal;
+        segments.clear();
+
+        auto score_at = [&] (size_t const column, size_t const row) -> score_t
+        {
+            return scoring_scheme.score(std::ranges::begin(sequence1)[column], std::ranges::begin(sequence2)[row]);
+        };
+
+        solve(score_at, 0, sequence1_size, 0, sequence2_size, gap_open, gap_open);
+
+        // The score is recomputed from the transcript such that it does not depend on the split decisions.
+        score_t score{};
+        size_t column = 0;
+        size_t row = 0;
+        for (auto const & [direction, span] : segments)
+        {
+            if (direction == trace_directions::diagonal)
+            {
+                for (size_t k = 0; k < span; ++k)
+                    score += score_at(column + k, row + k);
+
+                column += span;
+                row += span;
+            }
+            else
+            {
+                score += gap_score(span);
+
+                if (direction == trace_directions::up)
+                    row += span;
+                else
+                    column += span;
+            }
+        }
+
+        return score;
+    }
+
+    //!\brief Returns the trace segments of the last computed alignment in order from the first to the last cell.
+    trace_segments_type const & trace_segments() const noexcept
+    {
+        return segments;
+    }
+
+private:
+    //!\brief The type of a score column.
+    using score_column_type = std::vector<score_t>;
+
+    //!\brief A score representing an invalid cell, which leaves enough room to add gap scores without underflow.
+    static constexpr score_t infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+    //!\brief Whether the given score belongs to a valid cell.
+    static constexpr bool is_valid(score_t const score) noexcept
+    {
+        return score > infinity / 2;
+    }
+
+    //!\brief Returns the score of a gap with the given length (zero if the length is 0).
+    score_t gap_score(size_t const length) const noexcept
+    {
+        return (length == 0) ? score_t{} : gap_open + static_cast<score_t>(length) * gap_extension;
+    }
+
+    //!\brief Appends the given number of steps in the given direction to the trace segments.
+    void append(trace_directions const direction, size_t const span)
+    {
+        if (span == 0)
+            return;
+
+        if (!segments.empty() && segments.back().first == direction)
+            segments.back().second += span;
+        else
+            segments.emplace_back(direction, span);
+    }
+
+    /*!\brief Computes the last score column of a subproblem with the standard affine recursion.
+     * \tparam score_fn_t The type of the function returning the score for column `i` and row `j`, both starting at 1.
+     *
+     * \param[in] score_fn The function to compute the score of two aligned characters.
+     * \param[in] column_count The number of columns to compute (excluding the initialisation column).
+     * \param[in] row_count The number of rows to compute (excluding the initialisation row).
+     * \param[in] low The smallest diagonal (`column - row`) within the band, relative to the origin.
+     * \param[in] high The largest diagonal (`column - row`) within the band, relative to the origin.
+     * \param[in] first_row_gap_open The gap open score for horizontal gaps starting in the origin.
+     * \param[out] best The best score of every cell of the last column.
+     * \param[out] horizontal The best score of every cell of the last column ending in a horizontal gap.
+     *
+     * \details
+     *
+     * Cells outside of the band are set to seqan3::detail::linear_space_traceback::infinity.
+     */
+    template <typename score_fn_t>
+    void compute_last_column(score_fn_t && score_fn,
+                             size_t const column_count,
+                             size_t const row_count,
+                             int64_t const low,
+                             int64_t const high,
+                             score_t const first_row_gap_open,
+                             score_column_type & best,
+                             score_column_type & horizontal) const
+    {
+        int64_t const last_row = row_count;
+
+        best.assign(row_count + 1, infinity);
+        horizontal.assign(row_count + 1, infinity);
+
+        // Initialise the first column.
+        best[0] = score_t{};
+        for (int64_t row = 1; row <= std::min(last_row, -low); ++row)
+            best[row] = gap_open + static_cast<score_t>(row) * gap_extension;
+
+        int64_t first_band_row = 0;
+        for (int64_t column = 1; column <= static_cast<int64_t>(column_count); ++column)
+        {
+            first_band_row = std::max<int64_t>(0, column - high);
+            int64_t const last_band_row = std::min<int64_t>(last_row, column - low);
+            assert(first_band_row <= last_band_row);
+
+            score_t diagonal = infinity;
+            score_t best_up = infinity;
+            score_t vertical_up = infinity;
+            int64_t row = first_band_row;
+
+            if (row == 0)
+            {
+                diagonal = best[0];
+                best[0] = first_row_gap_open + static_cast<score_t>(column) * gap_extension;
+                horizontal[0] = best[0];
+                best_up = best[0];
+                ++row;
+            }
+            else
+            {
+                diagonal = best[row - 1]; // Still holds the value of the previous column.
+            }
+
+            for (; row <= last_band_row; ++row)
+            {
+                score_t const horizontal_score = std::max<score_t>(horizontal[row] + gap_extension,
+                                                                   best[row] + gap_open + gap_extension);
+                score_t const vertical_score = std::max<score_t>(vertical_up + gap_extension,
+                                                                 best_up + gap_open + gap_extension);
+                score_t const best_score = std::max<score_t>({diagonal + score_fn(column, row),
+                                                              horizontal_score,
+                                                              vertical_score});
+                diagonal = best[row];
+                best[row] = best_score;
+                horizontal[row] = horizontal_score;
+                best_up = best_score;
+                vertical_up = vertical_score;
+            }
+        }
+
+        // Rows above the band still hold values of former columns.
+        std::fill(best.begin(), best.begin() + first_band_row, infinity);
+        std::fill(horizontal.begin(), horizontal.begin() + first_band_row, infinity);
+    }
+
+    /*!\brief Checks if the cell given by the absolute column and row index is inside of the band.
+     * \param[in] column The column index.
+     * \param[in] row The row index.
+     */
+    bool in_band(size_t const column, size_t const row) const noexcept
+    {
+        int64_t const diagonal = static_cast<int64_t>(column) - static_cast<int64_t>(row);
+        return lower <= diagonal && diagonal <= upper;
+    }
+
+    /*!\brief Solves the subproblem consisting of a single column of the first sequence.
+     * \copydetails seqan3::detail::linear_space_traceback::solve
+     */
+    template <typename score_fn_t>
+    void solve_single_column(score_fn_t & score_at,
+                             size_t const column,
+                             size_t const first_row,
+                             size_t const last_row,
+                             score_t const begin_gap_open,
+                             score_t const end_gap_open)
+    {
+        size_t const row_count = last_row - first_row;
+
+        score_t best = infinity;
+        size_t best_row = 0;
+        bool best_is_diagonal = false;
+
+        // The character of the first sequence is aligned to one character of the second sequence.
+        for (size_t offset = 0; offset < row_count; ++offset)
+        {
+            if (!in_band(column, first_row + offset) || !in_band(column + 1, first_row + offset + 1))
+                continue;
+
+            score_t const score = gap_score(offset) +
+                                  score_at(column, first_row + offset) +
+                                  gap_score(row_count - offset - 1);
+            if (score > best)
+                std::tie(best, best_row, best_is_diagonal) = std::tuple{score, offset, true};
+        }
+
+        // The character of the first sequence is aligned to a gap.
+        for (size_t offset = 0; offset <= row_count; ++offset)
+        {
+            if (!in_band(column, first_row + offset) || !in_band(column + 1, first_row + offset))
+                continue;
+
+            score_t const open = (offset == 0) ? begin_gap_open : ((offset == row_count) ? end_gap_open : gap_open);
+            score_t const score = gap_score(offset) + open + gap_extension + gap_score(row_count - offset);
+            if (score > best)
+                std::tie(best, best_row, best_is_diagonal) = std::tuple{score, offset, false};
+        }
+
+        assert(is_valid(best));
+
+        append(trace_directions::up, best_row);
+        if (best_is_diagonal)
+        {
+            append(trace_directions::diagonal, 1);
+            append(trace_directions::up, row_count - best_row - 1);
+        }
+        else
+        {
+            append(trace_directions::left, 1);
+            append(trace_directions::up, row_count - best_row);
+        }
+    }
+
+    /*!\brief Recursively solves the subproblem spanned by the given columns and rows.
+     * \tparam score_fn_t The type of the function returning the score of two aligned characters given their absolute
+     *                    positions in the first and the second sequence.
+     *
+     * \param[in] score_at The function to score two aligned characters.
+     * \param[in] first_column The first column (position in the first sequence) of the subproblem.
+     * \param[in] last_column One after the last column of the subproblem.
+     * \param[in] first_row The first row (position in the second sequence) of the subproblem.
+     * \param[in] last_row One after the last row of the subproblem.
+     * \param[in] begin_gap_open The gap open score for horizontal gaps touching the first cell of the subproblem.
+     * \param[in] end_gap_open The gap open score for horizontal gaps touching the last cell of the subproblem.
+     *
+     * \details
+     *
+     * The gap open scores at the borders of the subproblem are set to 0 if the horizontal gap continues a gap that
+     * was already opened outside of the subproblem.
+     */
+    template <typename score_fn_t>
+    void solve(score_fn_t & score_at,
+               size_t const first_column,
+               size_t const last_column,
+               size_t const first_row,
+               size_t const last_row,
+               score_t const begin_gap_open,
+               score_t const end_gap_open)
+    {
+        size_t const column_count = last_column - first_column;
+        size_t const row_count = last_row - first_row;
+
+        if (column_count == 0)
+            return append(trace_directions::up, row_count);
+
+        if (row_count == 0)
+            return append(trace_directions::left, column_count);
+
+        if (column_count == 1)
+            return solve_single_column(score_at,
+                                       first_column,
+                                       first_row,
+                                       last_row,
+                                       begin_gap_open,
+                                       end_gap_open);
+
+        size_t const middle = column_count / 2;
+        int64_t const begin_diagonal = static_cast<int64_t>(first_column) - static_cast<int64_t>(first_row);
+        int64_t const end_diagonal = static_cast<int64_t>(last_column) - static_cast<int64_t>(last_row);
+
+        // Forward pass over the left half.
+        compute_last_column([&] (size_t const column, size_t const row)
+                            {
+                                return score_at(first_column + column - 1, first_row + row - 1);
+                            },
+                            middle,
+                            row_count,
+                            lower - begin_diagonal,
+                            upper - begin_diagonal,
+                            begin_gap_open,
+                            forward_best,
+                            forward_horizontal);
+
+        // Reverse pass over the right half.
+        compute_last_column([&] (size_t const column, size_t const row)
+                            {
+                                return score_at(last_column - column, last_row - row);
+                            },
+                            column_count - middle,
+                            row_count,
+                            end_diagonal - upper,
+                            end_diagonal - lower,
+                            end_gap_open,
+                            reverse_best,
+                            reverse_horizontal);
+
+        // Find the row where an optimal alignment crosses the middle column.
+        score_t best = infinity;
+        size_t best_row = 0;
+        bool crosses_in_gap = false;
+        for (size_t row = 0; row <= row_count; ++row)
+        {
+            if (is_valid(forward_best[row]) && is_valid(reverse_best[row_count - row]) &&
+                forward_best[row] + reverse_best[row_count - row] > best)
+            {
+                std::tie(best, best_row, crosses_in_gap) =
+                    std::tuple{forward_best[row] + reverse_best[row_count - row], row, false};
+            }
+
+            if (is_valid(forward_horizontal[row]) && is_valid(reverse_horizontal[row_count - row]) &&
+                forward_horizontal[row] + reverse_horizontal[row_count - row] - gap_open > best)
+            {
+                std::tie(best, best_row, crosses_in_gap) =
+                    std::tuple{forward_horizontal[row] + reverse_horizontal[row_count - row] - gap_open, row, true};
+            }
+        }
+
+        assert(is_valid(best));
+
+        size_t const middle_column = first_column + middle;
+        size_t const middle_row = first_row + best_row;
+        if (crosses_in_gap)
+        {
+            // The gap is opened only once, hence the halves continue it without opening it again.
+            solve(score_at, first_column, middle_column - 1, first_row, middle_row, begin_gap_open, score_t{});
+            append(trace_directions::left, 2);
+            solve(score_at, middle_column + 1, last_column, middle_row, last_row, score_t{}, end_gap_open);
+        }
+        else
+        {
+            solve(score_at, first_column, middle_column, first_row, middle_row, begin_gap_open, gap_open);
+            solve(score_at, middle_column, last_column, middle_row, last_row, gap_open, end_gap_open);
+        }
+    }
+
+    //!\brief The gap open score, excluding the gap extension.
+    score_t gap_open{};
+    //!\brief The gap extension score.
+    score_t gap_extension{};
+    //!\brief The lower diagonal of the band.
+    int64_t lower{};
+    //!\brief The upper diagonal of the band.
+    int64_t upper{};
+    //!\brief The best scores of the last column of the forward pass.
+    score_column_type forward_best{};
+    //!\brief The scores ending in a horizontal gap of the last column of the forward pass.
+    score_column_type forward_horizontal{};
+    //!\brief The best scores of the last column of the reverse pass.
+    score_column_type reverse_best{};
+    //!\brief The scores ending in a horizontal gap of the last column of the reverse pass.
+    score_column_type reverse_horizontal{};
+    //!\brief The computed trace segments.
+    trace_segments_type segments{};
+};
+
+} // namespace seqan3::detail
@@ -139,7 +139,9 @@ public:
 
             auto && [alignment_matrix, index_matrix] = this->acquire_matrices(sequence1_size, sequence2_size);
 
-            compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), alignment_matrix, index_matrix);
+            if (!compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair), alignment_matrix, index_matrix))
+                continue; // The alignment cannot reach the minimal score.
+
             this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
                                          std::move(idx),
                                          this->optimal_score,
@@ -164,7 +166,7 @@ public:
         auto seq1_collection = indexed_sequence_pairs | views::get<0> | views::get<0>;
         auto seq2_collection = indexed_sequence_pairs | views::get<0> | views::get<1>;
 
-        this->initialise_tracker(seq1_collection, seq2_collection);
+        this->initialise_tracker(seq1_collection, seq2_collection, this->scoring_scheme.padding_match_score());
 
         // Convert batch of sequences to sequence of simd vectors.
         thread_local simd_collection_t simd_seq1_collection{};
@@ -182,7 +184,9 @@ public:
 
         auto && [alignment_matrix, index_matrix] = this->acquire_matrices(sequence1_size, sequence2_size);
 
-        compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
+        // None of the alignments in this batch can reach the minimal score.
+        if (!compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix))
+            return;
 
         size_t index = 0;
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
@@ -250,6 +254,14 @@ protected:
      * \param[in] sequence2 The second sequence to compute the alignment for.
      * \param[in] alignment_matrix The alignment matrix to compute.
      * \param[in] index_matrix The index matrix corresponding to the alignment matrix.
+     *
+     * \returns `false` if the computation was stopped because the alignment cannot reach the configured
+     *          seqan3::align_cfg::min_score, `true` otherwise.
+     *
+     * \details
+     *
+     * If seqan3::align_cfg::min_score is configured, an upper bound of the optimal score is checked after every column
+     * and the computation stops as soon as it falls below the minimal score.
      */
     template <std::ranges::forward_range sequence1_t,
               std::ranges::forward_range sequence2_t,
@@ -259,7 +271,7 @@ protected:
         requires std::ranges::forward_range<std::ranges::range_reference_t<alignment_matrix_t>> &&
                  std::ranges::forward_range<std::ranges::range_reference_t<index_matrix_t>>
     //!\endcond
-    void compute_matrix(sequence1_t && sequence1,
+    bool compute_matrix(sequence1_t && sequence1,
                         sequence2_t && sequence2,
                         alignment_matrix_t && alignment_matrix,
                         index_matrix_t && index_matrix)
@@ -279,12 +291,22 @@ protected:
         // Iteration phase: compute column-wise the alignment matrix.
         // ---------------------------------------------------------------------
 
+        [[maybe_unused]] size_t remaining_columns = std::ranges::distance(sequence1);
+
         for (auto alphabet1 : sequence1)
+        {
             compute_column(*++alignment_matrix_it,
                            *++indexed_matrix_it,
                            this->scoring_scheme_profile_column(alphabet1),
                            sequence2);
 
+            if constexpr (traits_type::has_min_score)
+            {
+                if (this->is_min_score_unreachable(--remaining_columns))
+                    return false;
+            }
+        }
+
         // ---------------------------------------------------------------------
         // Final phase: track score of last column
         // ---------------------------------------------------------------------
@@ -301,6 +323,8 @@ protected:
             this->track_last_column_cell(*++alignment_column_it, *++cell_index_column_it);
 
         this->track_final_cell(*alignment_column_it, *cell_index_column_it);
+
+        return true;
     }
 
     /*!\brief Initialise the first column of the alignment matrix.
@@ -99,10 +99,12 @@ public:
             // Shrink the first sequence if the band ends before its actual end.
             sequence1_size = std::min(sequence1_size, this->upper_diagonal + sequence2_size);
 
-            compute_matrix(get<0>(sequence_pair) | views::take(sequence1_size),
-                           get<1>(sequence_pair),
-                           alignment_matrix,
-                           index_matrix);
+            if (!compute_matrix(get<0>(sequence_pair) | views::take(sequence1_size),
+                                get<1>(sequence_pair),
+                                alignment_matrix,
+                                index_matrix))
+                continue; // The alignment cannot reach the minimal score.
+
             this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
                                          std::move(idx),
                                          this->optimal_score,
@@ -126,7 +128,7 @@ public:
         auto seq1_collection = indexed_sequence_pairs | views::get<0> | views::get<0>;
         auto seq2_collection = indexed_sequence_pairs | views::get<0> | views::get<1>;
 
-        this->initialise_tracker(seq1_collection, seq2_collection);
+        this->initialise_tracker(seq1_collection, seq2_collection, this->scoring_scheme.padding_match_score());
 
         // Convert batch of sequences to sequence of simd vectors.
         thread_local simd_collection_t simd_seq1_collection{};
@@ -146,7 +148,9 @@ public:
                                                                           sequence2_size,
                                                                           this->lowest_viable_score());
 
-        compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix);
+        // None of the alignments in this batch can reach the minimal score.
+        if (!compute_matrix(simd_seq1_collection, simd_seq2_collection, alignment_matrix, index_matrix))
+            return;
 
         size_t index = 0;
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
@@ -180,6 +184,9 @@ protected:
      * \param[in] alignment_matrix The alignment matrix to compute.
      * \param[in] index_matrix The index matrix corresponding to the alignment matrix.
      *
+     * \returns `false` if the computation was stopped because the alignment cannot reach the configured
+     *          seqan3::align_cfg::min_score, `true` otherwise.
+     *
      * \details
      *
      * In the banded alignment the iteration of the inner columns is split into two phases. The first phase
@@ -227,7 +234,7 @@ protected:
         requires std::ranges::forward_range<std::ranges::range_reference_t<alignment_matrix_t>> &&
                  std::ranges::forward_range<std::ranges::range_reference_t<index_matrix_t>>
     //!\endcond
-    void compute_matrix(sequence1_t && sequence1,
+    bool compute_matrix(sequence1_t && sequence1,
                         sequence2_t && sequence2,
                         alignment_matrix_t && alignment_matrix,
                         index_matrix_t && index_matrix)
@@ -249,12 +256,20 @@ protected:
         // 1st recursion phase: band intersects with the first row.
         // ---------------------------------------------------------------------
 
+        [[maybe_unused]] size_t remaining_columns = std::ranges::distance(sequence1);
+
         for (auto alphabet1 : sequence1 | views::take(column_size))
         {
             this->compute_column(*++alignment_matrix_it,
                                  *++indexed_matrix_it,
                                  alphabet1,
                                  sequence2 | views::take(++row_size));
+
+            if constexpr (traits_type::has_min_score)
+            {
+                if (this->is_min_score_unreachable(--remaining_columns))
+                    return false;
+            }
         }
 
         // ---------------------------------------------------------------------
@@ -269,6 +284,12 @@ protected:
                                 alphabet1,
                                 sequence2 | views::slice(first_row_index, ++row_size));
             ++first_row_index;
+
+            if constexpr (traits_type::has_min_score)
+            {
+                if (this->is_min_score_unreachable(--remaining_columns))
+                    return false;
+            }
         }
 
         // ---------------------------------------------------------------------
@@ -289,6 +310,8 @@ protected:
             this->track_last_column_cell(*++alignment_column_it, *++cell_index_column_it);
 
         this->track_final_cell(*alignment_column_it, *cell_index_column_it);
+
+        return true;
     }
 
     /*!\brief Computes a column of the band that does not start in the first row of the alignment matrix.
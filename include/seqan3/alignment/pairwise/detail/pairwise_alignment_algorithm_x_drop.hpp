@@ -0,0 +1,851 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_x_drop.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_matrix_jagged.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/range/views/get.hpp>
+#include <seqan3/range/views/zip.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+#include <seqan3/utility/simd/views/to_simd.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the X-drop extension alignment.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * Extends the alignment from the origin of the alignment matrix and reports the best scoring alignment between any
+ * two prefixes of the sequences (see seqan3::align_cfg::method_extension). The cells are computed with the same
+ * gap recursion policies as the seqan3::detail::pairwise_alignment_algorithm. But instead of computing the entire
+ * column, only the window of rows that was still alive in the previous column plus the rows that can be reached
+ * from it are computed. Every cell whose score drops more than the configured X-drop value below the best score seen
+ * so far is discarded and the computation ends as soon as no cell of the current column is alive. If a Z-drop value
+ * is configured, a cell is also discarded if its score drops more than the Z-drop value plus the gap extension costs
+ * of its diagonal distance to the best cell below the best score.
+ *
+ * If the trace is required, only the computed windows are stored in a seqan3::detail::trace_matrix_jagged.
+ *
+ * In vectorised mode, the alignments of one batch are computed simultaneously, one alignment per lane of the vector
+ * unit. Every lane has its own optimum and the cells of a lane are discarded independently of the other lanes. The
+ * window of a column spans the alive rows of all lanes and the cells that lie outside of the alignment matrix of a
+ * lane are discarded for this lane. The computation of the batch ends as soon as every lane has been dropped. Only
+ * the score and the end positions can be computed in vectorised mode.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_x_drop : protected policies_t...
+{
+protected:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured scalar score type.
+    using original_score_type = typename traits_type::original_score_type;
+    //!\brief The configured matrix coordinate type.
+    using matrix_coordinate_type = typename traits_type::matrix_coordinate_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+
+    //!\brief The score of all discarded cells; leaves enough room to add further scores without an underflow.
+    static constexpr score_type dropped_score = [] () constexpr
+    {
+        constexpr original_score_type score = std::numeric_limits<original_score_type>::lowest() / 2;
+
+        if constexpr (traits_type::is_vectorised)
+            return simd::fill<score_type>(score);
+        else
+            return score;
+    }();
+
+    //!\brief The largest drop value; the scores of the discarded cells stay below the optimum of every lane.
+    static constexpr int32_t drop_limit = traits_type::is_vectorised
+                                        ? std::numeric_limits<original_score_type>::max() / 4
+                                        : std::numeric_limits<int32_t>::max();
+
+    //!\brief The maximal score difference to the best score before a cell is discarded.
+    int32_t x_drop{drop_limit};
+    //!\brief The maximal score difference to the best score on the same diagonal before a cell is discarded.
+    int32_t z_drop{std::numeric_limits<int32_t>::max()};
+    //!\brief Whether the Z-drop criterion is applied.
+    bool has_z_drop{false};
+    //!\brief The absolute gap extension score by which the Z-drop value grows per diagonal.
+    int32_t gap_extension{};
+    //!\brief The diagonal distance beyond which the Z-drop value exceeds the drop limit.
+    size_t z_drop_max_distance{};
+    //!\brief Whether gaps are allowed during the extension.
+    bool gapped_extension{true};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_x_drop() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop const &)
+        = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop &&)
+        = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_x_drop() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the configured X-drop or Z-drop value is negative or, in
+     *         vectorised mode, if none of them is set or one of them is greater than a quarter of the largest value of
+     *         the configured score type.
+     *
+     * \details
+     *
+     * Initialises the base policies of the alignment algorithm and reads the settings of the
+     * seqan3::align_cfg::method_extension. In vectorised mode, the drop values are limited such that the discarded
+     * cells, whose score is half of the lowest value of the score type, always fall below the optimum of every lane.
+     */
+    pairwise_alignment_algorithm_x_drop(alignment_configuration_t const & config) : policies_t(config)...
+    {
+        constexpr int32_t disabled = std::numeric_limits<int32_t>::max();
+
+        auto const & method = seqan3::get<align_cfg::method_extension>(config);
+
+        if (method.x_drop < 0)
+            throw invalid_alignment_configuration{"The X-drop value must not be negative."};
+
+        if (method.z_drop < 0)
+            throw invalid_alignment_configuration{"The Z-drop value must not be negative."};
+
+        if constexpr (traits_type::is_vectorised)
+        {
+            if ((method.x_drop == disabled && method.z_drop == disabled) ||
+                (method.x_drop != disabled && method.x_drop > drop_limit) ||
+                (method.z_drop != disabled && method.z_drop > drop_limit))
+                throw invalid_alignment_configuration{"The X-drop and Z-drop values are too large for the score type "
+                                                      "of the vectorised extension."};
+        }
+
+        x_drop = std::min(method.x_drop, drop_limit);
+        z_drop = method.z_drop;
+        has_z_drop = method.z_drop != disabled;
+        gapped_extension = method.gapped_extension;
+
+        if (has_z_drop)
+        {
+            auto const & gap_cost = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                             align_cfg::extension_score{-1}});
+            // The product of the gap extension and the capped distance never exceeds the drop limit.
+            gap_extension = std::min(std::abs(gap_cost.extension_score), drop_limit);
+            if (gap_extension > 0)
+                z_drop_max_distance = (drop_limit - std::min(z_drop, drop_limit)) / gap_extension;
+        }
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the extension alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the alignment matrices.
+     *
+     * \details
+     *
+     * The second sequence of every pair must model std::ranges::random_access_range and std::ranges::sized_range.
+     * For every computed alignment the given callback is invoked with the respective alignment result.
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee. Might throw std::bad_alloc.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `c` be the number of
+     * cells that were computed before the extension was dropped. In the worst case, `c` is \f$ O(n*m) \f$, but for
+     * dissimilar sequences it is typically much smaller.
+     *
+     * |                        | gapped           | ungapped              |
+     * |:----------------------:|:----------------:|:---------------------:|
+     * |runtime                 |\f$ O(c) \f$      |\f$ O(min(n, m)) \f$   |
+     * |space (score only)      |\f$ O(m) \f$      |\f$ O(1) \f$           |
+     * |space (alignment)       |\f$ O(m + c) \f$  |\f$ O(min(n, m)) \f$   |
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        static thread_local trace_matrix_jagged trace_matrix{};
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            this->reset_optimum(); // Reset the tracker for the new alignment computation.
+            trace_matrix.clear();
+
+            if (gapped_extension)
+                compute_gapped_extension(get<0>(sequence_pair), get<1>(sequence_pair), trace_matrix);
+            else
+                compute_ungapped_extension(get<0>(sequence_pair), get<1>(sequence_pair), trace_matrix);
+
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         this->optimal_score,
+                                         this->optimal_coordinate,
+                                         trace_matrix,
+                                         callback);
+        }
+    }
+
+    //!\overload
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires traits_type::is_vectorised && std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using simd_collection_t = std::vector<score_type, aligned_allocator<score_type, alignof(score_type)>>;
+        using index_t = typename traits_type::matrix_index_type;
+        using scalar_index_t = typename simd_traits<index_t>::scalar_type;
+
+        // Extract the batch of sequences for the first and the second sequence.
+        auto seq1_collection = indexed_sequence_pairs | views::get<0> | views::get<0>;
+        auto seq2_collection = indexed_sequence_pairs | views::get<0> | views::get<1>;
+
+        // The lanes without a sequence pair keep an empty alignment matrix.
+        alignas(alignof(index_t)) std::array<scalar_index_t, traits_type::alignments_per_vector> sequence1_sizes{};
+        alignas(alignof(index_t)) std::array<scalar_index_t, traits_type::alignments_per_vector> sequence2_sizes{};
+
+        size_t lane = 0;
+        for (auto && [sequence1, sequence2] : views::zip(seq1_collection, seq2_collection))
+        {
+            assert(lane < traits_type::alignments_per_vector);
+
+            sequence1_sizes[lane] = std::ranges::distance(sequence1);
+            sequence2_sizes[lane] = std::ranges::distance(sequence2);
+            ++lane;
+        }
+
+        // Convert batch of sequences to sequence of simd vectors.
+        thread_local simd_collection_t simd_seq1_collection{};
+        thread_local simd_collection_t simd_seq2_collection{};
+
+        auto convert_batch = [&] (simd_collection_t & simd_sequence, auto & sequences)
+        {
+            auto const padding_symbol = this->scoring_scheme.padding_symbol;
+
+            simd_sequence.clear();
+            for (auto && simd_vector_chunk : sequences | views::to_simd<score_type>(padding_symbol))
+                std::ranges::move(simd_vector_chunk, std::cpp20::back_inserter(simd_sequence));
+        };
+
+        convert_batch(simd_seq1_collection, seq1_collection);
+        convert_batch(simd_seq2_collection, seq2_collection);
+
+        this->reset_optimum(); // Reset the tracker for the new alignment computation.
+
+        if (gapped_extension)
+        {
+            compute_gapped_extension(simd_seq1_collection,
+                                     simd_seq2_collection,
+                                     simd::load<index_t>(sequence1_sizes.data()),
+                                     simd::load<index_t>(sequence2_sizes.data()));
+        }
+        else
+        {
+            compute_ungapped_extension(simd_seq1_collection,
+                                       simd_seq2_collection,
+                                       simd::load<index_t>(sequence1_sizes.data()),
+                                       simd::load<index_t>(sequence2_sizes.data()));
+        }
+
+        size_t index = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            original_score_type score = this->optimal_score[index];
+            matrix_coordinate coordinate{row_index_type{size_t{this->optimal_coordinate.row[index]}},
+                                         column_index_type{size_t{this->optimal_coordinate.col[index]}}};
+            this->make_result_and_invoke(std::forward<decltype(sequence_pair)>(sequence_pair),
+                                         std::move(idx),
+                                         std::move(score),
+                                         std::move(coordinate),
+                                         empty_type{}, // The trace is not computed in vectorised mode.
+                                         callback);
+            ++index;
+        }
+    }
+    //!\}
+
+protected:
+    /*!\brief Returns `true` if the given score of a cell drops too far below the best score seen so far.
+     * \param[in] score The score to check.
+     * \param[in] row The row of the cell.
+     * \param[in] col The column of the cell.
+     * \returns `bool` or, in vectorised mode, the mask of the lanes whose score is dropped.
+     *
+     * \details
+     *
+     * The score is dropped if it is more than x_drop below the best score. If the Z-drop criterion is applied, it is
+     * also dropped if it is more than \f$Z + e \cdot \Delta\f$ below the best score, where \f$e\f$ is the absolute
+     * gap extension score and \f$\Delta\f$ is the distance between the diagonals of the cell and the best cell.
+     */
+    auto is_dropped(score_type const & score, size_t const row, size_t const col) const noexcept
+    {
+        if constexpr (traits_type::is_vectorised)
+        {
+            using index_t = typename traits_type::matrix_index_type;
+
+            score_type allowance = simd::fill<score_type>(x_drop);
+
+            if (has_z_drop)
+            {
+                index_t const diagonal = simd::fill<index_t>(row) + this->optimal_coordinate.col;
+                index_t const optimal_diagonal = simd::fill<index_t>(col) + this->optimal_coordinate.row;
+                index_t distance = (diagonal < optimal_diagonal) ? optimal_diagonal - diagonal
+                                                                 : diagonal - optimal_diagonal;
+                index_t const max_distance = simd::fill<index_t>(z_drop_max_distance);
+                distance = (distance < max_distance) ? distance : max_distance;
+
+                // The capped distance is a non-negative value of the score type.
+                score_type const z_allowance = simd::fill<score_type>(z_drop) +
+                                               reinterpret_cast<score_type>(distance) *
+                                               simd::fill<score_type>(gap_extension);
+                allowance = (z_allowance < allowance) ? z_allowance : allowance;
+            }
+
+            return score < this->optimal_score - allowance;
+        }
+        else
+        {
+            int64_t allowance = x_drop;
+
+            if (has_z_drop)
+            {
+                size_t const diagonal = row + this->optimal_coordinate.col;
+                size_t const optimal_diagonal = col + this->optimal_coordinate.row;
+                size_t const distance = std::min((diagonal < optimal_diagonal) ? optimal_diagonal - diagonal
+                                                                               : diagonal - optimal_diagonal,
+                                                 z_drop_max_distance);
+                allowance = std::min<int64_t>(allowance, z_drop + static_cast<int64_t>(gap_extension * distance));
+            }
+
+            return static_cast<int64_t>(score) < static_cast<int64_t>(this->optimal_score) - allowance;
+        }
+    }
+
+    //!\brief Returns `true` if the given simd mask is set for at least one lane.
+    template <typename mask_t>
+    static bool any_lane(mask_t const & mask) noexcept
+    {
+        for (size_t lane = 0; lane < traits_type::alignments_per_vector; ++lane)
+        {
+            if (mask[lane])
+                return true;
+        }
+
+        return false;
+    }
+
+    //!\brief Reduces the trace of the best score to exactly one direction.
+    static constexpr trace_directions best_direction(trace_directions const trace) noexcept
+    {
+        if (static_cast<bool>(trace & trace_directions::diagonal))
+            return trace_directions::diagonal;
+        else if (static_cast<bool>(trace & (trace_directions::up | trace_directions::up_open)))
+            return trace_directions::up;
+        else if (static_cast<bool>(trace & (trace_directions::left | trace_directions::left_open)))
+            return trace_directions::left;
+        else
+            return trace_directions::none;
+    }
+
+    //!\brief Creates the matrix coordinate for the given row and column; the same for all lanes in vectorised mode.
+    static matrix_coordinate_type make_coordinate(size_t const row, size_t const col) noexcept
+    {
+        return matrix_coordinate_type{row_index_type{row}, column_index_type{col}};
+    }
+
+    /*!\brief Marks the given cell as discarded.
+     * \param[in,out] cell The cell to discard.
+     */
+    template <typename cell_t>
+    static void drop_cell(cell_t & cell) noexcept
+    {
+        cell.best_score() = dropped_score;
+        cell.horizontal_score() = dropped_score;
+        cell.vertical_score() = dropped_score;
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            cell.best_trace() = trace_directions::none;
+            cell.horizontal_trace() = trace_directions::none;
+            cell.vertical_trace() = trace_directions::none;
+        }
+    }
+
+    /*!\brief Marks the given cell as discarded in the lanes selected by the mask.
+     * \param[in,out] cell The simd cell to discard.
+     * \param[in] mask The lanes to discard.
+     */
+    template <typename cell_t, typename mask_t>
+    static void drop_cell(cell_t & cell, mask_t const & mask) noexcept
+    {
+        cell.best_score() = (mask) ? dropped_score : cell.best_score();
+        cell.horizontal_score() = (mask) ? dropped_score : cell.horizontal_score();
+        cell.vertical_score() = (mask) ? dropped_score : cell.vertical_score();
+    }
+
+    /*!\brief Computes the gapped X-drop extension.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     * \param[in,out] trace_matrix The matrix to store the traces in; only used if the trace is required.
+     *
+     * \details
+     *
+     * The alignment matrix is computed column by column. In every column only the rows between the first and the
+     * last cell that was not discarded in the previous column are computed, followed by all rows that are reached by
+     * a vertical gap that was not discarded yet.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::random_access_range sequence2_t>
+    //!\cond
+        requires std::ranges::sized_range<sequence2_t>
+    //!\endcond
+    void compute_gapped_extension(sequence1_t && sequence1,
+                                  sequence2_t && sequence2,
+                                  [[maybe_unused]] trace_matrix_jagged & trace_matrix)
+    {
+        using cell_type = decltype(this->initialise_origin_cell());
+
+        size_t const sequence2_size = std::ranges::size(sequence2);
+
+        static thread_local std::vector<cell_type> column{};
+        column.resize(sequence2_size + 1);
+
+        cell_type dropped_cell = this->initialise_origin_cell();
+        drop_cell(dropped_cell);
+
+        // Stores a computed cell and updates the trace and the window of alive rows.
+        size_t first_alive_row{};
+        size_t last_alive_row{};
+        bool is_alive_column{};
+
+        auto store_cell = [&] (cell_type cell,
+                               [[maybe_unused]] trace_directions const trace,
+                               size_t const row,
+                               size_t const col)
+        {
+            // A dropped cell never improves the optimum, so it is safe to track it first.
+            this->track_cell(cell, make_coordinate(row, col));
+
+            if (is_dropped(cell.best_score(), row, col))
+            {
+                drop_cell(cell);
+                if constexpr (traits_type::requires_trace_information)
+                    trace_matrix.push_back(trace_directions::none);
+            }
+            else
+            {
+                if constexpr (traits_type::requires_trace_information)
+                    trace_matrix.push_back(trace);
+
+                first_alive_row = is_alive_column ? first_alive_row : row;
+                last_alive_row = row;
+                is_alive_column = true;
+            }
+
+            column[row] = cell;
+        };
+
+        // ---------------------------------------------------------------------
+        // Initialisation phase: compute the first column.
+        // ---------------------------------------------------------------------
+
+        if constexpr (traits_type::requires_trace_information)
+            trace_matrix.add_column(0);
+
+        store_cell(this->initialise_origin_cell(), trace_directions::none, 0, 0);
+
+        for (size_t row = 1; row <= sequence2_size && !is_dropped(column[row - 1].vertical_score(), row - 1, 0); ++row)
+        {
+            trace_directions trace = trace_directions::up;
+            if constexpr (traits_type::requires_trace_information)
+                trace |= column[row - 1].vertical_trace() & trace_directions::up_open;
+
+            store_cell(this->initialise_first_column_cell(column[row - 1]), trace, row, 0);
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the alive window of every column.
+        // ---------------------------------------------------------------------
+
+        size_t col = 0;
+        for (auto const & alphabet1 : sequence1)
+        {
+            size_t const lo = first_alive_row;
+            size_t const hi = last_alive_row;
+            is_alive_column = false;
+            ++col;
+
+            if constexpr (traits_type::requires_trace_information)
+                trace_matrix.add_column(lo);
+
+            score_type diagonal = dropped_score;
+            cell_type above = dropped_cell;
+            size_t row = lo;
+
+            if (row == 0) // The first row only extends the horizontal gap.
+            {
+                cell_type previous = column[0];
+                diagonal = previous.best_score();
+
+                trace_directions trace = trace_directions::left;
+                if constexpr (traits_type::requires_trace_information)
+                    trace |= previous.horizontal_trace() & trace_directions::left_open;
+
+                store_cell(this->initialise_first_row_cell(previous), trace, 0, col);
+                above = column[0];
+                ++row;
+            }
+
+            for (; row <= sequence2_size; ++row)
+            {
+                bool const is_in_window = row <= hi;
+
+                // Beyond the window, the cell is only reachable by the diagonal or a vertical gap.
+                if (!is_in_window && diagonal == dropped_score && above.vertical_score() == dropped_score)
+                    break;
+
+                cell_type previous = is_in_window ? column[row] : dropped_cell;
+                score_type const next_diagonal = previous.best_score();
+                previous.vertical_score() = above.vertical_score();
+
+                if constexpr (traits_type::requires_trace_information)
+                    previous.vertical_trace() = above.vertical_trace();
+
+                cell_type cell = this->compute_inner_cell(diagonal,
+                                                          previous,
+                                                          this->scoring_scheme.score(alphabet1,
+                                                                                     sequence2[row - 1]));
+                trace_directions trace = trace_directions::none;
+                if constexpr (traits_type::requires_trace_information)
+                {
+                    trace = best_direction(cell.best_trace()) |
+                            (previous.vertical_trace() & trace_directions::up_open) |
+                            (previous.horizontal_trace() & trace_directions::left_open);
+                }
+
+                store_cell(std::move(cell), trace, row, col);
+                above = column[row];
+                diagonal = next_diagonal;
+            }
+
+            if (!is_alive_column) // All cells were dropped.
+                break;
+        }
+    }
+
+    /*!\brief Computes the ungapped X-drop extension.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     * \param[in,out] trace_matrix The matrix to store the traces in; only used if the trace is required.
+     *
+     * \details
+     *
+     * Only the main diagonal is extended until the score is dropped (see is_dropped()) or
+     * the end of one of the sequences is reached.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    void compute_ungapped_extension(sequence1_t && sequence1,
+                                    sequence2_t && sequence2,
+                                    [[maybe_unused]] trace_matrix_jagged & trace_matrix)
+    {
+        auto cell = this->track_cell(this->initialise_origin_cell(), make_coordinate(0, 0));
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            trace_matrix.add_column(0);
+            trace_matrix.push_back(trace_directions::none);
+        }
+
+        score_type score{};
+        size_t position = 0;
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        for (auto const & alphabet1 : sequence1)
+        {
+            if (sequence2_it == std::ranges::end(sequence2))
+                break;
+
+            score += this->scoring_scheme.score(alphabet1, *sequence2_it);
+            ++sequence2_it;
+            ++position;
+
+            if (is_dropped(score, position, position))
+                break;
+
+            cell.best_score() = score;
+            this->track_cell(cell, make_coordinate(position, position));
+
+            if constexpr (traits_type::requires_trace_information)
+            {
+                trace_matrix.add_column(position);
+                trace_matrix.push_back(trace_directions::diagonal);
+            }
+        }
+    }
+
+    /*!\brief Computes the gapped X-drop extension for a batch of sequences in vectorised mode.
+     * \tparam sequence1_t The type of the first simd sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second simd sequence; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range.
+     * \tparam index_t The simd index type.
+     *
+     * \param[in] sequence1 The first sequences of the batch transformed to a sequence of simd vectors.
+     * \param[in] sequence2 The second sequences of the batch transformed to a sequence of simd vectors.
+     * \param[in] sequence1_sizes The size of the first sequence of every lane.
+     * \param[in] sequence2_sizes The size of the second sequence of every lane.
+     *
+     * \details
+     *
+     * Computes the same cells as the scalar gapped extension in every lane. The window of a column spans the rows
+     * between the first and the last cell that was alive in any lane in the previous column, followed by all rows
+     * that are reached by a vertical gap or the diagonal in any lane. The cells of a lane that lie outside of the
+     * window of this lane are derived from discarded cells only and thus are discarded as well. The cells outside of
+     * the alignment matrix of a lane, i.e. the cells of the padding symbols, are discarded before they are tracked.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::random_access_range sequence2_t, typename index_t>
+    //!\cond
+        requires std::ranges::sized_range<sequence2_t> && simd_concept<index_t>
+    //!\endcond
+    void compute_gapped_extension(sequence1_t && sequence1,
+                                  sequence2_t && sequence2,
+                                  index_t const & sequence1_sizes,
+                                  index_t const & sequence2_sizes)
+    {
+        using cell_type = decltype(this->initialise_origin_cell());
+        using mask_type = typename simd_traits<score_type>::mask_type;
+
+        size_t const sequence2_size = std::ranges::size(sequence2);
+
+        static thread_local std::vector<cell_type, aligned_allocator<cell_type, alignof(cell_type)>> column{};
+        column.resize(sequence2_size + 1);
+
+        cell_type dropped_cell = this->initialise_origin_cell();
+        drop_cell(dropped_cell);
+
+        // The lanes whose alignment matrix contains the current column.
+        mask_type is_inside_column = simd::fill<index_t>(0) <= sequence1_sizes;
+        // The lanes with at least one alive cell in the current column and the first and last alive row of every lane.
+        mask_type is_alive_column{};
+        index_t first_alive_rows{};
+        index_t last_alive_rows{};
+
+        // Stores a computed cell and updates the alive mask and the window of alive rows of every lane.
+        auto store_cell = [&] (cell_type cell, size_t const row, size_t const col)
+        {
+            index_t const row_index = simd::fill<index_t>(row);
+
+            drop_cell(cell, ~(is_inside_column & (row_index <= sequence2_sizes)));
+            this->track_cell(cell, make_coordinate(row, col));
+
+            mask_type const is_alive = ~is_dropped(cell.best_score(), row, col);
+            drop_cell(cell, ~is_alive);
+
+            first_alive_rows = (is_alive & ~is_alive_column) ? row_index : first_alive_rows;
+            last_alive_rows = (is_alive) ? row_index : last_alive_rows;
+            is_alive_column |= is_alive;
+
+            column[row] = cell;
+        };
+
+        // ---------------------------------------------------------------------
+        // Initialisation phase: compute the first column.
+        // ---------------------------------------------------------------------
+
+        store_cell(this->initialise_origin_cell(), 0, 0);
+
+        for (size_t row = 1;
+             row <= sequence2_size && any_lane(~is_dropped(column[row - 1].vertical_score(), row - 1, 0));
+             ++row)
+        {
+            store_cell(this->initialise_first_column_cell(column[row - 1]), row, 0);
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the alive window of every column.
+        // ---------------------------------------------------------------------
+
+        size_t col = 0;
+        for (auto const & alphabet1 : sequence1)
+        {
+            // The window of the column spans the alive rows of all lanes.
+            size_t lo = sequence2_size;
+            size_t hi = 0;
+
+            for (size_t lane = 0; lane < traits_type::alignments_per_vector; ++lane)
+            {
+                if (is_alive_column[lane])
+                {
+                    lo = std::min<size_t>(lo, first_alive_rows[lane]);
+                    hi = std::max<size_t>(hi, last_alive_rows[lane]);
+                }
+            }
+
+            is_alive_column = mask_type{};
+            ++col;
+            is_inside_column = simd::fill<index_t>(col) <= sequence1_sizes;
+
+            auto const alphabet1_profile = this->scoring_scheme_profile_column(alphabet1);
+            score_type diagonal = dropped_score;
+            cell_type above = dropped_cell;
+            size_t row = lo;
+
+            if (row == 0) // The first row only extends the horizontal gap.
+            {
+                cell_type previous = column[0];
+                diagonal = previous.best_score();
+                store_cell(this->initialise_first_row_cell(previous), 0, col);
+                above = column[0];
+                ++row;
+            }
+
+            for (; row <= sequence2_size; ++row)
+            {
+                bool const is_in_window = row <= hi;
+
+                // Beyond the window, the cell is only reachable by the diagonal or a vertical gap in some lane.
+                if (!is_in_window && !any_lane((diagonal != dropped_score) | (above.vertical_score() != dropped_score)))
+                    break;
+
+                cell_type previous = is_in_window ? column[row] : dropped_cell;
+                score_type const next_diagonal = previous.best_score();
+                previous.vertical_score() = above.vertical_score();
+
+                store_cell(this->compute_inner_cell(diagonal,
+                                                    previous,
+                                                    this->scoring_scheme.score(alphabet1_profile, sequence2[row - 1])),
+                           row,
+                           col);
+                above = column[row];
+                diagonal = next_diagonal;
+            }
+
+            if (!any_lane(is_alive_column)) // All cells of all lanes were dropped.
+                break;
+        }
+    }
+
+    /*!\brief Computes the ungapped X-drop extension for a batch of sequences in vectorised mode.
+     * \tparam sequence1_t The type of the first simd sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second simd sequence; must model std::ranges::forward_range.
+     * \tparam index_t The simd index type.
+     *
+     * \param[in] sequence1 The first sequences of the batch transformed to a sequence of simd vectors.
+     * \param[in] sequence2 The second sequences of the batch transformed to a sequence of simd vectors.
+     * \param[in] sequence1_sizes The size of the first sequence of every lane.
+     * \param[in] sequence2_sizes The size of the second sequence of every lane.
+     *
+     * \details
+     *
+     * Extends the main diagonal of every lane until its score is dropped (see is_dropped())
+     * or the end of one of its sequences is reached. The computation ends as soon as every lane has been dropped.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t, typename index_t>
+    //!\cond
+        requires simd_concept<index_t>
+    //!\endcond
+    void compute_ungapped_extension(sequence1_t && sequence1,
+                                    sequence2_t && sequence2,
+                                    index_t const & sequence1_sizes,
+                                    index_t const & sequence2_sizes)
+    {
+        using mask_type = typename simd_traits<score_type>::mask_type;
+
+        auto cell = this->track_cell(this->initialise_origin_cell(), make_coordinate(0, 0));
+
+        mask_type is_alive = ~mask_type{};
+        score_type score{};
+        size_t position = 0;
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        for (auto const & alphabet1 : sequence1)
+        {
+            if (sequence2_it == std::ranges::end(sequence2))
+                break;
+
+            score += this->scoring_scheme.score(this->scoring_scheme_profile_column(alphabet1), *sequence2_it);
+            ++sequence2_it;
+            ++position;
+
+            index_t const position_index = simd::fill<index_t>(position);
+            is_alive &= (position_index <= sequence1_sizes) &
+                        (position_index <= sequence2_sizes) &
+                        ~is_dropped(score, position, position);
+
+            if (!any_lane(is_alive))
+                break;
+
+            cell.best_score() = (is_alive) ? score : dropped_score;
+            this->track_cell(cell, make_coordinate(position, position));
+        }
+    }
+};
+
+} // namespace seqan3::detail
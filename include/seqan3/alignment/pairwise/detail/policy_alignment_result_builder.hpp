@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
@@ -47,6 +49,9 @@ protected:
 
     static_assert(!std::same_as<result_type, empty_type>, "The alignment result type was not configured.");
 
+    //!\brief The minimal score a reported alignment must reach [only used with seqan3::align_cfg::min_score].
+    int32_t min_score{std::numeric_limits<int32_t>::lowest()};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -58,10 +63,17 @@ protected:
     ~policy_alignment_result_builder() = default; //!< Defaulted.
 
     /*!\brief Construction and initialisation using the alignment configuration.
-     * \param[in] config The alignment configuration [not used in this context].
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * Stores the minimal score if seqan3::align_cfg::min_score is configured.
      */
-    policy_alignment_result_builder(alignment_configuration_t const & SEQAN3_DOXYGEN_ONLY(config))
-    {}
+    policy_alignment_result_builder([[maybe_unused]] alignment_configuration_t const & config)
+    {
+        if constexpr (traits_type::has_min_score)
+            min_score = seqan3::get<align_cfg::min_score>(config).score;
+    }
     //!\}
 
     /*!\brief Builds the seqan3::alignment_result based on the given alignment result type and then invokes the
@@ -87,6 +99,8 @@ protected:
      * \ref seqan3_align_cfg_output_configurations "seqan3::align_cfg::output_*" configuration only the requested values
      * are stored. In some cases some additional work is done to generate the requested result. For example computing
      * the associated alignment from the traceback matrix.
+     * If seqan3::align_cfg::min_score is configured and the score is less than the minimal score, no result is
+     * generated and the callback is not invoked.
      */
     template <typename sequence_pair_t,
               typename index_t,
@@ -107,6 +121,12 @@ protected:
         using std::get;
         using invalid_t = std::nullopt_t *;
 
+        if constexpr (traits_type::has_min_score)
+        {
+            if (score < min_score)
+                return;
+        }
+
         result_type result{};
 
         if constexpr (traits_type::output_sequence1_id)
@@ -141,6 +161,9 @@ protected:
                 result.data.begin_positions.first = aligned_sequence_result.first_sequence_slice_positions.first;
                 result.data.begin_positions.second = aligned_sequence_result.second_sequence_slice_positions.first;
             }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+                result.data.alignment = std::move(aligned_sequence_result.alignment);
         }
 
         callback(std::move(result));
@@ -13,11 +13,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
+#include <utility>
 
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/matrix/detail/coordinate_matrix.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
@@ -214,6 +219,13 @@ protected:
     //!\brief Whether cells of the last column shall be tracked.
     bool test_last_column_cell{false};
 
+    //!\brief The best score of the currently computed column [only used with seqan3::align_cfg::min_score].
+    score_type column_optimum{};
+    //!\brief The minimal score a reported alignment must reach [only used with seqan3::align_cfg::min_score].
+    int64_t min_score{std::numeric_limits<int64_t>::lowest()};
+    //!\brief An upper bound for the score gained per column or `-1` if alignments cannot be rejected early.
+    int64_t max_column_gain{-1};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -230,16 +242,60 @@ protected:
      * \details
      *
      * Reads the state of seqan3::align_cfg::method_global and enables the tracking of the last row or column if
-     * requested. Otherwise, only the last cell will be tracked.
+     * requested. For the seqan3::align_cfg::method_extension every cell is tracked. Otherwise, only the last cell
+     * will be tracked. If seqan3::align_cfg::min_score is given, the bound for the early rejection of alignments is
+     * initialised as well.
      */
     policy_optimum_tracker(alignment_configuration_t const & config)
     {
         auto method_global_config = config.get_or(align_cfg::method_global{});
         test_last_row_cell = method_global_config.free_end_gaps_sequence1_trailing;
         test_last_column_cell = method_global_config.free_end_gaps_sequence2_trailing;
+        test_every_cell = traits_type::is_extension;
+
+        if constexpr (traits_type::has_min_score)
+            initialise_min_score(config);
     }
     //!\}
 
+    /*!\brief Initialises the minimal score and the maximal score gain per column.
+     * \param[in] config The alignment configuration.
+     *
+     * \details
+     *
+     * The maximal gain per column is the largest score of the configured scoring scheme over all pairs of symbols of
+     * its alphabet, but at least `0`. If a gap could increase the score, no such bound exists and the early rejection
+     * is disabled.
+     */
+    void initialise_min_score(alignment_configuration_t const & config)
+    {
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+        min_score = seqan3::get<align_cfg::min_score>(config).score;
+
+        // Use the same default as the gap recursion policy.
+        auto const & gap_cost = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                         align_cfg::extension_score{-1}});
+
+        if (gap_cost.extension_score > 0 || gap_cost.open_score + gap_cost.extension_score > 0)
+            return;
+
+        auto const & scoring_scheme = seqan3::get<align_cfg::scoring_scheme>(config).scheme;
+        alphabet_t symbol1{};
+        alphabet_t symbol2{};
+
+        max_column_gain = 0;
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            seqan3::assign_rank_to(static_cast<alphabet_rank_t<alphabet_t>>(rank1), symbol1);
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                seqan3::assign_rank_to(static_cast<alphabet_rank_t<alphabet_t>>(rank2), symbol2);
+                max_column_gain = std::max<int64_t>(max_column_gain, scoring_scheme.score(symbol1, symbol2));
+            }
+        }
+    }
+
     /*!\brief Tracks any cell within the alignment matrix.
      *
      * \tparam cell_t The cell type of the alignment matrix; must have a member function `best_score()`.
@@ -260,6 +316,9 @@ protected:
         if (test_every_cell)
             invoke_comparator(cell, std::move(coordinate));
 
+        if constexpr (traits_type::has_min_score)
+            column_optimum = (column_optimum < cell.best_score()) ? cell.best_score() : column_optimum;
+
         return std::forward<cell_t>(cell);
     }
 
@@ -331,6 +390,29 @@ protected:
     {
         optimal_score = std::numeric_limits<score_type>::lowest();
         optimal_coordinate = {};
+        column_optimum = std::numeric_limits<score_type>::lowest();
+    }
+
+    /*!\brief Checks whether the alignment can no longer reach the configured seqan3::align_cfg::min_score.
+     * \param[in] remaining_columns The number of columns that still need to be computed.
+     * \returns `true` if the optimal score will be less than the minimal score, `false` otherwise.
+     *
+     * \details
+     *
+     * Every path through the remaining columns starts in a cell of the last computed column and can gain at most the
+     * maximal score of the scoring scheme per column. If neither the tracked optimum nor this upper bound reaches the
+     * minimal score, the remaining columns do not need to be computed. The column optimum is reset for the next
+     * column.
+     */
+    bool is_min_score_unreachable(size_t const remaining_columns) noexcept
+    {
+        score_type const best_column_score = std::exchange(column_optimum, std::numeric_limits<score_type>::lowest());
+
+        if (max_column_gain < 0)
+            return false;
+
+        int64_t const column_bound = best_column_score + max_column_gain * static_cast<int64_t>(remaining_columns);
+        return std::max<int64_t>(optimal_score, column_bound) < min_score;
     }
 
     /*!\brief Handles the invocation of the optimum comparator and updater.
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <seqan3/std/ranges>
+#include <utility>
 
 #include <seqan3/alignment/pairwise/detail/policy_optimum_tracker.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -80,6 +82,49 @@ struct max_score_updater_simd_global
     }
 };
 
+/*!\brief Function object that compares and updates the alignment optimum for the vectorised extension alignment.
+ * \ingroup pairwise_alignment
+ *
+ * \details
+ *
+ * This is the vectorised counterpart of seqan3::detail::max_score_updater. Every lane of the vector unit stores the
+ * optimum of its own alignment matrix. The score and the coordinate of a lane are updated if the score of the current
+ * cell is greater than or equal to the optimal score of this lane. Cells that do not belong to the matrix of a lane
+ * must be set to a score below the optimum before they are tracked.
+ */
+struct max_score_updater_simd_extension
+{
+    /*!\brief Compares and updates the optimal score-coordinate pair of every lane.
+     * \tparam score_t The type of the score to track; must model std::assignable_from `const & score_t`.
+     * \tparam coordinate_t The type of the coordinate to track; must be a seqan3::matrix_index type with members that
+     *                      model seqan3::simd::simd_concept.
+     *
+     * \param[in,out] optimal_score The optimal score to update.
+     * \param[in,out] optimal_coordinate The optimal coordinate to update.
+     * \param[in] current_score The score of the current cell.
+     * \param[in] current_coordinate The coordinate of the current cell.
+     */
+    template <typename score_t, typename coordinate_t>
+    //!\cond
+        requires (std::assignable_from<score_t &, score_t const &> &&
+                  requires (coordinate_t coordinate)
+                  {
+                      requires simd_concept<decltype(coordinate.col)>;
+                      requires simd_concept<decltype(coordinate.row)>;
+                  })
+    //!\endcond
+    void operator()(score_t & optimal_score,
+                    coordinate_t & optimal_coordinate,
+                    score_t current_score,
+                    coordinate_t const & current_coordinate) const noexcept
+    {
+        auto mask = current_score >= optimal_score;
+        optimal_score = (mask) ? std::move(current_score) : optimal_score;
+        optimal_coordinate.row = (mask) ? current_coordinate.row : optimal_coordinate.row;
+        optimal_coordinate.col = (mask) ? current_coordinate.col : optimal_coordinate.col;
+    }
+};
+
 /*!\brief Implements the tracker to store the global optimum for a particular alignment computation.
  * \ingroup pairwise_alignment
  * \copydetails seqan3::detail::policy_optimum_tracker
@@ -115,8 +160,13 @@ protected:
     using base_policy_t::compare_and_set_optimum;
     using base_policy_t::optimal_score;
     using base_policy_t::optimal_coordinate;
+    using base_policy_t::column_optimum;
     //!\brief The individual offsets used for padding the sequences.
     std::array<original_score_type, simd_traits<score_type>::length> padding_offsets{};
+    //!\brief The score added for every aligned padding symbol.
+    original_score_type padding_score{};
+    //!\brief The number of alignments computed in the current batch.
+    size_t sequence_count{};
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -147,6 +197,42 @@ protected:
     void reset_optimum()
     {
         optimal_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+        column_optimum = optimal_score;
+    }
+
+    /*!\brief Checks whether none of the alignments can reach the configured seqan3::align_cfg::min_score anymore.
+     * \param[in] remaining_columns The number of columns that still need to be computed.
+     * \returns `true` if the optimal score of every alignment in the batch will be less than the minimal score,
+     *          `false` otherwise.
+     *
+     * \details
+     *
+     * Applies the bound of seqan3::detail::policy_optimum_tracker::is_min_score_unreachable to every alignment of the
+     * batch. Within the padded part of the matrix a column can additionally gain the padding score, which is
+     * subtracted again with the respective padding offset. The batch can only be stopped if all of its alignments
+     * are rejected.
+     */
+    bool is_min_score_unreachable(size_t const remaining_columns) noexcept
+    {
+        score_type const best_column_score = std::exchange(column_optimum,
+                                                           simd::fill<score_type>(
+                                                               std::numeric_limits<scalar_type>::lowest()));
+
+        if (base_policy_t::max_column_gain < 0)
+            return false;
+
+        int64_t const column_gain = std::max<int64_t>(base_policy_t::max_column_gain, padding_score) *
+                                    static_cast<int64_t>(remaining_columns);
+
+        for (size_t index = 0; index < sequence_count; ++index)
+        {
+            int64_t const upper_bound = std::max<int64_t>(optimal_score[index], best_column_score[index] + column_gain);
+
+            if (upper_bound - padding_offsets[index] * static_cast<int64_t>(padding_score) >= base_policy_t::min_score)
+                return false;
+        }
+
+        return true;
     }
 
     /*!\brief Initialises the tracker and possibly the binary update operation.
@@ -155,6 +241,7 @@ protected:
      *
      * \param[in] sequence1_collection The collection over sequences used for the initialisation of the tracker.
      * \param[in] sequence2_collection The collection over sequences used for the initialisation of the tracker.
+     * \param[in] padding_match_score The score of the simd scoring scheme for an aligned padding symbol.
      *
      * \details
      *
@@ -194,10 +281,14 @@ protected:
      * In the global alignment it is suffcient to only track the optimal score in the last row and column of the
      * encompassing matrix and only at the precomputed coordinate projections. Eventually, the score offset is
      * subtracted to obtain the original score.
+     *
+     * The padding score is stored to remove the offset from the bound used by
+     * seqan3::detail::policy_optimum_tracker_simd::is_min_score_unreachable.
      */
     template <std::ranges::input_range sequence1_collection_t, std::ranges::input_range sequence2_collection_t>
     void initialise_tracker(sequence1_collection_t & sequence1_collection,
-                            sequence2_collection_t & sequence2_collection)
+                            sequence2_collection_t & sequence2_collection,
+                            original_score_type const padding_match_score)
     {
         using index_t = typename traits_type::matrix_index_type;
         using scalar_index_t = typename simd_traits<index_t>::scalar_type;
@@ -207,8 +298,10 @@ protected:
         alignas(alignof(index_t)) std::array<scalar_index_t, traits_type::alignments_per_vector> sequence1_sizes{};
         alignas(alignof(index_t)) std::array<scalar_index_t, traits_type::alignments_per_vector> sequence2_sizes{};
 
+        padding_score = padding_match_score;
+        sequence_count = 0;
+
         // First, get all dimensions from the sequences and keep track of the maximal size in either dimension.
-        size_t sequence_count{};
         for (auto && [sequence1, sequence2] : views::zip(sequence1_collection, sequence2_collection))
         {
             sequence1_sizes[sequence_count] = std::ranges::distance(sequence1);
@@ -19,6 +19,7 @@
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
@@ -126,6 +127,10 @@ public:
         configuration_t::template exists<seqan3::align_cfg::method_global>();
     //!\brief Flag indicating whether local alignment mode is enabled.
     static constexpr bool is_local = configuration_t::template exists<seqan3::align_cfg::method_local>();
+    //!\brief Flag indicating whether extension alignment mode is enabled.
+    static constexpr bool is_extension = configuration_t::template exists<seqan3::align_cfg::method_extension>();
+    //!\brief Flag indicating whether a minimal score was configured.
+    static constexpr bool has_min_score = configuration_t::template exists<align_cfg::min_score>();
     //!\brief Flag indicating whether banded alignment mode is enabled.
     static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
     //!\brief Flag indicating whether debug mode is enabled.
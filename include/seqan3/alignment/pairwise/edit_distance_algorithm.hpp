@@ -17,6 +17,7 @@
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
 
 namespace seqan3::detail
 {
@@ -46,6 +47,17 @@ private:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    /*!\brief Whether the sequence pairs are computed with seqan3::detail::edit_distance_unbanded_simd.
+     *
+     * \details
+     *
+     * The vectorised edit distance is used if seqan3::align_cfg::vectorised is configured and neither the begin
+     * positions nor the alignment are requested, since these require the trace matrix of the scalar algorithm.
+     */
+    static constexpr bool use_vectorised_algorithm = configuration_traits_type::is_vectorised &&
+                                                     !configuration_traits_type::compute_begin_positions &&
+                                                     !configuration_traits_type::compute_sequence_alignment;
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -87,7 +99,8 @@ public:
      * \details
      *
      * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
-     * alignment result.
+     * alignment result. If seqan3::align_cfg::vectorised is configured and only the score and the end positions are
+     * requested, several sequence pairs are computed at once (see seqan3::detail::edit_distance_unbanded_simd).
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
     //!\cond
@@ -97,11 +110,19 @@ public:
     {
         using std::get;
 
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            compute_single_pair(index,
-                                get<0>(sequence_pair),
-                                get<1>(sequence_pair),
-                                std::forward<callback_t>(callback));
+        if constexpr (use_vectorised_algorithm)
+        {
+            edit_distance_unbanded_simd<std::remove_cvref_t<config_t>, traits_t> algorithm{*cfg_ptr};
+            algorithm(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs), callback);
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                compute_single_pair(index,
+                                    get<0>(sequence_pair),
+                                    get<1>(sequence_pair),
+                                    std::forward<callback_t>(callback));
+        }
     }
 private:
 
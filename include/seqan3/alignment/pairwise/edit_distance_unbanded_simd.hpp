@@ -0,0 +1,427 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a vectorised edit distance algorithm that computes several sequence pairs at once.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/matrix_concept.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the edit distance of several sequence pairs simultaneously with the bit-vector algorithm of Myers.
+ * \ingroup pairwise_alignment
+ * \implements std::invocable
+ * \tparam config_t The configuration type; must be a specialisation of seqan3::configuration.
+ * \tparam traits_t The traits type; must provide the member type `is_semi_global_type`.
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::edit_distance_unbanded, which computes the recurrence of a single sequence pair in
+ * scalar machine words, this algorithm vectorises over the sequence pairs (inter-sequence vectorisation): every lane
+ * of a seqan3::simd::simd_type over `uint64_t` holds the bit-vectors of one sequence pair. Thus, depending on the
+ * available instruction set, 2 (SSE4), 4 (AVX2) or 8 (AVX-512) sequence pairs are computed with the same
+ * instructions.
+ *
+ * Before the computation, the batch of sequences is transformed into a structure-of-arrays layout: the pattern bit
+ * masks of every query are stored per lane, and the ranks of the database sequences are stored column-wise.
+ * Queries longer than one machine word are split into blocks whose carries are propagated within each lane
+ * independently. Sequence pairs of different lengths are computed up to the longest database sequence and
+ * the score of every lane is only updated as long as its database sequence did not end.
+ *
+ * Only the score and the end positions are computed. If the begin positions or the alignment are requested, the
+ * scalar algorithm must be used instead since this algorithm does not store a trace matrix. If
+ * seqan3::align_cfg::min_score is configured, the complete matrix is computed and the threshold is only applied to
+ * the final score, i.e. the Ukkonen trick is not used in the vectorised computation.
+ */
+template <typename config_t, typename traits_t>
+//!\cond
+    requires is_type_specialisation_of_v<config_t, configuration>
+//!\endcond
+class edit_distance_unbanded_simd
+{
+private:
+    //!\brief The configuration traits for the selected alignment algorithm.
+    using configuration_traits_type = alignment_configuration_traits<config_t>;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename configuration_traits_type::alignment_result_type;
+    //!\brief The alignment result value type.
+    using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+    //!\brief The configured score type.
+    using score_type = typename configuration_traits_type::original_score_type;
+    //!\brief The scalar machine word type of a single lane.
+    using scalar_word_type = uint64_t;
+    //!\brief The simd vector over the machine words of all lanes.
+    using word_type = simd::simd_type_t<scalar_word_type>;
+    //!\brief The simd vector over the scores of all lanes.
+    using score_vector_type = simd::simd_type_t<int64_t>;
+    //!\brief The type of the allocator used for the simd vectors.
+    using word_allocator_type = aligned_allocator<word_type, alignof(word_type)>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!configuration_traits_type::compute_begin_positions &&
+                  !configuration_traits_type::compute_sequence_alignment,
+                  "The vectorised edit distance only computes the score and the end positions.");
+
+    //!\brief The number of sequence pairs computed simultaneously.
+    static constexpr size_t lane_count = simd_traits<word_type>::length;
+    //!\brief The number of bits in one machine word.
+    static constexpr size_t word_size = bits_of<scalar_word_type>;
+    //!\brief Whether the alignment is a semi-global alignment or not.
+    static constexpr bool is_semi_global = traits_t::is_semi_global_type::value;
+    //!\brief Whether the alignment is a global alignment or not.
+    static constexpr bool is_global = !is_semi_global;
+    //!\brief Whether the score is bounded by seqan3::align_cfg::min_score.
+    static constexpr bool use_max_errors = config_t::template exists<align_cfg::min_score>();
+
+    //!\brief The maximal number of errors if seqan3::align_cfg::min_score is configured.
+    score_type max_errors{std::numeric_limits<score_type>::max()};
+
+    /*!\name Batch state
+     * \brief The state of the sequence pairs that are currently collected for the next computation.
+     * \{
+     */
+    //!\brief The number of collected sequence pairs.
+    size_t batch_size{};
+    //!\brief The alphabet size of the query sequences.
+    size_t rank_count{};
+    //!\brief The index of every collected sequence pair.
+    std::array<size_t, lane_count> sequence_pair_indices{};
+    //!\brief The size of the database (first) sequence of every collected sequence pair.
+    std::array<size_t, lane_count> database_sizes{};
+    //!\brief The size of the query (second) sequence of every collected sequence pair.
+    std::array<size_t, lane_count> query_sizes{};
+    //!\brief The ranks of the database sequences stored column-wise with lane_count entries per column.
+    std::vector<size_t> database_ranks{};
+    //!\brief The match masks of the queries, stored per lane, per rank and per block.
+    std::vector<scalar_word_type> bit_masks{};
+    //!\brief The queries of the collected sequence pairs as ranks.
+    std::array<std::vector<size_t>, lane_count> query_ranks{};
+    //!\}
+
+    /*!\name Compute state
+     * \{
+     */
+    //!\brief The positive vertical differences of every block.
+    std::vector<word_type, word_allocator_type> vp{};
+    //!\brief The negative vertical differences of every block.
+    std::vector<word_type, word_allocator_type> vn{};
+    //!\brief For every block a mask with the bit of the last row set in all lanes whose last row is in this block.
+    std::vector<word_type, word_allocator_type> score_masks{};
+    //!\}
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = default; //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default; //!< Defaulted.
+    ~edit_distance_unbanded_simd() = default; //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the given configuration.
+     * \param[in] config The alignment configuration.
+     */
+    explicit edit_distance_unbanded_simd(config_t const & config)
+    {
+        if constexpr (use_max_errors)
+            max_errors = -get<align_cfg::min_score>(config).score;
+    }
+    //!\}
+
+    /*!\brief Computes the edit distance for every indexed sequence pair contained in the given range.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable accepting one argument of type seqan3::alignment_result.
+     *
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     *
+     * \details
+     *
+     * The sequence pairs are collected in batches of the simd length and every batch is computed at once. The
+     * callback is invoked for the results in the order of the sequence pairs.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        batch_size = 0;
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            add_sequence_pair(get<0>(sequence_pair), get<1>(sequence_pair), idx);
+
+            if (batch_size == lane_count)
+                compute_batch(callback);
+        }
+
+        if (batch_size > 0)
+            compute_batch(callback);
+    }
+
+private:
+    /*!\brief Adds a sequence pair to the current batch.
+     * \tparam database_t The type of the database sequence; must model std::ranges::forward_range.
+     * \tparam query_t The type of the query sequence; must model std::ranges::forward_range.
+     * \param[in] database The database (first) sequence.
+     * \param[in] query The query (second) sequence.
+     * \param[in] idx The index of the sequence pair.
+     *
+     * \details
+     *
+     * As in seqan3::detail::edit_distance_unbanded, the database sequence is converted into the alphabet of the
+     * query sequence.
+     */
+    template <std::ranges::forward_range database_t, std::ranges::forward_range query_t>
+    void add_sequence_pair(database_t && database, query_t && query, size_t const idx)
+    {
+        using query_alphabet_type = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+
+        size_t const lane = batch_size++;
+        sequence_pair_indices[lane] = idx;
+        rank_count = alphabet_size<query_alphabet_type>;
+
+        query_ranks[lane].clear();
+        for (auto && symbol : query)
+            query_ranks[lane].push_back(seqan3::to_rank(symbol));
+        query_sizes[lane] = query_ranks[lane].size();
+
+        size_t column = 0;
+        for (auto && symbol : database)
+        {
+            if (database_ranks.size() < (column + 1) * lane_count)
+                database_ranks.resize((column + 1) * lane_count, 0u);
+
+            database_ranks[column * lane_count + lane] = seqan3::to_rank((query_alphabet_type) symbol);
+            ++column;
+        }
+        database_sizes[lane] = column;
+    }
+
+    /*!\brief Computes the current batch and invokes the callback for every result.
+     * \tparam callback_t The type of the callback.
+     * \param[in] callback The callback to invoke with the alignment results.
+     */
+    template <typename callback_t>
+    void compute_batch(callback_t & callback)
+    {
+        // Lanes that are not used by the batch are computed as empty sequence pairs.
+        for (size_t lane = batch_size; lane < lane_count; ++lane)
+        {
+            query_ranks[lane].clear();
+            query_sizes[lane] = 0;
+            database_sizes[lane] = 0;
+        }
+
+        size_t const max_query_size = *std::ranges::max_element(query_sizes);
+        size_t const max_database_size = *std::ranges::max_element(database_sizes);
+        size_t const block_count = (max_query_size + word_size - 1) / word_size;
+
+        initialise_bit_masks(block_count);
+
+        std::array<score_type, lane_count> scores{};
+        std::array<size_t, lane_count> end_columns{};
+        compute_columns(block_count, max_database_size, scores, end_columns);
+
+        for (size_t lane = 0; lane < batch_size; ++lane)
+            invoke_result(lane, scores[lane], end_columns[lane], callback);
+
+        batch_size = 0;
+    }
+
+    /*!\brief Initialises the pattern bit masks, the vertical differences and the score masks of all lanes.
+     * \param[in] block_count The number of blocks of the longest query.
+     */
+    void initialise_bit_masks(size_t const block_count)
+    {
+        bit_masks.assign(lane_count * rank_count * block_count, 0u);
+        vp.assign(block_count, simd::fill<word_type>(~scalar_word_type{0u}));
+        vn.assign(block_count, simd::fill<word_type>(0u));
+        score_masks.assign(block_count, simd::fill<word_type>(0u));
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+        {
+            size_t const lane_offset = lane * rank_count * block_count;
+            for (size_t row = 0; row < query_sizes[lane]; ++row)
+            {
+                size_t const i = lane_offset + query_ranks[lane][row] * block_count + row / word_size;
+                bit_masks[i] |= scalar_word_type{1u} << (row % word_size);
+            }
+
+            if (query_sizes[lane] > 0)
+            {
+                size_t const last_row = query_sizes[lane] - 1;
+                score_masks[last_row / word_size][lane] = scalar_word_type{1u} << (last_row % word_size);
+            }
+        }
+    }
+
+    /*!\brief Computes all columns of the current batch.
+     * \param[in] block_count The number of blocks of the longest query.
+     * \param[in] max_database_size The size of the longest database sequence.
+     * \param[out] scores The edit distance of every lane.
+     * \param[out] end_columns The column of the best score of every lane.
+     */
+    void compute_columns(size_t const block_count,
+                         size_t const max_database_size,
+                         std::array<score_type, lane_count> & scores,
+                         std::array<size_t, lane_count> & end_columns)
+    {
+        // The global alignment increases the score of the first row by one in every column.
+        static constexpr scalar_word_type hp0 = is_global ? 1u : 0u;
+
+        alignas(alignof(score_vector_type)) std::array<int64_t, lane_count> buffer{};
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            buffer[lane] = query_sizes[lane];
+        score_vector_type score = simd::load<score_vector_type>(buffer.data());
+        score_vector_type best_score = score;
+        score_vector_type best_column = simd::fill<score_vector_type>(0);
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+            buffer[lane] = database_sizes[lane];
+        score_vector_type const database_size = simd::load<score_vector_type>(buffer.data());
+
+        std::array<size_t, lane_count> rank_offsets{};
+        alignas(alignof(word_type)) std::array<scalar_word_type, lane_count> match_buffer{};
+
+        for (size_t column = 0; block_count > 0 && column < max_database_size; ++column)
+        {
+            for (size_t lane = 0; lane < lane_count; ++lane)
+            {
+                size_t const rank = (column < database_sizes[lane]) ? database_ranks[column * lane_count + lane] : 0u;
+                rank_offsets[lane] = (lane * rank_count + rank) * block_count;
+            }
+
+            word_type carry_d0 = simd::fill<word_type>(0u);
+            word_type carry_hp = simd::fill<word_type>(hp0);
+            word_type carry_hn = simd::fill<word_type>(0u);
+            score_vector_type delta = simd::fill<score_vector_type>(0);
+
+            // Compute each block in the current column; carries between blocks are propagated per lane.
+            for (size_t block = 0; block < block_count; ++block)
+            {
+                for (size_t lane = 0; lane < lane_count; ++lane)
+                    match_buffer[lane] = bit_masks[rank_offsets[lane] + block];
+
+                word_type const b = simd::load<word_type>(match_buffer.data());
+                word_type const zero = simd::fill<word_type>(0u);
+
+                word_type x = b | vn[block];
+                word_type const t = vp[block] + (x & vp[block]) + carry_d0;
+                word_type const d0 = (t ^ vp[block]) | x;
+                word_type const hn = vp[block] & d0;
+                word_type const hp = vn[block] | ~(vp[block] | d0);
+
+                // Overflow of the addition, i.e. the carry into the next block.
+                carry_d0 = reinterpret_cast<word_type>((carry_d0 != zero) ? (t <= vp[block]) : (t < vp[block])) &
+                           simd::fill<word_type>(1u);
+
+                x = (hp << 1u) | carry_hp;
+                vn[block] = x & d0;
+                vp[block] = (hn << 1u) | ~(x | d0) | carry_hn;
+
+                carry_hp = hp >> (word_size - 1u);
+                carry_hn = hn >> (word_size - 1u);
+
+                // Comparisons return -1 for true, hence the score difference is subtracted.
+                delta -= reinterpret_cast<score_vector_type>((hp & score_masks[block]) != zero);
+                delta += reinterpret_cast<score_vector_type>((hn & score_masks[block]) != zero);
+            }
+
+            score_vector_type const current_column = simd::fill<score_vector_type>(column + 1);
+            auto const is_active = current_column <= database_size;
+            score = is_active ? score + delta : score;
+
+            if constexpr (is_semi_global)
+            {
+                auto const is_better = is_active && (score <= best_score);
+                best_score = is_better ? score : best_score;
+                best_column = is_better ? current_column : best_column;
+            }
+        }
+
+        for (size_t lane = 0; lane < lane_count; ++lane)
+        {
+            if constexpr (is_global)
+            {
+                // The score of an empty query is not tracked by the bit-vectors.
+                scores[lane] = (query_sizes[lane] == 0) ? database_sizes[lane] : score[lane];
+                end_columns[lane] = database_sizes[lane];
+            }
+            else
+            {
+                bool const is_empty = query_sizes[lane] == 0;
+                scores[lane] = best_score[lane];
+                end_columns[lane] = is_empty ? database_sizes[lane] : best_column[lane];
+            }
+        }
+    }
+
+    /*!\brief Builds the alignment result of a single lane and invokes the callback.
+     * \tparam callback_t The type of the callback.
+     * \param[in] lane The lane of the sequence pair.
+     * \param[in] edit_distance The computed edit distance.
+     * \param[in] end_column The column in which the best score was found.
+     * \param[in] callback The callback to invoke with the alignment result.
+     */
+    template <typename callback_t>
+    void invoke_result(size_t const lane,
+                       score_type const edit_distance,
+                       size_t const end_column,
+                       callback_t & callback) const
+    {
+        bool const is_valid = !use_max_errors || edit_distance <= max_errors;
+
+        result_value_type res_vt{};
+
+        if constexpr (configuration_traits_type::output_sequence1_id)
+            res_vt.sequence1_id = sequence_pair_indices[lane];
+
+        if constexpr (configuration_traits_type::output_sequence2_id)
+            res_vt.sequence2_id = sequence_pair_indices[lane];
+
+        if constexpr (configuration_traits_type::compute_score)
+            res_vt.score = is_valid ? -edit_distance : matrix_inf<score_type>;
+
+        if constexpr (configuration_traits_type::compute_end_positions)
+        {
+            size_t const end_column_or_invalid = is_valid ? end_column : database_sizes[lane];
+            res_vt.end_positions = alignment_coordinate{column_index_type{end_column_or_invalid},
+                                                        row_index_type{query_sizes[lane]}};
+        }
+
+        callback(alignment_result_type{std::move(res_vt)});
+    }
+};
+
+} // namespace seqan3::detail
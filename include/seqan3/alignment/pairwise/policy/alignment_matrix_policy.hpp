@@ -39,6 +39,12 @@ namespace seqan3::detail
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
  * algorithm.
  *
+ * The matrices are members of the alignment algorithm and are only resized on every invocation. Thus, the memory
+ * allocated by a previous alignment computed with the same algorithm instance is reused and only grows if a larger
+ * matrix is requested. The memory is released together with the algorithm, e.g. when the range returned by
+ * seqan3::align_pairwise is destroyed or, in a parallel execution, when a task has finished its chunk of sequence
+ * pairs.
+ *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
  *          configuration.
@@ -81,8 +87,8 @@ private:
     template <typename sequence1_t, typename sequence2_t>
     constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        score_matrix.resize(sequence1, sequence2);
+        trace_matrix.resize(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -117,8 +123,8 @@ private:
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
         score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        score_matrix.resize(sequence1, sequence2, band, inf);
+        trace_matrix.resize(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
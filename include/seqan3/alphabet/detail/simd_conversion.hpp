@@ -0,0 +1,612 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\cond DEV
+ * \file
+ * \brief Provides SIMD kernels that convert contiguous ranges of small alphabets from and to characters.
+ * \endcond
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+
+namespace seqan3::detail
+{
+
+// ============================================================================
+// byte kernels
+// ============================================================================
+
+/*!\brief The number of bytes that the SIMD conversion kernels process at once; 0 if no kernel is available.
+ * \ingroup alphabet
+ */
+#if defined(__AVX2__)
+inline constexpr size_t simd_conversion_block_size = 32;
+#elif defined(__SSSE3__)
+inline constexpr size_t simd_conversion_block_size = 16;
+#else
+inline constexpr size_t simd_conversion_block_size = 0;
+#endif
+
+/*!\brief Replaces every byte by the table entry it indexes.
+ * \ingroup alphabet
+ * \param[in]  in    The bytes to convert; every byte must be smaller than 16.
+ * \param[in]  count The number of bytes.
+ * \param[out] out   The converted bytes; may be the same as `in`.
+ * \param[in]  table The table.
+ * \returns The number of converted bytes, a multiple of seqan3::detail::simd_conversion_block_size.
+ */
+inline size_t simd_lookup16(uint8_t const * in,
+                            size_t const count,
+                            uint8_t * out,
+                            std::array<uint8_t, 16> const & table) noexcept
+{
+    size_t i = 0;
+
+#if defined(__SSSE3__)
+    __m128i const table128 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+#endif
+#if defined(__AVX2__)
+    __m256i const table256 = _mm256_broadcastsi128_si256(table128);
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i const values = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_shuffle_epi8(table256, values));
+    }
+#elif defined(__SSSE3__)
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const values = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_shuffle_epi8(table128, values));
+    }
+#else
+    (void) in;
+    (void) count;
+    (void) out;
+    (void) table;
+#endif
+
+    return i;
+}
+
+/*!\brief Reverses bytes and replaces every byte by the table entry it indexes, i.e. `out[i] = table[in[count - 1 - i]]`.
+ * \ingroup alphabet
+ * \param[in]  in    The bytes to convert; every byte must be smaller than 16.
+ * \param[in]  count The number of bytes.
+ * \param[out] out   The converted bytes; may be the same as `in`, but must not overlap it otherwise.
+ * \param[in]  table The table.
+ * \returns The number of bytes that were converted at either end, a multiple of
+ *          seqan3::detail::simd_conversion_block_size; the bytes in between are left to the caller.
+ *
+ * \details
+ *
+ * One block from the front and one block from the back are loaded before either is stored, so the range can be
+ * reversed in place in a single pass.
+ */
+inline size_t simd_reverse_lookup16(uint8_t const * in,
+                                    size_t const count,
+                                    uint8_t * out,
+                                    std::array<uint8_t, 16> const & table) noexcept
+{
+    size_t i = 0;
+
+#if defined(__SSSE3__)
+    __m128i const table128 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+    __m128i const reverse128 = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+#endif
+#if defined(__AVX2__)
+    __m256i const table256 = _mm256_broadcastsi128_si256(table128);
+    __m256i const reverse256 = _mm256_broadcastsi128_si256(reverse128);
+
+    // the shuffle reverses the bytes of each lane, the permutation swaps the lanes
+    auto convert = [&] (__m256i const values)
+    {
+        __m256i const reversed = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(values, reverse256), 0x4e);
+        return _mm256_shuffle_epi8(table256, reversed);
+    };
+
+    for (; 2 * (i + 32) <= count; i += 32)
+    {
+        __m256i const front = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+        __m256i const back = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + count - i - 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), convert(back));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + count - i - 32), convert(front));
+    }
+#elif defined(__SSSE3__)
+    auto convert = [&] (__m128i const values)
+    {
+        return _mm_shuffle_epi8(table128, _mm_shuffle_epi8(values, reverse128));
+    };
+
+    for (; 2 * (i + 16) <= count; i += 16)
+    {
+        __m128i const front = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+        __m128i const back = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + count - i - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), convert(back));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + count - i - 16), convert(front));
+    }
+#else
+    (void) in;
+    (void) count;
+    (void) out;
+    (void) table;
+#endif
+
+    return i;
+}
+
+/*!\brief Converts letters with a table that is indexed by the lower five bits of the character.
+ * \ingroup alphabet
+ * \param[in]  in    The characters to convert.
+ * \param[in]  count The number of characters.
+ * \param[out] out   The converted characters.
+ * \param[in]  table The value of every character between `@` (64) and DEL (127) by its lower five bits; 255 marks
+ *                   characters that cannot be converted.
+ * \returns The number of converted characters, a multiple of seqan3::detail::simd_conversion_block_size.
+ *
+ * \details
+ *
+ * The conversion stops before the first block that contains a character below 64 or above 127, e.g. whitespace,
+ * or a character that is marked in the table.
+ */
+inline size_t simd_lookup_letters(char const * in,
+                                  size_t const count,
+                                  uint8_t * out,
+                                  std::array<uint8_t, 32> const & table) noexcept
+{
+    size_t i = 0;
+
+#if defined(__SSSE3__)
+    __m128i const low128 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+    __m128i const high128 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data() + 16));
+#endif
+#if defined(__AVX2__)
+    __m256i const low = _mm256_broadcastsi128_si256(low128);
+    __m256i const high = _mm256_broadcastsi128_si256(high128);
+    __m256i const letter_bits = _mm256_set1_epi8(static_cast<char>(0xc0));
+    __m256i const letter_prefix = _mm256_set1_epi8(0x40);
+    __m256i const high_bit = _mm256_set1_epi8(0x10);
+    __m256i const invalid = _mm256_set1_epi8(static_cast<char>(0xff));
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i const chars = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+        // letters have no sign bit, so the shuffle uses their lower four bits
+        __m256i const is_high = _mm256_cmpeq_epi8(_mm256_and_si256(chars, high_bit), high_bit);
+        __m256i const values = _mm256_blendv_epi8(_mm256_shuffle_epi8(low, chars),
+                                                  _mm256_shuffle_epi8(high, chars),
+                                                  is_high);
+        __m256i const is_letter = _mm256_cmpeq_epi8(_mm256_and_si256(chars, letter_bits), letter_prefix);
+        __m256i const is_invalid = _mm256_cmpeq_epi8(values, invalid);
+
+        if (_mm256_movemask_epi8(_mm256_andnot_si256(is_invalid, is_letter)) != -1)
+            break;
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), values);
+    }
+#elif defined(__SSSE3__)
+    __m128i const letter_bits = _mm_set1_epi8(static_cast<char>(0xc0));
+    __m128i const letter_prefix = _mm_set1_epi8(0x40);
+    __m128i const high_bit = _mm_set1_epi8(0x10);
+    __m128i const invalid = _mm_set1_epi8(static_cast<char>(0xff));
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const chars = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+        // letters have no sign bit, so the shuffle uses their lower four bits
+        __m128i const is_high = _mm_cmpeq_epi8(_mm_and_si128(chars, high_bit), high_bit);
+        __m128i const values = _mm_or_si128(_mm_and_si128(is_high, _mm_shuffle_epi8(high128, chars)),
+                                            _mm_andnot_si128(is_high, _mm_shuffle_epi8(low128, chars)));
+        __m128i const is_letter = _mm_cmpeq_epi8(_mm_and_si128(chars, letter_bits), letter_prefix);
+        __m128i const is_invalid = _mm_cmpeq_epi8(values, invalid);
+
+        if (_mm_movemask_epi8(_mm_andnot_si128(is_invalid, is_letter)) != 0xffff)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), values);
+    }
+#else
+    (void) in;
+    (void) count;
+    (void) out;
+    (void) table;
+#endif
+
+    return i;
+}
+
+/*!\brief Converts characters to `min(max(c - offset, 0), max_value)`, e.g. Phred qualities to their ranks.
+ * \ingroup alphabet
+ * \param[in]  in        The characters to convert.
+ * \param[in]  count     The number of characters.
+ * \param[out] out       The converted characters.
+ * \param[in]  offset    The character of the value 0.
+ * \param[in]  max_value The largest value.
+ * \returns The number of converted characters, a multiple of seqan3::detail::simd_conversion_block_size.
+ * \details The conversion stops before the first block that contains a character above 127.
+ */
+inline size_t simd_subtract_offset(char const * in,
+                                   size_t const count,
+                                   uint8_t * out,
+                                   uint8_t const offset,
+                                   uint8_t const max_value) noexcept
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i const offsets = _mm256_set1_epi8(static_cast<char>(offset));
+    __m256i const max_values = _mm256_set1_epi8(static_cast<char>(max_value));
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i const chars = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+
+        if (_mm256_movemask_epi8(chars) != 0)
+            break;
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i),
+                            _mm256_min_epu8(_mm256_subs_epu8(chars, offsets), max_values));
+    }
+#elif defined(__SSSE3__)
+    __m128i const offsets = _mm_set1_epi8(static_cast<char>(offset));
+    __m128i const max_values = _mm_set1_epi8(static_cast<char>(max_value));
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const chars = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+
+        if (_mm_movemask_epi8(chars) != 0)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_min_epu8(_mm_subs_epu8(chars, offsets), max_values));
+    }
+#else
+    (void) in;
+    (void) count;
+    (void) out;
+    (void) offset;
+    (void) max_value;
+#endif
+
+    return i;
+}
+
+/*!\brief Adds an offset to every byte, e.g. to convert the ranks of Phred qualities to characters.
+ * \ingroup alphabet
+ * \param[in]  in     The bytes to convert.
+ * \param[in]  count  The number of bytes.
+ * \param[out] out    The converted bytes.
+ * \param[in]  offset The offset.
+ * \returns The number of converted bytes, a multiple of seqan3::detail::simd_conversion_block_size.
+ */
+inline size_t simd_add_offset(uint8_t const * in, size_t const count, char * out, uint8_t const offset) noexcept
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i const offsets = _mm256_set1_epi8(static_cast<char>(offset));
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i const values = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_add_epi8(values, offsets));
+    }
+#elif defined(__SSSE3__)
+    __m128i const offsets = _mm_set1_epi8(static_cast<char>(offset));
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i const values = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_add_epi8(values, offsets));
+    }
+#else
+    (void) in;
+    (void) count;
+    (void) out;
+    (void) offset;
+#endif
+
+    return i;
+}
+
+// ============================================================================
+// alphabet_simd_conversion
+// ============================================================================
+
+/*!\brief The tables of the SIMD conversion kernels for an alphabet and whether they are applicable.
+ * \ingroup alphabet
+ * \tparam alphabet_t The alphabet.
+ *
+ * \details
+ *
+ * The kernels work on the bytes of contiguous ranges, so they are only used for alphabets whose objects are a single
+ * byte that holds the rank, e.g. the nucleotide alphabets and the Phred qualities. Whether the conversion of an
+ * alphabet can be expressed by a kernel is checked once against seqan3::assign_char_to, seqan3::to_char and
+ * seqan3::complement, so the kernels give exactly the same results as the element-wise conversion.
+ */
+template <typename alphabet_t>
+struct alphabet_simd_conversion
+{
+    //!\brief Whether the alphabet is small enough to be considered at all.
+    static constexpr bool is_byte_alphabet = [] () constexpr
+    {
+        if constexpr (simd_conversion_block_size > 0 && alphabet<alphabet_t>)
+            return sizeof(alphabet_t) == 1 && std::is_trivially_copyable_v<alphabet_t> &&
+                   std::same_as<alphabet_char_t<alphabet_t>, char>;
+        else
+            return false;
+    }();
+
+    //!\brief Whether the only byte of an object is its rank; no kernel is used otherwise.
+    bool rank_is_byte{false};
+
+    //!\brief The rank of every letter by the lower five bits of its character (see seqan3::detail::simd_lookup_letters).
+    std::array<uint8_t, 32> letter_ranks{};
+    //!\brief Whether the letters `@` to DEL can be converted with #letter_ranks, i.e. upper and lower case are the same.
+    bool letter_ranks_are_valid{false};
+
+    //!\brief The character of every rank.
+    std::array<uint8_t, 16> rank_chars{};
+    //!\brief Whether the characters can be looked up with #rank_chars.
+    bool rank_chars_are_valid{false};
+
+    //!\brief The rank of the complement of every rank.
+    std::array<uint8_t, 16> complement_ranks{};
+    //!\brief Whether the complements can be looked up with #complement_ranks.
+    bool complement_ranks_are_valid{false};
+
+    //!\brief The character of the rank 0.
+    uint8_t char_offset{};
+    /*!\brief Whether ranks and characters can be converted by the offset #char_offset, i.e. the rank of a character
+     *        `c` is `min(max(c - char_offset, 0), alphabet_size - 1)`.
+     */
+    bool char_offset_is_valid{false};
+
+    //!\brief The tables of the alphabet; computed on first use.
+    static alphabet_simd_conversion const & get()
+    {
+        static alphabet_simd_conversion const tables{compute()};
+        return tables;
+    }
+
+private:
+    //!\brief Computes the tables and checks them against the element-wise conversion.
+    static alphabet_simd_conversion compute()
+    {
+        alphabet_simd_conversion result{};
+
+        if constexpr (is_byte_alphabet)
+        {
+            constexpr size_t size = alphabet_size<alphabet_t>;
+
+            for (size_t rank = 0; rank < size; ++rank)
+            {
+                alphabet_t const letter = assign_rank_to(rank, alphabet_t{});
+                uint8_t byte{};
+                std::memcpy(&byte, &letter, 1);
+
+                if (byte != rank) // the kernels cannot be used if the byte is not the rank
+                    return result;
+            }
+
+            result.rank_is_byte = true;
+
+            result.letter_ranks_are_valid = true;
+            for (size_t i = 0; i < 32; ++i)
+                result.letter_ranks[i] = to_rank(assign_char_to(static_cast<char>(0x40 | i), alphabet_t{}));
+
+            for (size_t c = 0x40; c < 0x80; ++c)
+            {
+                if (to_rank(assign_char_to(static_cast<char>(c), alphabet_t{})) != result.letter_ranks[c & 0x1f])
+                    result.letter_ranks_are_valid = false;
+            }
+
+            if constexpr (size <= 16)
+            {
+                result.rank_chars_are_valid = true;
+                for (size_t rank = 0; rank < size; ++rank)
+                    result.rank_chars[rank] = static_cast<uint8_t>(to_char(assign_rank_to(rank, alphabet_t{})));
+
+                if constexpr (nucleotide_alphabet<alphabet_t>)
+                {
+                    result.complement_ranks_are_valid = true;
+                    for (size_t rank = 0; rank < size; ++rank)
+                        result.complement_ranks[rank] = to_rank(seqan3::complement(assign_rank_to(rank, alphabet_t{})));
+                }
+            }
+
+            result.char_offset = static_cast<uint8_t>(to_char(assign_rank_to(0, alphabet_t{})));
+            result.char_offset_is_valid = true;
+
+            for (size_t rank = 0; rank < size; ++rank)
+            {
+                if (static_cast<size_t>(to_char(assign_rank_to(rank, alphabet_t{}))) != result.char_offset + rank)
+                    result.char_offset_is_valid = false;
+            }
+
+            for (int c = 0; c < 0x80; ++c)
+            {
+                int const expected = std::clamp<int>(c - result.char_offset, 0, size - 1);
+
+                if (to_rank(assign_char_to(static_cast<char>(c), alphabet_t{})) != expected)
+                    result.char_offset_is_valid = false;
+            }
+        }
+
+        return result;
+    }
+};
+
+/*!\brief Assigns characters to letters, like seqan3::assign_char_to on every element.
+ * \ingroup alphabet
+ * \tparam alphabet_t The alphabet; must model seqan3::alphabet with `char` as character type.
+ * \param[in]  in    The characters.
+ * \param[in]  count The number of characters.
+ * \param[out] out   The letters.
+ *
+ * \details
+ *
+ * Uses SIMD kernels for the nucleotide alphabets and alphabets that are a contiguous range of characters like
+ * the Phred qualities, if the CPU supports them.
+ */
+template <alphabet alphabet_t>
+void assign_chars_to(char const * in, size_t const count, alphabet_t * out)
+{
+    using simd_t = alphabet_simd_conversion<alphabet_t>;
+
+    size_t i = 0;
+
+    if constexpr (simd_t::is_byte_alphabet)
+    {
+        simd_t const & tables = simd_t::get();
+
+        // characters that are not letters are converted element-wise, followed by the next SIMD block
+        if (tables.letter_ranks_are_valid)
+        {
+            while (i < count)
+            {
+                i += simd_lookup_letters(in + i, count - i, reinterpret_cast<uint8_t *>(out) + i, tables.letter_ranks);
+
+                for (size_t const block_end = std::min(count, i + simd_conversion_block_size); i < block_end; ++i)
+                    assign_char_to(in[i], out[i]);
+            }
+        }
+        else if (tables.char_offset_is_valid)
+        {
+            while (i < count)
+            {
+                i += simd_subtract_offset(in + i,
+                                          count - i,
+                                          reinterpret_cast<uint8_t *>(out) + i,
+                                          tables.char_offset,
+                                          alphabet_size<alphabet_t> - 1);
+
+                for (size_t const block_end = std::min(count, i + simd_conversion_block_size); i < block_end; ++i)
+                    assign_char_to(in[i], out[i]);
+            }
+        }
+    }
+
+    for (; i < count; ++i)
+        assign_char_to(in[i], out[i]);
+}
+
+/*!\brief Converts letters to characters, like seqan3::to_char on every element.
+ * \ingroup alphabet
+ * \tparam alphabet_t The alphabet; must model seqan3::alphabet with `char` as character type.
+ * \param[in]  in    The letters.
+ * \param[in]  count The number of letters.
+ * \param[out] out   The characters.
+ */
+template <alphabet alphabet_t>
+void to_chars(alphabet_t const * in, size_t const count, char * out)
+{
+    using simd_t = alphabet_simd_conversion<alphabet_t>;
+
+    size_t i = 0;
+
+    if constexpr (simd_t::is_byte_alphabet)
+    {
+        simd_t const & tables = simd_t::get();
+        uint8_t const * ranks = reinterpret_cast<uint8_t const *>(in);
+
+        if (tables.rank_chars_are_valid)
+            i = simd_lookup16(ranks, count, reinterpret_cast<uint8_t *>(out), tables.rank_chars);
+        else if (tables.char_offset_is_valid)
+            i = simd_add_offset(ranks, count, out, tables.char_offset);
+    }
+
+    for (; i < count; ++i)
+        out[i] = to_char(in[i]);
+}
+
+/*!\brief Complements nucleotides, like seqan3::complement on every element.
+ * \ingroup alphabet
+ * \tparam alphabet_t The alphabet; must model seqan3::nucleotide_alphabet.
+ * \param[in]  in    The nucleotides.
+ * \param[in]  count The number of nucleotides.
+ * \param[out] out   The complements; may be the same as `in`.
+ */
+template <nucleotide_alphabet alphabet_t>
+void complement_letters(alphabet_t const * in, size_t const count, alphabet_t * out)
+{
+    using simd_t = alphabet_simd_conversion<alphabet_t>;
+
+    size_t i = 0;
+
+    if constexpr (simd_t::is_byte_alphabet)
+    {
+        simd_t const & tables = simd_t::get();
+
+        if (tables.complement_ranks_are_valid)
+        {
+            i = simd_lookup16(reinterpret_cast<uint8_t const *>(in),
+                              count,
+                              reinterpret_cast<uint8_t *>(out),
+                              tables.complement_ranks);
+        }
+    }
+
+    for (; i < count; ++i)
+        out[i] = seqan3::complement(in[i]);
+}
+
+/*!\brief Reverses and complements nucleotides, i.e. `out[i] = seqan3::complement(in[count - 1 - i])`.
+ * \ingroup alphabet
+ * \tparam alphabet_t The alphabet; must model seqan3::nucleotide_alphabet.
+ * \param[in]  in    The nucleotides.
+ * \param[in]  count The number of nucleotides.
+ * \param[out] out   The reverse complement; may be the same as `in`, but must not overlap it otherwise.
+ */
+template <nucleotide_alphabet alphabet_t>
+void reverse_complement_letters(alphabet_t const * in, size_t const count, alphabet_t * out)
+{
+    using simd_t = alphabet_simd_conversion<alphabet_t>;
+
+    size_t front = 0;
+    size_t back = count;
+
+    if constexpr (simd_t::is_byte_alphabet)
+    {
+        simd_t const & tables = simd_t::get();
+
+        if (tables.complement_ranks_are_valid)
+        {
+            size_t const converted = simd_reverse_lookup16(reinterpret_cast<uint8_t const *>(in),
+                                                           count,
+                                                           reinterpret_cast<uint8_t *>(out),
+                                                           tables.complement_ranks);
+            front += converted;
+            back -= converted;
+        }
+    }
+
+    // both letters are read before either is written, so this also works in place
+    while (front < back)
+    {
+        --back;
+        alphabet_t const first = in[front];
+        alphabet_t const last = in[back];
+        out[front] = seqan3::complement(last);
+        out[back] = seqan3::complement(first);
+        ++front;
+    }
+}
+
+} // namespace seqan3::detail
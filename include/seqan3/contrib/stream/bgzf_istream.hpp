@@ -537,8 +537,10 @@ public:
     typedef std::basic_istream<Elem, Tr>&                          istream_reference;
     typedef basic_bgzf_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>  decompression_bgzf_streambuf_type;
 
-    basic_bgzf_istreambase(istream_reference istream_)
-        : m_buf(istream_)
+    basic_bgzf_istreambase(istream_reference istream_,
+                           size_t numThreads = bgzf_thread_count,
+                           size_t jobsPerThread = 8)
+        : m_buf(istream_, numThreads, jobsPerThread)
     {
         this->init(&m_buf);
     };
@@ -580,8 +582,11 @@ public:
     typedef istream_type &                                     istream_reference;
     typedef char                                               byte_type;
 
-    basic_bgzf_istream(istream_reference istream_) :
-        bgzf_istreambase_type(istream_),
+    // numThreads_ is the number of decompression threads, each of them decompresses jobsPerThread_ blocks ahead
+    basic_bgzf_istream(istream_reference istream_,
+                       size_t numThreads_ = bgzf_thread_count,
+                       size_t jobsPerThread_ = 8) :
+        bgzf_istreambase_type(istream_, numThreads_, jobsPerThread_),
         istream_type(bgzf_istreambase_type::rdbuf()),
         m_is_gzip(false),
         m_gbgzf_data_size(0)
@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
 #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
@@ -81,13 +85,20 @@ public:
     struct BufferWriter
     {
         ostream_reference ostream;
+        // the compressed sizes of the written blocks, if recordBlockSizes is set
+        bool                recordBlockSizes;
+        std::vector<size_t> blockSizes;
 
         BufferWriter(ostream_reference ostream) :
-            ostream(ostream)
+            ostream(ostream),
+            recordBlockSizes(false)
         {}
 
         bool operator() (OutputBuffer const & outputBuffer)
         {
+            if (recordBlockSizes)
+                blockSizes.push_back(outputBuffer.size);
+
             ostream.write(outputBuffer.buffer, outputBuffer.size);
             return ostream.good();
         }
@@ -99,11 +110,13 @@ public:
 
         TBuffer         buffer;
         size_t          size;
+        int             level;
         OutputBuffer    *outputBuffer;
 
         CompressionJob() :
             buffer(DefaultPageSize<detail::bgzf_compression>::VALUE / sizeof(char_type), 0),
             size(0),
+            level(Z_BEST_SPEED),
             outputBuffer(NULL)
         {}
     };
@@ -117,6 +130,9 @@ public:
     Serializer<OutputBuffer, BufferWriter> serializer;
     size_t                                 currentJobId;
     bool                                   currentJobAvail;
+    int                                    compressionLevel;
+    // called with the uncompressed data of every block before it is compressed
+    std::function<void(char_type const *, size_t)> blockObserver;
 
     struct CompressionThread
     {
@@ -140,7 +156,8 @@ public:
 
                 CompressionJob &job = streamBuf->jobs[jobId];
 
-                // compress block with zlib
+                // compress block with zlib (or libdeflate)
+                compressionCtx.level = job.level;
                 job.outputBuffer->size = _compressBlock(
                     job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
                     &job.buffer[0], job.size, compressionCtx);
@@ -162,7 +179,8 @@ public:
         numJobs(numThreads * jobsPerThread),
         jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numThreads * jobsPerThread),
+        compressionLevel(Z_BEST_SPEED)
     {
         jobs.resize(numJobs);
         currentJobId = 0;
@@ -213,7 +231,11 @@ public:
         // submit current job
         if (currentJobAvail)
         {
+            if (blockObserver)
+                blockObserver(&jobs[currentJobId].buffer[0], size);
+
             jobs[currentJobId].size = size;
+            jobs[currentJobId].level = compressionLevel;
             appendValue(jobQueue, currentJobId);
         }
 
@@ -238,7 +260,7 @@ public:
         {
             CompressionJob &job = jobs[currentJobId];
             this->setp(&job.buffer[0], &job.buffer[0] + (job.buffer.size() - 1));
-            return c;
+            return traits_type::not_eof(c); // EOF would signal an error to sync()
         }
         else
         {
@@ -284,6 +306,30 @@ public:
             overflow(EOF);
     }
 
+    // sets the compression level (0 to 9) of the current and all following blocks
+    void compression_level(int level)
+    {
+        if (level < Z_NO_COMPRESSION || level > Z_BEST_COMPRESSION)
+            throw std::invalid_argument{"The BGZF compression level must be in [0, 9]."};
+
+        compressionLevel = level;
+    }
+
+    // returns the compression level
+    int compression_level() const            { return compressionLevel; };
+
+    // calls observer with the uncompressed data of every following block (in order and before it is compressed)
+    // and records the compressed sizes of these blocks; must be called before anything is written to get the
+    // virtual offsets of the data
+    void record_blocks(std::function<void(char_type const *, size_t)> observer)
+    {
+        blockObserver = std::move(observer);
+        serializer.worker.recordBlockSizes = true;
+    }
+
+    // returns the compressed sizes of the blocks written since record_blocks(); complete after flush()
+    std::vector<size_t> const & block_sizes() const { return serializer.worker.blockSizes; };
+
     // returns a reference to the output stream
     ostream_reference get_ostream() const    { return serializer.worker.ostream; };
 };
@@ -305,8 +351,10 @@ public:
     typedef std::basic_ostream<Elem, Tr>&                         ostream_reference;
     typedef basic_bgzf_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT> bgzf_streambuf_type;
 
-    basic_bgzf_ostreambase(ostream_reference ostream_)
-        : m_buf(ostream_)
+    basic_bgzf_ostreambase(ostream_reference ostream_,
+                           size_t numThreads = bgzf_thread_count,
+                           size_t jobsPerThread = 8)
+        : m_buf(ostream_, numThreads, jobsPerThread)
     {
         this->init(&m_buf );
     };
@@ -346,8 +394,11 @@ public:
     typedef std::basic_ostream<Elem,Tr>                        ostream_type;
     typedef ostream_type&                                      ostream_reference;
 
-    basic_bgzf_ostream(ostream_reference ostream_) :
-        bgzf_ostreambase_type(ostream_),
+    // numThreads_ is the number of compression threads, each of them compresses jobsPerThread_ blocks at once
+    basic_bgzf_ostream(ostream_reference ostream_,
+                       size_t numThreads_ = bgzf_thread_count,
+                       size_t jobsPerThread_ = 8) :
+        bgzf_ostreambase_type(ostream_, numThreads_, jobsPerThread_),
         ostream_type(bgzf_ostreambase_type::rdbuf())
     {}
 
@@ -357,6 +408,18 @@ public:
         ostream_type::flush(); this->rdbuf()->flush(); return *this;
     };
 
+    // sets the compression level (0 to 9) of the current and all following blocks
+    void compression_level(int level)
+    {
+        this->rdbuf()->compression_level(level);
+    }
+
+    // returns the compression level
+    int compression_level()
+    {
+        return this->rdbuf()->compression_level();
+    }
+
     ~basic_bgzf_ostream()
     {
         this->rdbuf()->addFooter();
@@ -0,0 +1,1758 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_parallel_gz_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZLIB
+#error "This file cannot be used when building without ZLIB-support."
+#endif
+
+#include <zlib.h>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/contrib/stream/bgzf_stream_util.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/utility/detail/to_little_endian.hpp>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads used to decompress plain gzip files.
+ *       Defaults to 1, i.e. plain gzip files are decompressed by basic_gz_istream.
+ *
+ * \details
+ *
+ * If the value is greater than 1, seqan3::detail::make_secondary_istream decompresses plain gzip input with
+ * basic_parallel_gz_istream on that many threads. A single thread decodes slower than zlib and the reading thread
+ * falls back to zlib for the rest of the input as soon as a chunk cannot be decoded speculatively, so only
+ * well-compressed input profits from more threads. BGZF input is decompressed on bgzf_thread_count threads instead.
+ */
+inline static uint64_t parallel_gz_thread_count = 1;
+
+// Default size of the compressed chunks that are decompressed in parallel, change this to suite your needs.
+const size_t PARALLEL_GZ_DEFAULT_CHUNK_SIZE = 1024 * 1024;
+// Default size of the buffer handed out to the reader of the stream.
+const size_t PARALLEL_GZ_INPUT_DEFAULT_BUFFER_SIZE = 921600;
+
+// ===========================================================================
+// Deflate decoding
+// ===========================================================================
+// A deflate (RFC 1951) decoder that, in contrast to zlib, can start at an arbitrary block boundary without knowing the
+// preceding 32 KiB window. Unknown window bytes are represented by 16 bit marker symbols, which are replaced by the
+// actual bytes as soon as the window is known.
+
+// --------------------------------------------------------------------------
+// Class deflate_bit_reader
+// --------------------------------------------------------------------------
+// Reads the bits of a byte buffer in deflate order (least significant bit first).
+// Reading past the end yields zeros; overrun() reports whether this happened.
+
+class deflate_bit_reader
+{
+public:
+    deflate_bit_reader(uint8_t const * data_, size_t size_) : data{data_}, size{size_}
+    {}
+
+    // moves the reader to the given bit position
+    void seek(size_t const bit_position)
+    {
+        byte_position = bit_position / 8;
+        buffer = 0;
+        count = 0;
+        refill();
+        consume(bit_position % 8);
+    }
+
+    // ensures that at least 56 bits are buffered
+    void refill()
+    {
+        if (count > 56)
+            return;
+
+        if (byte_position + 8 <= size)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + byte_position, 8);
+            buffer |= detail::to_little_endian(word) << count;
+            byte_position += (63 - count) / 8;
+            count |= 56;
+        }
+        else
+        {
+            for (; count <= 56; count += 8, ++byte_position)
+                buffer |= static_cast<uint64_t>(byte_position < size ? data[byte_position] : 0) << count;
+        }
+    }
+
+    // returns the next n buffered bits without consuming them
+    uint32_t peek(size_t const n) const
+    {
+        return static_cast<uint32_t>(buffer & ((uint64_t{1} << n) - 1));
+    }
+
+    void consume(size_t const n)
+    {
+        buffer >>= n;
+        count -= n;
+    }
+
+    // reads n buffered bits
+    uint32_t read(size_t const n)
+    {
+        uint32_t const value = peek(n);
+        consume(n);
+        return value;
+    }
+
+    // skips the bits up to the next byte boundary
+    void align()
+    {
+        consume(count % 8);
+    }
+
+    size_t position() const
+    {
+        return byte_position * 8 - count;
+    }
+
+    bool overrun() const
+    {
+        return position() > size * 8;
+    }
+
+    uint8_t const * bytes() const
+    {
+        return data;
+    }
+
+    size_t byte_size() const
+    {
+        return size;
+    }
+
+private:
+    uint8_t const * data;
+    size_t size;
+    size_t byte_position{0};
+    uint64_t buffer{0};
+    size_t count{0};
+};
+
+// --------------------------------------------------------------------------
+// Class deflate_huffman_decoder
+// --------------------------------------------------------------------------
+// A canonical Huffman decoder. Codes of up to table_bits bits are resolved by a single table lookup, longer codes
+// are decoded bit by bit from the canonical code.
+
+template <size_t table_bits, size_t max_symbols>
+class deflate_huffman_decoder
+{
+public:
+    enum class code_type
+    {
+        code_lengths,
+        literal_lengths,
+        distances
+    };
+
+    // Builds the decoder from the code lengths. Returns false for invalid codes, following the rules of zlib:
+    // over-subscribed codes are invalid, incomplete codes are only allowed for a single code of length one.
+    bool build(uint8_t const * lengths, size_t const symbol_count, code_type const type)
+    {
+        counts.fill(0);
+        for (size_t symbol = 0; symbol < symbol_count; ++symbol)
+            ++counts[lengths[symbol]];
+        counts[0] = 0;
+
+        table.fill(0);
+        complete = false;
+
+        size_t max_length = 15;
+        while (max_length > 0 && counts[max_length] == 0)
+            --max_length;
+
+        if (max_length == 0) // No codes at all: building succeeds but every decoding fails.
+            return true;
+
+        int left = 1;
+        for (size_t length = 1; length <= 15; ++length)
+        {
+            left = (left << 1) - counts[length];
+            if (left < 0) // over-subscribed
+                return false;
+        }
+
+        complete = (left == 0);
+        if (!complete && (type == code_type::code_lengths || max_length != 1))
+            return false;
+
+        std::array<uint16_t, 16> offsets{};
+        for (size_t length = 1; length < 15; ++length)
+            offsets[length + 1] = offsets[length] + counts[length];
+
+        for (size_t symbol = 0; symbol < symbol_count; ++symbol)
+            if (lengths[symbol] != 0)
+                symbols[offsets[lengths[symbol]]++] = symbol;
+
+        uint32_t code = 0;
+        size_t index = 0;
+        for (size_t length = 1; length <= table_bits; ++length, code <<= 1)
+        {
+            for (size_t i = 0; i < counts[length]; ++i, ++index, ++code)
+            {
+                uint32_t const entry = (static_cast<uint32_t>(symbols[index]) << 4) | length;
+
+                for (size_t slot = reverse(code, length); slot < table.size(); slot += size_t{1} << length)
+                    table[slot] = entry;
+            }
+        }
+
+        return true;
+    }
+
+    // Decodes the next symbol; requires at least 15 buffered bits. Returns -1 for an invalid code.
+    int decode(deflate_bit_reader & in) const
+    {
+        uint32_t const entry = table[in.peek(table_bits)];
+
+        if (entry != 0)
+        {
+            in.consume(entry & 15);
+            return entry >> 4;
+        }
+
+        return decode_long(in);
+    }
+
+    // whether the code uses the complete code space
+    bool is_complete() const
+    {
+        return complete;
+    }
+
+private:
+    int decode_long(deflate_bit_reader & in) const
+    {
+        uint32_t const bits = in.peek(15);
+        int code = 0;
+        int first = 0;
+        int index = 0;
+
+        for (size_t length = 1; length <= 15; ++length)
+        {
+            code |= (bits >> (length - 1)) & 1;
+            int const count = counts[length];
+
+            if (code - first < count)
+            {
+                in.consume(length);
+                return symbols[index + code - first];
+            }
+
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+
+        return -1;
+    }
+
+    static uint32_t reverse(uint32_t code, size_t const length)
+    {
+        uint32_t reversed = 0;
+        for (size_t i = 0; i < length; ++i, code >>= 1)
+            reversed = (reversed << 1) | (code & 1);
+        return reversed;
+    }
+
+    std::array<uint32_t, size_t{1} << table_bits> table{};
+    std::array<uint16_t, 16> counts{};
+    std::array<uint16_t, max_symbols> symbols{};
+    bool complete{false};
+};
+
+// --------------------------------------------------------------------------
+// Class deflate_block_decoder
+// --------------------------------------------------------------------------
+// Decodes single deflate blocks into a vector of output symbols.
+
+class deflate_block_decoder
+{
+public:
+    enum class status
+    {
+        ok,
+        final_block,
+        invalid,
+        end_of_input,
+        too_large
+    };
+
+    deflate_block_decoder()
+    {
+        std::array<uint8_t, 288> lengths{};
+        std::fill(lengths.begin(), lengths.begin() + 144, 8);
+        std::fill(lengths.begin() + 144, lengths.begin() + 256, 9);
+        std::fill(lengths.begin() + 256, lengths.begin() + 280, 7);
+        std::fill(lengths.begin() + 280, lengths.end(), 8);
+        fixed_literals.build(lengths.data(), 288, literal_decoder::code_type::literal_lengths);
+
+        std::fill(lengths.begin(), lengths.begin() + 32, 5);
+        fixed_distances.build(lengths.data(), 32, distance_decoder::code_type::distances);
+    }
+
+    // Decodes the block starting at the current position of in and appends it to out[out_size, ...).
+    // Back-references may reach back to out[member_begin]. In strict mode only dynamic blocks with a complete
+    // literal/length code are accepted, which is used to validate guessed block positions. Blocks producing more
+    // than block_limit symbols are reported as too_large.
+    template <typename symbol_t>
+    status decode(deflate_bit_reader & in,
+                  std::vector<symbol_t> & out,
+                  size_t & out_size,
+                  size_t const member_begin,
+                  bool const strict = false,
+                  size_t const block_limit = std::numeric_limits<size_t>::max())
+    {
+        in.refill();
+        bool const is_final = in.read(1);
+        uint32_t const type = in.read(2);
+        status result{status::invalid};
+
+        if (type == 0 && !strict)
+        {
+            result = copy_stored(in, out, out_size);
+        }
+        else if (type == 1 && !strict)
+        {
+            result = decode_huffman(in, out, out_size, member_begin, fixed_literals, fixed_distances, block_limit);
+        }
+        else if (type == 2)
+        {
+            result = read_dynamic_header(in, strict);
+
+            if (result == status::ok)
+                result = decode_huffman(in, out, out_size, member_begin, literals, distances, block_limit);
+        }
+
+        if (in.overrun())
+            return status::end_of_input;
+
+        if (result == status::ok && is_final)
+            return status::final_block;
+
+        return result;
+    }
+
+    // Whether a dynamic block header with a complete code length code starts at the given bit position.
+    // This cheap test rejects the vast majority of positions that are not a block boundary.
+    static bool is_dynamic_block_candidate(deflate_bit_reader & in, size_t const bit_position)
+    {
+        in.seek(bit_position);
+        uint32_t const header = in.read(17);
+
+        if (((header >> 1) & 3) != 2 || ((header >> 3) & 31) > 29 || ((header >> 8) & 31) > 29)
+            return false;
+
+        size_t const code_length_count = ((header >> 13) & 15) + 4;
+        uint32_t kraft_sum = 0; // in units of 2^-7
+
+        for (size_t i = 0; i < code_length_count; ++i)
+        {
+            if (i == 10)
+                in.refill();
+
+            uint32_t const length = in.read(3);
+            if (length != 0)
+                kraft_sum += 128u >> length;
+        }
+
+        return kraft_sum == 128;
+    }
+
+    // Whether the block starting at the current position of in is a dynamic block.
+    static bool is_dynamic_block(deflate_bit_reader & in)
+    {
+        in.refill();
+        return ((in.peek(3) >> 1) & 3) == 2;
+    }
+
+    // Whether the block starting at the current position of in is a stored block.
+    static bool is_stored_block(deflate_bit_reader & in)
+    {
+        in.refill();
+        return ((in.peek(3) >> 1) & 3) == 0;
+    }
+
+private:
+    using literal_decoder = deflate_huffman_decoder<10, 288>;
+    using distance_decoder = deflate_huffman_decoder<8, 32>;
+    using code_length_decoder = deflate_huffman_decoder<7, 19>;
+
+    static constexpr std::array<uint16_t, 29> length_base{3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35,
+                                                          43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static constexpr std::array<uint8_t, 29> length_extra{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                                          4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static constexpr std::array<uint16_t, 30> distance_base{1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                            257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                            8193, 12289, 16385, 24577};
+    static constexpr std::array<uint8_t, 30> distance_extra{0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8,
+                                                            8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    // Makes room for at least one more match of maximal length.
+    template <typename symbol_t>
+    static void reserve_output(std::vector<symbol_t> & out, size_t const out_size, size_t const count)
+    {
+        if (out.size() < out_size + count)
+            out.resize(std::max(out.size() * 2, out_size + count + 65536));
+    }
+
+    template <typename symbol_t>
+    static status copy_stored(deflate_bit_reader & in, std::vector<symbol_t> & out, size_t & out_size)
+    {
+        in.align();
+        size_t const byte_position = in.position() / 8;
+
+        if (byte_position + 4 > in.byte_size())
+            return status::end_of_input;
+
+        uint8_t const * header = in.bytes() + byte_position;
+        size_t const length = header[0] | (header[1] << 8);
+        size_t const inverted_length = header[2] | (header[3] << 8);
+
+        if (length != (~inverted_length & 0xFFFF))
+            return status::invalid;
+
+        if (byte_position + 4 + length > in.byte_size())
+            return status::end_of_input;
+
+        reserve_output(out, out_size, length);
+        std::copy(header + 4, header + 4 + length, out.begin() + out_size);
+        out_size += length;
+        in.seek((byte_position + 4 + length) * 8);
+
+        return status::ok;
+    }
+
+    status read_dynamic_header(deflate_bit_reader & in, bool const strict)
+    {
+        static constexpr std::array<uint8_t, 19> order{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1,
+                                                       15};
+
+        size_t const literal_count = in.read(5) + 257;
+        size_t const distance_count = in.read(5) + 1;
+        size_t const code_length_count = in.read(4) + 4;
+
+        if (literal_count > 286 || distance_count > 30)
+            return status::invalid;
+
+        std::array<uint8_t, 19> code_lengths{};
+        for (size_t i = 0; i < code_length_count; ++i)
+        {
+            in.refill();
+            code_lengths[order[i]] = in.read(3);
+        }
+
+        if (!code_length_decoder_.build(code_lengths.data(), 19, code_length_decoder::code_type::code_lengths))
+            return status::invalid;
+
+        std::array<uint8_t, 286 + 30> lengths{};
+        size_t const total = literal_count + distance_count;
+
+        for (size_t i = 0; i < total;)
+        {
+            in.refill();
+            int const symbol = code_length_decoder_.decode(in);
+
+            if (symbol < 0)
+                return status::invalid;
+
+            if (symbol < 16)
+            {
+                lengths[i++] = symbol;
+                continue;
+            }
+
+            uint8_t value = 0;
+            size_t repeat{};
+
+            if (symbol == 16)
+            {
+                if (i == 0)
+                    return status::invalid;
+
+                value = lengths[i - 1];
+                repeat = 3 + in.read(2);
+            }
+            else if (symbol == 17)
+            {
+                repeat = 3 + in.read(3);
+            }
+            else
+            {
+                repeat = 11 + in.read(7);
+            }
+
+            if (i + repeat > total)
+                return status::invalid;
+
+            std::fill_n(lengths.begin() + i, repeat, value);
+            i += repeat;
+        }
+
+        if (lengths[256] == 0) // the end-of-block code is missing
+            return status::invalid;
+
+        if (!literals.build(lengths.data(), literal_count, literal_decoder::code_type::literal_lengths) ||
+            !distances.build(lengths.data() + literal_count, distance_count, distance_decoder::code_type::distances))
+            return status::invalid;
+
+        if (strict && !literals.is_complete())
+            return status::invalid;
+
+        return status::ok;
+    }
+
+    template <typename symbol_t>
+    static status decode_huffman(deflate_bit_reader & in,
+                                 std::vector<symbol_t> & out,
+                                 size_t & out_size,
+                                 size_t const member_begin,
+                                 literal_decoder const & literal_codes,
+                                 distance_decoder const & distance_codes,
+                                 size_t const block_limit)
+    {
+        size_t const block_begin = out_size;
+
+        while (true)
+        {
+            // Every symbol consumes at least one bit, hence decoding stops after reading past the end.
+            if (in.overrun())
+                return status::end_of_input;
+
+            if (out_size - block_begin > block_limit)
+                return status::too_large;
+
+            // A length/distance pair needs at most 15 + 5 + 15 + 13 bits.
+            in.refill();
+            reserve_output(out, out_size, 258);
+
+            int symbol = literal_codes.decode(in);
+
+            if (symbol < 256)
+            {
+                if (symbol < 0)
+                    return status::invalid;
+
+                out[out_size++] = static_cast<symbol_t>(symbol);
+                continue;
+            }
+
+            if (symbol == 256)
+                return status::ok;
+
+            symbol -= 257;
+            if (symbol >= 29)
+                return status::invalid;
+
+            size_t const length = length_base[symbol] + in.read(length_extra[symbol]);
+
+            int const distance_symbol = distance_codes.decode(in);
+            if (distance_symbol < 0 || distance_symbol >= 30)
+                return status::invalid;
+
+            size_t const distance = distance_base[distance_symbol] + in.read(distance_extra[distance_symbol]);
+            if (distance > out_size - member_begin)
+                return status::invalid;
+
+            symbol_t * target = out.data() + out_size;
+            symbol_t const * source = target - distance;
+
+            if (distance >= length)
+                std::copy(source, source + length, target);
+            else // overlapping copy
+                for (size_t i = 0; i < length; ++i)
+                    target[i] = source[i];
+
+            out_size += length;
+        }
+    }
+
+    literal_decoder fixed_literals{};
+    distance_decoder fixed_distances{};
+    literal_decoder literals{};
+    distance_decoder distances{};
+    code_length_decoder code_length_decoder_{};
+};
+
+// --------------------------------------------------------------------------
+// Struct parallel_gz_chunk
+// --------------------------------------------------------------------------
+// A chunk of the compressed input and its decompressed content.
+//
+// The output of a chunk consists of the marked symbols marked[marked_begin, marked_end), which may refer to the
+// unknown window preceding the chunk, followed by the bytes data[data_begin, data_end).
+// A marker symbol has the highest bit set and stores the position inside of the 32 KiB window before the chunk.
+
+struct parallel_gz_chunk
+{
+    // where the decompression continues
+    enum class state_type
+    {
+        header,
+        block,
+        footer
+    };
+
+    // why the decompression of the chunk stopped
+    enum class end_type
+    {
+        boundary,       // at the first dynamic block after the end of the chunk
+        end_of_input,   // no complete block left in the input of the chunk
+        output_limit,   // the output exceeds the output limit
+        stored_block,   // a stored block, which is only decoded by the reader with zlib
+        end_of_stream,  // the last gzip member ended
+        invalid         // the input is not valid gzip data
+    };
+
+    // end of a gzip member
+    struct member_end
+    {
+        size_t position; // within the output of the chunk
+        uint32_t crc;
+        uint32_t size;
+    };
+
+    // -- input
+    std::vector<uint8_t> input{};   // the chunk followed by the next chunk as lookahead
+    size_t chunk_size{};            // the number of bytes belonging to this chunk
+    bool is_first{};                // whether the chunk starts at the beginning of the file
+    bool is_last{};                 // whether there is no input after this chunk
+    bool is_speculative{};          // whether the first block boundary must be searched for
+    size_t start_bit{};             // if not speculative, the bit to start at
+    state_type start_state{};       // if not speculative, the state to start in
+
+    // -- output
+    bool start_found{};
+    size_t end_bit{};
+    state_type end_state{};
+    end_type end{};
+    std::string error_message{};
+
+    std::vector<uint16_t> marked{};
+    size_t marked_begin{};
+    size_t marked_end{};
+    std::vector<char> data{};
+    size_t data_begin{};
+    size_t data_end{};
+
+    std::vector<member_end> member_ends{};
+    std::vector<uint32_t> data_crcs{}; // crc of the part of data belonging to each (partial) member
+
+    size_t output_size() const
+    {
+        return (marked_end - marked_begin) + (data_end - data_begin);
+    }
+};
+
+// --------------------------------------------------------------------------
+// Class parallel_gz_chunk_decoder
+// --------------------------------------------------------------------------
+// Decompresses a parallel_gz_chunk.
+//
+// A speculative chunk searches the first position in the chunk at which a valid dynamic block starts and decodes
+// from there with an unknown window. Every chunk stops at the first dynamic block starting after its end, which is
+// the same block the speculative search of the next chunk should find. If both positions match, the next chunk was
+// decoded correctly; otherwise the reader decodes the next chunk again from the correct position.
+
+class parallel_gz_chunk_decoder
+{
+public:
+    static constexpr size_t window_size = 32768;
+    static constexpr uint16_t marker_flag = 0x8000;
+
+    // The decoding stops early with an invalid chunk if cancelled_ is set.
+    explicit parallel_gz_chunk_decoder(size_t const output_limit_, std::atomic_bool const * cancelled_ = nullptr) :
+        output_limit{output_limit_},
+        cancelled{cancelled_}
+    {}
+
+    // Decompresses the chunk. If the chunk is not speculative, window holds the bytes preceding the chunk.
+    void decode(parallel_gz_chunk & chunk, char const * window, size_t const window_length)
+    {
+        using state_type = parallel_gz_chunk::state_type;
+        using end_type = parallel_gz_chunk::end_type;
+        using status = deflate_block_decoder::status;
+
+        deflate_bit_reader in{chunk.input.data(), chunk.input.size()};
+        size_t const input_bits = chunk.input.size() * 8;
+        size_t const stop_bit = chunk.is_last ? std::numeric_limits<size_t>::max() : chunk.chunk_size * 8;
+
+        chunk.member_ends.clear();
+        chunk.data_crcs.clear();
+        chunk.error_message.clear();
+        chunk.marked_begin = chunk.marked_end = 0;
+        chunk.data_begin = chunk.data_end = 0;
+
+        bool marker_mode = false;
+        size_t member_begin = 0;
+        state_type state = chunk.start_state;
+
+        auto finish = [&] (end_type const end, size_t const end_bit, state_type const end_state)
+        {
+            chunk.end = end;
+            chunk.end_bit = end_bit;
+            chunk.end_state = end_state;
+        };
+
+        auto fail = [&] (std::string message)
+        {
+            chunk.end = end_type::invalid;
+            chunk.error_message = std::move(message);
+        };
+
+        if (chunk.is_speculative)
+        {
+            if (!find_start(chunk, in, std::min(stop_bit, input_bits)))
+                return;
+
+            marker_mode = true;
+            state = chunk.end_state;
+            try_leave_marker_mode(chunk, marker_mode, member_begin);
+        }
+        else
+        {
+            // The window becomes the beginning of the data, which allows back-references into it.
+            if (chunk.data.size() < window_length)
+                chunk.data.resize(window_length);
+
+            std::copy(window, window + window_length, chunk.data.begin());
+            chunk.data_begin = chunk.data_end = window_length;
+            chunk.start_found = true;
+            in.seek(chunk.start_bit);
+        }
+
+        while (true)
+        {
+            if (state == state_type::header)
+            {
+                size_t const position = in.position() / 8;
+                size_t header_end{};
+                header_status const result = parse_header(chunk.input, position, header_end);
+
+                if (result == header_status::need_more_input)
+                {
+                    if (position == chunk.input.size() && chunk.is_last)
+                        return finish(end_type::end_of_stream, position * 8, state);
+                    else if (chunk.is_last)
+                        return fail("Unexpected end of the gzip compressed input.");
+                    else
+                        return finish(end_type::end_of_input, position * 8, state);
+                }
+                else if (result == header_status::invalid)
+                {
+                    // Anything following a complete member that is not a gzip member is ignored, like zlib does.
+                    if (chunk.is_first && chunk.start_bit == 0 && chunk.output_size() == 0 && position == 0)
+                        return fail("Invalid gzip header.");
+
+                    return finish(end_type::end_of_stream, position * 8, state);
+                }
+
+                // The window is reset at the beginning of every gzip member, thus no markers can occur.
+                if (marker_mode)
+                    leave_marker_mode(chunk, marker_mode);
+
+                member_begin = chunk.data_end;
+                in.seek(header_end * 8);
+                state = state_type::block;
+            }
+            else if (state == state_type::block)
+            {
+                size_t const block_bit = in.position();
+
+                if (block_bit >= stop_bit && deflate_block_decoder::is_dynamic_block(in))
+                    return finish(end_type::boundary, block_bit, state);
+
+                if (chunk.output_size() >= output_limit)
+                    return finish(end_type::output_limit, block_bit, state);
+
+                // Stored blocks indicate incompressible data, which zlib decodes much faster.
+                if (deflate_block_decoder::is_stored_block(in))
+                    return finish(end_type::stored_block, block_bit, state);
+
+                if (is_cancelled())
+                    return fail("The decompression was cancelled.");
+
+                size_t const block_limit = chunk.is_speculative ? output_limit : std::numeric_limits<size_t>::max();
+                bool is_final{};
+                status result{};
+
+                if (marker_mode)
+                {
+                    size_t const previous_end = chunk.marked_end;
+                    result = block_decoder.decode(in, chunk.marked, chunk.marked_end, 0, false, block_limit);
+
+                    if (result != status::ok && result != status::final_block)
+                        chunk.marked_end = previous_end;
+                }
+                else
+                {
+                    size_t const previous_end = chunk.data_end;
+                    result = block_decoder.decode(in, chunk.data, chunk.data_end, member_begin, false, block_limit);
+
+                    if (result != status::ok && result != status::final_block)
+                        chunk.data_end = previous_end;
+                }
+
+                switch (result)
+                {
+                    case status::final_block:
+                        is_final = true;
+                        break;
+                    case status::ok:
+                        break;
+                    case status::end_of_input:
+                        if (chunk.is_last)
+                            return fail("Unexpected end of the gzip compressed input.");
+                        return finish(end_type::end_of_input, block_bit, state);
+                    case status::too_large:
+                        return finish(end_type::output_limit, block_bit, state);
+                    default:
+                        return fail("Invalid deflate data in the gzip compressed input.");
+                }
+
+                if (is_final)
+                    state = state_type::footer;
+
+                if (marker_mode)
+                    try_leave_marker_mode(chunk, marker_mode, member_begin);
+            }
+            else // footer
+            {
+                in.align();
+                size_t const position = in.position() / 8;
+
+                if (position + 8 > chunk.input.size())
+                {
+                    if (chunk.is_last)
+                        return fail("Unexpected end of the gzip compressed input.");
+
+                    return finish(end_type::end_of_input, position * 8, state);
+                }
+
+                uint8_t const * footer = chunk.input.data() + position;
+                chunk.member_ends.push_back({chunk.output_size(), read_uint32(footer), read_uint32(footer + 4)});
+
+                in.seek((position + 8) * 8);
+                state = state_type::header;
+            }
+        }
+    }
+
+    // Computes the crc of the data part of every (partial) member, the reader only computes the crc of the marked
+    // part after resolving the markers.
+    static void compute_data_crcs(parallel_gz_chunk & chunk)
+    {
+        size_t const data_offset = chunk.marked_end - chunk.marked_begin;
+        size_t segment_begin = 0;
+
+        chunk.data_crcs.clear();
+
+        for (size_t i = 0; i <= chunk.member_ends.size(); ++i)
+        {
+            size_t const segment_end = (i < chunk.member_ends.size()) ? chunk.member_ends[i].position
+                                                                      : chunk.output_size();
+            size_t const from = std::max(segment_begin, data_offset);
+            uLong crc = crc32(0L, Z_NULL, 0);
+
+            if (segment_end > from)
+                crc = crc32(crc,
+                            reinterpret_cast<Bytef const *>(chunk.data.data() + chunk.data_begin + (from - data_offset)),
+                            static_cast<uInt>(segment_end - from));
+
+            chunk.data_crcs.push_back(static_cast<uint32_t>(crc));
+            segment_begin = segment_end;
+        }
+    }
+
+private:
+    enum class header_status
+    {
+        ok,
+        need_more_input,
+        invalid
+    };
+
+    static uint32_t read_uint32(uint8_t const * bytes)
+    {
+        return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+    }
+
+    // Parses a gzip member header (RFC 1952) starting at the byte position.
+    static header_status parse_header(std::vector<uint8_t> const & input, size_t position, size_t & header_end)
+    {
+        size_t const size = input.size();
+
+        if (position + 10 > size)
+            return (position + 2 > size || (input[position] == 0x1f && input[position + 1] == 0x8b))
+                   ? header_status::need_more_input : header_status::invalid;
+
+        if (input[position] != 0x1f || input[position + 1] != 0x8b || input[position + 2] != 8)
+            return header_status::invalid;
+
+        uint8_t const flags = input[position + 3];
+        position += 10;
+
+        if (flags & 4) // FEXTRA
+        {
+            if (position + 2 > size)
+                return header_status::need_more_input;
+
+            position += 2 + (input[position] | (input[position + 1] << 8));
+        }
+
+        for (uint8_t const flag : {8, 16}) // FNAME, FCOMMENT
+        {
+            if (flags & flag)
+            {
+                while (position < size && input[position] != 0)
+                    ++position;
+
+                ++position;
+            }
+        }
+
+        if (flags & 2) // FHCRC
+            position += 2;
+
+        if (position > size)
+            return header_status::need_more_input;
+
+        header_end = position;
+        return header_status::ok;
+    }
+
+    // Searches the first bit in [0, search_end) at which a valid dynamic block starts and decodes it with markers.
+    bool find_start(parallel_gz_chunk & chunk, deflate_bit_reader & in, size_t const search_end)
+    {
+        using status = deflate_block_decoder::status;
+
+        chunk.start_found = false;
+
+        if (chunk.marked.size() < window_size)
+            chunk.marked.resize(window_size);
+
+        for (size_t i = 0; i < window_size; ++i)
+            chunk.marked[i] = static_cast<uint16_t>(marker_flag | i);
+
+        chunk.marked_begin = window_size;
+
+        for (size_t bit = 0; bit < search_end; ++bit)
+        {
+            if (bit % 4096 == 0 && is_cancelled())
+                break;
+
+            if (!deflate_block_decoder::is_dynamic_block_candidate(in, bit))
+                continue;
+
+            in.seek(bit);
+            chunk.marked_end = window_size;
+            status const result = block_decoder.decode(in, chunk.marked, chunk.marked_end, 0, true, output_limit);
+
+            if (result == status::ok || result == status::final_block)
+            {
+                chunk.start_found = true;
+                chunk.start_bit = bit;
+                chunk.end_state = (result == status::final_block) ? parallel_gz_chunk::state_type::footer
+                                                                   : parallel_gz_chunk::state_type::block;
+                return true;
+            }
+        }
+
+        chunk.marked_end = window_size;
+        chunk.end = parallel_gz_chunk::end_type::end_of_input;
+        chunk.end_bit = 0;
+        chunk.end_state = parallel_gz_chunk::state_type::block;
+        return false;
+    }
+
+    // Continues with plain bytes once the last 32 KiB of the output contain no markers, since later blocks cannot
+    // refer to anything before them.
+    static void try_leave_marker_mode(parallel_gz_chunk & chunk, bool & marker_mode, size_t & member_begin)
+    {
+        uint16_t const * last = chunk.marked.data() + chunk.marked_end;
+
+        if (std::any_of(last - window_size, last, [] (uint16_t const symbol) { return symbol & marker_flag; }))
+            return;
+
+        if (chunk.data.size() < window_size)
+            chunk.data.resize(window_size);
+
+        std::copy(last - window_size, last, chunk.data.begin());
+        chunk.data_begin = 0;
+        chunk.data_end = window_size;
+        chunk.marked_end -= window_size;
+        member_begin = 0;
+        marker_mode = false;
+    }
+
+    // Continues with plain bytes at the beginning of a new gzip member.
+    static void leave_marker_mode(parallel_gz_chunk & chunk, bool & marker_mode)
+    {
+        chunk.data_begin = chunk.data_end = 0;
+        marker_mode = false;
+    }
+
+    bool is_cancelled() const
+    {
+        return cancelled != nullptr && cancelled->load(std::memory_order_relaxed);
+    }
+
+    size_t output_limit;
+    std::atomic_bool const * cancelled;
+    deflate_block_decoder block_decoder{};
+};
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that decompresses gzip input on several threads.
+//
+// The compressed input is split into chunks of a fixed size, which are decompressed by a pool of threads. Since the
+// deflate blocks of a regular gzip file are not aligned to the chunks, every chunk but the first searches for the
+// first block starting inside of it and decodes it without knowing the preceding 32 KiB. References into this unknown
+// window are resolved in input order by the reading thread, which also verifies the checksums of all gzip members.
+//
+// The speculation only pays off for well-compressed input. As soon as a guessed block position turns out to be wrong,
+// a stored block is found or a chunk cannot be completed by the threads, the threads are stopped and the reading
+// thread decompresses the rest of the input with zlib, starting at the known bit position with the known window.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_parallel_gz_istreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &              istream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    static_assert(sizeof(char_type) == 1, "The parallel gzip decompression only supports byte sized characters.");
+
+    // Construct a decompression stream buffer reading the compressed data from istream_.
+    basic_parallel_gz_istreambuf(istream_reference istream_,
+                                 size_t thread_count_,
+                                 size_t chunk_size_,
+                                 size_t read_buffer_size_) :
+        m_istream(istream_),
+        m_chunk_size(std::max<size_t>(chunk_size_, 1)),
+        m_jobs(std::max<size_t>(thread_count_, 1) + 2),
+        m_todo_queue(m_jobs.size()),
+        m_buffer(std::max<size_t>(read_buffer_size_, MAX_PUTBACK + 1))
+    {
+        m_pending_input = read_chunk();
+
+        for (size_t slot = 0; slot < m_jobs.size(); ++slot)
+            submit(slot);
+
+        for (size_t i = 0; i < std::max<size_t>(thread_count_, 1); ++i)
+            m_pool.emplace_back([this] () { decompress(); });
+
+        this->setg(&(m_buffer[0]) + MAX_PUTBACK,  // beginning of putback area
+                   &(m_buffer[0]) + MAX_PUTBACK,  // read position
+                   &(m_buffer[0]) + MAX_PUTBACK); // end position
+    }
+
+    ~basic_parallel_gz_istreambuf()
+    {
+        stop_threads();
+
+        if (m_sequential)
+            inflateEnd(&m_zip_stream);
+    }
+
+    int_type underflow()
+    {
+        if (this->gptr() && (this->gptr() < this->egptr()))
+            return traits_type::to_int_type(*this->gptr());
+
+        size_t n_putback = static_cast<size_t>(this->gptr() - this->eback());
+        if (n_putback > MAX_PUTBACK)
+            n_putback = MAX_PUTBACK;
+
+        std::memmove(&(m_buffer[0]) + (MAX_PUTBACK - n_putback), this->gptr() - n_putback, n_putback);
+
+        size_t const num = read_output(&(m_buffer[0]) + MAX_PUTBACK, m_buffer.size() - MAX_PUTBACK);
+
+        if (num == 0)     // EOF
+            return traits_type::eof();
+
+        // reset buffer pointers
+        this->setg(&(m_buffer[0]) + (MAX_PUTBACK - n_putback),   // beginning of putback area
+                   &(m_buffer[0]) + MAX_PUTBACK,                 // read position
+                   &(m_buffer[0]) + MAX_PUTBACK + num);          // end of buffer
+
+        // return next character
+        return traits_type::to_int_type(*this->gptr());
+    }
+
+    // returns the compressed input istream
+    istream_reference get_istream() { return m_istream; }
+
+    // returns whether the rest of the input is decompressed by zlib in the reading thread
+    bool is_sequential() const { return m_sequential; }
+
+private:
+    using chunk_type = parallel_gz_chunk;
+    using state_type = chunk_type::state_type;
+    using end_type = chunk_type::end_type;
+
+    static constexpr size_t MAX_PUTBACK = 4;
+    static constexpr size_t window_size = parallel_gz_chunk_decoder::window_size;
+
+    struct job
+    {
+        chunk_type chunk{};
+        std::mutex mutex{};
+        std::condition_variable ready_event{};
+        bool ready{true};
+    };
+
+    // Where the zlib decompression continues after falling back.
+    enum class sequential_state
+    {
+        header,      // at the header of the next gzip member
+        gzip_member, // inside of a gzip member, which zlib verifies
+        raw_member,  // inside of the member that was started by the threads, which is verified here
+        footer       // at the footer of the member that was started by the threads
+    };
+
+    // Bounds the memory of a single chunk. The rest of highly compressible input is decompressed by zlib.
+    size_t output_limit() const
+    {
+        return 32 * m_chunk_size + window_size;
+    }
+
+    std::vector<uint8_t> read_chunk()
+    {
+        std::vector<uint8_t> chunk(m_chunk_size);
+        m_istream.read(reinterpret_cast<char_type *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+        chunk.resize(static_cast<size_t>(m_istream.gcount()));
+        return chunk;
+    }
+
+    // Hands the next chunk of the input to the threads.
+    void submit(size_t const slot)
+    {
+        if (m_pending_input.empty())
+            return;
+
+        job & j = m_jobs[slot];
+        std::vector<uint8_t> lookahead = read_chunk();
+
+        j.chunk.input.resize(m_pending_input.size() + lookahead.size());
+        std::copy(m_pending_input.begin(), m_pending_input.end(), j.chunk.input.begin());
+        std::copy(lookahead.begin(), lookahead.end(), j.chunk.input.begin() + m_pending_input.size());
+        j.chunk.chunk_size = m_pending_input.size();
+        j.chunk.is_first = (m_submitted == 0);
+        j.chunk.is_last = lookahead.empty();
+        j.chunk.is_speculative = !j.chunk.is_first;
+        j.chunk.start_bit = 0;
+        j.chunk.start_state = state_type::header;
+
+        m_pending_input = std::move(lookahead);
+
+        {
+            std::lock_guard<std::mutex> lock(j.mutex);
+            j.ready = false;
+        }
+
+        ++m_submitted;
+        [[maybe_unused]] queue_op_status status = m_todo_queue.wait_push(slot);
+        assert(status == queue_op_status::success);
+    }
+
+    // The work of a decompression thread.
+    void decompress()
+    {
+        parallel_gz_chunk_decoder decoder{output_limit(), &m_cancelled};
+
+        while (true)
+        {
+            size_t slot{};
+            if (m_todo_queue.wait_pop(slot) == queue_op_status::closed)
+                return;
+
+            job & j = m_jobs[slot];
+
+            try
+            {
+                decoder.decode(j.chunk, nullptr, 0);
+                parallel_gz_chunk_decoder::compute_data_crcs(j.chunk);
+            }
+            catch (std::exception const & e)
+            {
+                j.chunk.end = end_type::invalid;
+                j.chunk.error_message = e.what();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(j.mutex);
+                j.ready = true;
+            }
+            j.ready_event.notify_all();
+        }
+    }
+
+    // Cancels the running chunks and joins the threads.
+    void stop_threads()
+    {
+        m_cancelled = true;
+        m_todo_queue.close();
+
+        for (auto & thread : m_pool)
+            if (thread.joinable())
+                thread.join();
+
+        m_pool.clear();
+    }
+
+    // Copies the next decompressed bytes to the buffer.
+    size_t read_output(char_type * buffer_, size_t const buffer_size_)
+    {
+        size_t written = 0;
+
+        while (written < buffer_size_)
+        {
+            if (m_sequential)
+                return written + inflate_sequential(buffer_ + written, buffer_size_ - written);
+
+            if (m_current_job == nullptr || m_served == m_current_job->chunk.output_size())
+            {
+                if (!next_output())
+                    break;
+
+                continue;
+            }
+
+            chunk_type const & chunk = m_current_job->chunk;
+            size_t const prefix_size = m_prefix.size();
+            size_t count{};
+
+            if (m_served < prefix_size)
+            {
+                count = std::min(buffer_size_ - written, prefix_size - m_served);
+                std::memcpy(buffer_ + written, m_prefix.data() + m_served, count);
+            }
+            else
+            {
+                size_t const data_position = chunk.data_begin + (m_served - prefix_size);
+                count = std::min(buffer_size_ - written, chunk.data_end - data_position);
+                std::memcpy(buffer_ + written, chunk.data.data() + data_position, count);
+            }
+
+            written += count;
+            m_served += count;
+        }
+
+        return written;
+    }
+
+    // Moves on to the output of the next chunk or falls back to zlib if the threads cannot provide it.
+    bool next_output()
+    {
+        if (m_end_of_stream)
+            return false;
+
+        if (m_continue_current)
+        {
+            // The rest of the current chunk is not decoded by the threads.
+            start_sequential();
+            return true;
+        }
+
+        if (m_current_job != nullptr)
+        {
+            submit(m_current_slot);
+            m_current_job = nullptr;
+        }
+
+        if (m_consumed == m_submitted)
+        {
+            if (m_consumed == 0)
+                return false;
+
+            throw io_error{"Unexpected end of the gzip compressed input."};
+        }
+
+        m_current_slot = m_consumed++ % m_jobs.size();
+        job & j = m_jobs[m_current_slot];
+
+        {
+            std::unique_lock<std::mutex> lock(j.mutex);
+            j.ready_event.wait(lock, [&j] { return j.ready; });
+        }
+
+        m_current_job = &j;
+        chunk_type & chunk = j.chunk;
+
+        if (!chunk.is_first && !(chunk.start_found &&
+                                 m_expected_state == state_type::block &&
+                                 chunk.start_bit == m_expected_bit))
+        {
+            start_sequential(); // the guessed block position is wrong
+            return true;
+        }
+
+        accept(chunk);
+        return true;
+    }
+
+    // Resolves the markers, verifies the checksums and determines where the next chunk has to start.
+    void accept(chunk_type & chunk)
+    {
+        if (chunk.end == end_type::invalid)
+            throw io_error{chunk.error_message};
+
+        // resolve markers
+        m_prefix.resize(chunk.marked_end - chunk.marked_begin);
+
+        for (size_t i = 0; i < m_prefix.size(); ++i)
+        {
+            uint16_t const symbol = chunk.marked[chunk.marked_begin + i];
+
+            if (symbol & parallel_gz_chunk_decoder::marker_flag)
+            {
+                size_t const distance = window_size - (symbol & ~parallel_gz_chunk_decoder::marker_flag);
+
+                if (distance > m_history.size())
+                    throw io_error{"Invalid deflate data in the gzip compressed input."};
+
+                m_prefix[i] = m_history[m_history.size() - distance];
+            }
+            else
+            {
+                m_prefix[i] = static_cast<char>(symbol);
+            }
+        }
+
+        verify_checksums(chunk);
+
+        // remember the last 32 KiB as window of the next chunk
+        append_history(m_prefix.data(), m_prefix.size());
+        append_history(chunk.data.data() + chunk.data_begin, chunk.data_end - chunk.data_begin);
+
+        m_served = 0;
+
+        size_t const chunk_bits = chunk.chunk_size * 8;
+
+        if (chunk.end == end_type::end_of_stream)
+        {
+            m_end_of_stream = true;
+        }
+        else if (chunk.end_bit >= chunk_bits && chunk.end != end_type::stored_block)
+        {
+            // The next chunk must have started its speculation at this position.
+            m_expected_bit = chunk.end_bit - chunk_bits;
+            m_expected_state = chunk.end_state;
+        }
+        else
+        {
+            // Exceeded output limit, stored block or a block that does not fit into the lookahead.
+            m_continue_current = true;
+            m_expected_bit = chunk.end_bit;
+            m_expected_state = chunk.end_state;
+        }
+    }
+
+    void verify_checksums(chunk_type const & chunk)
+    {
+        size_t const prefix_size = m_prefix.size();
+        size_t segment_begin = 0;
+
+        for (size_t i = 0; i < chunk.data_crcs.size(); ++i)
+        {
+            bool const is_member_end = (i < chunk.member_ends.size());
+            size_t const segment_end = is_member_end ? chunk.member_ends[i].position : chunk.output_size();
+
+            // the part of the segment in the resolved prefix
+            if (segment_begin < prefix_size)
+            {
+                size_t const prefix_end = std::min(segment_end, prefix_size);
+                m_member_crc = crc32(m_member_crc,
+                                     reinterpret_cast<Bytef const *>(m_prefix.data() + segment_begin),
+                                     static_cast<uInt>(prefix_end - segment_begin));
+            }
+
+            // the part of the segment in the data
+            size_t const data_length = segment_end - std::max(segment_begin, std::min(segment_end, prefix_size));
+            m_member_crc = crc32_combine(m_member_crc, chunk.data_crcs[i], static_cast<z_off_t>(data_length));
+            m_member_size += segment_end - segment_begin;
+
+            if (is_member_end)
+            {
+                verify_member(chunk.member_ends[i].crc, chunk.member_ends[i].size);
+                m_member_crc = crc32(0L, Z_NULL, 0);
+                m_member_size = 0;
+            }
+
+            segment_begin = segment_end;
+        }
+    }
+
+    void verify_member(uint32_t const crc, uint32_t const size) const
+    {
+        if (crc != static_cast<uint32_t>(m_member_crc) || size != static_cast<uint32_t>(m_member_size))
+            throw io_error{"The checksum of the gzip compressed input does not match."};
+    }
+
+    void append_history(char const * bytes, size_t const count)
+    {
+        if (count >= window_size)
+        {
+            m_history.assign(bytes + count - window_size, bytes + count);
+        }
+        else
+        {
+            m_history.insert(m_history.end(), bytes, bytes + count);
+
+            if (m_history.size() > window_size)
+                m_history.erase(m_history.begin(), m_history.end() - window_size);
+        }
+    }
+
+    // Stops the threads and continues with zlib at the expected position of the current chunk.
+    void start_sequential()
+    {
+        stop_threads();
+
+        // The rest of the input: the current chunk, the submitted chunks and the chunk that was read ahead.
+        auto take_chunk = [this] (chunk_type & chunk)
+        {
+            chunk.input.resize(chunk.chunk_size);
+            m_replay.push_back(std::move(chunk.input));
+        };
+
+        take_chunk(m_current_job->chunk);
+
+        for (size_t i = m_consumed; i < m_submitted; ++i)
+            take_chunk(m_jobs[i % m_jobs.size()].chunk);
+
+        m_replay.push_back(std::move(m_pending_input));
+        m_current_job = nullptr;
+        m_sequential = true;
+
+        for (size_t skip = m_expected_bit / 8; skip > 0;)
+        {
+            if (m_replay.empty())
+                throw io_error{"Unexpected end of the gzip compressed input."};
+
+            size_t const count = std::min(skip, m_replay.front().size());
+            m_replay.front().erase(m_replay.front().begin(), m_replay.front().begin() + count);
+            skip -= count;
+
+            if (m_replay.front().empty())
+                m_replay.pop_front();
+        }
+
+        m_zip_stream.zalloc = Z_NULL;
+        m_zip_stream.zfree = Z_NULL;
+        m_zip_stream.opaque = Z_NULL;
+        m_zip_stream.next_in = Z_NULL;
+        m_zip_stream.avail_in = 0;
+
+        if (m_expected_state == state_type::block)
+        {
+            // Raw deflate continuing the current member, which refers to the known window.
+            if (inflateInit2(&m_zip_stream, -MAX_WBITS) != Z_OK ||
+                inflateSetDictionary(&m_zip_stream,
+                                     reinterpret_cast<Bytef const *>(m_history.data()),
+                                     static_cast<uInt>(m_history.size())) != Z_OK)
+                throw io_error{"Could not initialise the gzip decompression."};
+
+            if (size_t const bit = m_expected_bit % 8; bit != 0)
+            {
+                if (!ensure_input(1))
+                    throw io_error{"Unexpected end of the gzip compressed input."};
+
+                inflatePrime(&m_zip_stream, static_cast<int>(8 - bit), *m_zip_stream.next_in >> bit);
+                ++m_zip_stream.next_in;
+                --m_zip_stream.avail_in;
+            }
+
+            m_sequential_state = sequential_state::raw_member;
+        }
+        else
+        {
+            if (inflateInit2(&m_zip_stream, MAX_WBITS + 16) != Z_OK)
+                throw io_error{"Could not initialise the gzip decompression."};
+
+            m_sequential_state = (m_expected_state == state_type::footer) ? sequential_state::footer
+                                                                          : sequential_state::header;
+        }
+    }
+
+    // Makes at least count bytes of the input available to zlib; returns false at the end of the input.
+    bool ensure_input(size_t const count)
+    {
+        while (m_zip_stream.avail_in < count)
+        {
+            std::vector<uint8_t> next{};
+
+            if (!m_replay.empty())
+            {
+                next = std::move(m_replay.front());
+                m_replay.pop_front();
+            }
+            else
+            {
+                next = read_chunk();
+
+                if (next.empty())
+                    return false;
+            }
+
+            // keep the bytes that were not consumed yet
+            next.insert(next.begin(), m_zip_stream.next_in, m_zip_stream.next_in + m_zip_stream.avail_in);
+            m_sequential_input = std::move(next);
+            m_zip_stream.next_in = m_sequential_input.data();
+            m_zip_stream.avail_in = static_cast<uInt>(m_sequential_input.size());
+        }
+
+        return true;
+    }
+
+    // Decompresses the rest of the input with zlib.
+    size_t inflate_sequential(char_type * buffer_, size_t const buffer_size_)
+    {
+        m_zip_stream.next_out = reinterpret_cast<Bytef *>(buffer_);
+        m_zip_stream.avail_out = static_cast<uInt>(buffer_size_);
+
+        while (m_zip_stream.avail_out > 0 && !m_end_of_stream)
+        {
+            if (m_sequential_state == sequential_state::header)
+            {
+                // Anything following a complete member that is not a gzip member is ignored, like zlib does.
+                ensure_input(2);
+
+                if (m_zip_stream.avail_in == 1 && m_zip_stream.next_in[0] == 0x1f)
+                    throw io_error{"Unexpected end of the gzip compressed input."};
+
+                if (m_zip_stream.avail_in < 2 || m_zip_stream.next_in[0] != 0x1f || m_zip_stream.next_in[1] != 0x8b)
+                {
+                    m_end_of_stream = true;
+                    break;
+                }
+
+                inflateReset2(&m_zip_stream, MAX_WBITS + 16);
+                m_sequential_state = sequential_state::gzip_member;
+            }
+            else if (m_sequential_state == sequential_state::footer)
+            {
+                if (!ensure_input(8))
+                    throw io_error{"Unexpected end of the gzip compressed input."};
+
+                Bytef const * footer = m_zip_stream.next_in;
+                verify_member(footer[0] | (footer[1] << 8) | (footer[2] << 16) | (uint32_t{footer[3]} << 24),
+                              footer[4] | (footer[5] << 8) | (footer[6] << 16) | (uint32_t{footer[7]} << 24));
+                m_zip_stream.next_in += 8;
+                m_zip_stream.avail_in -= 8;
+                m_sequential_state = sequential_state::header;
+            }
+            else
+            {
+                if (!ensure_input(1))
+                    throw io_error{"Unexpected end of the gzip compressed input."};
+
+                Bytef * const output = m_zip_stream.next_out;
+                int const result = inflate(&m_zip_stream, Z_NO_FLUSH);
+
+                if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)
+                    throw io_error{std::string{"Invalid deflate data in the gzip compressed input: "} +
+                                   (m_zip_stream.msg != Z_NULL ? m_zip_stream.msg : "unknown error")};
+
+                if (m_sequential_state == sequential_state::raw_member)
+                {
+                    size_t const count = m_zip_stream.next_out - output;
+                    m_member_crc = crc32(m_member_crc, output, static_cast<uInt>(count));
+                    m_member_size += count;
+                }
+
+                if (result == Z_STREAM_END)
+                {
+                    m_sequential_state = (m_sequential_state == sequential_state::raw_member)
+                                       ? sequential_state::footer
+                                       : sequential_state::header;
+                }
+            }
+        }
+
+        return buffer_size_ - m_zip_stream.avail_out;
+    }
+
+    istream_reference m_istream;
+    size_t m_chunk_size;
+
+    std::vector<job> m_jobs;
+    fixed_buffer_queue<size_t> m_todo_queue;
+    std::vector<std::thread> m_pool{};
+    std::atomic_bool m_cancelled{false};
+    std::vector<uint8_t> m_pending_input{};
+    size_t m_submitted{0};
+    size_t m_consumed{0};
+
+    // state of the reading thread
+    job * m_current_job{nullptr};
+    size_t m_current_slot{0};
+    size_t m_served{0};
+    bool m_continue_current{false};
+    bool m_end_of_stream{false};
+    size_t m_expected_bit{0};
+    state_type m_expected_state{state_type::header};
+    std::vector<char> m_prefix{};
+    std::vector<char> m_history{};
+    uLong m_member_crc{crc32(0L, Z_NULL, 0)};
+    size_t m_member_size{0};
+
+    // state of the zlib decompression after falling back
+    bool m_sequential{false};
+    sequential_state m_sequential_state{sequential_state::header};
+    z_stream m_zip_stream{};
+    std::deque<std::vector<uint8_t>> m_replay{};
+    std::vector<uint8_t> m_sequential_input{};
+
+    char_vector_type m_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istreambase
+// --------------------------------------------------------------------------
+// Base class for parallel gzip istreams
+// Contains a basic_parallel_gz_istreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_parallel_gz_istreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                                  istream_reference;
+    typedef basic_parallel_gz_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>    unzip_streambuf_type;
+
+    basic_parallel_gz_istreambase(istream_reference istream_,
+                                  size_t thread_count_,
+                                  size_t chunk_size_,
+                                  size_t read_buffer_size_) :
+        m_buf(istream_, thread_count_, chunk_size_, read_buffer_size_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying unzip istream object
+    unzip_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    unzip_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_parallel_gz_istream
+// --------------------------------------------------------------------------
+// A gzip decompression istream using several threads
+//
+// This class is a istream decorator that behaves 'almost' like any other istream.
+// At construction, it takes any istream that shall be used to input of the compressed data.
+// In contrast to basic_bgzf_istream, the input can be any gzip file, but the decompression does not scale as well,
+// since the reading thread needs to resolve references across the chunk borders.
+//
+// Simple example:
+//
+// // create a stream on a gzip compressed file
+// std::ifstream file_stream{"reads.fq.gz", std::ios::binary};
+// // create the decompressing istream using 8 threads
+// parallel_gz_istream decompressor{file_stream, 8};
+// // read the decompressed data
+// std::string line;
+// std::getline(decompressor, line);
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_parallel_gz_istream :
+    public basic_parallel_gz_istreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_istream<Elem, Tr>
+{
+public:
+    typedef basic_parallel_gz_istreambase<Elem, Tr, ElemA, ByteT, ByteAT> unzip_istreambase_type;
+    typedef std::basic_istream<Elem, Tr>                                   istream_type;
+    typedef istream_type &                                                 istream_reference;
+    typedef ByteT                                                          byte_type;
+    typedef Tr                                                             traits_type;
+
+    // Construct a decompressing stream
+    //
+    // istream_ input buffer
+    // thread_count_ the number of decompression threads
+    // chunk_size_ the size of the compressed chunks decompressed by one thread
+    // read_buffer_size_ the size of the buffer for the decompressed data
+
+    basic_parallel_gz_istream(istream_reference istream_,
+                              size_t thread_count_ = parallel_gz_thread_count,
+                              size_t chunk_size_ = PARALLEL_GZ_DEFAULT_CHUNK_SIZE,
+                              size_t read_buffer_size_ = PARALLEL_GZ_INPUT_DEFAULT_BUFFER_SIZE) :
+        unzip_istreambase_type(istream_, thread_count_, chunk_size_, read_buffer_size_),
+        istream_type(this->rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_parallel_gz_istream<char>
+typedef basic_parallel_gz_istream<char> parallel_gz_istream;
+
+} // namespace seqan3::contrib
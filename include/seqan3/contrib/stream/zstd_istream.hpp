@@ -0,0 +1,563 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <zstd.h>
+
+namespace seqan3::contrib
+{
+
+// Default zstd buffer size, change this to suite your needs.
+const size_t ZSTD_INPUT_DEFAULT_BUFFER_SIZE = 921600;
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that takes zstd compressed input and decompresses it to a istream.
+// Concatenated frames and skippable frames are handled transparently. In particular, files written in the
+// seekable zstd format (see basic_zstd_ostream) can be read sequentially, because their seek table is stored in a
+// skippable frame.
+//
+// The stream can be positioned at any uncompressed position with seekg if the compressed istream supports seeking.
+// If the input is in the seekable zstd format, the seek table is read on the first seek and decompression starts at
+// the frame containing the position. Otherwise, the input is decompressed from the current position or, for
+// positions before it, from the beginning. tellg always reports the uncompressed position.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &              istream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef byte_type *                                 byte_buffer_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef typename Tr::pos_type                       pos_type;
+    typedef typename Tr::off_type                       off_type;
+    typedef std::vector<byte_type, byte_allocator_type> byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    // Construct a decompression stream buffer reading the compressed data from istream_.
+    basic_zstd_istreambuf(istream_reference istream_,
+                          size_t read_buffer_size_,
+                          size_t input_buffer_size_);
+
+    ~basic_zstd_istreambuf();
+
+    int_type underflow();
+
+    pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode);
+    pos_type seekpos(pos_type, std::ios_base::openmode);
+
+    // returns the compressed input istream
+    istream_reference get_istream()  { return m_istream; }
+    // returns the zstd decompression context
+    ZSTD_DStream * get_zstd_stream() { return m_zstd_stream; }
+
+private:
+    std::streamsize decompress_from_stream(char_type *, std::streamsize);
+    size_t fill_input_buffer();
+    pos_type seek_to(uint64_t);
+    bool read_seek_table();
+
+    istream_reference m_istream;
+    ZSTD_DStream * m_zstd_stream;
+    ZSTD_inBuffer m_input;
+    // the hint returned by the last decompression call; 0 if the last frame was completely decoded.
+    size_t m_frame_remainder;
+    // the position of the compressed data in m_istream; -1 if m_istream cannot seek.
+    pos_type m_istream_begin;
+    // the uncompressed position of egptr in characters.
+    uint64_t m_position;
+    // whether the seek table was searched for.
+    bool m_seek_table_read;
+    // the compressed and uncompressed offset in bytes of every frame of the seek table and of the end of the data;
+    // empty if the input is not in the seekable format.
+    std::vector<std::pair<uint64_t, uint64_t>> m_frame_offsets;
+    byte_vector_type m_input_buffer;
+    char_vector_type m_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambuf implementation
+// --------------------------------------------------------------------------
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::basic_zstd_istreambuf(
+    istream_reference istream_,
+    size_t read_buffer_size_,
+    size_t input_buffer_size_
+    ) :
+    m_istream(istream_),
+    m_zstd_stream(ZSTD_createDStream()),
+    m_input{nullptr, 0, 0},
+    m_frame_remainder(0),
+    m_istream_begin(istream_.tellg()),
+    m_position(0),
+    m_seek_table_read(false),
+    m_input_buffer(input_buffer_size_),
+    m_buffer(read_buffer_size_)
+{
+    if (m_zstd_stream == nullptr)
+        throw std::bad_alloc{};
+
+    ZSTD_initDStream(m_zstd_stream);
+
+    this->setg(&(m_buffer[0]) + 4,  // beginning of putback area
+               &(m_buffer[0]) + 4,  // read position
+               &(m_buffer[0]) + 4); // end position
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::~basic_zstd_istreambuf()
+{
+    ZSTD_freeDStream(m_zstd_stream);
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::int_type
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::underflow()
+{
+    if (this->gptr() && (this->gptr() < this->egptr()))
+        return *reinterpret_cast<unsigned char *>(this->gptr());
+
+    int n_putback = static_cast<int>(this->gptr() - this->eback());
+    if (n_putback > 4)
+        n_putback = 4;
+
+    std::memmove(&(m_buffer[0]) + (4 - n_putback), this->gptr() - n_putback, n_putback * sizeof(char_type));
+
+    std::streamsize num = decompress_from_stream(&(m_buffer[0]) + 4,
+                                                 static_cast<std::streamsize>(m_buffer.size() - 4));
+
+    if (num <= 0)     // EOF
+        return traits_type::eof();
+
+    m_position += num;
+
+    // reset buffer pointers
+    this->setg(&(m_buffer[0]) + (4 - n_putback),         // beginning of putback area
+               &(m_buffer[0]) + 4,                       // read position
+               &(m_buffer[0]) + 4 + num);                // end of buffer
+
+    // return next character
+    return *reinterpret_cast<unsigned char *>(this->gptr());
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::pos_type
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::seekoff(off_type off_,
+                                                               std::ios_base::seekdir dir_,
+                                                               std::ios_base::openmode which_)
+{
+    if (!(which_ & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+    uint64_t const current = m_position - (this->egptr() - this->gptr());
+    int64_t target{};
+
+    if (dir_ == std::ios_base::beg)
+    {
+        target = off_;
+    }
+    else if (dir_ == std::ios_base::cur)
+    {
+        if (off_ == 0) // tellg
+            return pos_type(off_type(current));
+
+        target = static_cast<int64_t>(current) + off_;
+    }
+    else // The uncompressed size is only known from the seek table.
+    {
+        if (!read_seek_table())
+            return pos_type(off_type(-1));
+
+        target = static_cast<int64_t>(m_frame_offsets.back().second / sizeof(char_type)) + off_;
+    }
+
+    if (target < 0)
+        return pos_type(off_type(-1));
+
+    return seek_to(static_cast<uint64_t>(target));
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::pos_type
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::seekpos(pos_type pos_, std::ios_base::openmode which_)
+{
+    return seekoff(off_type(pos_), std::ios_base::beg, which_);
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::pos_type
+basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::seek_to(uint64_t target_)
+{
+    char_type * const buffer_begin = &(m_buffer[0]) + 4;
+    uint64_t const buffer_position = m_position - (this->egptr() - buffer_begin);
+
+    // The target is in the decompressed buffer.
+    if (target_ >= buffer_position && target_ <= m_position)
+    {
+        this->setg(this->eback(), buffer_begin + (target_ - buffer_position), this->egptr());
+        return pos_type(off_type(target_));
+    }
+
+    // Restart at the frame containing the target if it is not ahead in the current frame, or at the beginning.
+    uint64_t frame_compressed{0};
+    uint64_t frame_decompressed{0};
+    bool restart = target_ < m_position;
+
+    if (read_seek_table())
+    {
+        if (target_ * sizeof(char_type) > m_frame_offsets.back().second)
+            return pos_type(off_type(-1));
+
+        auto frame = std::prev(std::upper_bound(m_frame_offsets.begin(), m_frame_offsets.end(),
+                                                target_ * sizeof(char_type),
+                                                [] (uint64_t const value, auto const & offsets)
+                                                {
+                                                    return value < offsets.second;
+                                                }));
+
+        while (frame->second % sizeof(char_type) != 0) // frames of wide characters may start within a character
+            --frame;
+
+        std::tie(frame_compressed, frame_decompressed) = *frame;
+        restart = restart || frame_decompressed / sizeof(char_type) > m_position;
+    }
+
+    if (restart)
+    {
+        if (m_istream_begin == pos_type(off_type(-1)))
+            return pos_type(off_type(-1));
+
+        m_istream.clear();
+
+        if (!m_istream.seekg(m_istream_begin + off_type(frame_compressed)))
+            return pos_type(off_type(-1));
+
+        ZSTD_DCtx_reset(m_zstd_stream, ZSTD_reset_session_only);
+        m_input = ZSTD_inBuffer{nullptr, 0, 0};
+        m_frame_remainder = 0;
+        m_position = frame_decompressed / sizeof(char_type);
+        this->setg(buffer_begin, buffer_begin, buffer_begin);
+    }
+
+    // Decompress up to the target.
+    while (m_position < target_)
+    {
+        std::streamsize const num = decompress_from_stream(buffer_begin,
+                                                           static_cast<std::streamsize>(m_buffer.size() - 4));
+
+        if (num <= 0) // the target is behind the end of the input
+        {
+            this->setg(buffer_begin, buffer_begin, buffer_begin);
+            return pos_type(off_type(-1));
+        }
+
+        uint64_t const skipped = std::min<uint64_t>(num, target_ - m_position);
+        m_position += num;
+        this->setg(buffer_begin, buffer_begin + skipped, buffer_begin + num);
+    }
+
+    return pos_type(off_type(target_));
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+bool basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::read_seek_table()
+{
+    if (m_seek_table_read)
+        return !m_frame_offsets.empty();
+
+    m_seek_table_read = true;
+
+    // The seek table is read byte-wise from the end of the input, see basic_zstd_ostreambuf::write_seek_table.
+    if constexpr (sizeof(char_type) == 1)
+    {
+        if (m_istream_begin == pos_type(off_type(-1)))
+            return false;
+
+        auto & input = *m_istream.rdbuf();
+        pos_type const current = input.pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+        pos_type const end = input.pubseekoff(0, std::ios_base::end, std::ios_base::in);
+
+        // Reads a little endian 32 bit value at the given position.
+        auto read_uint32 = [&input] (pos_type const position, uint32_t & value)
+        {
+            char_type bytes[4];
+
+            if (input.pubseekpos(position, std::ios_base::in) != position || input.sgetn(bytes, 4) != 4)
+                return false;
+
+            value = 0;
+            for (size_t i = 0; i < 4; ++i)
+                value |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+
+            return true;
+        };
+
+        std::vector<std::pair<uint64_t, uint64_t>> offsets{{0, 0}};
+        uint32_t frame_count{};
+        uint32_t value{};
+        bool valid = current != pos_type(off_type(-1)) && end - m_istream_begin >= 17 &&
+                     read_uint32(end - off_type(4), value) && value == 0x8F92EAB1u &&
+                     read_uint32(end - off_type(9), frame_count);
+
+        if (valid)
+        {
+            char_type descriptor{};
+            input.pubseekpos(end - off_type(5), std::ios_base::in);
+            valid = input.sgetn(&descriptor, 1) == 1 && (static_cast<unsigned char>(descriptor) & 0x7C) == 0;
+
+            // Every entry stores the compressed and decompressed size and optionally a checksum.
+            off_type const entry_size = (static_cast<unsigned char>(descriptor) & 0x80) ? 12 : 8;
+            off_type const table_size = frame_count * entry_size + 9;
+            pos_type const table_begin = end - table_size - off_type(8);
+
+            valid = valid && table_begin - m_istream_begin >= 0 &&
+                    read_uint32(table_begin, value) && (value & 0xFFFFFFF0u) == 0x184D2A50u &&
+                    read_uint32(table_begin + off_type(4), value) && value == table_size;
+
+            for (uint32_t i = 0; valid && i < frame_count; ++i)
+            {
+                uint32_t compressed_size{};
+                uint32_t decompressed_size{};
+                pos_type const entry = table_begin + off_type(8 + i * entry_size);
+
+                valid = read_uint32(entry, compressed_size) && read_uint32(entry + off_type(4), decompressed_size);
+                offsets.emplace_back(offsets.back().first + compressed_size,
+                                     offsets.back().second + decompressed_size);
+            }
+
+            // The frames must cover the data before the seek table.
+            valid = valid && offsets.back().first == static_cast<uint64_t>(table_begin - m_istream_begin);
+        }
+
+        if (current != pos_type(off_type(-1)))
+            input.pubseekpos(current, std::ios_base::in);
+
+        if (valid)
+            m_frame_offsets = std::move(offsets);
+    }
+
+    return !m_frame_offsets.empty();
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+std::streamsize basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::decompress_from_stream(
+    char_type * buffer_,
+    std::streamsize buffer_size_)
+{
+    ZSTD_outBuffer output{buffer_, static_cast<size_t>(buffer_size_) * sizeof(char_type), 0};
+
+    while (output.pos < output.size)
+    {
+        bool const input_exhausted = (m_input.pos == m_input.size) && (fill_input_buffer() == 0);
+        size_t const input_pos = m_input.pos;
+        size_t const output_pos = output.pos;
+
+        // Called even without new input to flush the data buffered inside of the decompression context.
+        size_t const result = ZSTD_decompressStream(m_zstd_stream, &output, &m_input);
+
+        if (ZSTD_isError(result))
+            throw std::ios_base::failure{std::string{"Error while decompressing zstd input: "} +
+                                         ZSTD_getErrorName(result)};
+
+        if (m_input.pos != input_pos || output.pos != output_pos)
+        {
+            m_frame_remainder = result;
+        }
+        else
+        {
+            // A truncated frame is an error, but the already decompressed data is returned first.
+            if (input_exhausted && m_frame_remainder != 0 && output.pos == 0)
+                throw std::ios_base::failure{"Unexpected end of the zstd compressed input."};
+
+            break;
+        }
+    }
+
+    if (output.pos % sizeof(char_type) != 0)
+        throw std::ios_base::failure{"The zstd compressed input does not decompress to complete characters."};
+
+    return static_cast<std::streamsize>(output.pos / sizeof(char_type));
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+size_t basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::fill_input_buffer()
+{
+    m_istream.read(reinterpret_cast<char_type *>(&(m_input_buffer[0])),
+                   static_cast<std::streamsize>(m_input_buffer.size() / sizeof(char_type)));
+
+    m_input.src = &(m_input_buffer[0]);
+    m_input.size = m_istream.gcount() * sizeof(char_type);
+    m_input.pos = 0;
+
+    return m_input.size;
+}
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istreambase
+// --------------------------------------------------------------------------
+// Base class for zstd istreams
+// Contains a basic_zstd_istreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_istream<Elem, Tr> &                          istream_reference;
+    typedef basic_zstd_istreambuf<Elem, Tr, ElemA, ByteT, ByteAT>   zstd_streambuf_type;
+
+    basic_zstd_istreambase(istream_reference istream_,
+                           size_t read_buffer_size_,
+                           size_t input_buffer_size_) :
+        m_buf(istream_, read_buffer_size_, input_buffer_size_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying zstd istream buffer
+    zstd_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_istream
+// --------------------------------------------------------------------------
+// A zstd decompression istream
+//
+// This class is a istream decorator that behaves 'almost' like any other istream.
+// At construction, it takes any istream that shall be used to input the compressed data.
+//
+// Simple example:
+//
+// // create a stream on a zstd compressed file
+// std::ifstream file_stream{"reads.fq.zst", std::ios::binary};
+// // create the decompressing istream
+// zstd_istream decompressor{file_stream};
+// // read the decompressed data
+// std::string line;
+// std::getline(decompressor, line);
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_istream :
+    public basic_zstd_istreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_istream<Elem, Tr>
+{
+public:
+    typedef basic_zstd_istreambase<Elem, Tr, ElemA, ByteT, ByteAT> zstd_istreambase_type;
+    typedef std::basic_istream<Elem, Tr>                            istream_type;
+    typedef istream_type &                                          istream_reference;
+    typedef ByteT                                                   byte_type;
+    typedef Tr                                                      traits_type;
+
+    // Construct a decompressing stream
+    //
+    // istream_ input buffer
+    // read_buffer_size_ the size of the buffer for the decompressed data
+    // input_buffer_size_ the size of the buffer for the compressed data
+
+    basic_zstd_istream(istream_reference istream_,
+                       size_t read_buffer_size_ = ZSTD_INPUT_DEFAULT_BUFFER_SIZE,
+                       size_t input_buffer_size_ = ZSTD_INPUT_DEFAULT_BUFFER_SIZE) :
+        zstd_istreambase_type(istream_, read_buffer_size_, input_buffer_size_),
+        istream_type(this->rdbuf())
+    {}
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_zstd_istream<char>
+typedef basic_zstd_istream<char>     zstd_istream;
+// A typedef for basic_zstd_istream<wchar_t>
+typedef basic_zstd_istream<wchar_t>  zstd_wistream;
+
+} // namespace seqan3::contrib
@@ -0,0 +1,575 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::contrib::basic_zstd_ostream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef SEQAN3_HAS_ZSTD
+#error "This file cannot be used when building without ZSTD-support."
+#endif
+
+#include <zstd.h>
+
+namespace seqan3::contrib
+{
+
+/*!\brief A static variable indicating the number of threads to use for the zstd-streams.
+ *       Defaults to std::thread::hardware_concurrency.
+ */
+inline static uint64_t zstd_thread_count = std::thread::hardware_concurrency();
+
+// Default zstd buffer size, change this to suite your needs.
+const size_t ZSTD_OUTPUT_DEFAULT_BUFFER_SIZE = 921600;
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf
+// --------------------------------------------------------------------------
+// A stream decorator that takes raw input and compresses it with zstd to a ostream.
+//
+// If the library was built with multi-threading support, the compression is distributed over thread_count_ worker
+// threads. Otherwise the compression silently falls back to a single thread.
+//
+// If frame_size_ is not 0, the output is written in the seekable zstd format: a new frame is started after every
+// frame_size_ uncompressed bytes and a seek table listing the compressed and decompressed size of every frame is
+// appended in a skippable frame. Such files remain valid zstd files and can be decompressed by any zstd decoder;
+// basic_zstd_istream uses the seek table to seek without decompressing the preceding frames.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostreambuf :
+    public std::basic_streambuf<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &              ostream_reference;
+    typedef ElemA                                       char_allocator_type;
+    typedef ByteT                                       byte_type;
+    typedef ByteAT                                      byte_allocator_type;
+    typedef byte_type *                                 byte_buffer_type;
+    typedef Tr                                          traits_type;
+    typedef typename Tr::char_type                      char_type;
+    typedef typename Tr::int_type                       int_type;
+    typedef std::vector<byte_type, byte_allocator_type> byte_vector_type;
+    typedef std::vector<char_type, char_allocator_type> char_vector_type;
+
+    // Construct a compression stream buffer writing the compressed data to ostream_.
+    basic_zstd_ostreambuf(ostream_reference ostream_,
+                          int level_,
+                          size_t thread_count_,
+                          size_t frame_size_,
+                          size_t buffer_size_);
+
+    ~basic_zstd_ostreambuf();
+
+    int sync();
+    int_type overflow(int_type c);
+
+    // flushes the zstd buffer and output buffer without ending the current frame.
+    // Calling flush multiple times, will lower the compression ratio.
+    std::streamsize flush();
+
+    // flushes the zstd buffer and output buffer, ends the current frame and writes the seek table if requested.
+    // This method should be called at the end of the compression. Further calls have no effect.
+    std::streamsize flush_finalize();
+
+    // sets the uncompressed frame size of the seekable format; 0 continues the current frame until the end.
+    // A frame that was already started is ended first, so the new size applies to the next frame.
+    void frame_size(size_t frame_size_);
+    // returns the uncompressed frame size of the seekable format
+    size_t frame_size() const { return m_frame_size; }
+
+    // returns the compressed output ostream
+    ostream_reference get_ostream() { return m_ostream; }
+    // returns the zstd compression context
+    ZSTD_CCtx * get_zstd_stream() { return m_zstd_stream; }
+
+private:
+    bool compress_to_stream(char_type const *, std::streamsize, ZSTD_EndDirective);
+    bool compress_chunk(byte_type const *, size_t, ZSTD_EndDirective);
+    bool end_frame();
+    void write_seek_table();
+    void write_output(size_t);
+
+    ostream_reference m_ostream;
+    ZSTD_CCtx * m_zstd_stream;
+    // uncompressed size of a frame in the seekable format; 0 if no new frames are started.
+    size_t m_frame_size;
+    // whether a frame size was ever set, i.e. whether the seek table is written.
+    bool m_seekable;
+    // uncompressed and compressed number of bytes of the current frame.
+    size_t m_frame_decompressed_size;
+    size_t m_frame_compressed_size;
+    // pairs of compressed and decompressed size of every completed frame.
+    std::vector<std::pair<size_t, size_t>> m_seek_table;
+    bool m_finalized;
+    // number of compressed bytes at the beginning of m_output_buffer that do not form a complete char_type.
+    size_t m_output_remainder;
+    byte_vector_type m_output_buffer;
+    char_vector_type m_buffer;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambuf implementation
+// --------------------------------------------------------------------------
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::basic_zstd_ostreambuf(
+    ostream_reference ostream_,
+    int level_,
+    size_t thread_count_,
+    size_t frame_size_,
+    size_t buffer_size_
+    ) :
+    m_ostream(ostream_),
+    m_zstd_stream(ZSTD_createCCtx()),
+    // Every frame size must be representable in the 32 bit entries of the seek table.
+    m_frame_size(std::min<size_t>(frame_size_, std::numeric_limits<uint32_t>::max() / 2)),
+    m_seekable(m_frame_size != 0),
+    m_frame_decompressed_size(0),
+    m_frame_compressed_size(0),
+    m_finalized(false),
+    m_output_remainder(0),
+    m_output_buffer(std::max<size_t>(buffer_size_, ZSTD_CStreamOutSize()), 0),
+    m_buffer(buffer_size_, 0)
+{
+    if (m_zstd_stream == nullptr)
+        throw std::bad_alloc{};
+
+    level_ = std::clamp(level_, ZSTD_minCLevel(), ZSTD_maxCLevel());
+    ZSTD_CCtx_setParameter(m_zstd_stream, ZSTD_c_compressionLevel, level_);
+    ZSTD_CCtx_setParameter(m_zstd_stream, ZSTD_c_checksumFlag, 1);
+
+    // Fails if libzstd was built without multi-threading support, in which case a single thread is used.
+    if (thread_count_ > 1)
+        ZSTD_CCtx_setParameter(m_zstd_stream, ZSTD_c_nbWorkers, static_cast<int>(thread_count_));
+
+    this->setp(&(m_buffer[0]), &(m_buffer[m_buffer.size() - 1]));
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::~basic_zstd_ostreambuf()
+{
+    flush_finalize();
+    m_ostream.flush();
+    ZSTD_freeCCtx(m_zstd_stream);
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+int basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::sync()
+{
+    if (this->pptr() && this->pptr() > this->pbase())
+    {
+        if (traits_type::eq_int_type(overflow(traits_type::eof()), traits_type::eof()))
+            return -1;
+    }
+
+    return 0;
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+typename basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::int_type
+basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::overflow(
+    typename basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::int_type c)
+{
+    int w = static_cast<int>(this->pptr() - this->pbase());
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *this->pptr() = c;
+        ++w;
+    }
+
+    if (compress_to_stream(this->pbase(), w, ZSTD_e_continue))
+    {
+        this->setp(this->pbase(), this->epptr());
+        return traits_type::eq_int_type(c, traits_type::eof()) ? traits_type::not_eof(c) : c;
+    }
+    else
+    {
+        return traits_type::eof();
+    }
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+void basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::frame_size(size_t frame_size_)
+{
+    if (m_finalized)
+        return;
+
+    // The buffered data still belongs to the current frame.
+    if (sync() != 0 || (m_frame_decompressed_size != 0 && !end_frame()))
+        throw std::ios_base::failure{"Error while compressing zstd output."};
+
+    m_frame_size = std::min<size_t>(frame_size_, std::numeric_limits<uint32_t>::max() / 2);
+    m_seekable = m_seekable || m_frame_size != 0;
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+bool basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::compress_to_stream(
+    char_type const * buffer_,
+    std::streamsize buffer_size_,
+    ZSTD_EndDirective directive_)
+{
+    byte_type const * input = reinterpret_cast<byte_type const *>(buffer_);
+    size_t input_size = static_cast<size_t>(buffer_size_) * sizeof(char_type);
+
+    // Split the input at the frame boundaries of the seekable format.
+    while (m_frame_size != 0 && input_size >= m_frame_size - m_frame_decompressed_size)
+    {
+        size_t const chunk_size = m_frame_size - m_frame_decompressed_size;
+
+        if (!compress_chunk(input, chunk_size, ZSTD_e_continue))
+            return false;
+
+        m_frame_decompressed_size += chunk_size;
+        input += chunk_size;
+        input_size -= chunk_size;
+
+        if (!end_frame())
+            return false;
+    }
+
+    m_frame_decompressed_size += input_size;
+    return compress_chunk(input, input_size, directive_);
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+bool basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::compress_chunk(
+    byte_type const * buffer_,
+    size_t buffer_size_,
+    ZSTD_EndDirective directive_)
+{
+    ZSTD_inBuffer input{buffer_, buffer_size_, 0};
+    bool finished = false;
+
+    do
+    {
+        ZSTD_outBuffer output{&(m_output_buffer[0]) + m_output_remainder,
+                              m_output_buffer.size() - m_output_remainder,
+                              0};
+
+        size_t const remaining = ZSTD_compressStream2(m_zstd_stream, &output, &input, directive_);
+
+        if (ZSTD_isError(remaining))
+            return false;
+
+        m_frame_compressed_size += output.pos;
+        write_output(m_output_remainder + output.pos);
+
+        // ZSTD_e_continue only guarantees to consume the input, flushing and ending must empty the internal buffers.
+        finished = (directive_ == ZSTD_e_continue) ? (input.pos == input.size) : (remaining == 0);
+    }
+    while (!finished);
+
+    return true;
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+void basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::write_output(size_t byte_count_)
+{
+    m_ostream.write(reinterpret_cast<char_type const *>(&(m_output_buffer[0])),
+                    static_cast<std::streamsize>(byte_count_ / sizeof(char_type)));
+
+    // checking if some bytes were not written.
+    if ((m_output_remainder = byte_count_ % sizeof(char_type)) != 0)
+    {
+        // copy to the beginning of the stream
+        std::memmove(&(m_output_buffer[0]),
+                     &(m_output_buffer[byte_count_ - m_output_remainder]),
+                     m_output_remainder);
+    }
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+bool basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::end_frame()
+{
+    if (!compress_chunk(nullptr, 0, ZSTD_e_end))
+        return false;
+
+    m_seek_table.emplace_back(m_frame_compressed_size, m_frame_decompressed_size);
+    m_frame_compressed_size = 0;
+    m_frame_decompressed_size = 0;
+
+    return true;
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+void basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::write_seek_table()
+{
+    // The seek table is a skippable frame:
+    // [magic | frame size | (compressed size, decompressed size) per frame | number of frames | descriptor | magic]
+    // All integers are stored as 32 bit little endian values.
+    constexpr uint32_t skippable_magic_number = 0x184D2A5E;
+    constexpr uint32_t seekable_magic_number = 0x8F92EAB1;
+    constexpr size_t max_size = std::numeric_limits<uint32_t>::max();
+
+    // A frame that was written before the frame size was set may be too large for the table; the file stays valid.
+    for (auto const & [compressed_size, decompressed_size] : m_seek_table)
+        if (compressed_size > max_size || decompressed_size > max_size)
+            return;
+
+    std::vector<byte_type> table{};
+    auto append = [&table] (uint32_t const value)
+    {
+        for (size_t shift = 0; shift < 32; shift += 8)
+            table.push_back(static_cast<byte_type>((value >> shift) & 0xFF));
+    };
+
+    append(skippable_magic_number);
+    append(static_cast<uint32_t>(m_seek_table.size() * 8 + 9));
+
+    for (auto const & [compressed_size, decompressed_size] : m_seek_table)
+    {
+        append(static_cast<uint32_t>(compressed_size));
+        append(static_cast<uint32_t>(decompressed_size));
+    }
+
+    append(static_cast<uint32_t>(m_seek_table.size()));
+    table.push_back(0); // descriptor: the entries carry no checksums
+    append(seekable_magic_number);
+
+    for (size_t pos = 0; pos < table.size();)
+    {
+        size_t const count = std::min(table.size() - pos, m_output_buffer.size() - m_output_remainder);
+        std::memcpy(&(m_output_buffer[0]) + m_output_remainder, &(table[pos]), count);
+        write_output(m_output_remainder + count);
+        pos += count;
+    }
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+std::streamsize basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::flush()
+{
+    std::streamsize const buffer_size = static_cast<std::streamsize>(this->pptr() - this->pbase());
+
+    if (!m_finalized && compress_to_stream(this->pbase(), buffer_size, ZSTD_e_flush))
+        this->setp(this->pbase(), this->epptr());
+
+    m_ostream.flush();
+
+    return buffer_size;
+}
+
+template <typename Elem,
+          typename Tr,
+          typename ElemA,
+          typename ByteT,
+          typename ByteAT>
+std::streamsize basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>::flush_finalize()
+{
+    std::streamsize const buffer_size = static_cast<std::streamsize>(this->pptr() - this->pbase());
+
+    if (m_finalized)
+        return 0;
+
+    m_finalized = true;
+
+    if (compress_to_stream(this->pbase(), buffer_size, ZSTD_e_continue))
+    {
+        this->setp(this->pbase(), this->epptr());
+
+        // In the seekable format the last frame was already closed if it ended exactly at a frame boundary.
+        // An empty stream still gets one (empty) frame to be a valid zstd file.
+        if (m_frame_size == 0 || m_frame_decompressed_size != 0 || m_seek_table.empty())
+            end_frame();
+
+        if (m_seekable)
+            write_seek_table();
+    }
+
+    m_ostream.flush();
+
+    return buffer_size;
+}
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostreambase
+// --------------------------------------------------------------------------
+// Base class for zstd ostreams.
+// Contains a basic_zstd_ostreambuf.
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostreambase :
+    virtual public std::basic_ios<Elem, Tr>
+{
+public:
+    typedef std::basic_ostream<Elem, Tr> &                          ostream_reference;
+    typedef basic_zstd_ostreambuf<Elem, Tr, ElemA, ByteT, ByteAT>   zstd_streambuf_type;
+
+    basic_zstd_ostreambase(ostream_reference ostream_,
+                           int level_,
+                           size_t thread_count_,
+                           size_t frame_size_,
+                           size_t buffer_size_) :
+        m_buf(ostream_, level_, thread_count_, frame_size_, buffer_size_)
+    {
+        this->init(&m_buf);
+    }
+
+    // returns the underlying zstd ostream buffer
+    zstd_streambuf_type * rdbuf() { return &m_buf; }
+
+private:
+    zstd_streambuf_type m_buf;
+};
+
+// --------------------------------------------------------------------------
+// Class basic_zstd_ostream
+// --------------------------------------------------------------------------
+// A zstd compression ostream
+//
+// This class is a ostream decorator that behaves 'almost' like any other ostream.
+// At construction, it takes any ostream that shall be used to output of the compressed data.
+// When finished, you need to call the special method rdbuf()->flush_finalize() or call the destructor
+// to flush all the intermediate streams.
+//
+// Example:
+//
+// // creating the target file
+// std::ofstream file_stream{"reads.fq.zst", std::ios::binary};
+// // creating the compression layer, using 4 threads and a new seekable frame every MiB
+// zstd_ostream compressor{file_stream, 3, 4, 1024 * 1024};
+// // writing data
+// compressor << "@read1\nACGT\n+\n!!!!\n";
+
+template <typename Elem,
+          typename Tr = std::char_traits<Elem>,
+          typename ElemA = std::allocator<Elem>,
+          typename ByteT = unsigned char,
+          typename ByteAT = std::allocator<ByteT>
+          >
+class basic_zstd_ostream :
+    public basic_zstd_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT>,
+    public std::basic_ostream<Elem, Tr>
+{
+public:
+    typedef basic_zstd_ostreambase<Elem, Tr, ElemA, ByteT, ByteAT> zstd_ostreambase_type;
+    typedef std::basic_ostream<Elem, Tr>                            ostream_type;
+    typedef ostream_type &                                          ostream_reference;
+
+    // Constructs a compressing ostream decorator
+    //
+    // ostream_ ostream where the compressed output is written
+    // level_ level of compression, see the zstd documentation
+    // thread_count_ number of compression threads, values smaller than 2 compress in the calling thread
+    // frame_size_ uncompressed size of a frame in the seekable format, 0 writes a single regular frame
+    // buffer_size_ the buffer size used to compress data
+
+    basic_zstd_ostream(ostream_reference ostream_,
+                       int level_ = ZSTD_CLEVEL_DEFAULT,
+                       size_t thread_count_ = zstd_thread_count,
+                       size_t frame_size_ = 0,
+                       size_t buffer_size_ = ZSTD_OUTPUT_DEFAULT_BUFFER_SIZE) :
+        zstd_ostreambase_type(ostream_, level_, thread_count_, frame_size_, buffer_size_),
+        ostream_type(this->rdbuf())
+    {}
+
+    ~basic_zstd_ostream()
+    {
+        ostream_type::flush(); this->rdbuf()->flush_finalize();
+    }
+
+    // sets the uncompressed frame size of the seekable format, see basic_zstd_ostreambuf::frame_size
+    void frame_size(size_t frame_size_)
+    {
+        ostream_type::flush(); this->rdbuf()->frame_size(frame_size_);
+    }
+
+    // returns the uncompressed frame size of the seekable format
+    size_t frame_size()
+    {
+        return this->rdbuf()->frame_size();
+    }
+
+    // flush inner buffer and zstd buffer
+    basic_zstd_ostream<Elem, Tr> & flush()
+    {
+        ostream_type::flush(); this->rdbuf()->flush(); return *this;
+    }
+
+#ifdef _WIN32
+private:
+    void _Add_vtordisp1() {}  // Required to avoid VC++ warning C4250
+    void _Add_vtordisp2() {}  // Required to avoid VC++ warning C4250
+#endif
+};
+
+// ===========================================================================
+// Typedefs
+// ===========================================================================
+
+// A typedef for basic_zstd_ostream<char>
+typedef basic_zstd_ostream<char>     zstd_ostream;
+// A typedef for basic_zstd_ostream<wchar_t>
+typedef basic_zstd_ostream<wchar_t>  zstd_wostream;
+
+} // namespace seqan3::contrib
@@ -31,6 +31,9 @@
  * BLAST format (e.g. seqan3::field::bit_score). Please see the corresponding formats for more details.
  */
 
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -40,4 +43,5 @@
 #include <seqan3/io/alignment_file/output.hpp>
 #include <seqan3/io/alignment_file/output_format_concept.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
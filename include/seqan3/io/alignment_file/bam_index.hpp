@@ -0,0 +1,906 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index and seqan3::detail::bam_index_builder.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef SEQAN3_HAS_ZLIB
+    #include <seqan3/contrib/stream/bgzf_istream.hpp>
+    #include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+class bam_index_builder;
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A range of a BGZF compressed file given by two virtual offsets.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * A virtual offset stores the offset of a BGZF block in the compressed file in its upper 48 bits and the offset
+ * inside the uncompressed block in its lower 16 bits.
+ */
+struct bam_index_chunk
+{
+    //!\brief The virtual offset of the first record.
+    uint64_t begin{};
+    //!\brief The virtual offset behind the last record.
+    uint64_t end{};
+
+    //!\brief Chunks are compared member-wise.
+    friend bool operator==(bam_index_chunk const & lhs, bam_index_chunk const & rhs) noexcept
+    {
+        return lhs.begin == rhs.begin && lhs.end == rhs.end;
+    }
+
+    //!\brief Chunks are compared member-wise.
+    friend bool operator!=(bam_index_chunk const & lhs, bam_index_chunk const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/*!\brief The index of a coordinate-sorted BAM file in the BAI or CSI format.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The index divides every reference sequence into the hierarchical bins of the SAM specification and stores for every
+ * bin the chunks of the BAM file that contain the records of that bin. chunks() returns the parts of the BAM file
+ * that contain all records overlapping a region, so that a region can be read without scanning the whole file (see
+ * seqan3::alignment_file_input::region).
+ *
+ * BAI indexes use 5 levels of bins with a smallest bin size of 2^14 and an additional linear index over windows of
+ * 2^14 positions. CSI indexes store the size of the smallest bin (`min_shift`) and the number of levels (`depth`)
+ * and thereby support reference sequences longer than 2^29.
+ *
+ * Indexes are read from `.bai` and `.csi` files, or built from a coordinate-sorted BAM file with build().
+ * seqan3::alignment_file_output builds the index while it writes the file (see
+ * seqan3::alignment_file_output_options::write_bam_index).
+ */
+class bam_index
+{
+public:
+    //!\brief The type of a chunk.
+    using chunk_type = bam_index_chunk;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index() = default;                               //!< Defaulted.
+    bam_index(bam_index const &) = default;              //!< Defaulted.
+    bam_index(bam_index &&) = default;                   //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default;  //!< Defaulted.
+    bam_index & operator=(bam_index &&) = default;       //!< Defaulted.
+    ~bam_index() = default;                              //!< Defaulted.
+
+    /*!\brief Reads an index from a file.
+     * \param[in] index_file A `.bai` or `.csi` file; the format is detected by the magic bytes.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::format_error If the file is neither in the BAI nor in the CSI format.
+     */
+    explicit bam_index(std::filesystem::path const & index_file)
+    {
+        std::ifstream file{index_file, std::ios_base::in | std::ios_base::binary};
+
+        if (!file.good())
+            throw file_open_error{"Could not open file " + index_file.string() + " for reading."};
+
+        if (file.peek() == 0x1f) // CSI files are BGZF compressed
+        {
+        #ifdef SEQAN3_HAS_ZLIB
+            contrib::bgzf_istream decompressed{file};
+            read(decompressed);
+        #else
+            throw file_open_error{"Trying to read a compressed index, but no ZLIB available."};
+        #endif
+        }
+        else
+        {
+            read(file);
+        }
+    }
+    //!\}
+
+    /*!\brief Builds the index of a coordinate-sorted BAM file.
+     * \param[in] bam_file  The BAM file.
+     * \param[in] min_shift The logarithm of the size of the smallest bin; 14 for BAI indexes.
+     * \param[in] depth     The number of levels below the root bin; 5 for BAI indexes.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::format_error If the file is not a BAM file or is not sorted by coordinate.
+     *
+     * \details
+     *
+     * Only the fixed-length part and the CIGAR of every record are inspected.
+     */
+    static bam_index build(std::filesystem::path const & bam_file, int32_t const min_shift = 14, int32_t const depth = 5)
+    {
+    #ifdef SEQAN3_HAS_ZLIB
+        std::ifstream file{bam_file, std::ios_base::in | std::ios_base::binary};
+
+        if (!file.good())
+            throw file_open_error{"Could not open file " + bam_file.string() + " for reading."};
+
+        contrib::bgzf_istream stream{file};
+
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+
+        if (std::string_view{magic.data(), magic.size()} != std::string_view{"BAM\1", 4})
+            throw format_error{"File " + bam_file.string() + " is not in BAM format."};
+
+        stream.ignore(read_value<int32_t>(stream)); // header text
+        int32_t const reference_count = read_value<int32_t>(stream);
+
+        for (int32_t i = 0; i < reference_count; ++i)
+        {
+            stream.ignore(read_value<int32_t>(stream)); // name
+            read_value<int32_t>(stream);                // length
+        }
+
+        bam_index index{};
+        index.min_shift = min_shift;
+        index.depth = depth;
+        index.references.resize(reference_count);
+
+        std::string record{};
+
+        for (uint64_t record_begin = stream.tellg(); stream.peek() != std::char_traits<char>::eof();
+             record_begin = stream.tellg())
+        {
+            record.resize(read_value<int32_t>(stream));
+            stream.read(record.data(), record.size());
+
+            if (!stream.good() || record.size() < 32u)
+                throw format_error{"Unexpected end of input while reading a BAM record."};
+
+            index.add_record(record, record_begin, stream.tellg());
+        }
+
+        index.finish_reference();
+        return index;
+    #else // ^^^ zlib / no zlib vvv
+        throw file_open_error{"Trying to index the BAM file " + bam_file.string() + ", but no ZLIB available."};
+    #endif
+    }
+
+    /*!\brief Writes the index to a file.
+     * \param[in] index_file The file to write; a BGZF compressed CSI index is written if the extension is `.csi`, a
+     *                       BAI index otherwise.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::format_error If a BAI index is requested but the bins are not those of the BAI format.
+     */
+    void write(std::filesystem::path const & index_file) const
+    {
+        std::ofstream file{index_file, std::ios_base::out | std::ios_base::binary};
+
+        if (!file.good())
+            throw file_open_error{"Could not open file " + index_file.string() + " for writing."};
+
+        if (index_file.extension() == ".csi")
+        {
+        #ifdef SEQAN3_HAS_ZLIB
+            contrib::bgzf_ostream compressed{file};
+            write_csi(compressed);
+        #else
+            throw file_open_error{"Trying to write a compressed index, but no ZLIB available."};
+        #endif
+        }
+        else
+        {
+            if (min_shift != 14 || depth != 5)
+                throw format_error{"The BAI format requires min_shift = 14 and depth = 5; write a .csi index instead."};
+
+            write_bai(file);
+        }
+    }
+
+    /*!\brief Returns the chunks of the BAM file that contain all records overlapping a region.
+     * \param[in] ref_id The index of the reference sequence.
+     * \param[in] begin  The first position of the region (0-based).
+     * \param[in] end    The position behind the region.
+     * \returns The chunks sorted by their begin; overlapping chunks are merged.
+     *
+     * \details
+     *
+     * The chunks may also contain records that do not overlap the region, so the records read from them need to be
+     * filtered.
+     */
+    std::vector<chunk_type> chunks(int32_t const ref_id, int64_t const begin, int64_t const end) const
+    {
+        std::vector<chunk_type> result{};
+
+        if (ref_id < 0 || ref_id >= static_cast<int32_t>(references.size()) || begin >= end)
+            return result;
+
+        reference_index const & reference = references[ref_id];
+        uint64_t const min_offset = smallest_offset(reference, begin);
+
+        int64_t const first = std::max<int64_t>(begin, 0);
+        int64_t const last = std::min<int64_t>(end, int64_t{1} << (min_shift + 3 * depth)) - 1;
+
+        if (first > last)
+            return result;
+
+        // All bins that overlap [first, last], level by level (reg2bins of the SAM specification).
+        for (int32_t level = 0, shift = min_shift + 3 * depth, offset = 0; level <= depth;
+             ++level, shift -= 3, offset += 1 << (3 * (level - 1)))
+        {
+            for (int64_t bin = offset + (first >> shift); bin <= offset + (last >> shift); ++bin)
+            {
+                if (auto it = reference.bins.find(bin); it != reference.bins.end())
+                {
+                    for (chunk_type const & chunk : it->second.chunks)
+                        if (chunk.end > min_offset)
+                            result.push_back(chunk);
+                }
+            }
+        }
+
+        std::sort(result.begin(), result.end(), [] (chunk_type const & lhs, chunk_type const & rhs)
+        {
+            return lhs.begin < rhs.begin;
+        });
+
+        // merge overlapping chunks
+        size_t merged = 0;
+        for (size_t i = 1; i < result.size(); ++i)
+        {
+            if (result[i].begin <= result[merged].end)
+                result[merged].end = std::max(result[merged].end, result[i].end);
+            else
+                result[++merged] = result[i];
+        }
+
+        if (!result.empty())
+            result.resize(merged + 1);
+
+        return result;
+    }
+
+    //!\brief The number of reference sequences in the index.
+    size_t reference_count() const noexcept
+    {
+        return references.size();
+    }
+
+    //!\brief The number of records without a reference sequence, if it is stored in the index.
+    uint64_t unplaced_count() const noexcept
+    {
+        return unplaced_records;
+    }
+
+private:
+    //!\brief Builds an index from the blocks of a BAM file while it is written.
+    friend class detail::bam_index_builder;
+
+    //!\brief The chunks of a bin.
+    struct bin_type
+    {
+        //!\brief The smallest virtual offset of a record overlapping the first window of the bin (CSI only).
+        uint64_t min_offset{};
+        //!\brief The chunks containing the records of the bin.
+        std::vector<chunk_type> chunks{};
+    };
+
+    //!\brief The index of a single reference sequence.
+    struct reference_index
+    {
+        //!\brief The bins sorted by their number.
+        std::map<uint32_t, bin_type> bins{};
+        //!\brief The smallest virtual offset of a record overlapping each window of 2^min_shift positions.
+        std::vector<uint64_t> linear_index{};
+        //!\brief The virtual offsets of the first and behind the last record (only while building).
+        chunk_type span{};
+        //!\brief The number of mapped and unmapped records (only while building).
+        uint64_t mapped{}, unmapped{};
+    };
+
+    //!\brief The logarithm of the size of the smallest bin.
+    int32_t min_shift{14};
+    //!\brief The number of levels below the root bin.
+    int32_t depth{5};
+    //!\brief The index of every reference sequence.
+    std::vector<reference_index> references{};
+    //!\brief The number of records without a reference sequence.
+    uint64_t unplaced_records{};
+
+    //!\brief The reference sequence of the last record added while building.
+    int32_t last_ref_id{-1};
+    //!\brief The position of the last record added while building.
+    int64_t last_position{-1};
+
+    //!\brief The number of the pseudo bin that stores meta data instead of chunks.
+    uint32_t pseudo_bin() const noexcept
+    {
+        return ((1u << (3 * depth + 3)) - 1) / 7 + 1;
+    }
+
+    //!\brief Computes the bin of a region (reg2bin of the SAM specification).
+    uint32_t region_to_bin(int64_t const begin, int64_t end) const noexcept
+    {
+        --end;
+        int32_t shift = min_shift;
+        uint32_t offset = ((1u << (3 * depth)) - 1) / 7;
+
+        for (int32_t level = depth; level > 0; --level, shift += 3, offset -= 1u << (3 * level))
+            if (begin >> shift == end >> shift)
+                return offset + (begin >> shift);
+
+        return 0;
+    }
+
+    //!\brief The smallest virtual offset of a record that may overlap the given position.
+    uint64_t smallest_offset(reference_index const & reference, int64_t const position) const
+    {
+        uint64_t const window = std::max<int64_t>(position, 0) >> min_shift;
+
+        if (!reference.linear_index.empty())
+            return reference.linear_index[std::min<uint64_t>(window, reference.linear_index.size() - 1)];
+
+        // CSI: the offset of the smallest bin that contains the position and has records
+        uint32_t bin = ((1u << (3 * depth)) - 1) / 7 + window;
+
+        for (;;)
+        {
+            if (auto it = reference.bins.find(bin); it != reference.bins.end())
+                return it->second.min_offset;
+
+            if (bin == 0)
+                return 0;
+
+            bin = (bin - 1) / 8;
+        }
+    }
+
+    //!\brief Reads a little-endian value from a stream.
+    template <typename value_t>
+    static value_t read_value(std::istream & stream)
+    {
+        value_t value{};
+        stream.read(reinterpret_cast<char *>(&value), sizeof(value));
+
+        if (!stream.good())
+            throw format_error{"Unexpected end of input while reading a BAM index."};
+
+        return value;
+    }
+
+    //!\brief Writes a little-endian value to a stream.
+    template <typename value_t>
+    static void write_value(std::ostream & stream, value_t const value)
+    {
+        stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    //!\brief Reads an index in the BAI or CSI format.
+    void read(std::istream & stream)
+    {
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+        std::string_view const magic_view{magic.data(), magic.size()};
+
+        bool const is_csi = (magic_view == std::string_view{"CSI\1", 4});
+
+        if (!is_csi && magic_view != std::string_view{"BAI\1", 4})
+            throw format_error{"The index is neither in the BAI nor in the CSI format."};
+
+        if (is_csi)
+        {
+            min_shift = read_value<int32_t>(stream);
+            depth = read_value<int32_t>(stream);
+            stream.ignore(read_value<int32_t>(stream)); // auxiliary data
+
+            if (min_shift < 0 || depth < 0 || min_shift + 3 * depth > 63 || 3 * depth + 3 > 31)
+                throw format_error{"The CSI index has an unsupported min_shift or depth."};
+        }
+
+        references.resize(read_value<int32_t>(stream));
+
+        for (reference_index & reference : references)
+        {
+            for (int32_t bin_count = read_value<int32_t>(stream); bin_count > 0; --bin_count)
+            {
+                uint32_t const bin_number = read_value<uint32_t>(stream);
+                bin_type bin{};
+
+                if (is_csi)
+                    bin.min_offset = read_value<uint64_t>(stream);
+
+                bin.chunks.resize(read_value<int32_t>(stream));
+
+                for (chunk_type & chunk : bin.chunks)
+                {
+                    chunk.begin = read_value<uint64_t>(stream);
+                    chunk.end = read_value<uint64_t>(stream);
+                }
+
+                if (bin_number != pseudo_bin())
+                    reference.bins.emplace(bin_number, std::move(bin));
+            }
+
+            if (!is_csi)
+            {
+                reference.linear_index.resize(read_value<int32_t>(stream));
+
+                for (uint64_t & offset : reference.linear_index)
+                    offset = read_value<uint64_t>(stream);
+            }
+        }
+
+        // optional
+        stream.read(reinterpret_cast<char *>(&unplaced_records), sizeof(unplaced_records));
+
+        if (stream.gcount() != sizeof(unplaced_records))
+            unplaced_records = 0;
+    }
+
+    //!\brief Writes the bins and chunks of a reference sequence, including the pseudo bin.
+    void write_bins(std::ostream & stream, reference_index const & reference, bool const is_csi) const
+    {
+        bool const has_records = reference.mapped + reference.unmapped > 0;
+        write_value<int32_t>(stream, reference.bins.size() + has_records);
+
+        for (auto const & [bin_number, bin] : reference.bins)
+        {
+            write_value<uint32_t>(stream, bin_number);
+
+            if (is_csi)
+                write_value<uint64_t>(stream, bin.min_offset);
+
+            write_value<int32_t>(stream, bin.chunks.size());
+
+            for (chunk_type const & chunk : bin.chunks)
+            {
+                write_value<uint64_t>(stream, chunk.begin);
+                write_value<uint64_t>(stream, chunk.end);
+            }
+        }
+
+        if (has_records)
+        {
+            write_value<uint32_t>(stream, pseudo_bin());
+
+            if (is_csi)
+                write_value<uint64_t>(stream, 0);
+
+            write_value<int32_t>(stream, 2);
+            write_value<uint64_t>(stream, reference.span.begin);
+            write_value<uint64_t>(stream, reference.span.end);
+            write_value<uint64_t>(stream, reference.mapped);
+            write_value<uint64_t>(stream, reference.unmapped);
+        }
+    }
+
+    //!\brief Writes the index in the BAI format.
+    void write_bai(std::ostream & stream) const
+    {
+        stream.write("BAI\1", 4);
+        write_value<int32_t>(stream, references.size());
+
+        for (reference_index const & reference : references)
+        {
+            write_bins(stream, reference, false);
+            write_value<int32_t>(stream, reference.linear_index.size());
+
+            for (uint64_t const offset : reference.linear_index)
+                write_value<uint64_t>(stream, offset);
+        }
+
+        write_value<uint64_t>(stream, unplaced_records);
+    }
+
+    //!\brief Writes the index in the CSI format.
+    void write_csi(std::ostream & stream) const
+    {
+        stream.write("CSI\1", 4);
+        write_value<int32_t>(stream, min_shift);
+        write_value<int32_t>(stream, depth);
+        write_value<int32_t>(stream, 0); // no auxiliary data
+        write_value<int32_t>(stream, references.size());
+
+        for (reference_index const & reference : references)
+            write_bins(stream, reference, true);
+
+        write_value<uint64_t>(stream, unplaced_records);
+    }
+
+    /*!\brief Adds a BAM record to the index.
+     * \param[in] record The record without its block_size field.
+     * \param[in] begin  The virtual offset of the record.
+     * \param[in] end    The virtual offset behind the record.
+     * \throws seqan3::format_error If the records are not sorted by coordinate.
+     */
+    void add_record(std::string_view const record, uint64_t const begin, uint64_t const end)
+    {
+        auto field = [record] (size_t const position, auto value)
+        {
+            std::memcpy(&value, record.data() + position, sizeof(value));
+            return value;
+        };
+
+        int32_t const ref_id = field(0, int32_t{});
+        int64_t const position = field(4, int32_t{});
+        size_t const name_length = field(8, uint8_t{});
+        size_t const cigar_count = field(12, uint16_t{});
+        uint16_t const flag = field(14, uint16_t{});
+
+        if (ref_id >= static_cast<int32_t>(references.size()) || ref_id < -1)
+            throw format_error{"The reference id of a BAM record is out of range."};
+
+        if (ref_id == -1) // unplaced records are stored at the end of the file
+        {
+            finish_reference();
+            last_ref_id = std::numeric_limits<int32_t>::max();
+            ++unplaced_records;
+            return;
+        }
+
+        if (ref_id < last_ref_id || (ref_id == last_ref_id && position < last_position))
+            throw format_error{"The BAM file is not sorted by coordinate."};
+
+        if (ref_id != last_ref_id)
+        {
+            finish_reference();
+            last_ref_id = ref_id;
+            references[ref_id].span.begin = begin;
+        }
+
+        last_position = position;
+
+        reference_index & reference = references[ref_id];
+        reference.span.end = end;
+
+        if (flag & 0x4) // unmapped
+            ++reference.unmapped;
+        else
+            ++reference.mapped;
+
+        // the length of the alignment on the reference
+        int64_t length = 0;
+
+        if (32 + name_length + 4 * cigar_count > record.size())
+            throw format_error{"Unexpected end of a BAM record."};
+
+        for (size_t i = 0; i < cigar_count; ++i)
+        {
+            uint32_t const operation = field(32 + name_length + 4 * i, uint32_t{});
+
+            // M, D, N, = and X consume the reference
+            if ((0b110001101u >> (operation & 0xf)) & 1u)
+                length += operation >> 4;
+        }
+
+        int64_t const record_end = position + std::max<int64_t>(length, 1);
+
+        if (position < 0 || record_end > (int64_t{1} << (min_shift + 3 * depth)))
+            throw format_error{"A BAM record is outside of the range that the index can represent."};
+
+        // bins: extend the last chunk if the records are adjacent
+        std::vector<chunk_type> & chunks = reference.bins[region_to_bin(position, record_end)].chunks;
+
+        if (!chunks.empty() && chunks.back().end == begin)
+            chunks.back().end = end;
+        else
+            chunks.push_back(chunk_type{begin, end});
+
+        // linear index: the first record overlapping a window has the smallest offset
+        size_t const last_window = (record_end - 1) >> min_shift;
+
+        if (reference.linear_index.size() <= last_window)
+            reference.linear_index.resize(last_window + 1, 0);
+
+        for (size_t window = position >> min_shift; window <= last_window; ++window)
+            if (reference.linear_index[window] == 0)
+                reference.linear_index[window] = begin;
+    }
+
+    //!\brief Completes the index of the last reference sequence.
+    void finish_reference()
+    {
+        if (last_ref_id < 0 || last_ref_id >= static_cast<int32_t>(references.size()))
+            return;
+
+        reference_index & reference = references[last_ref_id];
+
+        // windows without records continue with the offset of the previous window
+        for (size_t window = 1; window < reference.linear_index.size(); ++window)
+            if (reference.linear_index[window] == 0)
+                reference.linear_index[window] = reference.linear_index[window - 1];
+
+        for (auto & [bin_number, bin] : reference.bins)
+        {
+            int32_t level = 0;
+            for (uint32_t first = 0; bin_number >= first + (1u << (3 * level)); first += 1u << (3 * level++))
+            {}
+
+            uint32_t const first_bin_of_level = ((1u << (3 * level)) - 1) / 7;
+            uint64_t const window = static_cast<uint64_t>(bin_number - first_bin_of_level)
+                                  << (3 * (depth - level));
+
+            bin.min_offset = (window < reference.linear_index.size()) ? reference.linear_index[window] : 0;
+        }
+
+        // CSI indexes do not store the linear index; it is kept for queries on the built index
+    }
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Builds a seqan3::bam_index from the uncompressed blocks of a BAM file while the file is written.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * add_block() is called with the uncompressed data of every BGZF block in the order of the file, e.g. by the block
+ * observer of seqan3::contrib::basic_bgzf_ostreambuf. The records are indexed by their position in the uncompressed
+ * data, because the compressed size of a block is only known after it was compressed; finish() translates these
+ * positions into virtual offsets once the compressed sizes of all blocks are known.
+ *
+ * The BAM file has to be sorted by coordinate. Errors in the data are stored and thrown by finish(), because
+ * add_block() is called while the stream writes.
+ */
+class bam_index_builder
+{
+public:
+    /*!\brief Indexes the records in the uncompressed data of the next block.
+     * \param[in] data The uncompressed data of the block.
+     * \param[in] size The size of the data.
+     */
+    void add_block(char const * const data, size_t const size) noexcept
+    {
+        try
+        {
+            block_sizes.push_back(size);
+
+            if (!error)
+                consume(std::string_view{data, size});
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    /*!\brief Completes the index.
+     * \param[in] compressed_sizes The compressed sizes of the blocks passed to add_block(), in the same order.
+     * \returns The index with the virtual offsets of the records.
+     * \throws seqan3::format_error If the data is not a complete BAM file or is not sorted by coordinate.
+     */
+    bam_index finish(std::vector<size_t> const & compressed_sizes)
+    {
+        if (error)
+            std::rethrow_exception(error);
+
+        if (!header_is_read || !pending.empty())
+            throw format_error{"Unexpected end of input while reading a BAM record."};
+
+        if (compressed_sizes.size() < block_sizes.size())
+            throw format_error{"The BAM file was not written completely and cannot be indexed."};
+
+        index.finish_reference();
+
+        // the positions of the non-empty blocks in the uncompressed and in the compressed data
+        std::vector<uint64_t> block_begin{};
+        std::vector<uint64_t> compressed_begin{};
+        uint64_t compressed_end = 0;
+
+        for (size_t i = 0, uncompressed_end = 0; i < block_sizes.size(); ++i)
+        {
+            if (block_sizes[i] != 0)
+            {
+                block_begin.push_back(uncompressed_end);
+                compressed_begin.push_back(compressed_end);
+            }
+
+            uncompressed_end += block_sizes[i];
+            compressed_end += compressed_sizes[i];
+        }
+
+        // a position at the end of a block belongs to the beginning of the next block
+        auto to_virtual_offset = [&] (uint64_t & offset)
+        {
+            size_t const block = std::upper_bound(block_begin.begin(), block_begin.end(), offset)
+                               - block_begin.begin();
+
+            if (block == 0)
+                return;
+
+            if (block == block_begin.size() && offset >= position)
+                offset = compressed_end << 16;
+            else
+                offset = (compressed_begin[block - 1] << 16) | (offset - block_begin[block - 1]);
+        };
+
+        for (bam_index::reference_index & reference : index.references)
+        {
+            for (auto & [bin_number, bin] : reference.bins)
+            {
+                to_virtual_offset(bin.min_offset);
+
+                for (bam_index::chunk_type & chunk : bin.chunks)
+                {
+                    to_virtual_offset(chunk.begin);
+                    to_virtual_offset(chunk.end);
+                }
+            }
+
+            for (uint64_t & offset : reference.linear_index)
+                to_virtual_offset(offset);
+
+            to_virtual_offset(reference.span.begin);
+            to_virtual_offset(reference.span.end);
+        }
+
+        return index;
+    }
+
+private:
+    //!\brief The index with the positions of the records in the uncompressed data.
+    bam_index index{};
+    //!\brief The uncompressed size of every block.
+    std::vector<size_t> block_sizes{};
+    //!\brief The beginning of a header or record that continues in the next block.
+    std::string pending{};
+    //!\brief The position of the first byte that is not indexed yet (the beginning of #pending).
+    uint64_t position{};
+    //!\brief Whether the header was read, i.e. #pending begins with a record.
+    bool header_is_read{false};
+    //!\brief The first error in the data.
+    std::exception_ptr error{};
+
+    //!\brief Reads a little-endian value at a position of the data.
+    template <typename value_t>
+    static value_t value_at(std::string_view const data, size_t const offset)
+    {
+        value_t value{};
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+
+    //!\brief Indexes the complete records of the data and keeps the rest in #pending.
+    void consume(std::string_view data)
+    {
+        while (!data.empty())
+        {
+            if (pending.empty()) // index the block directly
+            {
+                size_t const used = parse(data);
+                pending.assign(data.substr(used));
+                data = std::string_view{};
+            }
+            else // complete the record of the previous block
+            {
+                size_t const used = std::min(data.size(), missing_size());
+                pending.append(data.substr(0, used));
+                data.remove_prefix(used);
+                pending.erase(0, parse(pending));
+            }
+        }
+    }
+
+    //!\brief The number of bytes that are missing to complete the header or record in #pending.
+    size_t missing_size() const
+    {
+        if (!header_is_read) // the header is rarely split and parsed again as a whole
+            return std::numeric_limits<size_t>::max();
+
+        if (pending.size() < 4)
+            return 4 - pending.size();
+
+        return 4 + record_size(pending, 0) - pending.size();
+    }
+
+    //!\brief The size of the record at an offset of the data, without the block_size field.
+    static size_t record_size(std::string_view const data, size_t const offset)
+    {
+        int32_t const size = value_at<int32_t>(data, offset);
+
+        if (size < 32)
+            throw format_error{"Unexpected end of input while reading a BAM record."};
+
+        return size;
+    }
+
+    /*!\brief Indexes the header and the records that are complete in the data.
+     * \returns The number of bytes that were indexed.
+     */
+    size_t parse(std::string_view const data)
+    {
+        size_t offset = 0;
+
+        if (!header_is_read)
+        {
+            offset = header_size(data);
+
+            if (offset == 0)
+                return 0;
+        }
+
+        while (data.size() - offset >= 4 && data.size() - offset - 4 >= record_size(data, offset))
+        {
+            size_t const end = offset + 4 + record_size(data, offset);
+            index.add_record(data.substr(offset + 4, end - offset - 4), position + offset, position + end);
+            offset = end;
+        }
+
+        position += offset;
+        return offset;
+    }
+
+    /*!\brief Reads the header of the BAM file.
+     * \returns The size of the header or 0 if the data does not contain the complete header.
+     */
+    size_t header_size(std::string_view const data)
+    {
+        if (data.size() >= 4 && data.substr(0, 4) != std::string_view{"BAM\1", 4})
+            throw format_error{"The data is not in BAM format."};
+
+        auto skip = [&data] (size_t & offset) // skips a value given by its length
+        {
+            if (data.size() < offset + 4)
+                return false;
+
+            int32_t const length = value_at<int32_t>(data, offset);
+
+            if (length < 0)
+                throw format_error{"The BAM header contains a negative length."};
+
+            offset += 4 + length;
+            return data.size() >= offset;
+        };
+
+        size_t offset = 4;
+
+        if (!skip(offset) || data.size() < offset + 4) // header text
+            return 0;
+
+        int32_t const reference_count = value_at<int32_t>(data, offset);
+        offset += 4;
+
+        if (reference_count < 0)
+            throw format_error{"The number of reference sequences in the BAM header is negative."};
+
+        for (int32_t i = 0; i < reference_count; ++i, offset += 4) // name and length
+            if (!skip(offset) || data.size() < offset + 4)
+                return 0;
+
+        index.references.resize(reference_count);
+        header_is_read = true;
+        return offset;
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,224 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_record.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <seqan3/std/ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/sam_dna16.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/io/alignment_file/header.hpp>
+#include <seqan3/io/alignment_file/misc.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A BAM alignment record whose fields are decoded on access.
+ * \ingroup alignment_file
+ * \tparam header_t The type of the header of the file the record was read from.
+ *
+ * \details
+ *
+ * The record stores the bytes of a BAM alignment record as they are in the file (without the leading block size).
+ * Reading such a record with seqan3::alignment_file_input::read_raw_record only copies the bytes, and writing it to
+ * a BAM file with seqan3::alignment_file_output::push_back copies them back, so filtering a BAM file does not decode
+ * and re-encode the records.
+ *
+ * The member functions decode a single field when called:
+ *
+ *   * ref_id(), ref_offset(), mapq(), flag(), mate() and id() read the fixed-size part of the record and do not
+ *     allocate.
+ *   * sequence() and base_qualities() return views that decode the 4-bit bases and the Phred scores on access.
+ *   * cigar_vector() and tags() decode into a new container on every call.
+ *
+ * CIGAR strings with more than 65535 operations, which BAM stores in the CG tag, are returned as stored in the
+ * record, i.e. as the placeholder `<l_seq>S<ref_length>N`.
+ */
+template <typename header_t = alignment_file_header<>>
+class bam_record
+{
+public:
+    //!\brief The type of the header.
+    using header_type = header_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record() = default;                               //!< Defaulted.
+    bam_record(bam_record const &) = default;             //!< Defaulted.
+    bam_record(bam_record &&) = default;                  //!< Defaulted.
+    bam_record & operator=(bam_record const &) = default; //!< Defaulted.
+    bam_record & operator=(bam_record &&) = default;      //!< Defaulted.
+    ~bam_record() = default;                              //!< Defaulted.
+    //!\}
+
+    //!\brief The bytes of the record without the leading block size.
+    std::string bytes{};
+    //!\brief The header of the file the record was read from; the reference ids refer to it.
+    header_type * header_ptr{nullptr};
+
+    //!\brief The index of the reference sequence in the header (field::ref_id).
+    std::optional<int32_t> ref_id() const
+    {
+        return optional_position(get<int32_t>(0));
+    }
+
+    //!\brief The 0-based position of the alignment in the reference sequence (field::ref_offset).
+    std::optional<int32_t> ref_offset() const
+    {
+        return optional_position(get<int32_t>(4));
+    }
+
+    //!\brief The mapping quality (field::mapq).
+    uint8_t mapq() const
+    {
+        return get<uint8_t>(9);
+    }
+
+    //!\brief The flag (field::flag).
+    sam_flag flag() const
+    {
+        return static_cast<sam_flag>(get<uint16_t>(14));
+    }
+
+    //!\brief The reference id, the position and the template length of the mate (field::mate).
+    std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t> mate() const
+    {
+        return {optional_position(get<int32_t>(20)), optional_position(get<int32_t>(24)), get<int32_t>(28)};
+    }
+
+    //!\brief The name of the read (field::id).
+    std::string_view id() const
+    {
+        return std::string_view{bytes}.substr(name_begin(), get<uint8_t>(8) - 1); // without '\0'
+    }
+
+    //!\brief The CIGAR operations (field::cigar).
+    std::vector<cigar> cigar_vector() const
+    {
+        constexpr char const * cigar_mapping = "MIDNSHP=X*******";
+
+        std::vector<cigar> operations(cigar_count());
+
+        for (size_t i = 0; i < operations.size(); ++i)
+        {
+            uint32_t const operation = get<uint32_t>(cigar_begin() + 4 * i);
+            operations[i] = cigar{operation >> 4, cigar_op{}.assign_char(cigar_mapping[operation & 0x0f])};
+        }
+
+        return operations;
+    }
+
+    //!\brief The read sequence as a view over seqan3::sam_dna16 that decodes the 4-bit bases on access (field::seq).
+    auto sequence() const
+    {
+        char const * const data = bytes.data() + sequence_begin();
+
+        return std::views::iota(int32_t{0}, sequence_length())
+             | std::views::transform([data] (int32_t const i)
+               {
+                   uint8_t const pair = data[i / 2];
+                   return sam_dna16{}.assign_rank((i % 2) ? (pair & 0x0f) : (pair >> 4));
+               });
+    }
+
+    /*!\brief The qualities as a view over seqan3::phred94 (field::qual).
+     *
+     * \details
+     *
+     * The view is empty if the record does not store qualities.
+     */
+    auto base_qualities() const
+    {
+        int32_t const length = sequence_length();
+        size_t const begin = sequence_begin() + (length + 1) / 2;
+        bool const missing = length > 0 && static_cast<uint8_t>(bytes[begin]) == 0xff;
+
+        return std::string_view{bytes}.substr(begin, missing ? 0 : length)
+             | std::views::transform([] (char const score)
+               {
+                   return phred94{}.assign_rank(score);
+               });
+    }
+
+    /*!\brief The optional fields (field::tags).
+     * \throws seqan3::format_error If a tag cannot be decoded.
+     */
+    sam_tag_dictionary tags() const
+    {
+        int32_t const length = sequence_length();
+        size_t const begin = sequence_begin() + (length + 1) / 2 + length;
+
+        sam_tag_buffer buffer{};
+        buffer.assign_binary(std::string_view{bytes}.substr(begin));
+
+        return buffer.to_dictionary();
+    }
+
+private:
+    //!\brief Reads a little-endian value at the given position of the record.
+    template <typename value_t>
+    value_t get(size_t const position) const
+    {
+        value_t value;
+        std::memcpy(&value, bytes.data() + position, sizeof(value));
+        return value;
+    }
+
+    //!\brief Positions of -1 denote missing values.
+    static std::optional<int32_t> optional_position(int32_t const position)
+    {
+        return (position == -1) ? std::nullopt : std::optional<int32_t>{position};
+    }
+
+    //!\brief The position of the read name in the record.
+    static constexpr size_t name_begin()
+    {
+        return 32;
+    }
+
+    //!\brief The number of CIGAR operations.
+    size_t cigar_count() const
+    {
+        return get<uint16_t>(12);
+    }
+
+    //!\brief The position of the CIGAR in the record.
+    size_t cigar_begin() const
+    {
+        return name_begin() + get<uint8_t>(8);
+    }
+
+    //!\brief The length of the read sequence.
+    int32_t sequence_length() const
+    {
+        return get<int32_t>(16);
+    }
+
+    //!\brief The position of the read sequence in the record.
+    size_t sequence_begin() const
+    {
+        return cigar_begin() + 4 * cigar_count();
+    }
+};
+
+} // namespace seqan3
@@ -0,0 +1,404 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::cigar_alignment.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/range/decorator/gap_decorator.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A pairwise alignment that is represented by the unaligned sequences and the CIGAR operations.
+ * \ingroup alignment_file
+ * \tparam reference_t The type of the aligned part of the reference sequence; must model
+ *                     std::ranges::random_access_range and std::ranges::sized_range.
+ * \tparam query_t     The type of the aligned part of the query sequence; must model
+ *                     std::ranges::random_access_range and std::ranges::sized_range.
+ *
+ * \details
+ *
+ * When reading seqan3::field::alignment from a SAM or BAM file, the default alignment type stores both rows in a
+ * seqan3::gap_decorator, which inserts the gaps of every CIGAR operation. This class stores the CIGAR operations
+ * as they are and only computes, for every operation, the position of its first column in the alignment, in the
+ * reference and in the query (prefix sums over the operation counts). The rows of the alignment are random access
+ * views that look up the operation of a column by binary search, so no gaps are inserted while reading.
+ *
+ * The rows are accessed with `get<0>` (reference) and `get<1>` (query) like the rows of any other pairwise
+ * alignment; they are views that refer to this object. materialise() returns the alignment as a pair of
+ * seqan3::gap_decorator if a writable alignment is needed. Writing the alignment to a SAM or BAM file uses the stored
+ * CIGAR operations instead of recomputing them from the gaps.
+ *
+ * Soft and hard clipping operations are not part of the alignment and are dropped on assignment; the clipped bases
+ * are described by seqan3::field::offset and seqan3::field::seq.
+ *
+ * ### Performance
+ *
+ * **n** The number of alignment columns.
+ * **k** The number of CIGAR operations.
+ *
+ * | assign      | access next      | random access    | size overhead |
+ * |-------------|------------------|------------------|---------------|
+ * | \f$O(k)\f$  | \f$O(\log(k))\f$ | \f$O(\log(k))\f$ | \f$O(k)\f$    |
+ */
+template <std::ranges::random_access_range reference_t, std::ranges::random_access_range query_t>
+//!\cond
+    requires std::ranges::sized_range<reference_t> && std::ranges::sized_range<query_t> &&
+             std::semiregular<reference_t> && std::semiregular<query_t>
+//!\endcond
+class cigar_alignment
+{
+private:
+    //!\brief The positions at which a CIGAR operation starts.
+    struct operation_begin
+    {
+        //!\brief The first alignment column of the operation.
+        size_t column;
+        //!\brief The position in the reference sequence.
+        size_t reference;
+        //!\brief The position in the query sequence.
+        size_t query;
+    };
+
+    //!\brief The value type of a row; seqan3::gapped over the alphabet of the reference or the query.
+    template <size_t row>
+    using row_value_type = gapped<std::ranges::range_value_t<std::conditional_t<row == 0, reference_t, query_t>>>;
+
+    //!\brief Returns the value of an alignment column in the given row.
+    template <size_t row>
+    struct row_accessor
+    {
+        //!\brief The alignment.
+        cigar_alignment const * host{nullptr};
+
+        //!\brief Returns the value of the given column.
+        row_value_type<row> operator()(size_t const column) const
+        {
+            return host->template value_at<row>(column);
+        }
+    };
+
+    //!\brief The type of a row; a random access view over the alignment columns.
+    template <size_t row>
+    using row_type = decltype(std::views::iota(size_t{}, size_t{}) | std::views::transform(row_accessor<row>{}));
+
+public:
+    //!\brief The type of the aligned part of the reference sequence.
+    using reference_type = reference_t;
+    //!\brief The type of the aligned part of the query sequence.
+    using query_type = query_t;
+    //!\brief The type of the first row (seqan3::gapped over the reference alphabet).
+    using reference_row_type = row_type<0>;
+    //!\brief The type of the second row (seqan3::gapped over the query alphabet).
+    using query_row_type = row_type<1>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    cigar_alignment() = default;                                    //!< Defaulted.
+    cigar_alignment(cigar_alignment const &) = default;             //!< Defaulted.
+    cigar_alignment(cigar_alignment &&) = default;                  //!< Defaulted.
+    cigar_alignment & operator=(cigar_alignment const &) = default; //!< Defaulted.
+    cigar_alignment & operator=(cigar_alignment &&) = default;      //!< Defaulted.
+    ~cigar_alignment() = default;                                   //!< Defaulted.
+
+    /*!\brief Construct from the aligned parts of the sequences and the CIGAR operations.
+     * \param[in] reference    The aligned part of the reference sequence.
+     * \param[in] query        The aligned part of the query sequence.
+     * \param[in] cigar_vector The CIGAR operations; soft and hard clipping is dropped.
+     */
+    cigar_alignment(reference_t reference, query_t query, std::vector<cigar> const & cigar_vector) :
+        reference_sequence{std::move(reference)},
+        query_sequence{std::move(query)}
+    {
+        assign_cigar(cigar_vector);
+    }
+    //!\}
+
+    /*!\name Assignment
+     * \{
+     */
+    //!\brief Assigns the aligned part of the reference sequence.
+    void assign_reference(reference_t reference)
+    {
+        reference_sequence = std::move(reference);
+    }
+
+    //!\brief Assigns the aligned part of the query sequence.
+    void assign_query(query_t query)
+    {
+        query_sequence = std::move(query);
+    }
+
+    /*!\brief Assigns the CIGAR operations and computes the positions at which the operations start.
+     * \param[in] cigar_vector The CIGAR operations; soft and hard clipping is dropped.
+     *
+     * \details
+     *
+     * The operations M, = and X consume both sequences, D and N consume the reference, I consumes the query and P
+     * consumes neither; each operation adds its count to the number of alignment columns.
+     */
+    void assign_cigar(std::vector<cigar> const & cigar_vector)
+    {
+        operations.clear();
+        operation_begins.clear();
+        operations.reserve(cigar_vector.size());
+        operation_begins.reserve(cigar_vector.size() + 1);
+
+        operation_begin position{0, 0, 0};
+
+        for (auto const & operation : cigar_vector)
+        {
+            auto [count, op] = operation;
+
+            if (op == 'S'_cigar_op || op == 'H'_cigar_op || count == 0)
+                continue;
+
+            operations.push_back(operation);
+            operation_begins.push_back(position);
+
+            position.column += count;
+            position.reference += consumes_reference(op) ? count : 0;
+            position.query += consumes_query(op) ? count : 0;
+        }
+
+        operation_begins.push_back(position); // sentinel; holds the lengths of the alignment and the sequences
+    }
+
+    //!\brief Removes the sequences and the CIGAR operations.
+    void clear()
+    {
+        reference_sequence = reference_t{};
+        query_sequence = query_t{};
+        operations.clear();
+        operation_begins.clear();
+    }
+    //!\}
+
+    /*!\name Accessors
+     * \{
+     */
+    //!\brief The aligned part of the reference sequence.
+    reference_t const & reference() const noexcept
+    {
+        return reference_sequence;
+    }
+
+    //!\brief The aligned part of the query sequence.
+    query_t const & query() const noexcept
+    {
+        return query_sequence;
+    }
+
+    //!\brief The CIGAR operations without soft and hard clipping.
+    std::vector<cigar> const & cigar_operations() const noexcept
+    {
+        return operations;
+    }
+
+    /*!\brief The CIGAR operations with soft clipping at both ends of the query.
+     * \param[in] query_start_pos The number of soft clipped bases at the beginning of the query sequence.
+     * \param[in] query_end_pos   The number of soft clipped bases at the end of the query sequence.
+     *
+     * \details
+     *
+     * This is the counterpart of seqan3::detail::get_cigar_vector, which computes the operations from the gaps of
+     * the alignment. The operations are returned as they were assigned, i.e. = and X are kept.
+     */
+    std::vector<cigar> cigar_vector(uint32_t const query_start_pos = 0, uint32_t const query_end_pos = 0) const
+    {
+        std::vector<cigar> result{};
+        result.reserve(operations.size() + 2);
+
+        if (query_start_pos != 0)
+            result.emplace_back(query_start_pos, 'S'_cigar_op);
+
+        result.insert(result.end(), operations.begin(), operations.end());
+
+        if (query_end_pos != 0)
+            result.emplace_back(query_end_pos, 'S'_cigar_op);
+
+        return result;
+    }
+
+    //!\brief The number of alignment columns.
+    size_t size() const noexcept
+    {
+        return operation_begins.empty() ? 0 : operation_begins.back().column;
+    }
+
+    //!\brief Whether the alignment has no columns.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the value of an alignment column in the given row.
+     * \tparam row     0 for the reference and 1 for the query.
+     * \param  column  The alignment column; must be smaller than size().
+     * \returns seqan3::gap if the operation of the column does not consume the sequence of the row, otherwise the
+     *          letter of the sequence.
+     */
+    template <size_t row>
+    row_value_type<row> value_at(size_t const column) const
+    //!\cond
+        requires (row < 2)
+    //!\endcond
+    {
+        assert(column < size());
+
+        // the last operation that begins at or before the column
+        auto it = std::ranges::upper_bound(operation_begins, column, std::less<>{}, &operation_begin::column);
+        size_t const index = std::ranges::distance(operation_begins.begin(), it) - 1;
+        size_t const in_operation = column - operation_begins[index].column;
+        auto [count, op] = operations[index];
+        (void) count;
+
+        if constexpr (row == 0)
+        {
+            if (!consumes_reference(op))
+                return gap{};
+
+            return reference_sequence[operation_begins[index].reference + in_operation];
+        }
+        else
+        {
+            if (!consumes_query(op))
+                return gap{};
+
+            return query_sequence[operation_begins[index].query + in_operation];
+        }
+    }
+
+    /*!\brief Returns a row of the alignment as a view.
+     * \tparam row 0 for the reference and 1 for the query.
+     *
+     * \details
+     *
+     * The view refers to this object and must not outlive it.
+     */
+    template <size_t row>
+    row_type<row> row_view() const
+    //!\cond
+        requires (row < 2)
+    //!\endcond
+    {
+        return std::views::iota(size_t{0}, size()) | std::views::transform(row_accessor<row>{this});
+    }
+    //!\}
+
+    /*!\brief Returns the alignment as a pair of seqan3::gap_decorator.
+     *
+     * \details
+     *
+     * The gaps are inserted as seqan3::detail::alignment_from_cigar does when reading the default alignment type.
+     */
+    std::tuple<gap_decorator<reference_t>, gap_decorator<query_t>> materialise() const
+    {
+        std::tuple<gap_decorator<reference_t>, gap_decorator<query_t>> alignment{};
+
+        if (!empty())
+        {
+            assign_unaligned(std::get<0>(alignment), reference_sequence);
+            assign_unaligned(std::get<1>(alignment), query_sequence);
+            detail::alignment_from_cigar(alignment, operations);
+        }
+
+        return alignment;
+    }
+
+private:
+    //!\brief Whether the operation consumes the reference sequence.
+    static constexpr bool consumes_reference(cigar_op const op) noexcept
+    {
+        return op == 'M'_cigar_op || op == '='_cigar_op || op == 'X'_cigar_op ||
+               op == 'D'_cigar_op || op == 'N'_cigar_op;
+    }
+
+    //!\brief Whether the operation consumes the query sequence.
+    static constexpr bool consumes_query(cigar_op const op) noexcept
+    {
+        return op == 'M'_cigar_op || op == '='_cigar_op || op == 'X'_cigar_op || op == 'I'_cigar_op;
+    }
+
+    //!\brief The aligned part of the reference sequence.
+    reference_t reference_sequence{};
+    //!\brief The aligned part of the query sequence.
+    query_t query_sequence{};
+    //!\brief The CIGAR operations without soft and hard clipping.
+    std::vector<cigar> operations{};
+    //!\brief The positions at which the operations start, followed by the lengths of the alignment and sequences.
+    std::vector<operation_begin> operation_begins{};
+};
+
+/*!\name Tuple interface
+ * \relates seqan3::cigar_alignment
+ * \brief The rows of the alignment; views that refer to the alignment.
+ * \{
+ */
+//!\brief Returns the row with the given index.
+template <size_t index, typename reference_t, typename query_t>
+auto get(cigar_alignment<reference_t, query_t> const & alignment)
+//!\cond
+    requires (index < 2)
+//!\endcond
+{
+    return alignment.template row_view<index>();
+}
+//!\}
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+//!\brief Whether a type is a specialisation of seqan3::cigar_alignment.
+//!\ingroup alignment_file
+template <typename t>
+inline constexpr bool is_cigar_alignment_v = false;
+
+//!\brief Whether a type is a specialisation of seqan3::cigar_alignment.
+//!\ingroup alignment_file
+template <typename reference_t, typename query_t>
+inline constexpr bool is_cigar_alignment_v<cigar_alignment<reference_t, query_t>> = true;
+
+} // namespace seqan3::detail
+
+namespace std
+{
+
+//!\brief Obtains the number of rows of a seqan3::cigar_alignment.
+//!\relates seqan3::cigar_alignment
+template <typename reference_t, typename query_t>
+struct tuple_size<seqan3::cigar_alignment<reference_t, query_t>> : public std::integral_constant<size_t, 2>
+{};
+
+//!\brief Obtains the type of a row of a seqan3::cigar_alignment.
+//!\relates seqan3::cigar_alignment
+template <size_t index, typename reference_t, typename query_t>
+struct tuple_element<index, seqan3::cigar_alignment<reference_t, query_t>>
+{
+    //!\brief The type of the row.
+    using type = std::conditional_t<index == 0,
+                                    typename seqan3::cigar_alignment<reference_t, query_t>::reference_row_type,
+                                    typename seqan3::cigar_alignment<reference_t, query_t>::query_row_type>;
+};
+
+} // namespace std
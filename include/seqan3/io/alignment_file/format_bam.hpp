@@ -14,9 +14,12 @@
 
 #include <seqan3/std/bit>
 #include <seqan3/std/concepts>
+#include <cstring>
 #include <iterator>
 #include <seqan3/std/ranges>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <vector>
 
 #include <seqan3/alphabet/detail/convert.hpp>
@@ -33,6 +36,7 @@
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/alignment_file/output_format_concept.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
@@ -150,13 +154,118 @@ protected:
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(e_value),
                                 [[maybe_unused]] double SEQAN3_DOXYGEN_ONLY(bit_score));
 
+    /*!\brief The reference region covered by the record read last.
+     * \returns The reference id, the begin and the end position of the alignment; the end is `begin + 1` for records
+     *          without reference-consuming cigar operations. The reference id is -1 for unplaced records.
+     *
+     * \details
+     *
+     * Used by seqan3::alignment_file_input::region to filter the records of a region query.
+     */
+    std::tuple<int32_t, int32_t, int32_t> last_record_region() const noexcept
+    {
+        return last_region;
+    }
+
+    /*!\brief Reads the header of the file if it was not read yet.
+     * \tparam stream_type   The type of the input stream.
+     * \tparam ref_seqs_type The type of the reference sequences (or std::ignore).
+     * \tparam ref_ids_type  The type of the reference ids of the header.
+     * \param[in, out] stream   The stream to read from.
+     * \param[in]      ref_seqs The reference sequences to check the header against.
+     * \param[out]     header   The header to fill.
+     * \throws seqan3::format_error If the header is invalid.
+     */
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_file_header(stream_type & stream,
+                          ref_seqs_type & ref_seqs,
+                          alignment_file_header<ref_ids_type> & header)
+    {
+        if (!header_was_read)
+        {
+            auto stream_view = seqan3::views::istreambuf(stream);
+            read_bam_header(stream_view, ref_seqs, header);
+        }
+    }
+
+    /*!\brief Reads the bytes of the next alignment record without decoding them.
+     * \tparam stream_type   The type of the input stream.
+     * \tparam ref_seqs_type The type of the reference sequences (or std::ignore).
+     * \tparam ref_ids_type  The type of the reference ids of the header.
+     * \param[in, out] stream     The stream to read from.
+     * \param[in]      ref_seqs   The reference sequences to check the header against.
+     * \param[out]     header     The header; it is read before the first record.
+     * \param[out]     raw_record The bytes of the record without the leading block size; empty if no record follows.
+     * \throws seqan3::format_error If the record is truncated or its lengths are inconsistent.
+     *
+     * \details
+     *
+     * Only the lengths of the variable-sized fields are validated (see seqan3::bam_record).
+     */
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_raw_alignment_record(stream_type & stream,
+                                   ref_seqs_type & ref_seqs,
+                                   alignment_file_header<ref_ids_type> & header,
+                                   std::string & raw_record);
+
+    /*!\brief Writes the bytes of an alignment record that was read by read_raw_alignment_record.
+     * \tparam stream_type The type of the output stream.
+     * \tparam header_type The type of the header.
+     * \param[out] stream     The stream to write to.
+     * \param[in]  options    The options of the output file.
+     * \param[in]  header     The header; it is written before the first record.
+     * \param[in]  raw_record The bytes of the record without the leading block size.
+     */
+    template <typename stream_type, typename header_type>
+    void write_raw_alignment_record(stream_type & stream,
+                                    alignment_file_output_options const & options,
+                                    header_type & header,
+                                    std::string_view const raw_record)
+    {
+        if (!header_was_written)
+            write_bam_header(stream, options, header);
+
+        int32_t const block_size = raw_record.size();
+        stream.write(reinterpret_cast<char const *>(&block_size), sizeof(block_size));
+        stream.write(raw_record.data(), raw_record.size());
+    }
+
+    /*!\brief Writes the header if it was not written yet.
+     * \tparam stream_type The type of the output stream.
+     * \tparam header_type The type of the header (or std::ignore).
+     * \param[out] stream  The stream to write to.
+     * \param[in]  options The options of the output file.
+     * \param[in]  header  The header.
+     *
+     * \details
+     *
+     * Used by seqan3::alignment_file_output::push_back_batch before it copies the format to encode records.
+     */
+    template <typename stream_type, typename header_type>
+    void write_file_header(stream_type & stream,
+                           alignment_file_output_options const & options,
+                           header_type && header)
+    {
+        if constexpr (!detail::decays_to_ignore_v<header_type>)
+        {
+            if (!header_was_written)
+                write_bam_header(stream, options, header);
+        }
+    }
+
 private:
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
 
+    //!\brief The reference id, begin and end position of the record read last.
+    std::tuple<int32_t, int32_t, int32_t> last_region{-1, -1, -1};
+
     //!\brief Local buffer to read into while avoiding reallocation.
     std::string string_buffer{};
 
+    //!\brief Local buffer to encode the optional fields into while avoiding reallocation.
+    sam_tag_buffer tag_buffer{};
+
     //!\brief Stores all fixed length variables which can be read/written directly by reinterpreting the binary stream.
     struct alignment_record_core
     {   // naming corresponds to official SAM/BAM specifications
@@ -263,7 +372,13 @@ private:
     template <typename cigar_input_type>
     auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
 
-    static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
+    template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+    void read_bam_header(stream_view_type & stream_view,
+                         ref_seqs_type & ref_seqs,
+                         alignment_file_header<ref_ids_type> & header);
+
+    template <typename stream_type, typename header_type>
+    void write_bam_header(stream_type & stream, alignment_file_output_options const & options, header_type & header);
 };
 
 //!\copydoc alignment_file_input_format::read_alignment_record
@@ -328,51 +443,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t tmp32{};
-        read_field(stream_view, tmp32);
-
-        if (tmp32 > 0) // header text is present
-            read_header(stream_view | views::take_exactly_or_throw(tmp32), header, ref_seqs);
-
-        int32_t n_ref;
-        read_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
-
-            string_buffer.resize(tmp32 - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
-            std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
-
-            read_field(stream_view, tmp32); // l_ref (length of reference sequence)
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
-                                                     "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(), ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
-                                                     " does not correspond to the position ", id_it->second,
-                                                     " in the header (header.ref_ids():", header.ref_ids(), ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
-        header_was_read = true;
+        read_bam_header(stream_view, ref_seqs, header);
 
         if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
             return;
@@ -423,9 +494,17 @@ inline void format_bam::read_alignment_record(stream_type & stream,
         transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
         // the actual cigar_vector is swapped with tmp_cigar_vector at the end to avoid copying
     }
-    else
+    else // only the length of the alignment on the reference is needed
     {
-        detail::consume(stream_view | views::take_exactly_or_throw(core.n_cigar_op * 4));
+        uint32_t operation{};
+
+        for (uint32_t i = 0; i < core.n_cigar_op; ++i)
+        {
+            read_field(stream_view, operation);
+
+            if ((0b110001101u >> (operation & 0xf)) & 1u) // M, D, N, = and X consume the reference
+                ref_length += operation >> 4;
+        }
     }
 
     offset = offset_tmp;
@@ -516,9 +595,9 @@ inline void format_bam::read_alignment_record(stream_type & stream,
 
             if constexpr (!detail::decays_to_ignore_v<align_type>)
             {
-                assign_unaligned(get<1>(align),
-                                 seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
-                                                    std::ranges::distance(seq) - soft_clipping_end));
+                assign_aligned_query(align,
+                             seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
+                                                std::ranges::distance(seq) - soft_clipping_end));
             }
         }
     }
@@ -533,10 +612,23 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     int32_t remaining_bytes = core.block_size - (sizeof(alignment_record_core) - 4/*block_size excluded*/) -
                               core.l_read_name - core.n_cigar_op * 4 - (core.l_seq + 1) / 2 - core.l_seq;
     assert(remaining_bytes >= 0);
-    auto tags_view = stream_view | views::take_exactly_or_throw(remaining_bytes);
 
-    while (tags_view.size() > 0)
-        read_field(tags_view, tag_dict);
+    if constexpr (std::same_as<tag_dict_type, sam_tag_buffer>)
+    {
+        string_buffer.resize(remaining_bytes);
+
+        if (stream.rdbuf()->sgetn(string_buffer.data(), remaining_bytes) != remaining_bytes)
+            throw unexpected_end_of_input{"Reached end of input before the optional fields of the record were read."};
+
+        tag_dict.assign_binary(string_buffer);
+    }
+    else
+    {
+        auto tags_view = stream_view | views::take_exactly_or_throw(remaining_bytes);
+
+        while (tags_view.size() > 0)
+            read_field(tags_view, tag_dict);
+    }
 
     // DONE READING - wrap up
     // -------------------------------------------------------------------------------------------------------------
@@ -556,25 +648,32 @@ inline void format_bam::read_alignment_record(stream_type & stream,
             }
             else
             {
-                auto it = tag_dict.find("CG"_tag);
-
-                if (it == tag_dict.end())
+                if (tag_dict.count("CG"_tag) == 0)
                     throw format_error{detail::to_string("The cigar string '", offset_tmp, "S", ref_length,
                                    "N' suggests that the cigar string exceeded 65535 elements and was therefore ",
                                    "stored in the optional field CG but this tag is not present in the given ",
                                    "record.")};
 
-                auto cigar_view = std::views::all(std::get<std::string>(it->second));
-                std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_cigar(cigar_view);
+                if constexpr (std::same_as<tag_dict_type, sam_tag_buffer>)
+                {
+                    std::tie(tmp_cigar_vector, ref_length, seq_length) =
+                        parse_cigar(tag_dict.template get<std::string_view>("CG"_tag));
+                }
+                else
+                {
+                    auto cigar_view = std::views::all(std::get<std::string>(tag_dict.at("CG"_tag)));
+                    std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_cigar(cigar_view);
+                }
+
                 offset_tmp = soft_clipping_end = 0;
                 transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
-                tag_dict.erase(it); // remove redundant information
+                tag_dict.erase("CG"_tag); // remove redundant information
 
                 if constexpr (!detail::decays_to_ignore_v<align_type>)
                 {
-                    assign_unaligned(get<1>(align),
-                                     seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
-                                                        std::ranges::distance(seq) - soft_clipping_end));
+                    assign_aligned_query(align,
+                                 seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
+                                                    std::ranges::distance(seq) - soft_clipping_end));
                 }
             }
         }
@@ -586,6 +685,8 @@ inline void format_bam::read_alignment_record(stream_type & stream,
 
     if constexpr (!detail::decays_to_ignore_v<cigar_type>)
         std::swap(cigar_vector, tmp_cigar_vector);
+
+    last_region = {core.refID, core.pos, core.pos + std::max<int32_t>(ref_length, 1)};
 }
 
 //!\copydoc alignment_file_output_format::write_alignment_record
@@ -651,8 +752,8 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
                   "value_type is comparable to seqan3::gap");
 
     static_assert((std::tuple_size_v<std::remove_cvref_t<align_type>> == 2 &&
-                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(std::get<0>(align))>> &&
-                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(std::get<1>(align))>>),
+                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(get<0>(align))>> &&
+                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(get<1>(align))>>),
                   "The align object must be a std::pair of two ranges whose "
                   "value_type is comparable to seqan3::gap");
 
@@ -678,8 +779,9 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
                   "2) a std::integral or std::optional<std::integral>, and "
                   "3) a std::integral.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary> ||
+                  std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_buffer>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or seqan3::sam_tag_buffer.");
 
     if constexpr (detail::decays_to_ignore_v<header_type>)
     {
@@ -702,31 +804,7 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
         // Writing the BAM Header on first call
         // ---------------------------------------------------------------------
         if (!header_was_written)
-        {
-            stream << "BAM\1";
-            std::ostringstream os;
-            write_header(os, options, header); // write SAM header to temporary stream to query the size.
-            int32_t l_text{static_cast<int32_t>(os.str().size())};
-            std::ranges::copy_n(reinterpret_cast<char *>(&l_text), 4, stream_it); // write read id
-
-            stream  << os.str();
-
-            int32_t n_ref{static_cast<int32_t>(header.ref_ids().size())};
-            std::ranges::copy_n(reinterpret_cast<char *>(&n_ref), 4, stream_it); // write read id
-
-            for (int32_t ridx = 0; ridx < n_ref; ++ridx)
-            {
-                int32_t l_name{static_cast<int32_t>(header.ref_ids()[ridx].size()) + 1}; // plus null character
-                std::ranges::copy_n(reinterpret_cast<char *>(&l_name), 4, stream_it);    // write l_name
-                // write reference name:
-                std::ranges::copy(header.ref_ids()[ridx].begin(), header.ref_ids()[ridx].end(), stream_it);
-                stream_it = '\0';
-                // write reference sequence length:
-                std::ranges::copy_n(reinterpret_cast<char *>(&get<0>(header.ref_id_info[ridx])), 4, stream_it);
-            }
-
-            header_was_written = true;
-        }
+            write_bam_header(stream, options, header);
 
         // ---------------------------------------------------------------------
         // Writing the Record
@@ -741,6 +819,17 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
             for (auto & [count, operation] : cigar_vector)
                 update_alignment_lengths(ref_length, dummy_seq_length, operation.to_char(), count);
         }
+        else if constexpr (detail::is_cigar_alignment_v<std::remove_cvref_t<align_type>>)
+        {
+            // the CIGAR operations are stored, only the soft clipping at the end needs to be computed
+            if (!std::ranges::empty(align))
+            {
+                ref_length = std::ranges::size(align);
+                int32_t const off_end = static_cast<int32_t>(std::ranges::distance(seq)) - offset -
+                                        static_cast<int32_t>(std::ranges::size(align.query()));
+                cigar_vector = align.cigar_vector(offset, off_end);
+            }
+        }
         else if (!std::ranges::empty(get<0>(align)) && !std::ranges::empty(get<1>(align)))
         {
             ref_length = std::ranges::distance(get<1>(align));
@@ -759,15 +848,37 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
             cigar_vector = detail::get_cigar_vector(align, offset, off_end);
         }
 
+        // the encoded tags are either those of the given seqan3::sam_tag_buffer or those in tag_buffer
+        std::string_view tag_dict_binary_str{};
+
+        if constexpr (std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_buffer>)
+        {
+            tag_dict_binary_str = tag_dict.binary();
+        }
+
         if (cigar_vector.size() >= (1 << 16)) // must be written into the sam tag CG
         {
-            tag_dict["CG"_tag] = detail::get_cigar_string(cigar_vector);
+            if constexpr (std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_buffer>)
+            {
+                tag_buffer = tag_dict;
+                tag_buffer.set("CG"_tag, detail::get_cigar_string(cigar_vector));
+                tag_dict_binary_str = tag_buffer.binary();
+            }
+            else
+            {
+                tag_dict["CG"_tag] = detail::get_cigar_string(cigar_vector);
+            }
+
             cigar_vector.resize(2);
             cigar_vector[0] = cigar{static_cast<uint32_t>(std::ranges::distance(seq)), 'S'_cigar_op};
             cigar_vector[1] = cigar{static_cast<uint32_t>(std::ranges::distance(get<1>(align))), 'N'_cigar_op};
         }
 
-        std::string tag_dict_binary_str = get_tag_dict_str(tag_dict);
+        if constexpr (std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>)
+        {
+            tag_buffer.assign(tag_dict);
+            tag_dict_binary_str = tag_buffer.binary();
+        }
 
         // Compute the value for the l_read_name field for the bam record.
         // This value is stored including a trailing `0`, so at most 254 characters of the id can be stored, since
@@ -909,10 +1020,151 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
         }
 
         // write optional fields
-        stream << tag_dict_binary_str;
+        stream.write(tag_dict_binary_str.data(), tag_dict_binary_str.size());
     } // if constexpr (!detail::decays_to_ignore_v<header_type>)
 }
 
+//!\copydoc format_bam::read_raw_alignment_record
+template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_raw_alignment_record(stream_type & stream,
+                                                  ref_seqs_type & ref_seqs,
+                                                  alignment_file_header<ref_ids_type> & header,
+                                                  std::string & raw_record)
+{
+    read_file_header(stream, ref_seqs, header);
+
+    raw_record.clear();
+
+    int32_t block_size{};
+    std::streamsize const count = stream.rdbuf()->sgetn(reinterpret_cast<char *>(&block_size), sizeof(block_size));
+
+    if (count == 0) // no records follow
+        return;
+
+    if (count != sizeof(block_size) || block_size < static_cast<int32_t>(sizeof(alignment_record_core) - 4))
+        throw format_error{"Unexpected end of input while reading a BAM record."};
+
+    raw_record.resize(block_size);
+
+    if (stream.rdbuf()->sgetn(raw_record.data(), block_size) != block_size)
+        throw format_error{"Unexpected end of input while reading a BAM record."};
+
+    alignment_record_core core;
+    std::memcpy(reinterpret_cast<char *>(&core) + 4, raw_record.data(), sizeof(core) - 4);
+
+    if (core.refID >= static_cast<int32_t>(header.ref_ids().size()) || core.refID < -1) // [[unlikely]]
+    {
+        throw format_error{detail::to_string("Reference id index '", core.refID, "' is not in range of ",
+                                             "header.ref_ids(), which has size ", header.ref_ids().size(), ".")};
+    }
+
+    int64_t const fixed_length = (sizeof(core) - 4) + core.l_read_name + core.n_cigar_op * 4 +
+                                 (int64_t{core.l_seq} + 1) / 2 + core.l_seq;
+
+    if (core.l_read_name == 0 || core.l_seq < 0 || fixed_length > block_size)
+        throw format_error{"The lengths of the fields of a BAM record exceed the size of the record."};
+
+    // the reference region for region queries
+    int32_t ref_length{};
+
+    for (uint32_t i = 0; i < core.n_cigar_op; ++i)
+    {
+        uint32_t operation{};
+        std::memcpy(&operation, raw_record.data() + (sizeof(core) - 4) + core.l_read_name + 4 * i, 4);
+
+        if ((0b110001101u >> (operation & 0xf)) & 1u) // M, D, N, = and X consume the reference
+            ref_length += operation >> 4;
+    }
+
+    last_region = {core.refID, core.pos, core.pos + std::max<int32_t>(ref_length, 1)};
+}
+
+//!\brief Reads the BAM header, i.e. the magic string, the SAM header and the reference information.
+template <typename stream_view_type, typename ref_seqs_type, typename ref_ids_type>
+inline void format_bam::read_bam_header(stream_view_type & stream_view,
+                                        ref_seqs_type & ref_seqs,
+                                        alignment_file_header<ref_ids_type> & header)
+{
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | views::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t tmp32{};
+    read_field(stream_view, tmp32);
+
+    if (tmp32 > 0) // header text is present
+        read_header(stream_view | views::take_exactly_or_throw(tmp32), header, ref_seqs);
+
+    int32_t n_ref;
+    read_field(stream_view, n_ref);
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_field(stream_view, tmp32); // l_name (length of reference name including \0 character)
+
+        string_buffer.resize(tmp32 - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view), tmp32 - 1, string_buffer.data()); // copy without \0 character
+        std::ranges::next(std::ranges::begin(stream_view)); // skip \0 character
+
+        read_field(stream_view, tmp32); // l_ref (length of reference sequence)
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer +
+                                                 "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(), ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '", string_buffer, "' at position ", ref_idx,
+                                                 " does not correspond to the position ", id_it->second,
+                                                 " in the header (header.ref_ids():", header.ref_ids(), ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != tmp32) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
+
+    header_was_read = true;
+}
+
+//!\brief Writes the BAM header, i.e. the magic string, the SAM header and the reference information.
+template <typename stream_type, typename header_type>
+inline void format_bam::write_bam_header(stream_type & stream,
+                                         alignment_file_output_options const & options,
+                                         header_type & header)
+{
+    detail::fast_ostreambuf_iterator stream_it{*stream.rdbuf()};
+
+    stream << "BAM\1";
+    std::ostringstream os;
+    write_header(os, options, header); // write SAM header to temporary stream to query the size.
+    int32_t l_text{static_cast<int32_t>(os.str().size())};
+    std::ranges::copy_n(reinterpret_cast<char *>(&l_text), 4, stream_it); // write read id
+
+    stream  << os.str();
+
+    int32_t n_ref{static_cast<int32_t>(header.ref_ids().size())};
+    std::ranges::copy_n(reinterpret_cast<char *>(&n_ref), 4, stream_it); // write read id
+
+    for (int32_t ridx = 0; ridx < n_ref; ++ridx)
+    {
+        int32_t l_name{static_cast<int32_t>(header.ref_ids()[ridx].size()) + 1}; // plus null character
+        std::ranges::copy_n(reinterpret_cast<char *>(&l_name), 4, stream_it);    // write l_name
+        // write reference name:
+        std::ranges::copy(header.ref_ids()[ridx].begin(), header.ref_ids()[ridx].end(), stream_it);
+        stream_it = '\0';
+        // write reference sequence length:
+        std::ranges::copy_n(reinterpret_cast<char *>(&get<0>(header.ref_id_info[ridx])), 4, stream_it);
+    }
+
+    header_was_written = true;
+}
+
 //!\copydoc seqan3::format_sam::read_sam_dict_vector
 template <typename stream_view_type, typename value_type>
 inline void format_bam::read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
@@ -1132,92 +1384,4 @@ inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input, uint
     return std::tuple{operations, ref_length, seq_length};
 }
 
-/*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
- * \param[in] tag_dict The tag dictionary to print.
- */
-inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_dict)
-{
-    std::string result{};
-
-    auto stream_variant_fn = [&result] (auto && arg) // helper to print an std::variant
-    {
-        // T is either char, int32_t, float, std::string, or a std::vector<some int>
-        using T = std::remove_cvref_t<decltype(arg)>;
-
-        if constexpr (std::same_as<T, int32_t>)
-        {
-            // always choose the smallest possible representation [cCsSiI]
-            size_t const absolute_arg = std::abs(arg);
-            auto n = std::countr_zero(std::bit_ceil(absolute_arg + 1u) >> 1u) / 8u;
-            bool const negative = arg < 0;
-            n = n * n + 2 * negative; // for switch case order
-
-            switch (n)
-            {
-                case 0:
-                {
-                    result[result.size() - 1] = 'C';
-                    result.append(reinterpret_cast<char const *>(&arg), 1);
-                    break;
-                }
-                case 1:
-                {
-                    result[result.size() - 1] = 'S';
-                    result.append(reinterpret_cast<char const *>(&arg), 2);
-                    break;
-                }
-                case 2:
-                {
-                    result[result.size() - 1] = 'c';
-                    int8_t tmp = static_cast<int8_t>(arg);
-                    result.append(reinterpret_cast<char const *>(&tmp), 1);
-                    break;
-                }
-                case 3:
-                {
-                    result[result.size() - 1] = 's';
-                    int16_t tmp = static_cast<int16_t>(arg);
-                    result.append(reinterpret_cast<char const *>(&tmp), 2);
-                    break;
-                }
-                default:
-                {
-                    result.append(reinterpret_cast<char const *>(&arg), 4); // always i
-                    break;
-                }
-            }
-        }
-        else if constexpr (std::same_as<T, std::string>)
-        {
-            result.append(reinterpret_cast<char const *>(arg.data()), arg.size() + 1/*+ null character*/);
-        }
-        else if constexpr (!std::ranges::range<T>) // char, float
-        {
-            result.append(reinterpret_cast<char const *>(&arg), sizeof(arg));
-        }
-        else // std::vector of some arithmetic_type type
-        {
-            int32_t sz{static_cast<int32_t>(arg.size())};
-            result.append(reinterpret_cast<char *>(&sz), 4);
-            result.append(reinterpret_cast<char const *>(arg.data()),
-                          arg.size() * sizeof(std::ranges::range_value_t<T>));
-        }
-    };
-
-    for (auto & [tag, variant] : tag_dict)
-    {
-        result.push_back(static_cast<char>(tag / 256));
-        result.push_back(static_cast<char>(tag % 256));
-
-        result.push_back(detail::sam_tag_type_char[variant.index()]);
-
-        if (!is_char<'\0'>(detail::sam_tag_type_char_extra[variant.index()]))
-            result.push_back(detail::sam_tag_type_char_extra[variant.index()]);
-
-        std::visit(stream_variant_fn, variant);
-    }
-
-    return result;
-}
-
 } // namespace seqan3
@@ -31,6 +31,7 @@
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/alignment_file/output_format_concept.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
@@ -237,6 +238,32 @@ protected:
                                 e_value_type && SEQAN3_DOXYGEN_ONLY(e_value),
                                 bit_score_type && SEQAN3_DOXYGEN_ONLY(bit_score));
 
+    /*!\brief Writes the header if it is required and was not written yet.
+     * \tparam stream_type The type of the output stream.
+     * \tparam header_type The type of the header (or std::ignore).
+     * \param[out] stream  The stream to write to.
+     * \param[in]  options The options of the output file.
+     * \param[in]  header  The header.
+     *
+     * \details
+     *
+     * Used by seqan3::alignment_file_output::push_back_batch before it copies the format to encode records.
+     */
+    template <typename stream_type, typename header_type>
+    void write_file_header(stream_type & stream,
+                           alignment_file_output_options const & options,
+                           header_type && header)
+    {
+        if constexpr (!detail::decays_to_ignore_v<header_type>)
+        {
+            if (options.sam_require_header && !header_was_written)
+            {
+                write_header(stream, options, header);
+                header_was_written = true;
+            }
+        }
+    }
+
 private:
     //!\brief Stores quality values temporarily if seq and qual information are combined (not supported by SAM yet).
     std::string tmp_qual{};
@@ -273,6 +300,9 @@ private:
     template <typename stream_view_type>
     void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
 
+    template <typename stream_view_type>
+    void read_field(stream_view_type && stream_view, sam_tag_buffer & target);
+
     template <typename stream_it_t, std::ranges::forward_range field_type>
     void write_range_or_asterisk(stream_it_t & stream_it, field_type && field_value);
 
@@ -281,6 +311,9 @@ private:
 
     template <typename stream_it_t>
     void write_tag_fields(stream_it_t & stream, sam_tag_dictionary const & tag_dict, char const separator);
+
+    template <typename stream_it_t>
+    void write_tag_fields(stream_it_t & stream, sam_tag_buffer const & tag_buffer, char const separator);
 };
 
 //!\copydoc sequence_file_input_format::read_sequence_record
@@ -565,9 +598,9 @@ inline void format_sam::read_alignment_record(stream_type & stream,
             {
                 if (!tmp_cigar_vector.empty()) // if no alignment info is given, the field::alignment should remain empty
                 {
-                    assign_unaligned(get<1>(align),
-                                     seq | views::slice(static_cast<decltype(std::ranges::size(seq))>(offset_tmp),
-                                                       std::ranges::size(seq) - soft_clipping_end));
+                    assign_aligned_query(align,
+                                 seq | views::slice(static_cast<decltype(std::ranges::size(seq))>(offset_tmp),
+                                                   std::ranges::size(seq) - soft_clipping_end));
                 }
             }
         }
@@ -595,6 +628,9 @@ inline void format_sam::read_alignment_record(stream_type & stream,
 
     // All remaining optional fields if any: SAM tags dictionary
     // -------------------------------------------------------------------------------------------------------------
+    if constexpr (std::same_as<tag_dict_type, sam_tag_buffer>)
+        tag_dict.clear(); // the tags are encoded straight into the buffer
+
     while (is_char<'\t'>(*std::ranges::begin(stream_view))) // read all tags if present
     {
         std::ranges::next(std::ranges::begin(stream_view)); // skip tab
@@ -704,8 +740,8 @@ inline void format_sam::write_alignment_record(stream_type & stream,
                   "value_type is comparable to seqan3::gap");
 
     static_assert((std::tuple_size_v<std::remove_cvref_t<align_type>> == 2 &&
-                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(std::get<0>(align))>> &&
-                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(std::get<1>(align))>>),
+                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(get<0>(align))>> &&
+                   std::equality_comparable_with<gap, std::ranges::range_reference_t<decltype(get<1>(align))>>),
                   "The align object must be a std::pair of two ranges whose "
                   "value_type is comparable to seqan3::gap");
 
@@ -736,8 +772,9 @@ inline void format_sam::write_alignment_record(stream_type & stream,
         static_assert(!detail::decays_to_ignore_v<header_type>,
                       "If you give indices as mate reference id information the header must also be present.");
 
-    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary>,
-                  "The tag_dict object must be of type seqan3::sam_tag_dictionary.");
+    static_assert(std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_dictionary> ||
+                  std::same_as<std::remove_cvref_t<tag_dict_type>, sam_tag_buffer>,
+                  "The tag_dict object must be of type seqan3::sam_tag_dictionary or seqan3::sam_tag_buffer.");
 
     // ---------------------------------------------------------------------
     // logical Requirements
@@ -840,6 +877,19 @@ inline void format_sam::write_alignment_record(stream_type & stream,
         for (auto & c : cigar_vector) //TODO THIS IS PROBABLY TERRIBLE PERFORMANCE_WISE
             stream_it.write_range(c.to_string());
     }
+    else if constexpr (detail::is_cigar_alignment_v<std::remove_cvref_t<align_type>>)
+    {
+        // the CIGAR operations are stored, only the soft clipping at the end needs to be computed
+        if (!std::ranges::empty(align))
+        {
+            size_t const off_end{std::ranges::size(seq) - offset - std::ranges::size(align.query())};
+            write_range_or_asterisk(stream_it, detail::get_cigar_string(align.cigar_vector(offset, off_end)));
+        }
+        else
+        {
+            *stream_it = '*';
+        }
+    }
     else if (!std::ranges::empty(get<0>(align)) && !std::ranges::empty(get<1>(align)))
     {
         // compute possible distance from alignment end to sequence end
@@ -1052,6 +1102,122 @@ inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_dict
     }
 }
 
+/*!\brief Reads the optional tag fields into the seqan3::sam_tag_buffer.
+ * \tparam stream_view_type   The type of the stream as a view.
+ *
+ * \param[in, out] stream_view  The stream view to iterate over.
+ * \param[in, out] target       The seqan3::sam_tag_buffer to append the tag to.
+ *
+ * \throws seqan3::format_error if any unexpected character or format is encountered.
+ *
+ * \details
+ *
+ * Reads the same fields as the overload for seqan3::sam_tag_dictionary, but encodes the value straight into the
+ * buffer: strings are appended character by character and arrays element by element. In contrast to the
+ * dictionary, hex strings (type 'H') are stored as well. A tag that is already stored is replaced.
+ */
+template <typename stream_view_type>
+inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_buffer & target)
+{
+    uint16_t tag = static_cast<uint16_t>(*std::ranges::begin(stream_view)) << 8;
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    tag += static_cast<uint16_t>(*std::ranges::begin(stream_view));
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
+    char type_id = *std::ranges::begin(stream_view);
+    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
+
+    target.erase(tag); // the last value of a tag wins, like in the seqan3::sam_tag_dictionary
+
+    auto read_array = [&] (auto value)
+    {
+        target.push_back_array<decltype(value)>(tag);
+
+        while (std::ranges::begin(stream_view) != ranges::end(stream_view)) // not fully consumed yet
+        {
+            read_field(stream_view | views::take_until(is_char<','>), value);
+            target.push_back_element(value);
+
+            if (is_char<','>(*std::ranges::begin(stream_view)))
+                std::ranges::next(std::ranges::begin(stream_view)); // skip ','
+        }
+    };
+
+    switch (type_id)
+    {
+        case 'A' : // char
+        {
+            target.push_back(tag, static_cast<char>(*std::ranges::begin(stream_view)));
+            std::ranges::next(std::ranges::begin(stream_view)); // skip char that has been read
+            break;
+        }
+        case 'i' : // int32_t
+        {
+            int32_t tmp;
+            read_field(stream_view, tmp);
+            target.push_back(tag, tmp);
+            break;
+        }
+        case 'f' : // float
+        {
+            float tmp;
+            read_field(stream_view, tmp);
+            target.push_back(tag, tmp);
+            break;
+        }
+        case 'Z' : // string
+        case 'H' : // hex string
+        {
+            target.push_back_string(tag, type_id);
+
+            for (char const chr : stream_view)
+                target.push_back_char(chr);
+
+            break;
+        }
+        case 'B' : // Array. Value type depends on second char [cCsSiIf]
+        {
+            char array_value_type_id = *std::ranges::begin(stream_view);
+            std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
+            std::ranges::next(std::ranges::begin(stream_view)); // skip first ','
+
+            switch (array_value_type_id)
+            {
+                case 'c' : // int8_t
+                    read_array(int8_t{});
+                    break;
+                case 'C' : // uint8_t
+                    read_array(uint8_t{});
+                    break;
+                case 's' : // int16_t
+                    read_array(int16_t{});
+                    break;
+                case 'S' : // uint16_t
+                    read_array(uint16_t{});
+                    break;
+                case 'i' : // int32_t
+                    read_array(int32_t{});
+                    break;
+                case 'I' : // uint32_t
+                    read_array(uint32_t{});
+                    break;
+                case 'f' : // float
+                    read_array(float{});
+                    break;
+                default:
+                    throw format_error{std::string("The first character in the numerical ") +
+                                       "id of a SAM tag must be one of [cCsSiIf] but '" + array_value_type_id +
+                                       "' was given."};
+            }
+            break;
+        }
+        default:
+            throw format_error{std::string("The second character in the numerical id of a "
+                               "SAM tag must be one of [A,i,Z,H,B,f] but '") + type_id + "' was given."};
+    }
+}
+
 /*!\brief Writes a field value to the stream.
  * \tparam stream_it_t The stream iterator type.
  * \tparam field_type  The type of the field value. Must model std::ranges::forward_range.
@@ -1071,7 +1237,7 @@ inline void format_sam::write_range_or_asterisk(stream_it_t & stream_it, field_t
         if constexpr (std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<field_type>>, char>)
             stream_it.write_range(field_value);
         else // convert from alphabets to their character representation
-            stream_it.write_range(field_value | views::to_char);
+            stream_it.write_chars_of(field_value);
     }
 }
 
@@ -1167,4 +1333,84 @@ inline void format_sam::write_tag_fields(stream_it_t & stream_it, sam_tag_dictio
     }
 }
 
+/*!\brief Writes the optional fields of the seqan3::sam_tag_buffer.
+ * \tparam stream_it_t      The stream iterator's type.
+ *
+ * \param[in,out] stream_it  The stream iterator to print to.
+ * \param[in]     tag_buffer The tag buffer to print.
+ * \param[in]     separator  The field separator to append.
+ *
+ * \details
+ *
+ * The values are decoded straight from the buffer. All integer types are written as type 'i'.
+ */
+template <typename stream_it_t>
+inline void format_sam::write_tag_fields(stream_it_t & stream_it,
+                                         sam_tag_buffer const & tag_buffer,
+                                         char const separator)
+{
+    auto const type_is_integer = [] (char const type)
+    {
+        return type == 'c' || type == 'C' || type == 's' || type == 'S' || type == 'i' || type == 'I';
+    };
+
+    auto const write_array = [&] (auto const & entry, auto element)
+    {
+        using element_t = decltype(element);
+
+        for (uint32_t i = 0; i < entry.length; ++i)
+        {
+            *stream_it = ',';
+            stream_it.write_number(tag_buffer.get_element<element_t>(entry, i));
+        }
+    };
+
+    for (auto const & entry : tag_buffer.tag_entries())
+    {
+        bool const is_integer = type_is_integer(entry.type);
+
+        *stream_it = separator;
+        *stream_it = static_cast<char>(entry.tag / 256);
+        *stream_it = static_cast<char>(entry.tag % 256);
+        *stream_it = ':';
+        *stream_it = is_integer ? 'i' : entry.type; // SAM only knows int32_t
+        *stream_it = ':';
+
+        if (is_integer)
+        {
+            stream_it.write_number(tag_buffer.get<int64_t>(entry));
+            continue;
+        }
+
+        switch (entry.type)
+        {
+            case 'A':
+                *stream_it = tag_buffer.get<char>(entry);
+                break;
+            case 'f':
+                stream_it.write_number(tag_buffer.get<float>(entry));
+                break;
+            case 'B':
+            {
+                *stream_it = entry.array_type;
+
+                switch (entry.array_type)
+                {
+                    case 'c': write_array(entry, int8_t{}); break;
+                    case 'C': write_array(entry, uint8_t{}); break;
+                    case 's': write_array(entry, int16_t{}); break;
+                    case 'S': write_array(entry, uint16_t{}); break;
+                    case 'i': write_array(entry, int32_t{}); break;
+                    case 'I': write_array(entry, uint32_t{}); break;
+                    default:  write_array(entry, float{}); break;
+                }
+                break;
+            }
+            default: // 'Z' and 'H'
+                stream_it.write_range(tag_buffer.get<std::string_view>(entry));
+                break;
+        }
+    }
+}
+
 } // namespace seqan3
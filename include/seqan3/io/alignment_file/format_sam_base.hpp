@@ -24,6 +24,7 @@
 #include <seqan3/core/detail/debug_stream_range.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
@@ -51,6 +52,29 @@
 namespace seqan3::detail
 {
 
+/*!\brief The type of the unaligned reference sequence of an alignment read from SAM or BAM.
+ * \ingroup alignment_file
+ * \tparam align_type The type of the alignment.
+ */
+template <typename align_type>
+struct alignment_reference
+{
+    //!\brief The unaligned sequence type of the first row.
+    using type = std::remove_cvref_t<unaligned_seq_t<decltype(std::get<0>(std::declval<align_type &>()))>>;
+};
+
+/*!\brief A seqan3::cigar_alignment stores the unaligned reference sequence.
+ * \ingroup alignment_file
+ * \tparam reference_t The type of the reference sequence.
+ * \tparam query_t     The type of the query sequence.
+ */
+template <typename reference_t, typename query_t>
+struct alignment_reference<cigar_alignment<reference_t, query_t>>
+{
+    //!\brief The type of the reference sequence.
+    using type = reference_t;
+};
+
 /*!\brief The alignment base format.
  * \ingroup alignment_file
  *
@@ -99,6 +123,12 @@ protected:
                                          char const cigar_operation,
                                          uint32_t const cigar_count);
 
+    template <typename align_type, typename unaligned_type>
+    static void assign_aligned_reference(align_type & align, unaligned_type && reference);
+
+    template <typename align_type, typename unaligned_type>
+    static void assign_aligned_query(align_type & align, unaligned_type && query);
+
     template <typename align_type, typename ref_seqs_type>
     void construct_alignment(align_type                           & align,
                              std::vector<cigar>                   & cigar_vector,
@@ -286,6 +316,36 @@ inline std::tuple<std::vector<cigar>, int32_t, int32_t> format_sam_base::parse_c
     return {operations, ref_length, seq_length};
 }
 
+/*!\brief Assigns the aligned part of the reference sequence to the first row of the alignment.
+ * \tparam align_type     The alignment type.
+ * \tparam unaligned_type The type of the reference sequence.
+ * \param[in,out] align   The alignment to fill.
+ * \param[in] reference   The aligned part of the reference sequence.
+ */
+template <typename align_type, typename unaligned_type>
+inline void format_sam_base::assign_aligned_reference(align_type & align, unaligned_type && reference)
+{
+    if constexpr (is_cigar_alignment_v<align_type>)
+        align.assign_reference(std::forward<unaligned_type>(reference));
+    else
+        assign_unaligned(get<0>(align), std::forward<unaligned_type>(reference));
+}
+
+/*!\brief Assigns the aligned part of the query sequence to the second row of the alignment.
+ * \tparam align_type     The alignment type.
+ * \tparam unaligned_type The type of the query sequence.
+ * \param[in,out] align   The alignment to fill.
+ * \param[in] query       The aligned part of the query sequence.
+ */
+template <typename align_type, typename unaligned_type>
+inline void format_sam_base::assign_aligned_query(align_type & align, unaligned_type && query)
+{
+    if constexpr (is_cigar_alignment_v<align_type>)
+        align.assign_query(std::forward<unaligned_type>(query));
+    else
+        assign_unaligned(get<1>(align), std::forward<unaligned_type>(query));
+}
+
 /*!\brief Construct the field::alignment depending on the given information.
  * \tparam align_type      The alignment type.
  * \tparam ref_seqs_type   The type of reference sequences (might decay to ignore).
@@ -295,6 +355,10 @@ inline std::tuple<std::vector<cigar>, int32_t, int32_t> format_sam_base::parse_c
  * \param[in] ref_seqs     The reference sequence information.
  * \param[in] ref_start    The start position of the alignment in the reference sequence.
  * \param[in] ref_length   The length of the aligned reference sequence.
+ *
+ * \details
+ *
+ * A seqan3::cigar_alignment only stores the CIGAR operations, all other alignment types are filled with gaps.
  */
 template <typename align_type, typename ref_seqs_type>
 inline void format_sam_base::construct_alignment(align_type                           & align,
@@ -304,19 +368,27 @@ inline void format_sam_base::construct_alignment(align_type
                                                  [[maybe_unused]] int32_t               ref_start,
                                                  size_t                                 ref_length)
 {
+    using unaligned_t = typename alignment_reference<align_type>::type;
+
+    bool query_is_empty{};
+
+    if constexpr (is_cigar_alignment_v<align_type>)
+        query_is_empty = std::ranges::empty(align.query());
+    else
+        query_is_empty = std::ranges::empty(get<1>(align));
+
     if (rid > -1 && ref_start > -1 &&       // read is mapped
-        !cigar_vector.empty() &&                   // alignment field was not empty
-        !std::ranges::empty(get<1>(align))) // seq field was not empty
+        !cigar_vector.empty() &&            // alignment field was not empty
+        !query_is_empty)                    // seq field was not empty
     {
         if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>)
         {
             assert(static_cast<size_t>(ref_start + ref_length) <= std::ranges::size(ref_seqs[rid]));
             // copy over unaligned reference sequence part
-            assign_unaligned(get<0>(align), ref_seqs[rid] | views::slice(ref_start, ref_start + ref_length));
+            assign_aligned_reference(align, ref_seqs[rid] | views::slice(ref_start, ref_start + ref_length));
         }
         else
         {
-            using unaligned_t = std::remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
             auto dummy_seq    = views::repeat_n(std::ranges::range_value_t<unaligned_t>{}, ref_length)
                               | std::views::transform(detail::access_restrictor_fn{});
             static_assert(std::same_as<unaligned_t, decltype(dummy_seq)>,
@@ -325,25 +397,30 @@ inline void format_sam_base::construct_alignment(align_type
                           "views::repeat_n(dna5{}, size_t{}) | "
                           "std::views::transform(detail::access_restrictor_fn{}))");
 
-            assign_unaligned(get<0>(align), dummy_seq); // assign dummy sequence
+            assign_aligned_reference(align, dummy_seq); // assign dummy sequence
         }
 
         // insert gaps according to the cigar information
-        detail::alignment_from_cigar(align, cigar_vector);
+        if constexpr (is_cigar_alignment_v<align_type>)
+            align.assign_cigar(cigar_vector);
+        else
+            detail::alignment_from_cigar(align, cigar_vector);
     }
     else // not enough information for an alignment, assign an empty view/dummy_sequence
     {
         if constexpr (!detail::decays_to_ignore_v<ref_seqs_type>) // reference info given
         {
             assert(std::ranges::size(ref_seqs) > 0); // we assume that the given ref info is not empty
-            assign_unaligned(get<0>(align), ref_seqs[0] | views::slice(0, 0));
+            assign_aligned_reference(align, ref_seqs[0] | views::slice(0, 0));
         }
         else
         {
-            using unaligned_t = std::remove_cvref_t<detail::unaligned_seq_t<decltype(get<0>(align))>>;
-            assign_unaligned(get<0>(align), views::repeat_n(std::ranges::range_value_t<unaligned_t>{}, 0)
+            assign_aligned_reference(align, views::repeat_n(std::ranges::range_value_t<unaligned_t>{}, 0)
                                             | std::views::transform(detail::access_restrictor_fn{}));
         }
+
+        if constexpr (is_cigar_alignment_v<align_type>)
+            align.assign_cigar({});
     }
 }
 
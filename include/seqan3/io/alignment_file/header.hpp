@@ -121,6 +121,12 @@ public:
         return *ref_ids_ptr;
     }
 
+    //!\copydoc ref_ids()
+    ref_ids_type const & ref_ids() const
+    {
+        return *ref_ids_ptr;
+    }
+
     /*!\brief The reference information. (used by the SAM/BAM format)
      *
      * \details
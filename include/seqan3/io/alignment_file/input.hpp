@@ -16,8 +16,12 @@
 #include <seqan3/std/concepts>
 #include <seqan3/std/filesystem>
 #include <fstream>
+#include <memory>
+#include <optional>
 #include <seqan3/std/ranges>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 #include <variant>
 #include <vector>
 
@@ -28,15 +32,20 @@
 #include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/alignment_file/record.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/sequence_record_batch.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/range/decorator/gap_decorator.hpp>
 #include <seqan3/range/views/repeat_n.hpp>
@@ -108,6 +117,14 @@ namespace seqan3
  *            configured in order to allow for automatic type deduction from reference information input on
  *            construction.
  */
+/*!\var static constexpr bool tags_as_buffer
+ * \brief Optional; if `true`, seqan3::field::tags is read into a seqan3::sam_tag_buffer instead of a
+ *        seqan3::sam_tag_dictionary.
+ */
+/*!\var static constexpr bool alignment_as_cigar
+ * \brief Optional; if `true`, seqan3::field::alignment is read into a seqan3::cigar_alignment instead of a pair of
+ *        seqan3::gap_decorator.
+ */
 //!\}
 //!\cond
 template <typename t>
@@ -216,6 +233,28 @@ struct alignment_file_input_default_traits
     //!\}
 };
 
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Whether a traits type of seqan3::alignment_file_input requests the tags as seqan3::sam_tag_buffer.
+ * \ingroup alignment_file
+ */
+template <typename traits_t>
+SEQAN3_CONCEPT alignment_file_input_tags_as_buffer = requires { requires traits_t::tags_as_buffer; };
+
+/*!\brief Whether a traits type of seqan3::alignment_file_input requests the alignment as seqan3::cigar_alignment.
+ * \ingroup alignment_file
+ */
+template <typename traits_t>
+SEQAN3_CONCEPT alignment_file_input_alignment_as_cigar = requires { requires traits_t::alignment_as_cigar; };
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
 // ---------------------------------------------------------------------------------------------------------------------
 // alignment_file_input
 // ---------------------------------------------------------------------------------------------------------------------
@@ -428,6 +467,14 @@ public:
     using cigar_type               = std::vector<cigar>;
     //!\brief The type of field::mate is fixed to std::tuple<ref_id_type, ref_offset_type, int32_t>).
     using mate_type                = std::tuple<ref_id_type, ref_offset_type, int32_t>;
+    /*!\brief The type of field::tags (default seqan3::sam_tag_dictionary).
+     *
+     * If the traits type defines `static constexpr bool tags_as_buffer = true;`, the tags are read into a
+     * seqan3::sam_tag_buffer, which does not allocate memory per tag and copies the tags of BAM records as they are.
+     */
+    using tag_dictionary_type      = std::conditional_t<detail::alignment_file_input_tags_as_buffer<traits_type>,
+                                                        sam_tag_buffer,
+                                                        sam_tag_dictionary>;
     //!\brief The type of field::evalue is fixed to double.
     using e_value_type             = double;
     //!\brief The type of field::bitscore is fixed to double.
@@ -444,9 +491,23 @@ private:
                                      typename traits_type::template sequence_container<
                                          gapped<typename traits_type::sequence_alphabet>>>;
 
+    //!\brief The type of the aligned part of the query sequence if the alignment is read as seqan3::cigar_alignment.
+    using cigar_alignment_query_type = decltype(std::declval<sequence_type &>() | views::slice(0, 0));
+
 public:
-    //!\brief The type of field::alignment (default: std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>).
-    using alignment_type = std::tuple<gap_decorator<ref_sequence_type>, alignment_query_type>;
+    /*!\brief The type of field::alignment (default: std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>).
+     *
+     * If the traits type defines `static constexpr bool alignment_as_cigar = true;`, the alignment is read into a
+     * seqan3::cigar_alignment, which stores the CIGAR operations instead of inserting gaps into both sequences.
+     * This requires seqan3::field::seq to be selected.
+     */
+    using alignment_type = std::conditional_t<detail::alignment_file_input_alignment_as_cigar<traits_type>,
+                                              cigar_alignment<ref_sequence_type, cigar_alignment_query_type>,
+                                              std::tuple<gap_decorator<ref_sequence_type>, alignment_query_type>>;
+
+    static_assert(!detail::alignment_file_input_alignment_as_cigar<traits_type> ||
+                  !selected_field_ids::contains(field::alignment) || selected_field_ids::contains(field::seq),
+                  "If the alignment is read as seqan3::cigar_alignment, field::seq must be selected as well.");
 
     //!\brief The previously defined types aggregated in a seqan3::type_list.
     using field_types = type_list<sequence_type,
@@ -461,7 +522,7 @@ public:
                                   quality_type,
                                   flag_type,
                                   mate_type,
-                                  sam_tag_dictionary,
+                                  tag_dictionary_type,
                                   e_value_type,
                                   bitscore_type,
                                   header_type *>;
@@ -520,6 +581,9 @@ public:
     //!\brief The type of the record, a specialisation of seqan3::record; acts as a tuple of the selected field types.
     using record_type = sam_record<detail::select_types_with_ids_t<field_types, field_ids, selected_field_ids>,
                                    selected_field_ids>;
+
+    //!\brief The type returned by read_batch(); stores the sequences, IDs and qualities column-wise.
+    using batch_type = sequence_record_batch<sequence_type, id_type, quality_type>;
     //!\}
 
     /*!\name Range associated types
@@ -578,8 +642,7 @@ public:
      * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     alignment_file_input(std::filesystem::path filename,
-                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{})
     {
         init_by_filename(std::move(filename));
     }
@@ -654,8 +717,7 @@ public:
     alignment_file_input(std::filesystem::path filename,
                          typename traits_type::ref_ids & ref_ids,
                          typename traits_type::ref_sequences & ref_sequences,
-                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{})
     {
         // initialize reference information
         set_references(ref_ids, ref_sequences);
@@ -810,6 +872,38 @@ public:
     {
         return *begin();
     }
+
+    /*!\brief Reads the sequences, IDs and qualities of the next records into a reusable batch.
+     * \param[in] count The maximal number of records to read.
+     * \returns A reference to the batch; it contains fewer than `count` records only at the end of the file.
+     * \throws seqan3::format_error If a record could not be read.
+     *
+     * \details
+     *
+     * The batch stores the fields seqan3::field::seq, seqan3::field::id and seqan3::field::qual column-wise in
+     * seqan3::concatenated_sequences (see seqan3::sequence_record_batch); the other fields of the records are parsed
+     * but not stored. The batch is owned by the file and overwritten by the next call, which reuses its memory.
+     *
+     * The batch starts with the record that begin() currently points to; afterwards begin() points to the first record
+     * after the batch.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the records read.
+     *
+     * ### Exceptions
+     *
+     * Throws seqan3::format_error if a record could not be read. The batch then contains the records before it.
+     */
+    batch_type & read_batch(size_t const count)
+    {
+        batch_buffer.clear();
+
+        for (auto it = begin(); batch_buffer.size() < count && it != end(); ++it)
+            batch_buffer.push_back(*it);
+
+        return batch_buffer;
+    }
     //!\}
 
     //!\brief The options are public and its members can be set directly.
@@ -829,8 +923,8 @@ public:
      */
     header_type & header()
     {
-        // make sure header is read
-        if (!first_record_was_read)
+        // make sure header is read; formats that can read the header on its own do not buffer the first record
+        if (!first_record_was_read && !read_header_only())
         {
             read_next_record();
             first_record_was_read = true;
@@ -839,19 +933,152 @@ public:
         return *header_ptr;
     }
 
+    /*!\name Region queries
+     * \brief Read only the records of a region of an indexed BAM file.
+     * \{
+     */
+    /*!\brief Loads the index of the file.
+     * \param[in] index_file The `.bai` or `.csi` file.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::format_error If the file is not a valid index.
+     *
+     * \details
+     *
+     * Only needed if the index cannot be found by region(), e.g. because the file was constructed from a stream.
+     */
+    void load_index(std::filesystem::path const & index_file)
+    {
+        index = std::make_unique<bam_index>(index_file);
+    }
+
+    /*!\brief Restricts the file to the records that overlap a region.
+     * \param[in] ref_id The index of the reference sequence in the header.
+     * \param[in] begin  The first position of the region (0-based).
+     * \param[in] end    The position behind the region.
+     * \returns `*this`, so that the records of the region can be iterated directly.
+     * \throws seqan3::file_open_error If no index was loaded and none was found next to the file.
+     * \throws seqan3::format_error If the format does not support region queries or the file cannot be read.
+     *
+     * \details
+     *
+     * Region queries need a coordinate-sorted BAM file and its index. If no index was loaded with load_index(), the
+     * index is searched next to the file as `<file>.bai`, `<file without .bam>.bai` and `<file>.csi`.
+     *
+     * The file seeks to the parts of the BAM file that the index returns for the region (see
+     * seqan3::bam_index::chunks) and skips the records within them that do not overlap the region, so only a small
+     * part of a large file is read. The file is at end after the last record of the region; the next call to
+     * region() starts a new query. Unplaced records are never part of a region.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_input_region.cpp
+     */
+    alignment_file_input & region(int32_t const ref_id, int32_t const begin, int32_t const end)
+    {
+        bool supported{};
+        std::visit([&supported] (auto const & f)
+        {
+            supported = requires { f.last_record_region(); };
+        }, format);
+
+        if (!supported)
+            throw format_error{"Region queries are only supported for indexed BAM files."};
+
+        if (index == nullptr)
+            load_index(find_index());
+
+        header(); // make sure the header is read before seeking
+
+        region_query = std::tuple{ref_id, begin, end};
+        region_chunks = index->chunks(ref_id, begin, end);
+        region_chunk_position = 0;
+        at_end = false;
+
+        if (!region_chunks.empty())
+        {
+            secondary_stream->clear();
+            secondary_stream->seekg(region_chunks.front().begin);
+        }
+
+        read_next_record();
+        first_record_was_read = true;
+        return *this;
+    }
+    //!\}
+
+    /*!\name Reading records without decoding them
+     * \{
+     */
+    //!\brief The type of the records read by read_raw_record().
+    using raw_record_type = bam_record<header_type>;
+
+    /*!\brief Reads the next record of a BAM file without decoding its fields.
+     * \param[out] record The record to read into; its memory is reused.
+     * \returns `false` if no record follows, `true` otherwise.
+     * \throws seqan3::format_error If the format is not BAM or the record is invalid.
+     *
+     * \details
+     *
+     * Only the bytes of the record are copied into the seqan3::bam_record, which decodes single fields when they are
+     * accessed. Filters that only look at the flag, the position or the mapping quality therefore do not pay for
+     * decoding the sequence, the qualities, the CIGAR and the tags. Writing the record to a BAM file with
+     * seqan3::alignment_file_output::push_back copies its bytes unchanged.
+     *
+     * Records are read from the current position of the file, so this function cannot be mixed with iterating over
+     * the file; header() may be called before.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_input_read_raw_record.cpp
+     */
+    bool read_raw_record(raw_record_type & record)
+    {
+        if (first_record_was_read)
+            throw std::logic_error{"read_raw_record() cannot be called after records were read by iterating the file."};
+
+        record.header_ptr = header_ptr.get();
+        record.bytes.clear();
+
+        auto call_read_func = [this, &record] (auto & ref_seq_info)
+        {
+            std::visit([&] (auto & f)
+            {
+                if constexpr (requires { f.read_raw_alignment_record(*secondary_stream, ref_seq_info, *header_ptr,
+                                                                     record.bytes); })
+                {
+                    f.read_raw_alignment_record(*secondary_stream, ref_seq_info, *header_ptr, record.bytes);
+                }
+                else
+                {
+                    throw format_error{"Only BAM records can be read without decoding them."};
+                }
+            }, format);
+        };
+
+        if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+            std::istreambuf_iterator<stream_char_type>{})
+        {
+            return false;
+        }
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            call_read_func(*reference_sequences_ptr);
+        else
+            call_read_func(std::ignore);
+
+        return !record.bytes.empty();
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
     //!/brief Initialisation based on a filename.
     void init_by_filename(std::filesystem::path filename)
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())->open(filename,
-                                                                             std::ios_base::in | std::ios::binary);
-        // open stream
-        if (!primary_stream->good())
-            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
-
+        file_name = filename;
+        // regular files are memory-mapped
+        primary_stream = detail::make_primary_istream(filename, stream_buffer);
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
         detail::set_format(format, filename);
     }
@@ -875,6 +1102,8 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
+    //!\brief Buffer for the records returned by read_batch().
+    batch_type batch_buffer{};
     //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
     std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
     //!\}
@@ -906,6 +1135,70 @@ protected:
 
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
+    //!\brief The name of the file if constructed from a filename; used to find the index.
+    std::filesystem::path file_name{};
+    //!\}
+
+    /*!\name Region queries
+     * \{
+     */
+    //!\brief The index of the file, loaded on the first region query.
+    std::unique_ptr<bam_index> index{};
+    //!\brief The reference id, begin and end of the current region query, if any.
+    std::optional<std::tuple<int32_t, int32_t, int32_t>> region_query{};
+    //!\brief The parts of the file that contain the records of the region.
+    std::vector<bam_index_chunk> region_chunks{};
+    //!\brief The chunk that is currently read.
+    size_t region_chunk_position{};
+
+    //!\brief Reads only the header if the format supports it and returns whether it did.
+    bool read_header_only()
+    {
+        if (std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
+            std::istreambuf_iterator<stream_char_type>{})
+        {
+            return false; // the empty file is handled by read_next_record()
+        }
+
+        bool header_was_read{false};
+
+        auto call_read_func = [this, &header_was_read] (auto & ref_seq_info)
+        {
+            std::visit([&] (auto & f)
+            {
+                if constexpr (requires { f.read_file_header(*secondary_stream, ref_seq_info, *header_ptr); })
+                {
+                    f.read_file_header(*secondary_stream, ref_seq_info, *header_ptr);
+                    header_was_read = true;
+                }
+            }, format);
+        };
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            call_read_func(*reference_sequences_ptr);
+        else
+            call_read_func(std::ignore);
+
+        return header_was_read;
+    }
+
+    //!\brief Finds the index next to the file.
+    std::filesystem::path find_index() const
+    {
+        if (!file_name.empty())
+        {
+            for (std::filesystem::path candidate : {std::filesystem::path{file_name.string() + ".bai"},
+                                                    std::filesystem::path{file_name}.replace_extension(".bai"),
+                                                    std::filesystem::path{file_name.string() + ".csi"}})
+            {
+                if (std::filesystem::exists(candidate))
+                    return candidate;
+            }
+        }
+
+        throw file_open_error{"No index found for the file " + file_name.string() + ". Create an index or load it "
+                              "with load_index()."};
+    }
     //!\}
 
     /*!\name Reference information
@@ -956,6 +1249,12 @@ protected:
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
+        if (region_query)
+        {
+            read_next_record_in_region();
+            return;
+        }
+
         // clear the record
         record_buffer.clear();
         detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
@@ -968,6 +1267,68 @@ protected:
             return;
         }
 
+        read_record();
+    }
+
+    //!\brief Moves to the next record that overlaps the region of the current region query.
+    void read_next_record_in_region()
+    {
+        auto [ref_id, begin, end] = *region_query;
+
+        for (;;)
+        {
+            record_buffer.clear();
+            detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
+
+            // skip the chunks that were read completely and seek to the next one
+            uint64_t const position = secondary_stream->tellg();
+
+            while (region_chunk_position < region_chunks.size() &&
+                   position >= region_chunks[region_chunk_position].end)
+            {
+                ++region_chunk_position;
+            }
+
+            if (region_chunk_position == region_chunks.size())
+            {
+                at_end = true;
+                return;
+            }
+
+            if (position < region_chunks[region_chunk_position].begin)
+            {
+                secondary_stream->seekg(region_chunks[region_chunk_position].begin);
+
+                if (!secondary_stream->good())
+                    throw format_error{"Could not seek to a region of the BAM file; is the index outdated?"};
+            }
+
+            read_record();
+
+            auto [record_ref_id, record_begin, record_end] = std::visit([] (auto const & f)
+            {
+                if constexpr (requires { f.last_record_region(); })
+                    return f.last_record_region();
+                else
+                    return std::tuple<int32_t, int32_t, int32_t>{-1, -1, -1};
+            }, format);
+
+            // the file is sorted by coordinate, so no later record overlaps the region
+            if (record_ref_id > ref_id || record_ref_id == -1 || (record_ref_id == ref_id && record_begin >= end))
+            {
+                record_buffer.clear();
+                at_end = true;
+                return;
+            }
+
+            if (record_ref_id == ref_id && record_end > begin)
+                return;
+        }
+    }
+
+    //!\brief Reads the record at the current position of the stream into the buffer.
+    void read_record()
+    {
         auto call_read_func = [this] (auto & ref_seq_info)
         {
             std::visit([&] (auto & f)
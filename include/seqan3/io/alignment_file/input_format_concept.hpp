@@ -14,6 +14,7 @@
 
 #include <fstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <seqan3/alphabet/cigar/cigar.hpp>
@@ -53,6 +54,61 @@ public:
     {
         format_type::read_alignment_record(std::forward<ts>(args)...);
     }
+
+    /*!\brief Forwards to `last_record_region` if the format offers it.
+     *
+     * \details
+     *
+     * Formats may offer this member to support region queries on indexed files (see
+     * seqan3::alignment_file_input::region).
+     */
+    std::tuple<int32_t, int32_t, int32_t> last_record_region() const
+    //!\cond
+        requires requires (alignment_file_input_format_exposer const & exposer)
+        {
+            exposer.format_type::last_record_region();
+        }
+    //!\endcond
+    {
+        return format_type::last_record_region();
+    }
+
+    /*!\brief Forwards to `read_file_header` if the format offers it.
+     *
+     * \details
+     *
+     * Formats may offer this member to read the header without reading the first record.
+     */
+    template <typename ...ts>
+    //!\cond
+        requires requires (alignment_file_input_format_exposer & exposer, ts && ...args)
+        {
+            exposer.format_type::read_file_header(std::forward<ts>(args)...);
+        }
+    //!\endcond
+    void read_file_header(ts && ...args)
+    {
+        format_type::read_file_header(std::forward<ts>(args)...);
+    }
+
+    /*!\brief Forwards to `read_raw_alignment_record` if the format offers it.
+     *
+     * \details
+     *
+     * Formats may offer this member to read records without decoding them (see
+     * seqan3::alignment_file_input::read_raw_record).
+     */
+    template <typename ...ts>
+    //!\cond
+        requires requires (alignment_file_input_format_exposer & exposer, ts && ...args)
+        {
+            exposer.format_type::read_raw_alignment_record(std::forward<ts>(args)...);
+        }
+    //!\endcond
+    void read_raw_alignment_record(ts && ...args)
+    {
+        format_type::read_raw_alignment_record(std::forward<ts>(args)...);
+    }
 };
 
 } // namespace seqan3::detail
@@ -13,20 +13,30 @@
 #pragma once
 
 #include <cassert>
+#include <exception>
 #include <seqan3/std/filesystem>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <seqan3/std/ranges>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
 
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/bam_record.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
 #include <seqan3/io/alignment_file/misc.hpp>
 #include <seqan3/io/alignment_file/output_format_concept.hpp>
 #include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/detail/bam_sorter.hpp>
 #include <seqan3/io/detail/out_file_iterator.hpp>
 #include <seqan3/io/detail/misc_output.hpp>
 #include <seqan3/io/detail/record.hpp>
@@ -240,8 +250,22 @@ public:
     alignment_file_output(alignment_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     alignment_file_output & operator=(alignment_file_output &&) = default;
-    //!\brief Destructor is defaulted.
-    ~alignment_file_output() = default;
+    /*!\brief Closes the file (see close()), ignoring all errors.
+     *
+     * \details
+     *
+     * A destructor must not throw, thus errors while writing the remaining records or the index are not reported.
+     * Call close() before the file is destroyed to be notified of them.
+     */
+    ~alignment_file_output()
+    {
+        try
+        {
+            close();
+        }
+        catch (std::exception const &)
+        {} // a destructor must not throw
+    }
 
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
@@ -270,7 +294,8 @@ public:
      */
     alignment_file_output(std::filesystem::path filename,
                           selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ofstream{}, stream_deleter_default}
+        primary_stream{new std::ofstream{}, stream_deleter_default},
+        file_name{filename}
     {
         primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
         static_cast<std::basic_ofstream<char> *>(primary_stream.get())->open(filename,
@@ -486,25 +511,10 @@ public:
         requires detail::record_like<record_t>
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
-
-        write_record(detail::get_or<field::header_ptr>(r, nullptr),
-                     detail::get_or<field::seq>(r, std::string_view{}),
-                     detail::get_or<field::qual>(r, std::string_view{}),
-                     detail::get_or<field::id>(r, std::string_view{}),
-                     detail::get_or<field::offset>(r, 0u),
-                     detail::get_or<field::ref_seq>(r, std::string_view{}),
-                     detail::get_or<field::ref_id>(r, std::ignore),
-                     detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
-                     detail::get_or<field::alignment>(r, default_align_t{}),
-                     detail::get_or<field::cigar>(r, std::vector<cigar>{}),
-                     detail::get_or<field::flag>(r, sam_flag::none),
-                     detail::get_or<field::mapq>(r, 0u),
-                     detail::get_or<field::mate>(r, default_mate_t{}),
-                     detail::get_or<field::tags>(r, sam_tag_dictionary{}),
-                     detail::get_or<field::evalue>(r, 0u),
-                     detail::get_or<field::bit_score>(r, 0u));
+        visit_fields(r, [this] (auto && ...fields)
+        {
+            write_record(std::forward<decltype(fields)>(fields)...);
+        });
     }
 
     /*!\brief           Write a record in form of a std::tuple to the file.
@@ -534,26 +544,95 @@ public:
         requires tuple_like<tuple_t> && (!detail::record_like<tuple_t>)
     //!\endcond
     {
-        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
-        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+        visit_fields(t, [this] (auto && ...fields)
+        {
+            write_record(std::forward<decltype(fields)>(fields)...);
+        });
+    }
+
+    /*!\brief            Write a seqan3::bam_record to the file.
+     * \tparam header_t  The type of the header of the record.
+     * \param[in] record The record to write.
+     *
+     * \details
+     *
+     * BAM files store the bytes of the record unchanged; the header is taken from the record or, if the record has no
+     * header, from this file. For other formats the fields of the record are decoded and written like a
+     * seqan3::record.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the record.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety.
+     */
+    template <typename header_t>
+    void push_back(bam_record<header_t> const & record)
+    {
+        assert(!format.valueless_by_exception());
+        update_stream_options();
+
+        bool raw_record_was_written{false};
+
+        std::visit([&] (auto & f)
+        {
+            if constexpr (requires { f.write_raw_alignment_record(*secondary_stream,
+                                                                  options,
+                                                                  *record.header_ptr,
+                                                                  std::string_view{record.bytes}); })
+            {
+                if (record.header_ptr != nullptr)
+                {
+                    start_sorting(*record.header_ptr);
+                    f.write_raw_alignment_record(record_stream(), options, *record.header_ptr, record.bytes);
+                    raw_record_was_written = true;
+                }
+                else if constexpr (!std::same_as<ref_ids_type, ref_info_not_given>)
+                {
+                    start_sorting(*header_ptr);
+                    f.write_raw_alignment_record(record_stream(), options, *header_ptr, record.bytes);
+                    raw_record_was_written = true;
+                }
+            }
+        }, format);
+
+        if (raw_record_was_written)
+        {
+            if (sorter != nullptr)
+                sorter->records_written();
+
+            return;
+        }
+
+        // all other formats write the decoded fields
+        auto write_decoded_record = [&] (auto && record_header_ptr)
+        {
+            using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
+
+            write_record(std::forward<decltype(record_header_ptr)>(record_header_ptr),
+                         record.sequence(),
+                         record.base_qualities(),
+                         record.id(),
+                         0u,
+                         std::string_view{},
+                         record.ref_id(),
+                         record.ref_offset(),
+                         default_align_t{},
+                         record.cigar_vector(),
+                         record.flag(),
+                         record.mapq(),
+                         record.mate(),
+                         record.tags(),
+                         0u,
+                         0u);
+        };
 
-        // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
-        write_record(detail::get_or<selected_field_ids::index_of(field::header_ptr)>(t, nullptr),
-                     detail::get_or<selected_field_ids::index_of(field::seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::qual)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::id)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::offset)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::ref_seq)>(t, std::string_view{}),
-                     detail::get_or<selected_field_ids::index_of(field::ref_id)>(t, std::ignore),
-                     detail::get_or<selected_field_ids::index_of(field::ref_offset)>(t, std::optional<int32_t>{}),
-                     detail::get_or<selected_field_ids::index_of(field::alignment)>(t, default_align_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::cigar)>(t, std::vector<cigar>{}),
-                     detail::get_or<selected_field_ids::index_of(field::flag)>(t, sam_flag::none),
-                     detail::get_or<selected_field_ids::index_of(field::mapq)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::mate)>(t, default_mate_t{}),
-                     detail::get_or<selected_field_ids::index_of(field::tags)>(t, sam_tag_dictionary{}),
-                     detail::get_or<selected_field_ids::index_of(field::evalue)>(t, 0u),
-                     detail::get_or<selected_field_ids::index_of(field::bit_score)>(t, 0u));
+        if (record.header_ptr != nullptr)
+            write_decoded_record(record.header_ptr);
+        else
+            write_decoded_record(nullptr);
     }
 
     /*!\brief            Write a record to the file by passing individual fields.
@@ -585,6 +664,205 @@ public:
         push_back(std::tie(arg, args...));
     }
 
+    /*!\brief                Encode a batch of records on the calling thread and write it at the position of its index.
+     * \tparam records_t      Type of the batch, must satisfy std::ranges::forward_range and have a reference type that
+     *                        satisfies seqan3::tuple_like, i.e. records or tuples as accepted by push_back().
+     * \param[in] records     The records of the batch.
+     * \param[in] batch_index The position of the batch in the file; the first batch has the index 0.
+     * \throws std::logic_error If a batch with the same index was already pushed.
+     *
+     * \details
+     *
+     * Several threads may call this function at the same time, e.g. every thread of an aligner pushes the records
+     * of the reads it mapped. Each caller encodes its records into its own buffer without holding a lock, so the
+     * formatting of the records (CIGAR, sequence, qualities and tags) runs in parallel. The encoded batches are then
+     * appended to the file in the order of their indices: batch `i` is written directly after batch `i - 1`, and
+     * a batch that is pushed before its predecessors is kept in memory until they were written. Batches that still
+     * wait for a missing predecessor when the file is closed are written in the order of their indices.
+     *
+     * The header is written before the first batch. Do not call the other member functions that write records
+     * while batches are pushed from other threads.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of records.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety. If a record cannot be written, no record of the batch is written.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_output_push_back_batch.cpp
+     */
+    template <typename records_t>
+    void push_back_batch(records_t && records, size_t const batch_index)
+    //!\cond
+        requires std::ranges::forward_range<records_t> && tuple_like<std::ranges::range_reference_t<records_t>>
+    //!\endcond
+    {
+        assert(!format.valueless_by_exception());
+
+        format_type batch_format{};
+
+        {
+            std::lock_guard<std::mutex> lock{*batch_mutex};
+
+            // the copies of the format must not write the header again
+            if (!std::ranges::empty(records))
+            {
+                update_stream_options();
+
+                visit_fields(*std::ranges::begin(records), [this] (auto && record_header_ptr, auto && ...)
+                {
+                    visit_header(record_header_ptr, [this] (auto && header)
+                    {
+                        start_sorting(header);
+
+                        std::visit([&] (auto & f)
+                        {
+                            if constexpr (requires { f.write_file_header(*secondary_stream, options, header); })
+                                f.write_file_header(*secondary_stream, options, header);
+                        }, format);
+                    });
+                });
+            }
+
+            batch_format = format;
+        }
+
+        std::basic_ostringstream<stream_char_type> encoded_stream{};
+
+        for (auto && record : records)
+        {
+            visit_fields(record, [&] (auto && ...fields)
+            {
+                write_record_to(encoded_stream, batch_format, std::forward<decltype(fields)>(fields)...);
+            });
+        }
+
+        std::basic_string<stream_char_type> encoded_batch = encoded_stream.str();
+
+        std::lock_guard<std::mutex> lock{*batch_mutex};
+
+        if (batch_index < next_batch_index || pending_batches.count(batch_index) != 0)
+            throw std::logic_error{"The batch with the index " + std::to_string(batch_index) + " was already pushed."};
+
+        if (batch_index != next_batch_index)
+        {
+            pending_batches.emplace(batch_index, std::move(encoded_batch));
+            return;
+        }
+
+        update_stream_options();
+        record_stream().write(encoded_batch.data(), encoded_batch.size());
+        ++next_batch_index;
+        write_pending_batches(false);
+
+        if (sorter != nullptr)
+            sorter->records_written();
+    }
+
+    /*!\brief Sorts and writes the records that were pushed since the sorting started.
+     * \throws seqan3::format_error If a record cannot be sorted.
+     * \throws seqan3::file_open_error If a temporary file cannot be written or read.
+     *
+     * \details
+     *
+     * If seqan3::alignment_file_output_options::sort_order is not seqan3::sam_sort_order::none, the records are
+     * kept in memory and temporary files until this function is called or the file is closed (see close()).
+     * Afterwards no more records may be written to the file. Does nothing if no records wait to be sorted.
+     *
+     * ### Complexity
+     *
+     * \f$O(n \log n)\f$ in the number of records.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety.
+     *
+     * ### Example
+     *
+     * \include test/snippet/io/sam_file/sam_file_output_sort.cpp
+     */
+    void write_sorted_records()
+    {
+        if (sorter == nullptr)
+            return;
+
+        std::unique_ptr<detail::bam_sorter> records{std::move(sorter)};
+        sorted_records_were_written = true;
+        update_stream_options();
+
+        if constexpr (std::same_as<stream_char_type, char>)
+            records->write_sorted(*secondary_stream);
+    }
+
+    /*!\brief Writes all remaining records, closes the file and writes the index if
+     *        seqan3::alignment_file_output_options::write_bam_index is set.
+     * \throws seqan3::format_error If a record cannot be sorted or the file cannot be indexed.
+     * \throws seqan3::file_open_error If a temporary file or the index cannot be written.
+     * \throws seqan3::io_error If the file cannot be written.
+     *
+     * \details
+     *
+     * Batches that wait for a missing predecessor (see push_back_batch()) are written first, followed by the
+     * records that wait to be sorted (see seqan3::alignment_file_output_options::sort_order). Afterwards the streams
+     * are flushed and released, i.e. the file is complete and no more records may be written to it. Calling close()
+     * again does nothing.
+     *
+     * The destructor closes the file as well, but cannot report errors.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of records that wait to be written, \f$O(n \log n)\f$ if they need to be sorted.
+     *
+     * ### Exceptions
+     *
+     * Basic exception safety; the file is closed even if an exception is thrown.
+     */
+    void close()
+    {
+        if (secondary_stream == nullptr) // closed or moved from
+            return;
+
+        bool const write_index = options.write_bam_index && !file_name.empty() && format_is_bam();
+        std::optional<bam_index> index{};
+        std::exception_ptr error{};
+
+        try
+        {
+            if (!pending_batches.empty())
+                write_pending_batches(true);
+
+            write_sorted_records();
+
+            if (write_index && index_builder != nullptr)
+                index = finish_indexing();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        secondary_stream.reset(); // a compression stream writes its last block on destruction
+        primary_stream->flush();
+        bool const written = primary_stream->good();
+        primary_stream.reset();
+
+        if (error)
+            std::rethrow_exception(error);
+
+        if (!written)
+            throw io_error{"Could not write the alignment file."};
+
+        if (write_index && !index) // the option was set after the first record was written
+            index = bam_index::build(file_name);
+
+        if (index)
+            index->write(file_name.string() + ".bai");
+    }
+
     /*!\brief            Write a range of records (or tuples) to the file.
      * \tparam rng_t     Type of the range, must satisfy std::ranges::output_range and have a reference type that
      *                   satisfies seqan3::tuple_like.
@@ -725,8 +1003,145 @@ protected:
 
     //!\brief The actual std::variant holding a pointer to the detected/selected format.
     format_type format;
+    //!\brief The name of the file if constructed from a filename; used to write the index.
+    std::filesystem::path file_name{};
+    //!\}
+
+    /*!\name Batches
+     * \brief State of push_back_batch.
+     * \{
+     */
+    //!\brief Synchronises the threads that push batches; a pointer, because the file is movable.
+    std::unique_ptr<std::mutex> batch_mutex{std::make_unique<std::mutex>()};
+    //!\brief The index of the next batch to write.
+    size_t next_batch_index{0};
+    //!\brief The encoded batches that wait for their predecessors by index.
+    std::map<size_t, std::basic_string<stream_char_type>> pending_batches{};
+    //!\}
+
+    /*!\name Sorting
+     * \brief State of seqan3::alignment_file_output_options::sort_order.
+     * \{
+     */
+    //!\brief Sorts the records; only set while records wait to be sorted.
+    std::unique_ptr<detail::bam_sorter> sorter{};
+    //!\brief Whether the sorted records were written, i.e. no more records may be written.
+    bool sorted_records_were_written{false};
     //!\}
 
+    //!\brief Whether the selected format is seqan3::format_bam.
+    bool format_is_bam() const
+    {
+        bool is_bam{};
+        std::visit([&is_bam] (auto const & f)
+        {
+            is_bam = std::same_as<std::remove_cvref_t<decltype(f)>,
+                                  detail::alignment_file_output_format_exposer<format_bam>>;
+        }, format);
+
+        return is_bam;
+    }
+
+    /*!\brief Writes the header with the `SO` tag of the sort order and starts sorting the records.
+     * \throws std::logic_error If the records cannot be sorted.
+     * \details Does nothing if the records are not sorted or the sorting was already started.
+     */
+    template <typename header_t>
+    void start_sorting(header_t && header)
+    {
+        if (options.sort_order == sam_sort_order::none || sorter != nullptr)
+            return;
+
+        if (sorted_records_were_written)
+            throw std::logic_error{"No records can be written after the sorted records were written."};
+
+        if constexpr (!std::same_as<stream_char_type, char> || detail::decays_to_ignore_v<header_t>)
+        {
+            throw std::logic_error{"Sorting the records requires the BAM format and reference information."};
+        }
+        else
+        {
+            if (!format_is_bam())
+                throw std::logic_error{"Only BAM files can be sorted."};
+
+            char const * const sorting_name = (options.sort_order == sam_sort_order::coordinate) ? "coordinate"
+                                                                                                 : "queryname";
+
+            if constexpr (std::is_const_v<std::remove_reference_t<header_t>>)
+            {
+                // the header of the records cannot be changed, so a copy with the sort order is written
+                std::remove_cvref_t<header_t> sorted_header = copy_file_header(header);
+                sorted_header.sorting = sorting_name;
+                write_file_header(sorted_header);
+            }
+            else
+            {
+                std::string sorting = std::exchange(header.sorting, sorting_name);
+                try
+                {
+                    write_file_header(header);
+                }
+                catch (...)
+                {
+                    header.sorting = std::move(sorting);
+                    throw;
+                }
+
+                header.sorting = std::move(sorting);
+            }
+
+            sorter = std::make_unique<detail::bam_sorter>(options.sort_order,
+                                                          options.sort_memory_limit,
+                                                          options.sort_threads,
+                                                          options.sort_temporary_directory);
+        }
+    }
+
+    /*!\brief Copies the information of a header that is written to a file.
+     * \details The copy owns a copy of the reference ids; the reference dictionary, which is only needed to encode
+     *          the records, is not copied.
+     */
+    template <typename header_t>
+    static header_t copy_file_header(header_t const & header)
+    {
+        using ref_ids_t = std::remove_cvref_t<decltype(header.ref_ids())>;
+
+        header_t copy{ref_ids_t{header.ref_ids()}};
+        copy.format_version = header.format_version;
+        copy.sorting = header.sorting;
+        copy.subsorting = header.subsorting;
+        copy.grouping = header.grouping;
+        copy.program_infos = header.program_infos;
+        copy.comments = header.comments;
+        copy.ref_id_info = header.ref_id_info;
+        copy.read_groups = header.read_groups;
+
+        return copy;
+    }
+
+    //!\brief Writes the header to the file unless it was already written.
+    template <typename header_t>
+    void write_file_header(header_t && header)
+    {
+        std::visit([&] (auto & f)
+        {
+            if constexpr (requires { f.write_file_header(*secondary_stream, options, header); })
+                f.write_file_header(*secondary_stream, options, header);
+        }, format);
+    }
+
+    //!\brief The stream the records are written to: the buffer of the sorter or the file.
+    std::basic_ostream<stream_char_type> & record_stream()
+    {
+        if constexpr (std::same_as<stream_char_type, char>)
+        {
+            if (sorter != nullptr)
+                return sorter->stream();
+        }
+
+        return *secondary_stream;
+    }
+
     //!\brief The header type, which specilised with ref_ids_type if reference information are given.
     using header_type = alignment_file_header<std::conditional_t<std::same_as<ref_ids_type, ref_info_not_given>,
                                               std::vector<std::string>,
@@ -761,39 +1176,195 @@ protected:
         }
     }
 
+    //!\brief The compression level that was last passed to the secondary stream.
+    int secondary_stream_compression_level{alignment_file_output_options{}.compression_level};
+    //!\brief The zstd frame size that was last passed to the secondary stream.
+    size_t secondary_stream_zstd_frame_size{alignment_file_output_options{}.zstd_frame_size};
+
+    //!\brief Indexes the blocks of the BGZF stream while they are written; only set if the index is written.
+    std::shared_ptr<detail::bam_index_builder> index_builder{};
+    //!\brief Whether anything was written to the secondary stream, i.e. the index can no longer be built while writing.
+    bool secondary_stream_was_written{false};
+
+    /*!\brief Passes a changed seqan3::alignment_file_output_options::compression_level and
+     *        seqan3::alignment_file_output_options::zstd_frame_size on to the secondary stream and starts building the
+     *        index before the first write.
+     */
+    void update_stream_options()
+    {
+        if (!secondary_stream_was_written)
+        {
+            start_indexing();
+            secondary_stream_was_written = true;
+        }
+
+        if (options.compression_level != secondary_stream_compression_level)
+        {
+            detail::set_compression_level(*secondary_stream, options.compression_level);
+            secondary_stream_compression_level = options.compression_level;
+        }
+
+        if (options.zstd_frame_size != secondary_stream_zstd_frame_size)
+        {
+            detail::set_zstd_frame_size(*secondary_stream, options.zstd_frame_size);
+            secondary_stream_zstd_frame_size = options.zstd_frame_size;
+        }
+    }
+
+    /*!\brief Builds the index from the blocks of the BGZF stream while they are written, if
+     *        seqan3::alignment_file_output_options::write_bam_index is set.
+     */
+    void start_indexing()
+    {
+    #ifdef SEQAN3_HAS_ZLIB
+        if constexpr (std::same_as<stream_char_type, char>)
+        {
+            auto * bgzf_stream = dynamic_cast<contrib::bgzf_ostream *>(secondary_stream.get());
+
+            if (!options.write_bam_index || file_name.empty() || !format_is_bam() || bgzf_stream == nullptr)
+                return;
+
+            // the builder is shared with the stream, which observes the last (empty) block on destruction
+            index_builder = std::make_shared<detail::bam_index_builder>();
+            bgzf_stream->rdbuf()->record_blocks([builder = index_builder] (char const * data, size_t const size)
+            {
+                builder->add_block(data, size);
+            });
+        }
+    #endif
+    }
+
+    /*!\brief Writes the buffered blocks of the BGZF stream and returns the index that was built from them.
+     * \throws seqan3::format_error If the records are not sorted by coordinate.
+     */
+    bam_index finish_indexing()
+    {
+        bam_index index{};
+
+    #ifdef SEQAN3_HAS_ZLIB
+        if constexpr (std::same_as<stream_char_type, char>)
+        {
+            auto & bgzf_stream = dynamic_cast<contrib::bgzf_ostream &>(*secondary_stream);
+            bgzf_stream.flush(); // waits for the compression of all blocks
+            index = index_builder->finish(bgzf_stream.rdbuf()->block_sizes());
+        }
+    #endif
+
+        return index;
+    }
+
+    /*!\brief Calls `fn` with the fields of a record (or tuple) in the order of write_record.
+     * \details Fields that are not part of the record are replaced by defaults.
+     */
+    template <typename record_t, typename fn_t>
+    static void visit_fields(record_t && r, fn_t && fn)
+    {
+        using default_align_t = std::pair<std::span<gapped<char>>, std::span<gapped<char>>>;
+        using default_mate_t  = std::tuple<std::string_view, std::optional<int32_t>, int32_t>;
+
+        if constexpr (detail::record_like<record_t>)
+        {
+            fn(detail::get_or<field::header_ptr>(r, nullptr),
+               detail::get_or<field::seq>(r, std::string_view{}),
+               detail::get_or<field::qual>(r, std::string_view{}),
+               detail::get_or<field::id>(r, std::string_view{}),
+               detail::get_or<field::offset>(r, 0u),
+               detail::get_or<field::ref_seq>(r, std::string_view{}),
+               detail::get_or<field::ref_id>(r, std::ignore),
+               detail::get_or<field::ref_offset>(r, std::optional<int32_t>{}),
+               detail::get_or<field::alignment>(r, default_align_t{}),
+               detail::get_or<field::cigar>(r, std::vector<cigar>{}),
+               detail::get_or<field::flag>(r, sam_flag::none),
+               detail::get_or<field::mapq>(r, 0u),
+               detail::get_or<field::mate>(r, default_mate_t{}),
+               detail::get_or<field::tags>(r, sam_tag_dictionary{}),
+               detail::get_or<field::evalue>(r, 0u),
+               detail::get_or<field::bit_score>(r, 0u));
+        }
+        else
+        {
+            // index_of might return npos, but this will be handled well by get_or_ignore (and just return ignore)
+            fn(detail::get_or<selected_field_ids::index_of(field::header_ptr)>(r, nullptr),
+               detail::get_or<selected_field_ids::index_of(field::seq)>(r, std::string_view{}),
+               detail::get_or<selected_field_ids::index_of(field::qual)>(r, std::string_view{}),
+               detail::get_or<selected_field_ids::index_of(field::id)>(r, std::string_view{}),
+               detail::get_or<selected_field_ids::index_of(field::offset)>(r, 0u),
+               detail::get_or<selected_field_ids::index_of(field::ref_seq)>(r, std::string_view{}),
+               detail::get_or<selected_field_ids::index_of(field::ref_id)>(r, std::ignore),
+               detail::get_or<selected_field_ids::index_of(field::ref_offset)>(r, std::optional<int32_t>{}),
+               detail::get_or<selected_field_ids::index_of(field::alignment)>(r, default_align_t{}),
+               detail::get_or<selected_field_ids::index_of(field::cigar)>(r, std::vector<cigar>{}),
+               detail::get_or<selected_field_ids::index_of(field::flag)>(r, sam_flag::none),
+               detail::get_or<selected_field_ids::index_of(field::mapq)>(r, 0u),
+               detail::get_or<selected_field_ids::index_of(field::mate)>(r, default_mate_t{}),
+               detail::get_or<selected_field_ids::index_of(field::tags)>(r, sam_tag_dictionary{}),
+               detail::get_or<selected_field_ids::index_of(field::evalue)>(r, 0u),
+               detail::get_or<selected_field_ids::index_of(field::bit_score)>(r, 0u));
+        }
+    }
+
+    //!\brief Calls `fn` with the header of the record if given (e.g. file_output = file_input) or the file's header.
+    template <typename record_header_ptr_t, typename fn_t>
+    void visit_header(record_header_ptr_t && record_header_ptr, fn_t && fn)
+    {
+        if constexpr (!std::same_as<std::remove_cvref_t<record_header_ptr_t>, std::nullptr_t>)
+            fn(*record_header_ptr);
+        else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
+            fn(std::ignore);
+        else
+            fn(*header_ptr);
+    }
+
     //!\brief Write record to format.
     template <typename record_header_ptr_t, typename ...pack_type>
     void write_record(record_header_ptr_t && record_header_ptr, pack_type && ...remainder)
     {
-        static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_record.");
-
         assert(!format.valueless_by_exception());
+        update_stream_options();
+        visit_header(record_header_ptr, [this] (auto && header) { start_sorting(header); });
 
-        std::visit([&] (auto & f)
+        write_record_to(record_stream(),
+                        format,
+                        std::forward<record_header_ptr_t>(record_header_ptr),
+                        std::forward<pack_type>(remainder)...);
+
+        if (sorter != nullptr)
+            sorter->records_written();
+    }
+
+    //!\brief Write record to the given stream with the given format object.
+    template <typename record_header_ptr_t, typename ...pack_type>
+    void write_record_to(std::basic_ostream<stream_char_type> & stream,
+                         format_type & target_format,
+                         record_header_ptr_t && record_header_ptr,
+                         pack_type && ...remainder)
+    {
+        static_assert((sizeof...(pack_type) == 15), "Wrong parameter list passed to write_record.");
+
+        visit_header(record_header_ptr, [&] (auto && header)
         {
-            // use header from record if explicitly given, e.g. file_output = file_input
-            if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
-            {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *record_header_ptr,
-                                         std::forward<pack_type>(remainder)...);
-            }
-            else if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
-            {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         std::ignore,
-                                         std::forward<pack_type>(remainder)...);
-            }
-            else
+            std::visit([&] (auto & f)
             {
-                f.write_alignment_record(*secondary_stream,
-                                         options,
-                                         *header_ptr,
-                                         std::forward<pack_type>(remainder)...);
-            }
-        }, format);
+                f.write_alignment_record(stream, options, header, std::forward<pack_type>(remainder)...);
+            }, target_format);
+        });
+    }
+
+    /*!\brief Writes the batches that wait for their predecessors (see push_back_batch).
+     * \param[in] skip_missing Whether to also write the batches after a missing batch.
+     */
+    void write_pending_batches(bool const skip_missing)
+    {
+        update_stream_options();
+
+        for (auto it = pending_batches.begin(); it != pending_batches.end(); it = pending_batches.erase(it))
+        {
+            if (it->first != next_batch_index && !skip_missing)
+                break;
+
+            record_stream().write(it->second.data(), it->second.size());
+            next_batch_index = it->first + 1;
+        }
     }
 
     //!\brief Befriend iterator so it can access the buffers.
@@ -52,6 +52,44 @@ public:
     {
         format_type::write_alignment_record(std::forward<ts>(args)...);
     }
+
+    /*!\brief Forwards to `write_raw_alignment_record` if the format offers it.
+     *
+     * \details
+     *
+     * Formats may offer this member to write records that were read without decoding them (see
+     * seqan3::bam_record).
+     */
+    template <typename ...ts>
+    //!\cond
+        requires requires (alignment_file_output_format_exposer & exposer, ts && ...args)
+        {
+            exposer.format_type::write_raw_alignment_record(std::forward<ts>(args)...);
+        }
+    //!\endcond
+    void write_raw_alignment_record(ts && ...args)
+    {
+        format_type::write_raw_alignment_record(std::forward<ts>(args)...);
+    }
+
+    /*!\brief Forwards to `write_file_header` if the format offers it.
+     *
+     * \details
+     *
+     * Formats may offer this member to write the header before the first record is written (see
+     * seqan3::alignment_file_output::push_back_batch).
+     */
+    template <typename ...ts>
+    //!\cond
+        requires requires (alignment_file_output_format_exposer & exposer, ts && ...args)
+        {
+            exposer.format_type::write_file_header(std::forward<ts>(args)...);
+        }
+    //!\endcond
+    void write_file_header(ts && ...args)
+    {
+        format_type::write_file_header(std::forward<ts>(args)...);
+    }
 };
 
 } // namespace seqan3::detail
@@ -13,10 +13,22 @@
 #pragma once
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
 
 namespace seqan3
 {
 
+/*!\brief The order in which seqan3::alignment_file_output writes the records of a BAM file.
+ * \ingroup alignment_file
+ * \see seqan3::alignment_file_output_options::sort_order
+ */
+enum class sam_sort_order : uint8_t
+{
+    none,       //!< The records are written in the order they are given.
+    coordinate, //!< By reference id (unmapped records last), position and strand.
+    query_name  //!< By read name and first/last segment flags.
+};
+
 //!\brief The options type defines various option members that influence the behavior of all or some formats.
 //!\ingroup alignment_file
 struct alignment_file_output_options
@@ -39,6 +51,67 @@ struct alignment_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief Whether to create a BAI index when a BAM file that was opened by its filename is closed.
+     *
+     * \details
+     *
+     * The index is written to `<file>.bai`, so it can be used by seqan3::alignment_file_input::region right away.
+     * It is built from the compressed blocks while they are written, so the file is not read again. If the option is
+     * set after the first record was written, the BAM file is scanned after the last record instead (see
+     * seqan3::bam_index::build). The records must be sorted by coordinate; no index is written for unsorted files or
+     * files that are not BAM.
+     * seqan3::alignment_file_output::close reports if the index cannot be written.
+     */
+    bool write_bam_index = false;
+
+    /*!\brief The compression level of BGZF compressed files (`.bam`, `.gz` and `.bgzf`).
+     *
+     * \details
+     *
+     * The level ranges from 0 (no compression) to 9 (best compression). The default level 1 is the fastest level
+     * that compresses; higher levels produce smaller files but make writing considerably slower.
+     * A changed level applies to the data written from the next record on. Files that are not compressed with BGZF
+     * are not affected. If SeqAn was built with libdeflate, the blocks are compressed with libdeflate instead of
+     * zlib, which is faster at every level.
+     */
+    int compression_level = 1;
+
+    /*!\brief The uncompressed size of the frames of zstd compressed files (`.zst`) in bytes.
+     *
+     * \details
+     *
+     * If the size is not 0, the file is written in the seekable zstd format: a new frame is started after every
+     * `zstd_frame_size` bytes and a seek table is appended to the file. seqan3::contrib::zstd_istream uses the table
+     * to seek to a position by decompressing only the frame that contains it. Smaller frames allow faster seeking but
+     * compress worse; frames of a few MiB are a good compromise. The default 0 writes a single frame.
+     * A changed size applies from the next record on. Files that are not compressed with zstd are not affected.
+     */
+    size_t zstd_frame_size = 0;
+
+    /*!\brief The order in which the records of a BAM file are written.
+     *
+     * \details
+     *
+     * If the order is not seqan3::sam_sort_order::none, the records are sorted before they are written and the
+     * `SO` tag of the header is set accordingly. Records that compare equal keep the order in which they were given.
+     * The records are written when the file is closed or seqan3::alignment_file_output::write_sorted_records is
+     * called. Records that exceed #sort_memory_limit are sorted and written to temporary files, which are merged at
+     * the end. Combine seqan3::sam_sort_order::coordinate with #write_bam_index to get an indexed file.
+     *
+     * The order must be set before the first record is written and is only supported by seqan3::format_bam;
+     * otherwise writing a record throws std::logic_error.
+     */
+    sam_sort_order sort_order = sam_sort_order::none;
+
+    //!\brief The size in bytes of the encoded records that are sorted in memory before they are written to a temporary file.
+    size_t sort_memory_limit = 768ull * 1024ull * 1024ull;
+
+    //!\brief The number of threads that sort the records in memory.
+    size_t sort_threads = 1;
+
+    //!\brief The directory of the temporary files; the system's temporary directory if empty.
+    std::filesystem::path sort_temporary_directory{};
 };
 
 } // namespace seqan3
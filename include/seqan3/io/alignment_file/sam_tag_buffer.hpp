@@ -0,0 +1,759 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sam_tag_buffer.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <seqan3/std/bit>
+#include <seqan3/std/concepts>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <seqan3/core/debug_stream/detail/to_string.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Stores the optional fields of a SAM/BAM record in the binary layout of BAM.
+ * \ingroup alignment_file_io
+ *
+ * \details
+ *
+ * In contrast to seqan3::sam_tag_dictionary, which stores every tag in a node of a std::map and strings and arrays in
+ * their own containers, the seqan3::sam_tag_buffer stores all tags in a single byte buffer exactly like the tag block
+ * of a BAM record, and a flat array of (tag, type, offset) entries that index the buffer. Reading the tags of a BAM
+ * record thus copies the tag block and indexes it, and writing them copies the buffer. Both containers keep their
+ * capacity when the buffer is cleared or assigned again, so reusing a buffer for every record does not allocate
+ * memory once it has grown large enough.
+ *
+ * Tags are looked up by a linear scan over the entries, which is fast for the handful of tags a record usually has.
+ * Values are decoded on access:
+ *
+ * | BAM type           | Value type of get()                                                   |
+ * |--------------------|-----------------------------------------------------------------------|
+ * | A                  | char                                                                  |
+ * | c, C, s, S, i, I   | any integral type except char (converted)                             |
+ * | f                  | float                                                                 |
+ * | Z, H               | std::string_view (without the terminating null character)             |
+ * | H                  | std::vector<std::byte> (decoded from the hex string)                  |
+ * | B                  | std::vector<int8_t>, ..., std::vector<float> matching the element type |
+ *
+ * set() always appends the tag (after removing a previous value), integers are stored in the smallest BAM type that
+ * can represent them.
+ *
+ * A parser that reads the tags one after another can append them with push_back() without a lookup. Strings and
+ * arrays are appended empty and then filled character by character or element by element, so the values are encoded
+ * straight into the buffer.
+ *
+ * A buffer can be converted from and to a seqan3::sam_tag_dictionary. To read the tags of an alignment file into a
+ * buffer, add `static constexpr bool tags_as_buffer = true;` to the traits type of seqan3::alignment_file_input.
+ * seqan3::alignment_file_output accepts a buffer for field::tags.
+ *
+ * \include test/snippet/io/sam_file/sam_tag_dictionary/sam_tag_buffer.cpp
+ */
+class sam_tag_buffer
+{
+public:
+    //!\brief Describes where a tag is stored in the buffer.
+    struct entry_type
+    {
+        uint16_t tag;         //!< The tag, e.g. "NM"_tag.
+        char type;            //!< The BAM type character, one of [AcCsSiIfZHB].
+        char array_type;      //!< The element type of 'B' arrays, one of [cCsSiIf]; `'\0'` otherwise.
+        uint32_t begin;       //!< The position of the tag in the buffer.
+        uint32_t value_begin; //!< The position of the value (for arrays the first element) in the buffer.
+        uint32_t length;      //!< The number of array elements or characters (without null character); 1 otherwise.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_tag_buffer() = default;                                   //!< Defaulted.
+    sam_tag_buffer(sam_tag_buffer const &) = default;             //!< Defaulted.
+    sam_tag_buffer(sam_tag_buffer &&) = default;                  //!< Defaulted.
+    sam_tag_buffer & operator=(sam_tag_buffer const &) = default; //!< Defaulted.
+    sam_tag_buffer & operator=(sam_tag_buffer &&) = default;      //!< Defaulted.
+    ~sam_tag_buffer() = default;                                  //!< Defaulted.
+
+    //!\brief Construct from a seqan3::sam_tag_dictionary.
+    explicit sam_tag_buffer(sam_tag_dictionary const & dictionary)
+    {
+        assign(dictionary);
+    }
+    //!\}
+
+    /*!\brief Replaces the content by the tags of a seqan3::sam_tag_dictionary.
+     * \param[in] dictionary The dictionary to encode.
+     */
+    void assign(sam_tag_dictionary const & dictionary)
+    {
+        clear();
+
+        for (auto const & [tag, variant] : dictionary)
+            std::visit([&, tag = tag] (auto const & value) { append(tag, value); }, variant);
+    }
+
+    /*!\brief Replaces the content by the binary tag block of a BAM record.
+     * \param[in] binary The tag block.
+     * \throws seqan3::format_error If the tag block is malformed.
+     */
+    void assign_binary(std::string_view const binary)
+    {
+        data.assign(binary.data(), binary.size());
+        entries.clear();
+
+        for (size_t position = 0; position < data.size();)
+            position = index_entry(position);
+    }
+
+    //!\brief The binary tag block in the layout of BAM.
+    std::string_view binary() const noexcept
+    {
+        return data;
+    }
+
+    //!\brief Converts the buffer to a seqan3::sam_tag_dictionary.
+    sam_tag_dictionary to_dictionary() const
+    {
+        sam_tag_dictionary dictionary{};
+
+        for (entry_type const & entry : entries)
+            dictionary[entry.tag] = get_variant(entry);
+
+        return dictionary;
+    }
+
+    /*!\name Capacity and lookup
+     * \{
+     */
+    //!\brief The number of tags.
+    size_t size() const noexcept
+    {
+        return entries.size();
+    }
+
+    //!\brief Whether the buffer stores no tags.
+    bool empty() const noexcept
+    {
+        return entries.empty();
+    }
+
+    //!\brief Removes all tags but keeps the allocated memory.
+    void clear() noexcept
+    {
+        data.clear();
+        entries.clear();
+    }
+
+    //!\brief Whether the buffer stores the given tag.
+    bool contains(uint16_t const tag) const noexcept
+    {
+        return find(tag) != nullptr;
+    }
+
+    //!\brief The number of times the tag is stored, i.e. 0 or 1 (like std::map::count).
+    size_t count(uint16_t const tag) const noexcept
+    {
+        return contains(tag);
+    }
+
+    //!\brief Returns the entry of the given tag or `nullptr` if the tag is not stored.
+    entry_type const * find(uint16_t const tag) const noexcept
+    {
+        auto it = std::find_if(entries.begin(), entries.end(), [tag] (entry_type const & e) { return e.tag == tag; });
+        return (it == entries.end()) ? nullptr : &*it;
+    }
+
+    //!\brief The entries of all tags in the order they are stored in.
+    std::vector<entry_type> const & tag_entries() const noexcept
+    {
+        return entries;
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Returns the value of a tag as `value_t`.
+     * \tparam value_t The type to decode the value as; see the table in the detailed description.
+     * \param[in] tag  The tag to look up.
+     * \throws std::out_of_range If the tag is not stored.
+     * \throws std::bad_variant_access If the tag is not stored as `value_t`.
+     */
+    template <typename value_t>
+    value_t get(uint16_t const tag) const
+    {
+        entry_type const * entry = find(tag);
+
+        if (entry == nullptr)
+            throw std::out_of_range{detail::to_string("The tag ", tag_string(tag), " is not stored.")};
+
+        return get<value_t>(*entry);
+    }
+
+    /*!\brief Returns the value of a known tag by the type given by seqan3::sam_tag_type.
+     * \tparam tag The tag to look up.
+     * \throws std::out_of_range If the tag is not stored.
+     * \throws std::bad_variant_access If the tag is not stored as seqan3::sam_tag_type_t<tag>.
+     *
+     * \details
+     *
+     * String tags are returned as std::string_view into the buffer.
+     */
+    template <uint16_t tag>
+    //!\cond
+        requires (!std::same_as<sam_tag_type_t<tag>, sam_tag_dictionary::variant_type>)
+    //!\endcond
+    auto get() const
+    {
+        using value_t = std::conditional_t<std::same_as<sam_tag_type_t<tag>, std::string>,
+                                           std::string_view,
+                                           sam_tag_type_t<tag>>;
+        return get<value_t>(tag);
+    }
+
+    /*!\brief Returns the value of an entry as `value_t`.
+     * \tparam value_t The type to decode the value as; see the table in the detailed description.
+     * \param[in] entry An entry of this buffer.
+     * \throws std::bad_variant_access If the tag is not stored as `value_t`.
+     */
+    template <typename value_t>
+    value_t get(entry_type const & entry) const
+    {
+        if constexpr (std::same_as<value_t, char>)
+        {
+            check_type(entry.type == 'A');
+            return data[entry.value_begin];
+        }
+        else if constexpr (std::same_as<value_t, float>)
+        {
+            check_type(entry.type == 'f');
+            return load<float>(entry.value_begin);
+        }
+        else if constexpr (std::integral<value_t>)
+        {
+            switch (entry.type)
+            {
+                case 'c': return static_cast<value_t>(load<int8_t>(entry.value_begin));
+                case 'C': return static_cast<value_t>(load<uint8_t>(entry.value_begin));
+                case 's': return static_cast<value_t>(load<int16_t>(entry.value_begin));
+                case 'S': return static_cast<value_t>(load<uint16_t>(entry.value_begin));
+                case 'i': return static_cast<value_t>(load<int32_t>(entry.value_begin));
+                case 'I': return static_cast<value_t>(load<uint32_t>(entry.value_begin));
+                default: throw std::bad_variant_access{};
+            }
+        }
+        else if constexpr (std::same_as<value_t, std::string_view>)
+        {
+            check_type(entry.type == 'Z' || entry.type == 'H');
+            return std::string_view{data}.substr(entry.value_begin, entry.length);
+        }
+        else if constexpr (std::same_as<value_t, std::vector<std::byte>>)
+        {
+            check_type(entry.type == 'H');
+
+            std::vector<std::byte> bytes(entry.length / 2);
+            for (size_t i = 0; i < bytes.size(); ++i)
+            {
+                bytes[i] = static_cast<std::byte>(hex_value(data[entry.value_begin + 2 * i]) << 4 |
+                                                  hex_value(data[entry.value_begin + 2 * i + 1]));
+            }
+
+            return bytes;
+        }
+        else
+        {
+            static_assert(detail::is_type_specialisation_of_v<value_t, std::vector>,
+                          "The value type must be char, an integral type, float, std::string_view or std::vector.");
+
+            using element_t = typename value_t::value_type;
+            check_type(entry.type == 'B' && entry.array_type == array_type_char<element_t>());
+
+            value_t values(entry.length);
+            std::memcpy(values.data(), data.data() + entry.value_begin, entry.length * sizeof(element_t));
+            return values;
+        }
+    }
+
+    /*!\brief Returns an element of an array entry (type 'B') as `value_t`.
+     * \tparam value_t The element type of the array; one of int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t
+     *                 and float.
+     * \param[in] entry An entry of this buffer.
+     * \param[in] index The position of the element; must be smaller than `entry.length`.
+     * \throws std::bad_variant_access If the tag is not stored as an array of `value_t`.
+     */
+    template <typename value_t>
+    value_t get_element(entry_type const & entry, size_t const index) const
+    {
+        check_type(entry.type == 'B' && entry.array_type == array_type_char<value_t>());
+        assert(index < entry.length);
+
+        return load<value_t>(entry.value_begin + index * sizeof(value_t));
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \brief Sets the value of a tag. A previous value of the tag is removed and the tag is appended.
+     * \{
+     */
+    //!\brief Stores a character (type 'A').
+    void set(uint16_t const tag, char const value)
+    {
+        erase(tag);
+        append(tag, value);
+    }
+
+    //!\brief Stores an integer in the smallest of the types [cCsSiI].
+    void set(uint16_t const tag, int32_t const value)
+    {
+        erase(tag);
+        append(tag, value);
+    }
+
+    //!\brief Stores a float (type 'f').
+    void set(uint16_t const tag, float const value)
+    {
+        erase(tag);
+        append(tag, value);
+    }
+
+    //!\brief Stores a string (type 'Z').
+    void set(uint16_t const tag, std::string_view const value)
+    {
+        erase(tag);
+        append(tag, value);
+    }
+
+    //!\brief Stores a numeric array (type 'B') or, for std::byte, a hex string (type 'H').
+    template <typename element_t>
+    void set(uint16_t const tag, std::vector<element_t> const & values)
+    {
+        erase(tag);
+        append(tag, values);
+    }
+
+    /*!\brief Removes a tag.
+     * \returns Whether the tag was stored.
+     */
+    bool erase(uint16_t const tag)
+    {
+        auto it = std::find_if(entries.begin(), entries.end(), [tag] (entry_type const & e) { return e.tag == tag; });
+
+        if (it == entries.end())
+            return false;
+
+        uint32_t const begin = it->begin;
+        uint32_t const end = (std::next(it) == entries.end()) ? data.size() : std::next(it)->begin;
+
+        data.erase(begin, end - begin);
+        it = entries.erase(it);
+
+        for (; it != entries.end(); ++it)
+        {
+            it->begin -= end - begin;
+            it->value_begin -= end - begin;
+        }
+
+        return true;
+    }
+    //!\}
+
+    /*!\name Appending
+     * \brief Appends a tag without looking it up, e.g. while parsing a record. The tag must not be stored yet.
+     * \{
+     */
+    //!\brief Appends a character (type 'A').
+    void push_back(uint16_t const tag, char const value)
+    {
+        append(tag, value);
+    }
+
+    //!\brief Appends an integer in the smallest of the types [cCsSiI].
+    void push_back(uint16_t const tag, int32_t const value)
+    {
+        append(tag, value);
+    }
+
+    //!\brief Appends a float (type 'f').
+    void push_back(uint16_t const tag, float const value)
+    {
+        append(tag, value);
+    }
+
+    //!\brief Appends a string (type 'Z').
+    void push_back(uint16_t const tag, std::string_view const value)
+    {
+        append(tag, value);
+    }
+
+    /*!\brief Appends an empty string whose characters are added with push_back_char().
+     * \param[in] tag  The tag to append.
+     * \param[in] type The type of the string, i.e. 'Z' or 'H'.
+     */
+    void push_back_string(uint16_t const tag, char const type = 'Z')
+    {
+        assert(type == 'Z' || type == 'H');
+
+        append_entry(tag, type, '\0', 0);
+        data.push_back('\0');
+    }
+
+    //!\brief Appends a character to the string of the last tag.
+    void push_back_char(char const chr)
+    {
+        assert(!entries.empty() && (entries.back().type == 'Z' || entries.back().type == 'H'));
+
+        data.back() = chr; // overwrite the null character
+        data.push_back('\0');
+        ++entries.back().length;
+    }
+
+    /*!\brief Appends an empty array (type 'B') whose elements are added with push_back_element().
+     * \tparam element_t The element type; one of int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t and float.
+     * \param[in] tag The tag to append.
+     */
+    template <typename element_t>
+    void push_back_array(uint16_t const tag)
+    {
+        static_assert(array_type_char<element_t>() != '\0',
+                      "The element type must be one of int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t and "
+                      "float.");
+
+        append_entry(tag, 'B', array_type_char<element_t>(), 0);
+    }
+
+    //!\brief Appends an element to the array of the last tag; must be of the element type of this array.
+    template <typename element_t>
+    void push_back_element(element_t const value)
+    {
+        assert(!entries.empty() && entries.back().type == 'B' &&
+               entries.back().array_type == array_type_char<element_t>());
+
+        store(value);
+
+        entry_type & entry = entries.back();
+        int32_t const length = ++entry.length;
+        std::memcpy(data.data() + entry.value_begin - sizeof(length), &length, sizeof(length)); // update the count
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \brief Two buffers are equal if they store the same tags in the same order and representation.
+     * \{
+     */
+    friend bool operator==(sam_tag_buffer const & lhs, sam_tag_buffer const & rhs) noexcept
+    {
+        return lhs.data == rhs.data;
+    }
+
+    friend bool operator!=(sam_tag_buffer const & lhs, sam_tag_buffer const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+private:
+    //!\brief The tags in the binary layout of BAM.
+    std::string data{};
+    //!\brief Where the tags are stored in data.
+    std::vector<entry_type> entries{};
+
+    //!\brief Throws std::bad_variant_access if `matches` is false.
+    static void check_type(bool const matches)
+    {
+        if (!matches)
+            throw std::bad_variant_access{};
+    }
+
+    //!\brief Returns the two characters of a tag.
+    static std::string tag_string(uint16_t const tag)
+    {
+        return std::string{static_cast<char>(tag >> 8), static_cast<char>(tag & 0xff)};
+    }
+
+    //!\brief The value of a hexadecimal digit.
+    static uint8_t hex_value(char const chr) noexcept
+    {
+        return (chr <= '9') ? chr - '0' : (chr & ~0x20) - 'A' + 10;
+    }
+
+    //!\brief The BAM type character of an array element type.
+    template <typename element_t>
+    static constexpr char array_type_char() noexcept
+    {
+        if constexpr (std::same_as<element_t, int8_t>)
+            return 'c';
+        else if constexpr (std::same_as<element_t, uint8_t>)
+            return 'C';
+        else if constexpr (std::same_as<element_t, int16_t>)
+            return 's';
+        else if constexpr (std::same_as<element_t, uint16_t>)
+            return 'S';
+        else if constexpr (std::same_as<element_t, int32_t>)
+            return 'i';
+        else if constexpr (std::same_as<element_t, uint32_t>)
+            return 'I';
+        else if constexpr (std::same_as<element_t, float>)
+            return 'f';
+        else
+            return '\0';
+    }
+
+    //!\brief The size in bytes of a value of the given BAM type character, or 0 for unknown types.
+    static constexpr size_t type_size(char const type) noexcept
+    {
+        switch (type)
+        {
+            case 'A': case 'c': case 'C': return 1;
+            case 's': case 'S': return 2;
+            case 'i': case 'I': case 'f': return 4;
+            default: return 0;
+        }
+    }
+
+    //!\brief Reads a little-endian value at the given position.
+    template <typename value_t>
+    value_t load(size_t const position) const noexcept
+    {
+        value_t value;
+        std::memcpy(&value, data.data() + position, sizeof(value));
+        return value;
+    }
+
+    //!\brief Appends the bytes of a value.
+    template <typename value_t>
+    void store(value_t const value)
+    {
+        data.append(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    //!\brief Appends the tag and the type characters and adds the entry.
+    void append_entry(uint16_t const tag, char const type, char const array_type, uint32_t const length)
+    {
+        uint32_t const begin = data.size();
+
+        data.push_back(static_cast<char>(tag >> 8));
+        data.push_back(static_cast<char>(tag & 0xff));
+        data.push_back(type);
+
+        if (type == 'B')
+        {
+            data.push_back(array_type);
+            store(static_cast<int32_t>(length));
+        }
+
+        entries.push_back(entry_type{tag, type, array_type, begin, static_cast<uint32_t>(data.size()), length});
+    }
+
+    //!\brief Appends a character.
+    void append(uint16_t const tag, char const value)
+    {
+        append_entry(tag, 'A', '\0', 1);
+        data.push_back(value);
+    }
+
+    //!\brief Appends an integer in the smallest representation.
+    void append(uint16_t const tag, int32_t const value)
+    {
+        // always choose the smallest possible representation [cCsSiI]
+        size_t const absolute_value = std::abs(value);
+        auto n = std::countr_zero(std::bit_ceil(absolute_value + 1u) >> 1u) / 8u;
+        bool const negative = value < 0;
+        n = n * n + 2 * negative; // for switch case order
+
+        switch (n)
+        {
+            case 0:
+                append_entry(tag, 'C', '\0', 1);
+                store(static_cast<uint8_t>(value));
+                break;
+            case 1:
+                append_entry(tag, 'S', '\0', 1);
+                store(static_cast<uint16_t>(value));
+                break;
+            case 2:
+                append_entry(tag, 'c', '\0', 1);
+                store(static_cast<int8_t>(value));
+                break;
+            case 3:
+                append_entry(tag, 's', '\0', 1);
+                store(static_cast<int16_t>(value));
+                break;
+            default:
+                append_entry(tag, 'i', '\0', 1);
+                store(value);
+                break;
+        }
+    }
+
+    //!\brief Appends a float.
+    void append(uint16_t const tag, float const value)
+    {
+        append_entry(tag, 'f', '\0', 1);
+        store(value);
+    }
+
+    //!\brief Appends a string.
+    void append(uint16_t const tag, std::string_view const value)
+    {
+        append_entry(tag, 'Z', '\0', value.size());
+        data.append(value.data(), value.size());
+        data.push_back('\0');
+    }
+
+    //!\brief Appends a string.
+    void append(uint16_t const tag, std::string const & value)
+    {
+        append(tag, std::string_view{value});
+    }
+
+    //!\brief Appends an array or, for std::byte, a hex string.
+    template <typename element_t>
+    void append(uint16_t const tag, std::vector<element_t> const & values)
+    {
+        if constexpr (std::same_as<element_t, std::byte>)
+        {
+            constexpr char const * hex_digits = "0123456789ABCDEF";
+
+            append_entry(tag, 'H', '\0', 2 * values.size());
+            for (std::byte const value : values)
+            {
+                data.push_back(hex_digits[std::to_integer<uint8_t>(value) >> 4]);
+                data.push_back(hex_digits[std::to_integer<uint8_t>(value) & 0x0f]);
+            }
+            data.push_back('\0');
+        }
+        else
+        {
+            static_assert(array_type_char<element_t>() != '\0',
+                          "The element type must be one of int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t and "
+                          "float.");
+
+            append_entry(tag, 'B', array_type_char<element_t>(), values.size());
+            data.append(reinterpret_cast<char const *>(values.data()), values.size() * sizeof(element_t));
+        }
+    }
+
+    /*!\brief Adds the entry of the tag stored at `position` and returns the position of the next tag.
+     * \throws seqan3::format_error If the tag is malformed.
+     */
+    size_t index_entry(size_t const position)
+    {
+        if (data.size() < position + 3)
+            throw format_error{"The optional fields of the record are truncated."};
+
+        uint16_t const tag = static_cast<uint16_t>(static_cast<uint8_t>(data[position])) << 8 |
+                             static_cast<uint8_t>(data[position + 1]);
+        char const type = data[position + 2];
+        size_t value_begin = position + 3;
+
+        auto check_size = [&] (size_t const required)
+        {
+            if (data.size() < required)
+                throw format_error{detail::to_string("The optional field ", tag_string(tag),
+                                                     " exceeds the end of the record.")};
+        };
+
+        switch (type)
+        {
+            case 'Z':
+            case 'H':
+            {
+                size_t const end = data.find('\0', value_begin);
+
+                if (end == std::string::npos)
+                    throw format_error{detail::to_string("The string of the optional field ", tag_string(tag),
+                                                         " is not terminated by a null character.")};
+
+                entries.push_back(entry_type{tag, type, '\0', static_cast<uint32_t>(position),
+                                             static_cast<uint32_t>(value_begin),
+                                             static_cast<uint32_t>(end - value_begin)});
+                return end + 1;
+            }
+            case 'B':
+            {
+                check_size(value_begin + 5);
+                char const array_type = data[value_begin];
+                size_t const element_size = (array_type == 'A') ? 0 : type_size(array_type);
+
+                if (element_size == 0)
+                    throw format_error{detail::to_string("The element type of the array in the optional field ",
+                                                         tag_string(tag), " must be one of [cCsSiIf] but '",
+                                                         array_type, "' was given.")};
+
+                int32_t const length = load<int32_t>(value_begin + 1);
+                value_begin += 5;
+
+                if (length < 0)
+                    throw format_error{detail::to_string("The array of the optional field ", tag_string(tag),
+                                                         " has a negative length.")};
+
+                check_size(value_begin + length * element_size);
+                entries.push_back(entry_type{tag, type, array_type, static_cast<uint32_t>(position),
+                                             static_cast<uint32_t>(value_begin), static_cast<uint32_t>(length)});
+                return value_begin + length * element_size;
+            }
+            default:
+            {
+                size_t const size = type_size(type);
+
+                if (size == 0)
+                    throw format_error{detail::to_string("The type of the optional field ", tag_string(tag),
+                                                         " must be one of [AcCsSiIfZHB] but '", type,
+                                                         "' was given.")};
+
+                check_size(value_begin + size);
+                entries.push_back(entry_type{tag, type, '\0', static_cast<uint32_t>(position),
+                                             static_cast<uint32_t>(value_begin), 1});
+                return value_begin + size;
+            }
+        }
+    }
+
+    //!\brief Decodes an entry into the representation of seqan3::sam_tag_dictionary.
+    detail::sam_tag_variant get_variant(entry_type const & entry) const
+    {
+        switch (entry.type)
+        {
+            case 'A': return get<char>(entry);
+            case 'f': return get<float>(entry);
+            case 'Z': return std::string{get<std::string_view>(entry)};
+            case 'H': return get<std::vector<std::byte>>(entry);
+            case 'B':
+            {
+                switch (entry.array_type)
+                {
+                    case 'c': return get<std::vector<int8_t>>(entry);
+                    case 'C': return get<std::vector<uint8_t>>(entry);
+                    case 's': return get<std::vector<int16_t>>(entry);
+                    case 'S': return get<std::vector<uint16_t>>(entry);
+                    case 'i': return get<std::vector<int32_t>>(entry);
+                    case 'I': return get<std::vector<uint32_t>>(entry);
+                    default:  return get<std::vector<float>>(entry);
+                }
+            }
+            default: return get<int32_t>(entry); // SAM only allows int32_t
+        }
+    }
+};
+
+} // namespace seqan3
@@ -23,10 +23,13 @@
  * | GZip       | `.gz`¹          | [zlib](https://zlib.net/)                  | GNU-Zip, most common format on UNIX                                                                                   |
  * | BGZF       | `.gz`, `.bgzf`² | [zlib](https://zlib.net/)                  | [Blocked GZip](https://samtools.github.io/hts-specs/SAMv1.pdf), compatible extension to GZip, features parallelisation|
  * | BZip2      | `.bz2`          | [libbz2](https://www.sourceware.org/bzip2) | Stronger compression than GZip, slower to compress                                                                    |
+ * | ZStandard  | `.zst`          | [libzstd](https://facebook.github.io/zstd) | Fast compression and decompression with ratios similar to BZip2, features parallelisation³                            |
  *
  * <small>¹ SeqAn always assumes GZip and does not handle pure `.Z`.<br>
  * ² Some file formats like `.bam` or `.bcf` are implicitly BGZF-compressed without showing this in the
- * extension.</small>
+ * extension.<br>
+ * ³ The output can also be written in the seekable ZStandard format, which splits the data into independent frames and
+ * appends a seek table. Such files are valid ZStandard files for every decoder.</small>
  *
  * Support for these compression formats is **optional** and depends on whether the respective dependency is available
  * when you build your program (if you use CMake, this should happen automatically).
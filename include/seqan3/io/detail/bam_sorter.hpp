@@ -0,0 +1,534 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::bam_sorter.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <ostream>
+#include <queue>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef SEQAN3_HAS_ZLIB
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+#include <seqan3/io/alignment_file/output_options.hpp>
+#include <seqan3/io/detail/safe_filesystem_entry.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Sorts encoded BAM records with an external merge sort.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The records are encoded into an in-memory buffer (see stream()). When the buffer exceeds the memory limit, its
+ * records are sorted and written to a temporary file (a *run*), compressed with BGZF if zlib is available.
+ * write_sorted() sorts the last buffer and merges it with all runs into the output stream, using a heap over the
+ * current record of every run. If no run was written, the buffer is sorted and written directly.
+ *
+ * To bound the number of open files, the runs form a k-way merge tree of width merge_width(): every run has a level,
+ * which is 0 for the runs of the buffer, and as soon as there are merge_width() runs of the same level, they are merged
+ * into one run of the next level. Every record is thus rewritten once per level, i.e. logarithmically often in the
+ * number of runs. Before the final merge, the smallest runs are merged until merge_width() runs are left.
+ *
+ * Every run is compressed and decompressed on a single thread with two blocks in flight. The buffers of these streams
+ * count against the memory limit: a run is written once the records and the buffers of one stream exceed it and at
+ * most as many runs are merged at once as their streams fit into it.
+ *
+ * Records that compare equal keep the order in which they were given, also across runs.
+ * The buffer is sorted by splitting it into one part per thread; the parts are sorted in parallel and merged.
+ * The temporary files are removed when the sorter is destroyed.
+ */
+class bam_sorter
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_sorter() = delete;                               //!< Deleted.
+    bam_sorter(bam_sorter const &) = delete;             //!< Deleted.
+    bam_sorter(bam_sorter &&) = delete;                  //!< Deleted, stream() refers to the buffer.
+    bam_sorter & operator=(bam_sorter const &) = delete; //!< Deleted.
+    bam_sorter & operator=(bam_sorter &&) = delete;      //!< Deleted, stream() refers to the buffer.
+    ~bam_sorter() = default;                             //!< Defaulted.
+
+    /*!\brief Construct from the sort order and the resources.
+     * \param[in] order               The order of the records; must not be seqan3::sam_sort_order::none.
+     * \param[in] memory_limit        The size in bytes of the encoded records that are sorted in memory.
+     * \param[in] thread_count        The number of threads that sort the records in memory.
+     * \param[in] temporary_directory The directory for the runs; the system's temporary directory if empty.
+     */
+    bam_sorter(sam_sort_order const order,
+               size_t const memory_limit,
+               size_t const thread_count,
+               std::filesystem::path temporary_directory) :
+        order{order},
+        memory_limit{std::max<size_t>(memory_limit, 1)},
+        thread_count{std::max<size_t>(thread_count, 1)},
+        temporary_directory{temporary_directory.empty() ? std::filesystem::temp_directory_path()
+                                                        : std::move(temporary_directory)},
+        width{std::clamp<size_t>(this->memory_limit / run_stream_memory, 3, max_run_count + 1) - 1}
+    {
+        assert(order != sam_sort_order::none);
+    }
+    //!\}
+
+    //!\brief The stream to write the encoded records to (each preceded by its block size).
+    std::ostream & stream() noexcept
+    {
+        return buffer_stream;
+    }
+
+    //!\brief Writes a run if the buffered records exceed the memory limit; call after records were written.
+    void records_written()
+    {
+        // the stream of the run needs memory as well while the records are written to it
+        if (buffer.size() + run_stream_memory >= memory_limit)
+            write_run();
+    }
+
+    //!\brief The number of runs that are merged at once; the memory limit bounds it to the streams it can hold.
+    size_t merge_width() const noexcept
+    {
+        return width;
+    }
+
+    /*!\brief Writes all records in sorted order.
+     * \param[out] out The stream to write to.
+     * \throws seqan3::format_error If a record is truncated.
+     * \throws seqan3::file_open_error If a temporary file cannot be opened.
+     */
+    void write_sorted(std::ostream & out)
+    {
+        if (runs.empty())
+        {
+            std::string const data = take_buffer();
+            std::vector<entry> entries = split(data);
+            sort(entries);
+
+            for (entry const & e : entries)
+                out.write(e.record.data(), e.record.size());
+
+            return;
+        }
+
+        write_run();
+
+        // merge the smallest runs until the remaining ones can be merged at once
+        while (runs.size() > width)
+            merge_last(std::min(width, runs.size() - width + 1));
+
+        merge(runs, out);
+        runs.clear(); // removes the temporary files
+    }
+
+private:
+    //!\brief A record and the values it is sorted by.
+    struct entry
+    {
+        //!\brief The record including its block size.
+        std::string_view record{};
+        //!\brief The reference id (unmapped last) in the upper and the position + 1 in the lower 32 bits.
+        uint64_t position{};
+        //!\brief The flag of the record.
+        uint16_t flag{};
+        //!\brief The name of the read without the terminating null character.
+        std::string_view name{};
+    };
+
+    //!\brief An output stream buffer that collects the records in a string, which is taken without a copy.
+    class record_buffer : public std::streambuf
+    {
+    public:
+        //!\brief The number of bytes written.
+        size_t size() const noexcept
+        {
+            return (this->pptr() == nullptr) ? 0 : static_cast<size_t>(this->pptr() - data.data());
+        }
+
+        //!\brief Returns the written bytes and clears the buffer.
+        std::string take() noexcept
+        {
+            size_t const used = size();
+            std::string result{std::move(data)};
+            result.resize(used);
+            data = std::string{};
+            this->setp(nullptr, nullptr);
+            return result;
+        }
+
+    protected:
+        //!\brief Appends a character, growing the string.
+        int_type overflow(int_type const c) override
+        {
+            if (traits_type::eq_int_type(c, traits_type::eof()))
+                return traits_type::not_eof(c);
+
+            reserve(1);
+            *this->pptr() = traits_type::to_char_type(c);
+            this->setp(this->pptr() + 1, this->epptr());
+            return c;
+        }
+
+        //!\brief Appends the characters at once.
+        std::streamsize xsputn(char_type const * characters, std::streamsize const count) override
+        {
+            reserve(count);
+            std::memcpy(this->pptr(), characters, count);
+            this->setp(this->pptr() + count, this->epptr());
+            return count;
+        }
+
+    private:
+        //!\brief Grows the string geometrically such that `count` more characters fit.
+        void reserve(size_t const count)
+        {
+            size_t const used = size();
+
+            if (data.size() - used >= count)
+                return;
+
+            data.resize(std::max({used + count, 2 * data.size(), size_t{4096}}));
+            this->setp(data.data() + used, data.data() + data.size());
+        }
+
+        //!\brief The written bytes followed by the unused capacity.
+        std::string data{};
+    };
+
+    //!\brief A temporary file of sorted records.
+    struct run_file
+    {
+        //!\brief Takes ownership of the file at `path` on the given level of the merge tree.
+        run_file(std::filesystem::path const & path, size_t const level) : path{path}, file{path}, level{level}
+        {}
+
+        //!\brief The path of the file.
+        std::filesystem::path path;
+        //!\brief Removes the file on destruction.
+        safe_filesystem_entry file;
+        //!\brief The number of merges the records of the run went through.
+        size_t level;
+    };
+
+    //!\brief Reads the records of a run one by one.
+    struct run_reader
+    {
+        //!\brief Opens the run.
+        explicit run_reader(std::filesystem::path const & path) :
+            file{path, std::ios::binary}
+        {
+            if (!file.good())
+                throw file_open_error{"Could not open the temporary file " + path.string() + " for reading."};
+        }
+
+        //!\brief Reads the next record; returns `false` at the end of the run.
+        bool next(bam_sorter const & sorter)
+        {
+            int32_t block_size{};
+
+            if (!stream.read(reinterpret_cast<char *>(&block_size), sizeof(block_size)))
+                return false;
+
+            record.resize(sizeof(block_size) + block_size);
+            std::memcpy(record.data(), &block_size, sizeof(block_size));
+
+            if (block_size < 0 || !stream.read(record.data() + sizeof(block_size), block_size))
+                throw format_error{"The temporary file of the sorted BAM records is truncated."};
+
+            current = sorter.make_entry(record);
+            return true;
+        }
+
+        //!\brief The file of the run.
+        std::ifstream file;
+#ifdef SEQAN3_HAS_ZLIB
+        //!\brief Decompresses the file.
+        contrib::bgzf_istream stream{file, run_stream_threads, run_stream_jobs};
+#else
+        //!\brief The file is not compressed.
+        std::istream & stream{file};
+#endif
+        //!\brief The current record.
+        std::string record{};
+        //!\brief The sort values of the current record.
+        entry current{};
+    };
+
+    //!\brief Returns the buffered records and clears the buffer.
+    std::string take_buffer()
+    {
+        buffer_stream.clear();
+        return buffer.take();
+    }
+
+    //!\brief Reads the sort values of a record (including its block size).
+    entry make_entry(std::string_view const record) const
+    {
+        // the fixed-size part of the record (after the block size): refID, pos, l_read_name, mapq, bin, n_cigar_op,
+        // flag, ..., followed by the read name at byte 32
+        if (record.size() < 36)
+            throw format_error{"Encountered a truncated BAM record while sorting."};
+
+        auto get = [record] (size_t const position, auto value)
+        {
+            std::memcpy(&value, record.data() + 4 + position, sizeof(value));
+            return value;
+        };
+
+        int32_t const ref_id = get(0, int32_t{});
+        int32_t const ref_offset = get(4, int32_t{});
+        uint8_t const name_length = get(8, uint8_t{});
+
+        if (record.size() < 36u + name_length)
+            throw format_error{"Encountered a truncated BAM record while sorting."};
+
+        entry result{};
+        result.record = record;
+        result.position = (static_cast<uint64_t>(static_cast<uint32_t>(ref_id)) << 32) |
+                          static_cast<uint32_t>(ref_offset + 1);
+        result.flag = get(14, uint16_t{});
+        result.name = record.substr(36, std::max<uint8_t>(name_length, 1) - 1);
+        return result;
+    }
+
+    //!\brief Splits a buffer into its records.
+    std::vector<entry> split(std::string_view data) const
+    {
+        std::vector<entry> entries{};
+
+        while (!data.empty())
+        {
+            int32_t block_size{};
+
+            if (data.size() < sizeof(block_size))
+                throw format_error{"Encountered a truncated BAM record while sorting."};
+
+            std::memcpy(&block_size, data.data(), sizeof(block_size));
+
+            if (block_size < 0 || data.size() - sizeof(block_size) < static_cast<size_t>(block_size))
+                throw format_error{"Encountered a truncated BAM record while sorting."};
+
+            entries.push_back(make_entry(data.substr(0, sizeof(block_size) + block_size)));
+            data.remove_prefix(sizeof(block_size) + block_size);
+        }
+
+        return entries;
+    }
+
+    /*!\brief Whether the first record is sorted before the second one.
+     *
+     * \details
+     *
+     * By coordinate, records are compared by reference id (unmapped reads last), position and strand. By query name,
+     * records are compared by name and the first/last segment flags.
+     */
+    bool less(entry const & lhs, entry const & rhs) const noexcept
+    {
+        if (order == sam_sort_order::coordinate)
+            return std::tuple{lhs.position, lhs.flag & 0x10} < std::tuple{rhs.position, rhs.flag & 0x10};
+
+        return std::tuple{lhs.name, lhs.flag & 0xc0} < std::tuple{rhs.name, rhs.flag & 0xc0};
+    }
+
+    //!\brief Sorts the entries stably; parts of the entries are sorted in parallel and merged afterwards.
+    void sort(std::vector<entry> & entries) const
+    {
+        auto compare = [this] (entry const & lhs, entry const & rhs) { return less(lhs, rhs); };
+
+        // do not start threads for small parts
+        size_t const part_count = std::clamp<size_t>(entries.size() / 1024, 1, thread_count);
+        size_t const part_size = (entries.size() + part_count - 1) / part_count;
+
+        std::vector<size_t> bounds(part_count + 1);
+        for (size_t i = 0; i <= part_count; ++i)
+            bounds[i] = std::min(i * part_size, entries.size());
+
+        auto sort_part = [&] (size_t const i)
+        {
+            std::stable_sort(entries.begin() + bounds[i], entries.begin() + bounds[i + 1], compare);
+        };
+
+        std::vector<std::thread> workers{};
+        for (size_t i = 1; i < part_count; ++i)
+            workers.emplace_back(sort_part, i);
+
+        sort_part(0);
+
+        for (auto & worker : workers)
+            worker.join();
+
+        for (size_t width = 1; width < part_count; width *= 2)
+        {
+            for (size_t i = 0; i + width < part_count; i += 2 * width)
+            {
+                std::inplace_merge(entries.begin() + bounds[i],
+                                   entries.begin() + bounds[i + width],
+                                   entries.begin() + bounds[std::min(i + 2 * width, part_count)],
+                                   compare);
+            }
+        }
+    }
+
+    //!\brief Sorts the buffered records and writes them to a new temporary file.
+    void write_run()
+    {
+        std::string const data = take_buffer();
+
+        if (data.empty())
+            return;
+
+        std::vector<entry> entries = split(data);
+        sort(entries);
+
+        add_run(0, [&entries] (std::ostream & run)
+        {
+            for (entry const & e : entries)
+                run.write(e.record.data(), e.record.size());
+        });
+
+        // The levels do not increase towards the end, thus the last runs have the same level if the first of them has.
+        while (runs.size() >= width && std::prev(runs.end(), width)->level == runs.back().level)
+            merge_last(width);
+    }
+
+    //!\brief Merges the last `count` runs into a new run on the next level and removes them.
+    void merge_last(size_t const count)
+    {
+        std::list<run_file> merged{};
+        merged.splice(merged.end(), runs, std::prev(runs.end(), count), runs.end());
+
+        add_run(merged.front().level + 1, [&] (std::ostream & run) { merge(merged, run); });
+    } // removes the merged runs
+
+    //!\brief Creates a new temporary file on the given level and calls `write` with a stream to it.
+    template <typename write_fn_t>
+    void add_run(size_t const level, write_fn_t && write)
+    {
+        std::filesystem::path path{};
+        std::random_device random{};
+
+        do
+        {
+            path = temporary_directory / ("seqan3_bam_sort_" + std::to_string(random()) + "_" +
+                                          std::to_string(runs.size()) + ".tmp");
+        }
+        while (std::filesystem::exists(path));
+
+        std::list<run_file> written{}; // removes the file if writing fails
+        written.emplace_back(path, level);
+
+        std::ofstream file{path, std::ios::binary};
+
+        if (!file.good())
+            throw file_open_error{"Could not open the temporary file " + path.string() + " for writing."};
+
+        {
+#ifdef SEQAN3_HAS_ZLIB
+            contrib::bgzf_ostream run{file, run_stream_threads, run_stream_jobs};
+#else
+            std::ostream & run{file};
+#endif
+            write(run);
+        } // the BGZF stream writes the last block on destruction
+
+        if (!file.good())
+            throw file_open_error{"Could not write the temporary file " + path.string() + "."};
+
+        runs.splice(runs.end(), written);
+    }
+
+    //!\brief Merges the given runs; records that compare equal are taken from the earlier run first.
+    void merge(std::list<run_file> const & merged, std::ostream & out) const
+    {
+        std::vector<std::unique_ptr<run_reader>> readers{};
+        readers.reserve(merged.size());
+
+        for (run_file const & run : merged)
+            readers.push_back(std::make_unique<run_reader>(run.path));
+
+        auto greater = [&readers, this] (size_t const lhs, size_t const rhs)
+        {
+            entry const & lhs_entry = readers[lhs]->current;
+            entry const & rhs_entry = readers[rhs]->current;
+
+            if (less(rhs_entry, lhs_entry))
+                return true;
+            if (less(lhs_entry, rhs_entry))
+                return false;
+            return lhs > rhs;
+        };
+
+        std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heap{greater};
+
+        for (size_t i = 0; i < readers.size(); ++i)
+            if (readers[i]->next(*this))
+                heap.push(i);
+
+        while (!heap.empty())
+        {
+            size_t const i = heap.top();
+            heap.pop();
+
+            out.write(readers[i]->record.data(), readers[i]->record.size());
+
+            if (readers[i]->next(*this))
+                heap.push(i);
+        }
+    }
+
+    //!\brief The maximal number of runs that are merged at once.
+    static constexpr size_t max_run_count{128};
+#ifdef SEQAN3_HAS_ZLIB
+    //!\brief The number of threads that compress or decompress a run.
+    static constexpr size_t run_stream_threads{1};
+    //!\brief The number of blocks that a run stream compresses or decompresses at the same time.
+    static constexpr size_t run_stream_jobs{2};
+    //!\brief The memory of the buffers of a run stream: every job holds a compressed and an uncompressed block.
+    static constexpr size_t run_stream_memory{run_stream_threads * run_stream_jobs * 2 * 64 * 1024};
+#else
+    //!\brief The memory of a run stream, which is dominated by the record it reads.
+    static constexpr size_t run_stream_memory{64 * 1024};
+#endif
+
+    //!\brief The order of the records.
+    sam_sort_order order;
+    //!\brief The size in bytes of the buffer that triggers writing a run.
+    size_t memory_limit;
+    //!\brief The number of threads that sort the buffer.
+    size_t thread_count;
+    //!\brief The directory of the runs.
+    std::filesystem::path temporary_directory;
+    //!\brief The number of runs that are merged at once.
+    size_t width;
+    //!\brief The records that were not written to a run yet.
+    record_buffer buffer{};
+    //!\brief Writes to #buffer.
+    std::ostream buffer_stream{&buffer};
+    //!\brief The runs in the order they were written; the last ones are merged first.
+    std::list<run_file> runs{};
+};
+
+} // namespace seqan3::detail
@@ -15,11 +15,13 @@
 #include <seqan3/std/algorithm>
 #include <seqan3/std/concepts>
 #include <seqan3/std/filesystem>
+#include <fstream>
 #include <iostream>
 #include <seqan3/std/ranges>
 #include <seqan3/std/span>
 #include <string>
 #include <tuple>
+#include <vector>
 
 
 #ifdef SEQAN3_HAS_BZIP2
@@ -29,8 +31,14 @@
     #include <seqan3/contrib/stream/bgzf_istream.hpp>
     #include <seqan3/contrib/stream/bgzf_stream_util.hpp>
     #include <seqan3/contrib/stream/gz_istream.hpp>
+    #include <seqan3/contrib/stream/parallel_gz_istream.hpp>
+#endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_istream.hpp>
 #endif
 #include <seqan3/io/detail/magic_header.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/detail/mmap_istream.hpp>
 #include <seqan3/utility/detail/exposition_only_concept.hpp>
 
 namespace seqan3::detail
@@ -69,6 +77,42 @@ inline bool starts_with(ref_t && reference, query_t && query)
     }
 }
 
+/*!\brief Opens a file for reading; regular files are memory-mapped if possible.
+ * \param[in] filename      The file to open.
+ * \param[in] stream_buffer The buffer of the std::ifstream that is used if the file cannot be memory-mapped.
+ * \returns A pointer to the primary stream with a default deleter.
+ * \throws seqan3::file_open_error If the file could not be opened.
+ *
+ * \details
+ *
+ * A memory-mapped file (see seqan3::detail::mmap_istream) is buffered completely, so the formats parse it directly
+ * from memory. Pipes and other files that cannot be mapped are read through a std::ifstream that uses the given
+ * stream buffer.
+ */
+inline auto make_primary_istream(std::filesystem::path const & filename, std::vector<char> & stream_buffer)
+    -> std::unique_ptr<std::basic_istream<char>, std::function<void(std::basic_istream<char>*)>>
+{
+    auto stream_deleter_default = [] (std::basic_istream<char> * ptr) { delete ptr; };
+
+#ifdef SEQAN3_HAS_MMAP
+    {
+        auto stream = std::make_unique<mmap_istream>(filename);
+
+        if (stream->good())
+            return {stream.release(), stream_deleter_default};
+    }
+#endif
+
+    auto stream = std::make_unique<std::ifstream>();
+    stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+    stream->open(filename, std::ios_base::in | std::ios::binary);
+
+    if (!stream->good())
+        throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+    return {stream.release(), stream_deleter_default};
+}
+
 /*!\brief Depending on the magic bytes of the given stream, return a decompression stream or forward the primary stream.
  * \param[in] primary_stream The primary (device) stream for reading.
  * \param[in,out] filename  The associated filename; compression extensions will be stripped. [optional]
@@ -133,6 +177,17 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
         if (contains_extension(gz_compression{}, extension) || contains_extension(bgzf_compression{}, extension))
             filename.replace_extension();
 
+        // Plain gzip files are only decompressed block-parallel if explicitly requested.
+        if constexpr (std::same_as<char_t, char>)
+        {
+            if (contrib::parallel_gz_thread_count > 1)
+            {
+                return {new contrib::basic_parallel_gz_istream<char_t>{primary_stream,
+                                                                       contrib::parallel_gz_thread_count},
+                        stream_deleter_default};
+            }
+        }
+
         return {new contrib::basic_gz_istream<char_t>{primary_stream}, stream_deleter_default};
     #else
         throw file_open_error{"Trying to read from a gzipped file, but no ZLIB available."};
@@ -151,7 +206,14 @@ inline auto make_secondary_istream(std::basic_istream<char_t> & primary_stream,
     }
     else if (starts_with(magic_number, zstd_compression::magic_header)) // ZStd
     {
-        throw file_open_error{"Trying to read from a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        if (contains_extension(zstd_compression{}, extension))
+            filename.replace_extension();
+
+        return {new contrib::basic_zstd_istream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to read from a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
@@ -24,6 +24,9 @@
     #include <seqan3/contrib/stream/bgzf_ostream.hpp>
     #include <seqan3/contrib/stream/gz_ostream.hpp>
 #endif
+#ifdef SEQAN3_HAS_ZSTD
+    #include <seqan3/contrib/stream/zstd_ostream.hpp>
+#endif
 #include <seqan3/std/filesystem>
 
 namespace seqan3::detail
@@ -69,10 +72,48 @@ inline auto make_secondary_ostream(std::basic_ostream<char_t> & primary_stream,
     }
     else if (extension == ".zst")
     {
-        throw file_open_error{"Trying to write a zst'ed file, but SeqAn does not yet support this."};
+    #ifdef SEQAN3_HAS_ZSTD
+        filename.replace_extension("");
+        return {new contrib::basic_zstd_ostream<char_t>{primary_stream}, stream_deleter_default};
+    #else
+        throw file_open_error{"Trying to write a zst'ed file, but no libzstd available."};
+    #endif
     }
 
     return {&primary_stream, stream_deleter_noop};
 }
 
+/*!\brief Sets the compression level of a BGZF stream created by seqan3::detail::make_secondary_ostream.
+ * \param[in,out] secondary_stream The stream to configure; streams that do not compress with BGZF are not changed.
+ * \param[in] level                The compression level from 0 (no compression) to 9 (best compression).
+ * \throws std::invalid_argument If the stream compresses with BGZF and the level is out of range.
+ */
+template <builtin_character char_t>
+inline void set_compression_level(std::basic_ostream<char_t> & secondary_stream, [[maybe_unused]] int const level)
+{
+#ifdef SEQAN3_HAS_ZLIB
+    if (auto * bgzf_stream = dynamic_cast<contrib::basic_bgzf_ostream<char_t> *>(&secondary_stream))
+        bgzf_stream->compression_level(level);
+#else
+    (void) secondary_stream;
+#endif
+}
+
+/*!\brief Sets the frame size of a zstd stream created by seqan3::detail::make_secondary_ostream.
+ * \param[in,out] secondary_stream The stream to configure; streams that do not compress with zstd are not changed.
+ * \param[in] frame_size           The uncompressed size of a frame of the seekable zstd format in bytes; 0 does not
+ *                                 start new frames.
+ */
+template <builtin_character char_t>
+inline void set_zstd_frame_size(std::basic_ostream<char_t> & secondary_stream,
+                                [[maybe_unused]] size_t const frame_size)
+{
+#ifdef SEQAN3_HAS_ZSTD
+    if (auto * zstd_stream = dynamic_cast<contrib::basic_zstd_ostream<char_t> *>(&secondary_stream))
+        zstd_stream->frame_size(frame_size);
+#else
+    (void) secondary_stream;
+#endif
+}
+
 } // namespace seqan3::detail
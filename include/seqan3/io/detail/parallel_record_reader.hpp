@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::parallel_record_reader.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer over a string that it owns.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The whole string forms the get area, so parsers see the complete chunk at once.
+ */
+class string_istreambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Takes ownership of the text.
+    explicit string_istreambuf(std::string text_) : text{std::move(text_)}
+    {
+        setg(text.data(), text.data(), text.data() + text.size());
+    }
+
+    string_istreambuf(string_istreambuf const &) = delete;              //!< Deleted.
+    string_istreambuf(string_istreambuf &&) = delete;                   //!< Deleted.
+    string_istreambuf & operator=(string_istreambuf const &) = delete;  //!< Deleted.
+    string_istreambuf & operator=(string_istreambuf &&) = delete;       //!< Deleted.
+    ~string_istreambuf() override = default;                            //!< Defaulted.
+    //!\}
+
+private:
+    //!\brief The buffered text.
+    std::string text;
+};
+
+/*!\brief The records parsed from one chunk of a file.
+ * \ingroup io
+ * \tparam record_t The type of the records.
+ */
+template <typename record_t>
+struct record_batch
+{
+    //!\brief The records in file order.
+    std::vector<record_t> records{};
+    //!\brief The exception thrown while parsing the record after the last one in `records`, if any.
+    std::exception_ptr error{};
+};
+
+/*!\brief Reads a file in chunks that are cut at record boundaries and parses the chunks on several threads.
+ * \ingroup io
+ * \tparam record_t The type of the records.
+ *
+ * \details
+ *
+ * The calling thread reads chunks of `chunk_size` bytes from the stream and cuts every chunk at the beginning of the
+ * last record it contains; the incomplete record is moved to the front of the next chunk. The chunks are parsed by
+ * a seqan3::detail::execution_handler_parallel and returned as seqan3::detail::record_batch in file order. Up to
+ * twice as many chunks as threads are read ahead.
+ *
+ * Every chunk is parsed with its own copy of the parse function, so the function may carry state, e.g. a format.
+ * If parsing a chunk throws, the records before the error are returned together with the exception.
+ */
+template <typename record_t>
+class parallel_record_reader
+{
+public:
+    //!\brief The type of a batch of records.
+    using batch_type = record_batch<record_t>;
+    //!\brief Reads one record from the stream.
+    using parse_function_type = std::function<void(std::istream &, record_t &)>;
+    //!\brief Returns the beginning of the last record in a chunk or 0 if there is none after the first one.
+    using boundary_function_type = std::function<size_t(std::string_view)>;
+
+    //!\brief The default number of bytes that are read per chunk.
+    static constexpr size_t default_chunk_size = 4 * 1024 * 1024;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parallel_record_reader() = delete;                                             //!< Deleted.
+    parallel_record_reader(parallel_record_reader const &) = delete;               //!< Deleted.
+    parallel_record_reader(parallel_record_reader &&) = delete;                    //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader const &) = delete;   //!< Deleted.
+    parallel_record_reader & operator=(parallel_record_reader &&) = delete;        //!< Deleted.
+    ~parallel_record_reader() = default;                                           //!< Defaulted.
+
+    /*!\brief Constructs the reader and spawns the threads.
+     * \param[in] stream         The stream to read from; must be positioned at the beginning of a record.
+     * \param[in] thread_count   The number of threads that parse chunks.
+     * \param[in] find_boundary  Finds the beginning of the last record in a chunk.
+     * \param[in] parse_record   Reads one record from the stream.
+     * \param[in] chunk_size     The number of bytes that are read per chunk.
+     */
+    parallel_record_reader(std::istream & stream,
+                           size_t const thread_count,
+                           boundary_function_type find_boundary,
+                           parse_function_type parse_record,
+                           size_t const chunk_size = default_chunk_size) :
+        stream{&stream},
+        find_boundary{std::move(find_boundary)},
+        parse_record{std::move(parse_record)},
+        chunk_size{std::max<size_t>(chunk_size, 1u)},
+        read_ahead{2 * std::max<size_t>(thread_count, 1u)},
+        handler{std::max<size_t>(thread_count, 1u)}
+    {}
+    //!\}
+
+    /*!\brief Returns the records of the next chunk.
+     * \returns The next batch; an empty batch without error signals the end of the file.
+     *
+     * \details
+     *
+     * Batches may also be empty if a chunk consisted only of whitespace, so callers should only stop at an empty
+     * batch if at_end() is `true`.
+     */
+    batch_type next_batch()
+    {
+        while (pending.size() < read_ahead && !end_of_stream)
+            submit(read_chunk());
+
+        if (pending.empty())
+            return {};
+
+        batch_type batch = pending.front().get();
+        pending.pop_front();
+
+        return batch;
+    }
+
+    //!\brief Whether all batches have been returned.
+    bool at_end() const noexcept
+    {
+        return end_of_stream && pending.empty();
+    }
+
+private:
+    //!\brief Reads the next chunk and moves the incomplete record at its end to the next chunk.
+    std::string read_chunk()
+    {
+        std::string text = std::move(remainder);
+        remainder.clear();
+
+        for (;;)
+        {
+            size_t const old_size = text.size();
+            text.resize(old_size + chunk_size);
+            stream->read(text.data() + old_size, chunk_size);
+            text.resize(old_size + stream->gcount());
+
+            if (static_cast<size_t>(stream->gcount()) < chunk_size)
+            {
+                end_of_stream = true;
+                return text;
+            }
+
+            // A record that does not fit into the chunk makes the chunk grow.
+            if (size_t const boundary = find_boundary(text); boundary > 0 && boundary < text.size())
+            {
+                remainder.assign(text, boundary);
+                text.resize(boundary);
+                return text;
+            }
+        }
+    }
+
+    //!\brief Schedules the parsing of a chunk.
+    void submit(std::string text)
+    {
+        if (text.empty())
+            return;
+
+        auto task = std::make_shared<std::packaged_task<batch_type()>>(
+            [parse = parse_record, text = std::move(text)] () mutable
+        {
+            string_istreambuf buffer{std::move(text)};
+            std::istream chunk_stream{&buffer};
+            batch_type batch{};
+
+            try
+            {
+                while (std::istreambuf_iterator<char>{chunk_stream} != std::istreambuf_iterator<char>{})
+                {
+                    batch.records.emplace_back();
+                    parse(chunk_stream, batch.records.back());
+                }
+            }
+            catch (...)
+            {
+                batch.records.pop_back();
+                batch.error = std::current_exception();
+            }
+
+            return batch;
+        });
+
+        pending.push_back(task->get_future());
+        handler.execute([] (auto const & task, auto &&) { (*task)(); }, std::move(task), [] () {});
+    }
+
+    //!\brief The stream to read from.
+    std::istream * stream;
+    //!\brief Finds the beginning of the last record in a chunk.
+    boundary_function_type find_boundary;
+    //!\brief Reads one record; copied for every chunk.
+    parse_function_type parse_record;
+    //!\brief The number of bytes read per chunk.
+    size_t chunk_size;
+    //!\brief The maximal number of chunks that are scheduled but not yet returned.
+    size_t read_ahead;
+    //!\brief The incomplete record at the end of the last chunk.
+    std::string remainder{};
+    //!\brief Whether the stream has been read completely.
+    bool end_of_stream{false};
+    //!\brief The batches of the scheduled chunks in file order.
+    std::deque<std::future<batch_type>> pending{};
+    //!\brief The thread pool; declared last so that its threads are joined first.
+    execution_handler_parallel handler;
+};
+
+} // namespace seqan3::detail
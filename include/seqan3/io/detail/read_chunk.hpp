@@ -0,0 +1,360 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides helper functions to parse whole chunks of a stream buffer.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/small_vector.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+#include <seqan3/utility/char_operations/pretty_print.hpp>
+#include <seqan3/utility/detail/type_name_as_string.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Lookup tables for validating and converting the characters of a sequence.
+ * \ingroup io
+ * \tparam legal_alphabet_t The alphabet that determines which characters are legal.
+ * \tparam target_t         The alphabet the characters are converted to.
+ * \tparam skip_digits      Whether digits are ignored in addition to whitespace.
+ *
+ * \details
+ *
+ * Every character is classified once per type combination, so that reading a sequence only needs two table lookups
+ * per character instead of evaluating seqan3::char_is_valid_for and seqan3::assign_char_to.
+ */
+template <typename legal_alphabet_t, typename target_t, bool skip_digits>
+struct sequence_char_table
+{
+    //!\brief Character is a letter of the sequence.
+    static constexpr uint8_t letter = 0;
+    //!\brief Character is ignored.
+    static constexpr uint8_t skip = 1;
+    //!\brief Character is not allowed in the sequence.
+    static constexpr uint8_t illegal = 2;
+
+    //!\brief The class of every character; the last entry stands for all characters that do not fit into a byte.
+    static inline std::array<uint8_t, 257> const classes = [] ()
+    {
+        std::array<uint8_t, 257> result{};
+        result[256] = illegal;
+
+        for (size_t i = 0; i < 256; ++i)
+        {
+            char const c = static_cast<char>(i);
+
+            if (is_space(c) || (skip_digits && is_digit(c)))
+                result[i] = skip;
+            else if (!char_is_valid_for<legal_alphabet_t>(c))
+                result[i] = illegal;
+            else
+                result[i] = letter;
+        }
+
+        return result;
+    }();
+
+    //!\brief The letter every character is converted to.
+    static inline std::array<target_t, 257> const letters = [] ()
+    {
+        std::array<target_t, 257> result{};
+
+        for (size_t i = 0; i < 256; ++i)
+            result[i] = assign_char_to(static_cast<char>(i), target_t{});
+
+        return result;
+    }();
+
+    //!\brief Whether the letters may be converted with seqan3::detail::simd_lookup_letters.
+    static constexpr bool simd_letters_usable = alphabet_simd_conversion<target_t>::is_byte_alphabet;
+
+    /*!\brief The rank of every letter by the lower five bits of its character (see seqan3::detail::simd_lookup_letters).
+     * \details 255 marks the characters whose upper and lower case differ in their class or letter; all entries are 255
+     *          if the ranks cannot be written as bytes.
+     */
+    static inline std::array<uint8_t, 32> const simd_letters = [] ()
+    {
+        std::array<uint8_t, 32> result{};
+        result.fill(0xff);
+
+        if constexpr (simd_letters_usable)
+        {
+            if (!alphabet_simd_conversion<target_t>::get().rank_is_byte)
+                return result;
+
+            for (size_t i = 0; i < 32; ++i)
+            {
+                char const upper = static_cast<char>(0x40 | i);
+                char const lower = static_cast<char>(0x60 | i);
+                size_t const rank = to_rank(assign_char_to(upper, target_t{}));
+
+                if (char_is_valid_for<legal_alphabet_t>(upper) && char_is_valid_for<legal_alphabet_t>(lower) &&
+                    rank == to_rank(assign_char_to(lower, target_t{})))
+                {
+                    result[i] = rank;
+                }
+            }
+        }
+
+        return result;
+    }();
+
+    //!\brief The index of a character in the tables.
+    template <typename char_t>
+    static size_t index(char_t const c) noexcept
+    {
+        auto const value = static_cast<std::make_unsigned_t<char_t>>(c);
+        return (value < 256) ? value : 256;
+    }
+
+    //!\brief Throws seqan3::parse_error for the first illegal character of the chunk.
+    template <typename char_t>
+    [[noreturn]] static void throw_illegal(std::basic_string_view<char_t> const chunk)
+    {
+        for (char_t const c : chunk)
+        {
+            if (classes[index(c)] == illegal)
+            {
+                throw parse_error{std::string{"Encountered an unexpected letter: "} +
+                                  "char_is_valid_for<" +
+                                  type_name_as_string<legal_alphabet_t> +
+                                  "> evaluated to false on " +
+                                  make_printable(static_cast<char>(c))};
+            }
+        }
+
+        throw parse_error{"Encountered an unexpected letter."}; // LCOV_EXCL_LINE
+    }
+};
+
+/*!\brief Appends the letters of a chunk to a sequence, ignoring whitespace (and digits).
+ * \ingroup io
+ * \tparam legal_alphabet_t The alphabet that determines which characters are legal.
+ * \tparam skip_digits      Whether digits are ignored in addition to whitespace.
+ * \param[in,out] sequence  The sequence to append to.
+ * \param[in]     chunk     The characters to append.
+ * \returns The number of appended letters.
+ * \throws seqan3::parse_error if the chunk contains a character that is not valid for `legal_alphabet_t`.
+ *
+ * \details
+ *
+ * For resizable random access sequences, every character is written unconditionally and the output position is
+ * only advanced for letters. This avoids a branch per character and a `push_back` per letter.
+ * A seqan3::bitcompressed_vector is filled through a small buffer, whose letters are appended as packed words.
+ */
+template <typename legal_alphabet_t, bool skip_digits, typename sequence_t, typename char_t>
+size_t append_sequence_chunk(sequence_t & sequence, std::basic_string_view<char_t> const chunk)
+{
+    using target_t = std::ranges::range_value_t<sequence_t>;
+    using table_t = sequence_char_table<legal_alphabet_t, target_t, skip_digits>;
+
+    if constexpr (is_type_specialisation_of_v<sequence_t, bitcompressed_vector>)
+    {
+        small_vector<target_t, 4096> buffer{};
+        size_t count = 0;
+
+        for (size_t start = 0; start < chunk.size(); start += buffer.max_size())
+        {
+            buffer.clear();
+            count += append_sequence_chunk<legal_alphabet_t, skip_digits>(buffer,
+                                                                          chunk.substr(start, buffer.max_size()));
+            sequence.insert(sequence.cend(), buffer.begin(), buffer.end());
+        }
+
+        return count;
+    }
+    else if constexpr (std::ranges::random_access_range<sequence_t> &&
+                  requires (sequence_t & s) { s.resize(0u); { s.size() } -> std::convertible_to<size_t>; })
+    {
+        size_t const old_size = sequence.size();
+        sequence.resize(old_size + chunk.size());
+
+        auto out = std::ranges::begin(sequence) + old_size;
+        uint8_t classes = 0;
+        size_t count = 0;
+        size_t position = 0;
+
+        auto append_until = [&] (size_t const end)
+        {
+            for (; position < end; ++position)
+            {
+                size_t const i = table_t::index(chunk[position]);
+                uint8_t const char_class = table_t::classes[i];
+
+                out[count] = table_t::letters[i];
+                count += (char_class == table_t::letter);
+                classes |= char_class;
+            }
+        };
+
+        if constexpr (table_t::simd_letters_usable && std::same_as<char_t, char> &&
+                      std::ranges::contiguous_range<sequence_t>)
+        {
+            // blocks of letters are converted with SIMD, blocks with other characters (e.g. line breaks) element-wise
+            if (alphabet_simd_conversion<target_t>::get().rank_is_byte)
+            {
+                uint8_t * const ranks = reinterpret_cast<uint8_t *>(std::ranges::data(sequence) + old_size);
+
+                while (position < chunk.size())
+                {
+                    size_t const converted = simd_lookup_letters(chunk.data() + position,
+                                                                 chunk.size() - position,
+                                                                 ranks + count,
+                                                                 table_t::simd_letters);
+                    position += converted;
+                    count += converted;
+                    append_until(std::min(chunk.size(), position + simd_conversion_block_size));
+                }
+            }
+        }
+
+        append_until(chunk.size());
+
+        sequence.resize(old_size + count);
+
+        if (classes & table_t::illegal)
+            table_t::throw_illegal(chunk);
+
+        return count;
+    }
+    else
+    {
+        size_t count = 0;
+
+        for (char_t const c : chunk)
+        {
+            size_t const i = table_t::index(c);
+
+            if (table_t::classes[i] == table_t::skip)
+                continue;
+
+            if (table_t::classes[i] == table_t::illegal)
+                table_t::throw_illegal(chunk);
+
+            sequence.push_back(table_t::letters[i]);
+            ++count;
+        }
+
+        return count;
+    }
+}
+
+/*!\brief Counts the characters of a chunk that are not ignored when reading a sequence.
+ * \ingroup io
+ * \tparam skip_digits Whether digits are ignored in addition to whitespace.
+ * \param[in] chunk    The characters to count.
+ * \returns The number of characters that are neither whitespace nor (if `skip_digits` is set) digits.
+ */
+template <bool skip_digits, typename char_t>
+size_t count_sequence_chunk(std::basic_string_view<char_t> const chunk)
+{
+    using table_t = sequence_char_table<char, char, skip_digits>;
+
+    size_t count = 0;
+    for (char_t const c : chunk)
+        count += (table_t::classes[table_t::index(c)] != table_t::skip);
+
+    return count;
+}
+
+/*!\brief Checks whether a chunk consists only of letters that are valid for an alphabet.
+ * \ingroup io
+ * \tparam legal_alphabet_t The alphabet that determines which characters are legal.
+ * \tparam skip_digits      Whether digits are ignored in addition to whitespace.
+ * \param[in] chunk         The characters to check.
+ * \returns `true` if the chunk contains neither illegal nor ignored characters.
+ */
+template <typename legal_alphabet_t, bool skip_digits, typename char_t>
+bool chunk_has_only_letters(std::basic_string_view<char_t> const chunk)
+{
+    using table_t = sequence_char_table<legal_alphabet_t, char, skip_digits>;
+
+    uint8_t classes = 0;
+    for (char_t const c : chunk)
+        classes |= table_t::classes[table_t::index(c)];
+
+    return classes == table_t::letter;
+}
+
+/*!\brief Appends the characters of a chunk to a range without validation, e.g. to an ID.
+ * \ingroup io
+ * \param[in,out] output The range to append to.
+ * \param[in]     chunk  The characters to append.
+ */
+template <typename output_t, typename char_t>
+void append_chunk(output_t & output, std::basic_string_view<char_t> const chunk)
+{
+    using target_t = std::ranges::range_value_t<output_t>;
+
+    if constexpr (std::same_as<target_t, char_t> &&
+                  requires (output_t & o) { o.insert(o.end(), chunk.begin(), chunk.end()); })
+    {
+        output.insert(output.end(), chunk.begin(), chunk.end());
+    }
+    else
+    {
+        using table_t = sequence_char_table<char, target_t, false>;
+
+        for (char_t const c : chunk)
+            output.push_back(table_t::letters[table_t::index(c)]);
+    }
+}
+
+/*!\brief Skips all characters that satisfy the predicate.
+ * \ingroup io
+ * \param[in,out] stream_it The iterator over the stream buffer.
+ * \param[in]     predicate The characters to skip.
+ */
+template <typename char_t, typename traits_t, typename predicate_t>
+void skip_while(fast_istreambuf_iterator<char_t, traits_t> & stream_it, predicate_t && predicate)
+{
+    stream_it.consume_chunks([&] (std::basic_string_view<char_t, traits_t> const chunk)
+    {
+        size_t i = 0;
+        while (i < chunk.size() && predicate(chunk[i]))
+            ++i;
+
+        return i;
+    });
+}
+
+/*!\brief Reads a line like seqan3::views::take_line_or_throw.
+ * \ingroup io
+ * \param[in,out] stream_it The iterator over the stream buffer.
+ * \param[in]     callback  Invoked with the chunks of the line, excluding the end-of-line characters.
+ * \throws seqan3::unexpected_end_of_input if the input ends before the end of the line.
+ *
+ * \details
+ *
+ * The line ends at the first `\n` or `\r`. All directly following end-of-line characters are consumed as well.
+ */
+template <typename char_t, typename traits_t, typename callback_t>
+void read_line_or_throw(fast_istreambuf_iterator<char_t, traits_t> & stream_it, callback_t && callback)
+{
+    if (!stream_it.read_until(callback, '\n', '\r'))
+        throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+
+    skip_while(stream_it, is_char<'\r'> || is_char<'\n'>);
+}
+
+} // namespace seqan3::detail
@@ -15,6 +15,7 @@
 #include <seqan3/std/algorithm>
 #include <iterator>
 #include <seqan3/std/ranges>
+#include <seqan3/std/span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -26,10 +27,12 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/detail/read_chunk.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/io/stream/detail/fast_ostreambuf_iterator.hpp>
 #include <seqan3/range/detail/misc.hpp>
 #include <seqan3/range/views/char_to.hpp>
@@ -117,13 +120,120 @@ protected:
                               id_type & id,
                               qual_type & SEQAN3_DOXYGEN_ONLY(qualities))
     {
-        auto stream_view = views::istreambuf(stream);
+        // The record is parsed chunk-wise directly on the stream buffer: delimiters are searched with memchr and
+        // whole chunks are validated and converted with lookup tables (see seqan3/io/detail/read_chunk.hpp).
+        detail::fast_istreambuf_iterator<typename stream_type::char_type> stream_it{*stream.rdbuf()};
 
         // ID
-        read_id(stream_view, options, id);
+        read_id(stream_it, options, id);
 
         // Sequence
-        read_seq(stream_view, options, sequence);
+        read_seq(stream_it, options, sequence);
+    }
+
+    /*!\brief Read a record without copying it, if it is contained completely in the buffer of the stream.
+     * \tparam stream_type          The type of the stream.
+     * \tparam legal_alph_type      The alphabet that determines which characters of the sequence are legal.
+     * \tparam seq_qual_combined    Whether the options are for reading field::seq_qual.
+     * \param[in,out] stream        The input stream to read from.
+     * \param[in]     options       File specific options passed to the format.
+     * \param[out]    sequence      Points to the sequence in the stream buffer afterwards.
+     * \param[out]    id            Points to the ID in the stream buffer afterwards.
+     * \param[out]    qualities     Is set to an empty view; FASTA has no qualities.
+     * \returns `true` if the record was read, `false` if nothing was consumed and the record needs to be read by
+     *          read_sequence_record().
+     *
+     * \details
+     *
+     * Only records whose sequence is on a single line that is directly followed by the next ID line inside the buffer
+     * are read in place; multi-line sequences and malformed records are left to read_sequence_record(). The views are
+     * valid until the stream is read from again.
+     */
+    template <typename stream_type,     // constraints checked by file
+              typename legal_alph_type, bool seq_qual_combined>
+    bool read_sequence_record_in_place(stream_type                                                      & stream,
+                                       sequence_file_input_options<legal_alph_type,
+                                                                   seq_qual_combined> const             & options,
+                                       std::basic_string_view<typename stream_type::char_type>          & sequence,
+                                       std::basic_string_view<typename stream_type::char_type>          & id,
+                                       std::basic_string_view<typename stream_type::char_type>          & qualities)
+    {
+        using chunk_type = std::basic_string_view<typename stream_type::char_type>;
+
+        detail::fast_istreambuf_iterator<typename stream_type::char_type> stream_it{*stream.rdbuf()};
+        auto const is_id = is_char<'>'> || is_char<';'>;
+        bool record_was_read = false;
+
+        stream_it.consume_chunks([&] (chunk_type const chunk) -> size_t
+        {
+            if (chunk.empty() || !is_id(chunk[0]))
+                return 0;
+
+            size_t const id_begin = std::ranges::find_if_not(chunk, is_id || is_blank) - chunk.begin();
+            size_t const id_end = chunk.find('\n', id_begin);
+
+            if (id_end == chunk_type::npos)
+                return 0;
+
+            size_t const sequence_end = chunk.find('\n', id_end + 1);
+
+            if (sequence_end == chunk_type::npos || sequence_end + 1 == chunk.size() || !is_id(chunk[sequence_end + 1]))
+                return 0;
+
+            chunk_type id_line = chunk.substr(id_begin, id_end - id_begin);
+            chunk_type sequence_line = chunk.substr(id_end + 1, sequence_end - id_end - 1);
+
+            if (!id_line.empty() && id_line.back() == '\r')
+                id_line.remove_suffix(1);
+
+            if (!sequence_line.empty() && sequence_line.back() == '\r')
+                sequence_line.remove_suffix(1);
+
+            if (id_line.find('\r') != chunk_type::npos ||
+                sequence_line.find_first_of(">;") != chunk_type::npos ||
+                !detail::chunk_has_only_letters<legal_alph_type, true>(sequence_line))
+            {
+                return 0;
+            }
+
+            if (options.truncate_ids)
+                id = id_line.substr(0, std::ranges::find_if(id_line, is_cntrl || is_blank) - id_line.begin());
+            else
+                id = id_line;
+
+            sequence = sequence_line;
+            qualities = chunk_type{};
+            record_was_read = true;
+
+            return sequence_end + 1;
+        });
+
+        return record_was_read;
+    }
+
+    /*!\brief Finds the beginning of the last record in a chunk of a file.
+     * \tparam legal_alph_type The alphabet that determines which characters of the sequence are legal.
+     * \param[in] chunk        A chunk of the file that begins with a record.
+     * \returns The position of the last ID line in `chunk` or 0 if there is no ID line after the first one.
+     *
+     * \details
+     *
+     * Used to cut a file into chunks that can be parsed independently (see
+     * seqan3::sequence_file_input_options::parsing_threads). Every line that begins with '>' or ';' begins a record.
+     */
+    template <typename legal_alph_type>
+    static size_t find_last_record_begin(std::string_view const chunk)
+    {
+        size_t const last_id = chunk.find_last_of(">;");
+
+        for (size_t position = last_id; position != std::string_view::npos && position > 0;
+             position = chunk.find_last_of(">;", position - 1))
+        {
+            if (chunk[position - 1] == '\n')
+                return position;
+        }
+
+        return 0;
     }
 
     //!\copydoc sequence_file_output_format::write_sequence_record
@@ -169,159 +279,80 @@ protected:
 private:
     //!\privatesection
     //!\brief Implementation of reading the ID.
-    template <typename stream_view_t,
+    template <typename stream_it_t,
               typename seq_legal_alph_type, bool seq_qual_combined,
               typename id_type>
-    void read_id(stream_view_t & stream_view,
+    void read_id(stream_it_t & stream_it,
                   sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const & options,
                   id_type & id)
     {
+        using chunk_type = std::basic_string_view<std::iter_value_t<stream_it_t>>;
         auto const is_id = is_char<'>'> || is_char<';'>;
 
-        if (!is_id(*begin(stream_view)))
+        if (!is_id(*stream_it))
             throw parse_error{std::string{"Expected to be on beginning of ID, but "} + is_id.msg +
-                              " evaluated to false on " + detail::make_printable(*begin(stream_view))};
+                              " evaluated to false on " + detail::make_printable(*stream_it)};
 
         // read id
         if constexpr (!detail::decays_to_ignore_v<id_type>)
         {
+            detail::skip_while(stream_it, is_id || is_blank); // skip leading >
+
             if (options.truncate_ids)
             {
-            #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
-                auto it = stream_view.begin();
-                auto e = stream_view.end();
-                for (; (it != e) && (is_id || is_blank)(*it); ++it)
-                {}
-
-                bool at_delimiter = false;
-                for (; it != e; ++it)
+                bool const found_delimiter = stream_it.consume_chunks([&] (chunk_type const chunk)
                 {
-                    if ((is_cntrl || is_blank)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
-
-                if (!at_delimiter)
-                    throw unexpected_end_of_input{"FastA ID line did not end in newline."};
-
-                for (; (it != e) && ((!is_char<'\n'>)(*it)); ++it)
-                {}
+                    size_t const length = std::ranges::find_if(chunk, is_cntrl || is_blank) - chunk.begin();
+                    detail::append_chunk(id, chunk.substr(0, length));
+                    return length;
+                });
 
-            #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
-
-                std::ranges::copy(stream_view | std::views::drop_while(is_id || is_blank)        // skip leading >
-                                              | views::take_until_or_throw(is_cntrl || is_blank) // read ID until delimiter…
-                                              | views::char_to<std::ranges::range_value_t<id_type>>,
-                                  std::cpp20::back_inserter(id));                               // … ^A is old delimiter
+                if (!found_delimiter)
+                    throw unexpected_end_of_input{"FastA ID line did not end in newline."};
 
                 // consume rest of line
-                detail::consume(stream_view | views::take_line_or_throw);
-            #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
-
+                detail::read_line_or_throw(stream_it, [] (chunk_type) {});
             }
             else
             {
-            #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
-                auto it = stream_view.begin();
-                auto e = stream_view.end();
-                for (; (it != e) && (is_id || is_blank)(*it); ++it)
-                {}
-
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_char<'\n'>)(*it))
-                    {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
-
-                if (!at_delimiter)
-                    throw unexpected_end_of_input{"FastA ID line did not end in newline."};
+                auto append_to_id = [&] (chunk_type const chunk) { detail::append_chunk(id, chunk); };
 
-            #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
+                if (!stream_it.read_until(append_to_id, '\n', '\r'))
+                    throw unexpected_end_of_input{"FastA ID line did not end in newline."};
 
-                std::ranges::copy(stream_view | views::take_line_or_throw                    // read line
-                                              | std::views::drop_while(is_id || is_blank)    // skip leading >
-                                              | views::char_to<std::ranges::range_value_t<id_type>>,
-                                  std::cpp20::back_inserter(id));
-            #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+                detail::skip_while(stream_it, is_char<'\r'> || is_char<'\n'>);
             }
         }
         else
         {
-            detail::consume(stream_view | views::take_line_or_throw);
+            detail::read_line_or_throw(stream_it, [] (chunk_type) {});
         }
     }
 
     //!\brief Implementation of reading the sequence.
-    template <typename stream_view_t,
+    template <typename stream_it_t,
               typename seq_legal_alph_type, bool seq_qual_combined,
               typename seq_type>
-    void read_seq(stream_view_t & stream_view,
+    void read_seq(stream_it_t & stream_it,
                    sequence_file_input_options<seq_legal_alph_type, seq_qual_combined> const &,
                    seq_type & seq)
     {
-        auto constexpr is_id = is_char<'>'> || is_char<';'>;
+        using chunk_type = std::basic_string_view<std::iter_value_t<stream_it_t>>;
 
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
         {
-            auto constexpr is_legal_alph = char_is_valid_for<seq_legal_alph_type>;
-
-        #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
-            auto it = stream_view.begin();
-            auto e = stream_view.end();
-
-            if (it == e)
+            if (stream_it == std::default_sentinel)
                 throw unexpected_end_of_input{"No sequence information given!"};
 
-            for (; (it != e) && ((!is_id)(*it)); ++it)
+            // until next header (or end), ignoring whitespace and numbers and enforcing the legal alphabet
+            stream_it.read_until([&] (chunk_type const chunk)
             {
-                if ((is_space || is_digit)(*it))
-                    continue;
-                else if (!is_legal_alph(*it))
-                {
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                      "char_is_valid_for<" +
-                                      detail::type_name_as_string<seq_legal_alph_type> +
-                                      "> evaluated to false on " +
-                                      detail::make_printable(*it)};
-                }
-
-                seq.push_back(assign_char_to(*it, std::ranges::range_value_t<seq_type>{}));
-            }
-
-        #else // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
-
-            if (std::ranges::begin(stream_view) == std::ranges::end(stream_view))
-                throw unexpected_end_of_input{"No sequence information given!"};
-
-            std::ranges::copy(stream_view | views::take_until(is_id)                   // until next header (or end)
-                                          | std::views::filter(!(is_space || is_digit))// ignore whitespace and numbers
-                                          | std::views::transform([is_legal_alph] (char const c)
-                                            {
-                                                if (!is_legal_alph(c))
-                                                {
-                                                    throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                      "char_is_valid_for<" +
-                                                                      detail::type_name_as_string<seq_legal_alph_type> +
-                                                                      "> evaluated to false on " +
-                                                                      detail::make_printable(c)};
-                                                }
-                                                return c;
-                                            })                                      // enforce legal alphabet
-                                          | views::char_to<std::ranges::range_value_t<seq_type>>, // convert to actual target alphabet
-                              std::cpp20::back_inserter(seq));
-        #endif // SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+                detail::append_sequence_chunk<seq_legal_alph_type, true>(seq, chunk);
+            }, '>', ';');
         }
         else
         {
-            detail::consume(stream_view | views::take_until(is_id));
+            stream_it.read_until([] (chunk_type) {}, '>', ';');
         }
     }
 
@@ -345,6 +376,25 @@ private:
     template <typename stream_it_t, typename seq_type>
     void write_seq(stream_it_t & stream_it, sequence_file_output_options const & options, seq_type && seq)
     {
+        if constexpr (std::ranges::contiguous_range<seq_type> && std::ranges::sized_range<seq_type>)
+        {
+            // convert line by line directly into the stream buffer
+            std::span letters{std::ranges::data(seq), std::ranges::size(seq)};
+            size_t const line_length = options.fasta_letters_per_line > 0 ? options.fasta_letters_per_line
+                                                                           : letters.size();
+
+            for (size_t i = 0; i < letters.size(); i += line_length)
+            {
+                stream_it.write_chars_of(letters.subspan(i, std::min(line_length, letters.size() - i)));
+                stream_it.write_end_of_line(options.add_carriage_return);
+            }
+
+            if (letters.empty() && options.fasta_letters_per_line == 0)
+                stream_it.write_end_of_line(options.add_carriage_return);
+
+            return;
+        }
+
         auto char_sequence = seq | views::to_char;
 
         if (options.fasta_letters_per_line > 0)
@@ -26,10 +26,12 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/detail/read_chunk.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
 #include <seqan3/io/stream/detail/fast_ostreambuf_iterator.hpp>
 #include <seqan3/range/detail/misc.hpp>
 #include <seqan3/range/views/char_to.hpp>
@@ -110,12 +112,16 @@ protected:
                               id_type                                                                   & id,
                               qual_type                                                                 & qualities)
     {
-        auto stream_view = views::istreambuf(stream);
-        auto stream_it = begin(stream_view);
+        using char_type = typename stream_type::char_type;
+        using chunk_type = std::basic_string_view<char_type>;
+
+        // The record is parsed chunk-wise directly on the stream buffer: delimiters are searched with memchr and
+        // whole chunks are validated and converted with lookup tables (see seqan3/io/detail/read_chunk.hpp).
+        detail::fast_istreambuf_iterator<char_type> stream_it{*stream.rdbuf()};
 
         // cache the begin position so we write quals to the same position as seq in seq_qual case
         size_t sequence_size_before = 0;
-        size_t sequence_size_after = 0;
+        size_t sequence_size = 0;
         if constexpr (!detail::decays_to_ignore_v<seq_type>)
             sequence_size_before = size(sequence);
 
@@ -131,77 +137,244 @@ protected:
         {
             if (options.truncate_ids)
             {
-                std::ranges::copy(stream_view | views::take_until_or_throw(is_cntrl || is_blank)
-                                              | views::char_to<std::ranges::range_value_t<id_type>>,
-                                  std::cpp20::back_inserter(id));
-                detail::consume(stream_view | views::take_line_or_throw);
+                bool const found_delimiter = stream_it.consume_chunks([&] (chunk_type const chunk)
+                {
+                    size_t const length = std::ranges::find_if(chunk, is_cntrl || is_blank) - chunk.begin();
+                    detail::append_chunk(id, chunk.substr(0, length));
+                    return length;
+                });
+
+                if (!found_delimiter)
+                    throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+
+                detail::read_line_or_throw(stream_it, [] (chunk_type) {});
             }
             else
             {
-                std::ranges::copy(stream_view | views::take_line_or_throw
-                                              | views::char_to<std::ranges::range_value_t<id_type>>,
-                                  std::cpp20::back_inserter(id));
+                detail::read_line_or_throw(stream_it, [&] (chunk_type const chunk)
+                {
+                    detail::append_chunk(id, chunk);
+                });
             }
         }
         else
         {
-            detail::consume(stream_view | views::take_line_or_throw);
+            detail::read_line_or_throw(stream_it, [] (chunk_type) {});
         }
 
         /* Sequence */
-        auto seq_view = stream_view | views::take_until_or_throw(is_char<'+'>)    // until 2nd ID line
-                                    | std::views::filter(!is_space);           // ignore whitespace
-        if constexpr (!detail::decays_to_ignore_v<seq_type>)
+        bool const found_plus = stream_it.read_until([&] (chunk_type const chunk) // until 2nd ID line
         {
-            auto constexpr is_legal_alph = char_is_valid_for<seq_legal_alph_type>;
-            std::ranges::copy(seq_view | std::views::transform([is_legal_alph] (char const c) // enforce legal alphabet
-                                    {
-                                        if (!is_legal_alph(c))
-                                        {
-                                            throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                              "char_is_valid_for<" +
-                                                              detail::type_name_as_string<seq_legal_alph_type> +
-                                                              "> evaluated to false on " +
-                                                              detail::make_printable(c)};
-                                        }
-                                        return c;
-                                    })
-                                        | views::char_to<std::ranges::range_value_t<seq_type>>,         // convert to actual target alphabet
-                              std::cpp20::back_inserter(sequence));
-            sequence_size_after = size(sequence);
-        }
-        else // consume, but count
+            if constexpr (!detail::decays_to_ignore_v<seq_type>)
+                sequence_size += detail::append_sequence_chunk<seq_legal_alph_type, false>(sequence, chunk);
+            else // consume, but count
+                sequence_size += detail::count_sequence_chunk<false>(chunk);
+        }, '+');
+
+        if (!found_plus)
+            throw unexpected_end_of_input{"Reached end of input before functor evaluated to true."};
+
+        detail::read_line_or_throw(stream_it, [] (chunk_type) {});
+
+        /* Qualities */
+        size_t remaining = sequence_size;
+
+        stream_it.consume_chunks([&] (chunk_type const chunk)
         {
-            auto it = begin(seq_view);
-            auto it_end = end(seq_view);
-            while (it != it_end)
+            size_t position = 0;
+
+            while (remaining > 0 && position < chunk.size())
             {
-                ++it;
-                ++sequence_size_after;
+                chunk_type const part = chunk.substr(position, remaining);
+                size_t read{};
+
+                if constexpr (seq_qual_combined)
+                {
+                    // seq_qual field implies that they are the same variable
+                    assert(std::addressof(sequence) == std::addressof(qualities));
+                    using quality_alphabet_type = typename std::ranges::range_value_t<qual_type>::quality_alphabet_type;
+                    auto out = begin(qualities) + sequence_size_before + (sequence_size - remaining);
+
+                    for (char_type const c : part)
+                    {
+                        if (!is_space(c))
+                        {
+                            out[read] = assign_char_to(static_cast<char>(c), quality_alphabet_type{});
+                            ++read;
+                        }
+                    }
+                }
+                else if constexpr (!detail::decays_to_ignore_v<qual_type>)
+                {
+                    read = detail::append_sequence_chunk<char, false>(qualities, part);
+                }
+                else
+                {
+                    read = detail::count_sequence_chunk<false>(part);
+                }
+
+                remaining -= read;
+                position += part.size();
             }
-        }
 
-        detail::consume(stream_view | views::take_line_or_throw);
+            return position;
+        });
 
-        /* Qualities */
-        auto qview = stream_view | std::views::filter(!is_space)                  // this consumes trailing newline
-                                 | views::take_exactly_or_throw(sequence_size_after - sequence_size_before);
-        if constexpr (seq_qual_combined)
+        if (remaining > 0)
+            throw unexpected_end_of_input{"Reached end of input before designated size."};
+
+        detail::skip_while(stream_it, is_space); // this consumes trailing newline
+    }
+
+    /*!\brief Read a record without copying it, if it is contained completely in the buffer of the stream.
+     * \tparam stream_type          The type of the stream.
+     * \tparam seq_legal_alph_type  The alphabet that determines which characters of the sequence are legal.
+     * \tparam seq_qual_combined    Whether the options are for reading field::seq_qual.
+     * \param[in,out] stream        The input stream to read from.
+     * \param[in]     options       File specific options passed to the format.
+     * \param[out]    sequence      Points to the sequence in the stream buffer afterwards.
+     * \param[out]    id            Points to the ID in the stream buffer afterwards.
+     * \param[out]    qualities     Points to the qualities in the stream buffer afterwards.
+     * \returns `true` if the record was read, `false` if nothing was consumed and the record needs to be read by
+     *          read_sequence_record().
+     *
+     * \details
+     *
+     * Only records with a single sequence and quality line whose end is followed by the beginning of the next record
+     * inside the buffer are read in place; everything else, including malformed records, is left to
+     * read_sequence_record(). The views are valid until the stream is read from again.
+     */
+    template <typename stream_type,     // constraints checked by file
+              typename seq_legal_alph_type,
+              bool     seq_qual_combined>
+    bool read_sequence_record_in_place(stream_type                                                          & stream,
+                                       sequence_file_input_options<seq_legal_alph_type,
+                                                                   seq_qual_combined> const                 & options,
+                                       std::basic_string_view<typename stream_type::char_type>              & sequence,
+                                       std::basic_string_view<typename stream_type::char_type>              & id,
+                                       std::basic_string_view<typename stream_type::char_type>              & qualities)
+    {
+        using chunk_type = std::basic_string_view<typename stream_type::char_type>;
+
+        detail::fast_istreambuf_iterator<typename stream_type::char_type> stream_it{*stream.rdbuf()};
+        bool record_was_read = false;
+
+        stream_it.consume_chunks([&] (chunk_type const chunk) -> size_t
         {
-            // seq_qual field implies that they are the same variable
-            assert(std::addressof(sequence) == std::addressof(qualities));
-            std::ranges::copy(qview | views::char_to<typename std::ranges::range_value_t<qual_type>::quality_alphabet_type>,
-                              begin(qualities) + sequence_size_before);
-        }
-        else if constexpr (!detail::decays_to_ignore_v<qual_type>)
+            if (chunk.empty() || chunk[0] != '@')
+                return 0;
+
+            size_t position = 1;
+
+            // Returns the next line without the line break; position becomes npos if the line does not end in chunk.
+            auto next_line = [&] ()
+            {
+                size_t const line_end = chunk.find('\n', position);
+
+                if (line_end == chunk_type::npos)
+                {
+                    position = chunk_type::npos;
+                    return chunk_type{};
+                }
+
+                chunk_type line = chunk.substr(position, line_end - position);
+                position = line_end + 1;
+
+                if (!line.empty() && line.back() == '\r')
+                    line.remove_suffix(1);
+
+                return line;
+            };
+
+            chunk_type const id_line = next_line();
+            chunk_type const sequence_line = next_line();
+            chunk_type const plus_line = next_line();
+            chunk_type const quality_line = next_line();
+
+            if (position == chunk_type::npos)
+                return 0;
+
+            if (id_line.find('\r') != chunk_type::npos ||
+                plus_line.empty() || plus_line[0] != '+' || plus_line.find('\r') != chunk_type::npos ||
+                sequence_line.find('+') != chunk_type::npos ||
+                quality_line.size() != sequence_line.size() ||
+                !detail::chunk_has_only_letters<seq_legal_alph_type, false>(sequence_line) ||
+                !detail::chunk_has_only_letters<char, false>(quality_line))
+            {
+                return 0;
+            }
+
+            while (position < chunk.size() && is_space(chunk[position]))
+                ++position;
+
+            if (position == chunk.size()) // the record might continue after the buffer is refilled
+                return 0;
+
+            if (options.truncate_ids)
+                id = id_line.substr(0, std::ranges::find_if(id_line, is_cntrl || is_blank) - id_line.begin());
+            else
+                id = id_line;
+
+            sequence = sequence_line;
+            qualities = quality_line;
+            record_was_read = true;
+
+            return position;
+        });
+
+        return record_was_read;
+    }
+
+    /*!\brief Finds the beginning of the last record in a chunk of a file.
+     * \tparam seq_legal_alph_type The alphabet that determines which characters of the sequence are legal.
+     * \param[in] chunk            A chunk of the file that begins with a record.
+     * \returns The position of the last record in `chunk` or 0 if no record after the first one could be identified.
+     *
+     * \details
+     *
+     * Used to cut a file into chunks that can be parsed independently (see
+     * seqan3::sequence_file_input_options::parsing_threads). Since quality lines may begin with '@', a line that
+     * begins with '@' is only accepted as ID line if it is followed by a line of legal sequence characters and a line
+     * that begins with '+'. This identifies records reliably if sequence and qualities are stored on single lines.
+     */
+    template <typename seq_legal_alph_type>
+    static size_t find_last_record_begin(std::string_view const chunk)
+    {
+        // Returns the end of the line that begins at position or npos if the line does not end in chunk.
+        auto line_end = [chunk] (size_t const position)
         {
-            std::ranges::copy(qview | views::char_to<std::ranges::range_value_t<qual_type>>,
-                              std::cpp20::back_inserter(qualities));
-        }
-        else
+            return (position >= chunk.size()) ? std::string_view::npos : chunk.find('\n', position);
+        };
+
+        for (size_t position = chunk.rfind('@'); position != std::string_view::npos && position > 0;
+             position = chunk.rfind('@', position - 1))
         {
-            detail::consume(qview);
+            if (chunk[position - 1] != '\n')
+                continue;
+
+            size_t const id_end = line_end(position);
+
+            if (id_end == std::string_view::npos)
+                continue;
+
+            size_t const sequence_end = line_end(id_end + 1);
+
+            if (sequence_end == std::string_view::npos || sequence_end + 1 == chunk.size())
+                continue;
+
+            std::string_view sequence_line = chunk.substr(id_end + 1, sequence_end - id_end - 1);
+
+            if (!sequence_line.empty() && sequence_line.back() == '\r')
+                sequence_line.remove_suffix(1);
+
+            if (chunk[sequence_end + 1] == '+' && sequence_line.find('+') == std::string_view::npos &&
+                detail::chunk_has_only_letters<seq_legal_alph_type, false>(sequence_line))
+            {
+                return position;
+            }
         }
+
+        return 0;
     }
 
     //!\copydoc sequence_file_output_format::write_sequence_record
@@ -242,7 +415,7 @@ protected:
             if (std::ranges::empty(sequence)) //[[unlikely]]
                 throw std::runtime_error{"The SEQ field may not be empty when writing FASTQ files."};
 
-            stream_it.write_range(sequence | views::to_char);
+            stream_it.write_chars_of(sequence);
             stream_it.write_end_of_line(options.add_carriage_return);
         }
 
@@ -272,7 +445,7 @@ protected:
                 assert(std::ranges::size(sequence) == std::ranges::size(qualities));
             }
 
-            stream_it.write_range(qualities | views::to_char);
+            stream_it.write_chars_of(qualities);
             stream_it.write_end_of_line(options.add_carriage_return);
         }
     }
@@ -15,7 +15,11 @@
 #include <cassert>
 #include <seqan3/std/filesystem>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -30,6 +34,7 @@
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/detail/parallel_record_reader.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
@@ -37,7 +42,9 @@
 #include <seqan3/io/sequence_file/format_fastq.hpp>
 #include <seqan3/io/sequence_file/format_genbank.hpp>
 #include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/io/sequence_record_batch.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/range/views/char_to.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 
 namespace seqan3
@@ -181,6 +188,54 @@ struct sequence_file_input_default_traits_aa : sequence_file_input_default_trait
     //!\}
 };
 
+/*!\brief A traits type that exposes the fields as views into the buffered record instead of copying them.
+ * \implements sequence_file_input_traits
+ * \ingroup sequence_file
+ *
+ * \details
+ *
+ * With these traits, field::id is a std::string_view and field::seq and field::qual are std::string_views that are
+ * transformed by seqan3::views::char_to into the sequence and quality alphabet, i.e. the characters are converted
+ * only when they are accessed. Reading a record neither allocates memory nor converts the record.
+ *
+ * If a FASTA or FASTQ record lies completely in the buffer of the stream and has its sequence on a single line, the
+ * views point directly into the stream buffer. Other records, e.g. with multi-line sequences, are copied to internal
+ * buffers of the file that are reused for every record. In both cases, the fields are only valid until the iterator
+ * is incremented; copy them, e.g. with `seqan3::views::to<std::vector>`, if you need to keep them.
+ *
+ * You can expose the fields of other traits types as views by adding `static constexpr bool fields_as_views = true;`
+ * to them. field::seq_qual cannot be read as view.
+ *
+ * \include test/snippet/io/sequence_file/sequence_file_input_view_traits.cpp
+ */
+struct sequence_file_input_view_traits_dna : sequence_file_input_default_traits_dna
+{
+    //!\brief Expose the fields as views into the buffered record.
+    static constexpr bool fields_as_views = true;
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief Whether a traits type of seqan3::sequence_file_input requests the fields as views.
+ * \ingroup sequence_file
+ * \see seqan3::sequence_file_input_view_traits_dna
+ */
+template <typename traits_t>
+SEQAN3_CONCEPT sequence_file_input_fields_as_views = requires { requires traits_t::fields_as_views; };
+
+//!\brief The type of a field that is read as view and converted to `alphabet_t` on access.
+//!\ingroup sequence_file
+template <typename alphabet_t>
+using sequence_file_field_view_t = decltype(std::string_view{} | views::char_to<alphabet_t>);
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
 // ----------------------------------------------------------------------------
 // sequence_file_input
 // ----------------------------------------------------------------------------
@@ -353,20 +408,30 @@ public:
                   }(),
                   "You may not select field::seq_qual and either of field::seq and field::qual at the same time.");
 
+    static_assert(!(detail::sequence_file_input_fields_as_views<traits_type> &&
+                    selected_field_ids::contains(field::seq_qual)),
+                  "You may not select field::seq_qual if the fields are read as views.");
+
     /*!\name Field types and record type
      * \brief These types are relevant for record/row-based reading; they may be manipulated via the \ref traits_type
      * to achieve different storage behaviour.
      * \{
      */
     //!\brief The type of field::seq (std::vector <seqan3::dna5> by default).
-    using sequence_type         = typename traits_type::template sequence_container<
-                                    typename traits_type::sequence_alphabet>;
+    using sequence_type         = std::conditional_t<detail::sequence_file_input_fields_as_views<traits_type>,
+                                    detail::sequence_file_field_view_t<typename traits_type::sequence_alphabet>,
+                                    typename traits_type::template sequence_container<
+                                      typename traits_type::sequence_alphabet>>;
     //!\brief The type of field::id (std::string by defaul).
-    using id_type               = typename traits_type::template id_container<
-                                    typename traits_type::id_alphabet>;
+    using id_type               = std::conditional_t<detail::sequence_file_input_fields_as_views<traits_type>,
+                                    std::basic_string_view<stream_char_type>,
+                                    typename traits_type::template id_container<
+                                      typename traits_type::id_alphabet>>;
     //!\brief The type of field::qual (std::vector <seqan3::phred42> by default).
-    using quality_type          = typename traits_type::template quality_container<
-                                    typename traits_type::quality_alphabet>;
+    using quality_type          = std::conditional_t<detail::sequence_file_input_fields_as_views<traits_type>,
+                                    detail::sequence_file_field_view_t<typename traits_type::quality_alphabet>,
+                                    typename traits_type::template quality_container<
+                                      typename traits_type::quality_alphabet>>;
     //!\brief The type of field::seq_qual (std::vector <seqan3::dna5q> by default).
     using sequence_quality_type = typename traits_type::
                                     template sequence_container<qualified<typename traits_type::sequence_alphabet,
@@ -380,6 +445,14 @@ public:
                                                                                   field_ids,
                                                                                   selected_field_ids>,
                                                   selected_field_ids>;
+
+    //!\brief The type returned by read_batch(); stores the fields in the containers defined by the traits.
+    using batch_type            = sequence_record_batch<typename traits_type::template sequence_container<
+                                                          typename traits_type::sequence_alphabet>,
+                                                        typename traits_type::template id_container<
+                                                          typename traits_type::id_alphabet>,
+                                                        typename traits_type::template quality_container<
+                                                          typename traits_type::quality_alphabet>>;
     //!\}
 
     /*!\name Range associated types
@@ -435,18 +508,16 @@ public:
      * This constructor transparently applies a decompression stream on top of the file stream in case
      * the file is detected as being compressed.
      * See the section on \link io_compression compression and decompression \endlink for more information.
+     *
+     * ### Memory mapping
+     *
+     * Regular files are memory-mapped and parsed directly from memory; other files, e.g. named pipes, are read
+     * through a buffered file stream.
      */
     sequence_file_input(std::filesystem::path filename,
                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+        primary_stream{detail::make_primary_istream(filename, stream_buffer)}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())->open(filename,
-                                                                             std::ios_base::in | std::ios::binary);
-
-        if (!primary_stream->good())
-            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
-
         // possibly add intermediate compression stream
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
 
@@ -587,6 +658,43 @@ public:
     {
         return *begin();
     }
+
+    /*!\brief Reads the next records into a reusable batch.
+     * \param[in] count The maximal number of records to read.
+     * \returns A reference to the batch; it contains fewer than `count` records only at the end of the file.
+     * \throws seqan3::parse_error If a record could not be read.
+     *
+     * \details
+     *
+     * The batch stores the sequences, IDs and qualities column-wise in seqan3::concatenated_sequences (see
+     * seqan3::sequence_record_batch). It is owned by the file and overwritten by the next call, which reuses its
+     * memory, so reading a file batch by batch does not allocate memory per record.
+     *
+     * The batch starts with the record that begin() currently points to; afterwards begin() points to the first record
+     * after the batch. Fields that are not selected are stored as empty ranges.
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the records read.
+     *
+     * ### Exceptions
+     *
+     * Throws seqan3::parse_error if a record could not be read. The batch then contains the records before it.
+     */
+    batch_type & read_batch(size_t const count)
+    //!\cond
+        requires (!selected_field_ids::contains(field::seq_qual))
+    //!\endcond
+    {
+        batch_buffer.clear();
+
+        for (auto it = begin(); batch_buffer.size() < count && it != end(); ++it)
+            batch_buffer.push_back(*it);
+
+        return batch_buffer;
+    }
     //!\}
 
     //!\brief The options are public and its members can be set directly.
@@ -600,8 +708,12 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
+    //!\brief Buffer for the records returned by read_batch().
+    batch_type batch_buffer{};
     //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
     std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief Buffers for fields that cannot be viewed in the stream buffer if the fields are read as views.
+    std::basic_string<stream_char_type> sequence_text{}, id_text{}, quality_text{};
     //!\}
 
     /*!\name Stream / file access
@@ -632,12 +744,32 @@ protected:
     format_type format;
     //!\}
 
+    /*!\name Parallel parsing
+     * \{
+     */
+    //!\brief Reads and parses chunks of the file if seqan3::sequence_file_input_options::parsing_threads is > 1.
+    std::unique_ptr<detail::parallel_record_reader<record_type>> parallel_reader{};
+    //!\brief The records of the current chunk.
+    detail::record_batch<record_type> parallel_batch{};
+    //!\brief The position of the next record in parallel_batch.
+    size_t parallel_batch_position{0};
+    //!\brief Whether the format does not support parallel parsing.
+    bool parallel_parsing_unsupported{false};
+    //!\}
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
         // clear the record
         record_buffer.clear();
 
+        if constexpr (!detail::sequence_file_input_fields_as_views<traits_type> &&
+                      std::same_as<stream_char_type, char>)
+        {
+            if (options.parsing_threads > 1 && !parallel_parsing_unsupported && read_next_record_in_parallel())
+                return;
+        }
+
         // at end if we could not read further
         if ((std::istreambuf_iterator<stream_char_type>{*secondary_stream} ==
              std::istreambuf_iterator<stream_char_type>{}))
@@ -650,23 +782,133 @@ protected:
         std::visit([&] (auto & f)
         {
             // read new record
-            if constexpr (selected_field_ids::contains(field::seq_qual))
+            if constexpr (detail::sequence_file_input_fields_as_views<traits_type>)
+                read_next_record_as_views(f);
+            else
+                read_record(f, *secondary_stream, options, record_buffer);
+        }, format);
+    }
+
+    //!\brief Reads a single record from the stream with the given format.
+    template <typename format_t>
+    static void read_record(format_t & f,
+                            std::basic_istream<stream_char_type> & stream,
+                            decltype(options) const & record_options,
+                            record_type & record)
+    {
+        if constexpr (selected_field_ids::contains(field::seq_qual))
+        {
+            f.read_sequence_record(stream,
+                                   record_options,
+                                   detail::get_or_ignore<field::seq_qual>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::seq_qual>(record));
+        }
+        else
+        {
+            f.read_sequence_record(stream,
+                                   record_options,
+                                   detail::get_or_ignore<field::seq>(record),
+                                   detail::get_or_ignore<field::id>(record),
+                                   detail::get_or_ignore<field::qual>(record));
+        }
+    }
+
+    /*!\brief Moves the next record out of the chunks that are parsed in parallel.
+     * \returns `false` if the format does not support parallel parsing; `true` otherwise.
+     * \throws Rethrows the exception that occurred while parsing the next record.
+     */
+    bool read_next_record_in_parallel()
+    {
+        using legal_alphabet_type = typename traits_type::sequence_legal_alphabet;
+
+        if (parallel_reader == nullptr)
+        {
+            assert(!format.valueless_by_exception());
+            std::visit([&] (auto & f)
             {
-                f.read_sequence_record(*secondary_stream,
-                                       options,
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::seq_qual>(record_buffer));
+                using format_t = std::remove_cvref_t<decltype(f)>;
+
+                if constexpr (requires { format_t::template find_last_record_begin<legal_alphabet_type>(""); })
+                {
+                    parallel_reader = std::make_unique<detail::parallel_record_reader<record_type>>(
+                        *secondary_stream,
+                        options.parsing_threads,
+                        &format_t::template find_last_record_begin<legal_alphabet_type>,
+                        [f, record_options = options] (std::istream & stream, record_type & record) mutable
+                        {
+                            read_record(f, stream, record_options, record);
+                        });
+                }
+            }, format);
+
+            if (parallel_reader == nullptr)
+            {
+                parallel_parsing_unsupported = true;
+                return false;
             }
-            else
+        }
+
+        while (parallel_batch_position == parallel_batch.records.size())
+        {
+            if (parallel_batch.error)
+                std::rethrow_exception(std::exchange(parallel_batch.error, nullptr));
+
+            if (parallel_reader->at_end())
             {
-                f.read_sequence_record(*secondary_stream,
-                                       options,
-                                       detail::get_or_ignore<field::seq>(record_buffer),
-                                       detail::get_or_ignore<field::id>(record_buffer),
-                                       detail::get_or_ignore<field::qual>(record_buffer));
+                at_end = true;
+                return true;
             }
-        }, format);
+
+            parallel_batch = parallel_reader->next_batch();
+            parallel_batch_position = 0;
+        }
+
+        record_buffer = std::move(parallel_batch.records[parallel_batch_position++]);
+        return true;
+    }
+
+    //!\brief Points the fields to the record in the stream buffer or, if that is not possible, to the text buffers.
+    template <typename format_t>
+    void read_next_record_as_views(format_t & f)
+    {
+        std::basic_string_view<stream_char_type> sequence{};
+        std::basic_string_view<stream_char_type> id{};
+        std::basic_string_view<stream_char_type> qualities{};
+
+        if (!f.read_sequence_record_in_place(*secondary_stream, options, sequence, id, qualities))
+        {
+            sequence_text.clear();
+            id_text.clear();
+            quality_text.clear();
+
+            f.read_sequence_record(*secondary_stream,
+                                   options,
+                                   text_buffer_or_ignore<field::seq>(sequence_text),
+                                   text_buffer_or_ignore<field::id>(id_text),
+                                   text_buffer_or_ignore<field::qual>(quality_text));
+
+            sequence = sequence_text;
+            id = id_text;
+            qualities = quality_text;
+        }
+
+        if constexpr (selected_field_ids::contains(field::seq))
+            detail::get_or_ignore<field::seq>(record_buffer) = sequence | views::char_to<typename traits_type::sequence_alphabet>;
+        if constexpr (selected_field_ids::contains(field::id))
+            detail::get_or_ignore<field::id>(record_buffer) = id;
+        if constexpr (selected_field_ids::contains(field::qual))
+            detail::get_or_ignore<field::qual>(record_buffer) = qualities | views::char_to<typename traits_type::quality_alphabet>;
+    }
+
+    //!\brief Returns the text buffer if the field is selected and std::ignore otherwise.
+    template <field f>
+    auto & text_buffer_or_ignore(std::basic_string<stream_char_type> & buffer)
+    {
+        if constexpr (selected_field_ids::contains(f))
+            return buffer;
+        else
+            return std::ignore;
     }
 
     //!\brief Befriend iterator so it can access the buffers.
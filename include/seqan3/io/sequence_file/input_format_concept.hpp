@@ -49,6 +49,40 @@ public:
     {
         format_type::read_sequence_record(std::forward<ts>(args)...);
     }
+
+    /*!\brief Forwards to `read_sequence_record_in_place` if the format offers it.
+     * \returns `false` if the format does not support reading records in place or did not read the current record.
+     *
+     * \details
+     *
+     * Formats may offer this member to expose the fields of a record as views into the stream buffer instead of
+     * copying them (see seqan3::sequence_file_input_view_traits_dna).
+     */
+    template <typename ...ts>
+    bool read_sequence_record_in_place(ts && ...args)
+    {
+        if constexpr (requires { format_type::read_sequence_record_in_place(std::forward<ts>(args)...); })
+            return format_type::read_sequence_record_in_place(std::forward<ts>(args)...);
+        else
+            return false;
+    }
+
+    /*!\brief Forwards to `find_last_record_begin` if the format offers it.
+     * \tparam legal_alph_type The alphabet that determines which characters of the sequence are legal.
+     *
+     * \details
+     *
+     * Formats may offer this member to have their files parsed on several threads (see
+     * seqan3::sequence_file_input_options::parsing_threads).
+     */
+    template <typename legal_alph_type>
+    //!\cond
+        requires requires (std::string_view chunk) { format_type::template find_last_record_begin<legal_alph_type>(chunk); }
+    //!\endcond
+    static size_t find_last_record_begin(std::string_view const chunk)
+    {
+        return format_type::template find_last_record_begin<legal_alph_type>(chunk);
+    }
 };
 
 } // namespace seqan3::detail
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -28,6 +30,17 @@ struct sequence_file_input_options
     bool truncate_ids = false;
     //!\brief Read the complete_header into the seqan3::field::id for embl or genbank format.
     bool embl_genbank_complete_header = false;
+    /*!\brief The number of threads that parse FASTA and FASTQ records in parallel.
+     *
+     * \details
+     *
+     * If greater than one, seqan3::sequence_file_input reads the file in chunks of several megabytes, cuts them at
+     * record boundaries and parses the chunks on this many threads. The records are still returned in file order.
+     * FASTQ chunks are cut before lines starting with `@` if the line two lines further down starts with `+`, so
+     * sequences and qualities should be on a single line each. Other formats and files whose fields are read as views
+     * (see seqan3::sequence_file_input_view_traits_dna) are always parsed on the calling thread.
+     */
+    size_t parsing_threads = 1;
 };
 
 } // namespace seqan3
@@ -587,6 +587,29 @@ protected:
     format_type format;
     //!\}
 
+    //!\brief The compression level that was last passed to the secondary stream.
+    int secondary_stream_compression_level{sequence_file_output_options{}.compression_level};
+    //!\brief The zstd frame size that was last passed to the secondary stream.
+    size_t secondary_stream_zstd_frame_size{sequence_file_output_options{}.zstd_frame_size};
+
+    /*!\brief Passes a changed seqan3::sequence_file_output_options::compression_level and
+     *        seqan3::sequence_file_output_options::zstd_frame_size on to the secondary stream.
+     */
+    void update_compression_options()
+    {
+        if (options.compression_level != secondary_stream_compression_level)
+        {
+            detail::set_compression_level(*secondary_stream, options.compression_level);
+            secondary_stream_compression_level = options.compression_level;
+        }
+
+        if (options.zstd_frame_size != secondary_stream_zstd_frame_size)
+        {
+            detail::set_zstd_frame_size(*secondary_stream, options.zstd_frame_size);
+            secondary_stream_zstd_frame_size = options.zstd_frame_size;
+        }
+    }
+
     //!\brief Write record to format.
     template <typename seq_t, typename id_t, typename qual_t, typename seq_qual_t>
     void write_record(seq_t && seq, id_t && id, qual_t && qual, seq_qual_t && seq_qual)
@@ -600,6 +623,8 @@ protected:
                           "The SEQ_QUAL field must contain a range over the seqan3::qualified alphabet.");
 
         assert(!format.valueless_by_exception());
+        update_compression_options();
+
         std::visit([&] (auto & f)
         {
             if constexpr (!detail::decays_to_ignore_v<seq_qual_t>)
@@ -40,6 +40,30 @@ struct sequence_file_output_options
 
     //!\brief Complete header given for embl or genbank
     bool        embl_genbank_complete_header  = false;
+
+    /*!\brief The compression level of BGZF compressed files (`.gz` and `.bgzf`).
+     *
+     * \details
+     *
+     * The level ranges from 0 (no compression) to 9 (best compression). The default level 1 is the fastest level
+     * that compresses; higher levels produce smaller files but make writing considerably slower.
+     * A changed level applies to the data written from the next record on. Files that are not compressed with BGZF
+     * are not affected. If SeqAn was built with libdeflate, the blocks are compressed with libdeflate instead of
+     * zlib, which is faster at every level.
+     */
+    int         compression_level       = 1;
+
+    /*!\brief The uncompressed size of the frames of zstd compressed files (`.zst`) in bytes.
+     *
+     * \details
+     *
+     * If the size is not 0, the file is written in the seekable zstd format: a new frame is started after every
+     * `zstd_frame_size` bytes and a seek table is appended to the file. seqan3::contrib::zstd_istream uses the table
+     * to seek to a position by decompressing only the frame that contains it. Smaller frames allow faster seeking but
+     * compress worse; frames of a few MiB are a good compromise. The default 0 writes a single frame.
+     * A changed size applies from the next record on. Files that are not compressed with zstd are not affected.
+     */
+    size_t      zstd_frame_size         = 0;
 };
 
 } // namespace seqan3
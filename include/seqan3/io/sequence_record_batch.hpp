@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_batch.
+ */
+
+#pragma once
+
+#include <seqan3/std/concepts>
+#include <tuple>
+#include <type_traits>
+
+#include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/record.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Stores the sequences, IDs and qualities of several records column-wise.
+ * \ingroup io
+ * \tparam sequence_container_t The type of a single sequence; must model seqan3::reservible_container.
+ * \tparam id_container_t       The type of a single ID; must model seqan3::reservible_container.
+ * \tparam quality_container_t  The type of a single quality string; must model seqan3::reservible_container.
+ *
+ * \details
+ *
+ * Every column is a seqan3::concatenated_sequences, i.e. all sequences of the batch are stored in one buffer, all IDs
+ * in another and all qualities in a third one. The i-th record of the batch consists of `sequences[i]`, `ids[i]` and
+ * `base_qualities[i]`. Fields that were not read are stored as empty ranges, so all columns always have the same size.
+ *
+ * clear() keeps the memory of the columns, so a batch that is filled repeatedly, e.g. by
+ * seqan3::sequence_file_input::read_batch, stops allocating once it has grown to the size of the largest batch.
+ * The elements of the columns are contiguous ranges that can be passed to seqan3::align_pairwise directly.
+ */
+template <typename sequence_container_t, typename id_container_t, typename quality_container_t>
+class sequence_record_batch
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_record_batch() = default;                                          //!< Defaulted.
+    sequence_record_batch(sequence_record_batch const &) = default;             //!< Defaulted.
+    sequence_record_batch(sequence_record_batch &&) = default;                  //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch const &) = default; //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch &&) = default;      //!< Defaulted.
+    ~sequence_record_batch() = default;                                         //!< Defaulted.
+    //!\}
+
+    //!\brief The sequences of the records.
+    concatenated_sequences<sequence_container_t> sequences{};
+    //!\brief The IDs of the records.
+    concatenated_sequences<id_container_t> ids{};
+    //!\brief The qualities of the records.
+    concatenated_sequences<quality_container_t> base_qualities{};
+
+    //!\brief The number of records in the batch.
+    size_t size() const noexcept
+    {
+        return ids.size();
+    }
+
+    //!\brief Whether the batch contains no records.
+    bool empty() const noexcept
+    {
+        return ids.empty();
+    }
+
+    //!\brief Removes all records but keeps the memory of the columns.
+    void clear() noexcept
+    {
+        sequences.clear();
+        ids.clear();
+        base_qualities.clear();
+    }
+
+    /*!\brief Appends the fields seqan3::field::seq, seqan3::field::id and seqan3::field::qual of a record.
+     * \tparam record_t The type of the record; must be a specialisation of seqan3::record.
+     * \param[in] record The record to append.
+     */
+    template <typename record_t>
+    void push_back(record_t const & record)
+    {
+        push_back_field(sequences, detail::get_or_ignore<field::seq>(record));
+        push_back_field(ids, detail::get_or_ignore<field::id>(record));
+        push_back_field(base_qualities, detail::get_or_ignore<field::qual>(record));
+    }
+
+private:
+    //!\brief Appends a field to a column or an empty range if the field was not read.
+    template <typename column_t, typename field_t>
+    static void push_back_field(column_t & column, field_t const & field)
+    {
+        if constexpr (std::same_as<field_t, std::remove_cvref_t<decltype(std::ignore)>>)
+            column.push_back(typename column_t::value_type{});
+        else
+            column.push_back(field);
+    }
+};
+
+} // namespace seqan3
@@ -14,7 +14,9 @@
 #pragma once
 
 #include <cassert>
+#include <seqan3/std/concepts>
 #include <seqan3/std/iterator>
+#include <string_view>
 
 #include <seqan3/io/stream/detail/stream_buffer_exposer.hpp>
 
@@ -90,6 +92,82 @@ public:
     }
     //!\}
 
+    /*!\brief Hands the buffered characters to a callback chunk by chunk until the callback stops consuming.
+     * \tparam callback_t The type of the callback; must be invocable with `std::basic_string_view<char_t>` and return
+     *                    the number of consumed characters as `size_t`.
+     * \param[in] callback The callback.
+     * \returns `true` if the callback did not consume a complete chunk, `false` if the end of input was reached.
+     *
+     * \details
+     *
+     * The callback is invoked with the complete remaining get area of the stream buffer and returns how many of its
+     * characters it consumed. If it consumed all of them, the stream buffer is refilled and the callback is invoked
+     * with the next chunk. This allows parsers to process whole blocks of characters, e.g. with `std::memchr`, instead
+     * of advancing the iterator character by character.
+     */
+    template <typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, std::basic_string_view<char_t, traits_t>>
+    //!\endcond
+    bool consume_chunks(callback_t && callback)
+    {
+        assert(stream_buf != nullptr);
+
+        while (stream_buf->gptr() != stream_buf->egptr())
+        {
+            std::basic_string_view<char_t, traits_t> chunk{stream_buf->gptr(),
+                                                           static_cast<size_t>(stream_buf->egptr() -
+                                                                               stream_buf->gptr())};
+            size_t const consumed = callback(chunk);
+            assert(consumed <= chunk.size());
+
+            stream_buf->setg(stream_buf->eback(), stream_buf->gptr() + consumed, stream_buf->egptr());
+
+            if (consumed < chunk.size())
+                return true;
+
+            stream_buf->underflow(); // refill the get area; it stays empty at the end of input
+        }
+
+        return false;
+    }
+
+    /*!\brief Hands the characters up to the first occurrence of one of the delimiters to a callback.
+     * \tparam callback_t The type of the callback; must be invocable with `std::basic_string_view<char_t>`.
+     * \param[in] callback   Invoked for every contiguous part of the stream buffer before the first delimiter.
+     * \param[in] delimiters The characters to search for.
+     * \returns `true` if a delimiter was found, `false` if the end of input was reached before.
+     *
+     * \details
+     *
+     * The delimiters are searched with `std::char_traits::find`, i.e. `std::memchr` for `char`. If a delimiter is
+     * found, the iterator points to it afterwards.
+     */
+    template <typename callback_t, std::convertible_to<char_t> ...delimiter_ts>
+    //!\cond
+        requires std::invocable<callback_t, std::basic_string_view<char_t, traits_t>> && (sizeof...(delimiter_ts) > 0)
+    //!\endcond
+    bool read_until(callback_t && callback, delimiter_ts const ... delimiters)
+    {
+        return consume_chunks([&] (std::basic_string_view<char_t, traits_t> const chunk)
+        {
+            size_t position = chunk.size();
+
+            auto find = [&] (char_t const delimiter)
+            {
+                char_t const * found = traits_t::find(chunk.data(), position, delimiter);
+
+                if (found != nullptr)
+                    position = found - chunk.data();
+            };
+
+            (find(static_cast<char_t>(delimiters)), ...);
+
+            callback(chunk.substr(0, position));
+            return position;
+        });
+    }
+
     //!\brief Read current value from buffer (no vtable lookup, safe if not at end).
     reference operator*() const
     {
@@ -18,7 +18,10 @@
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
 #include <seqan3/io/stream/detail/stream_buffer_exposer.hpp>
+#include <seqan3/range/views/to_char.hpp>
 
 namespace seqan3::detail
 {
@@ -195,6 +198,66 @@ public:
     }
     //!\endcond
 
+    /*!\brief Writes the characters of a range of alphabet letters, i.e. `write_range(rng | views::to_char)`.
+     * \tparam range_type The type of range to write; the value type must model seqan3::alphabet.
+     * \param[in] rng     The range to write.
+     *
+     * \details
+     *
+     * Contiguous ranges of alphabets with the character type `char` are converted directly into the put area with
+     * seqan3::detail::to_chars, which uses SIMD for the nucleotide and quality alphabets.
+     */
+    template <std::ranges::forward_range range_type>
+    void write_chars_of(range_type && rng)
+    {
+        using alphabet_t = std::remove_cvref_t<std::ranges::range_reference_t<range_type>>;
+
+        constexpr bool has_char_type = [] () constexpr
+        {
+            if constexpr (alphabet<alphabet_t>)
+                return std::same_as<alphabet_char_t<alphabet_t>, char_t>;
+            else
+                return false;
+        }();
+
+        if constexpr (has_char_type && std::same_as<char_t, char> &&
+                      std::ranges::contiguous_range<range_type> && std::ranges::sized_range<range_type>)
+        {
+            alphabet_t const * letters = std::ranges::data(rng);
+            size_t remaining = std::ranges::size(rng);
+
+            while (remaining > 0)
+            {
+                size_t const buffer_space = stream_buf->epptr() - stream_buf->pptr();
+
+                if (buffer_space == 0)
+                {
+                    // Push one character and flush
+                    if (stream_buf->overflow(seqan3::to_char(*letters)) == traits_t::eof())
+                    {
+                        // LCOV_EXCL_START
+                        throw std::ios_base::failure{"Cannot write to output stream (reached traits::eof() condition)."};
+                        // LCOV_EXCL_STOP
+                    }
+
+                    ++letters;
+                    --remaining;
+                    continue;
+                }
+
+                size_t const characters_to_write = std::min(remaining, buffer_space);
+                detail::to_chars(letters, characters_to_write, stream_buf->pptr());
+                stream_buf->pbump(characters_to_write);
+                letters += characters_to_write;
+                remaining -= characters_to_write;
+            }
+        }
+        else
+        {
+            write_range(rng | views::to_char);
+        }
+    }
+
     /*!\brief Writes a number to the underlying stream buffer using std::to_chars.
      * \tparam number_type The type of number; must model seqan3::arithmetic.
      * \param[in] num The number to write.
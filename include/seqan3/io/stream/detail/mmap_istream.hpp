@@ -0,0 +1,223 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::mmap_istreambuf and seqan3::detail::mmap_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <seqan3/std/filesystem>
+#include <istream>
+#include <streambuf>
+
+#include <seqan3/core/platform.hpp>
+
+#if !defined(_WIN32) && __has_include(<sys/mman.h>)
+//!\brief Defined if files can be memory-mapped.
+#   define SEQAN3_HAS_MMAP 1
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+#ifdef SEQAN3_HAS_MMAP
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only stream buffer over a memory-mapped file.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * The complete file is mapped into memory and forms the get area of the stream buffer. Parsers that work on the get
+ * area, e.g. via seqan3::detail::fast_istreambuf_iterator, therefore read the file without copying it and without a
+ * virtual function call per buffer refill. The kernel is told that the mapping is read sequentially.
+ *
+ * Only regular files can be mapped; open() fails for pipes, sockets and character devices.
+ */
+class mmap_istreambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mmap_istreambuf() = default;                                     //!< Defaulted.
+    mmap_istreambuf(mmap_istreambuf const &) = delete;               //!< Deleted.
+    mmap_istreambuf(mmap_istreambuf &&) = delete;                    //!< Deleted.
+    mmap_istreambuf & operator=(mmap_istreambuf const &) = delete;   //!< Deleted.
+    mmap_istreambuf & operator=(mmap_istreambuf &&) = delete;        //!< Deleted.
+
+    //!\brief Unmaps the file.
+    ~mmap_istreambuf() override
+    {
+        close();
+    }
+    //!\}
+
+    /*!\brief Maps a file into memory.
+     * \param[in] filename The file to map.
+     * \returns `true` if the file was mapped, `false` if it is not a regular file or cannot be mapped.
+     */
+    bool open(std::filesystem::path const & filename)
+    {
+        close();
+
+        int const file_descriptor = ::open(filename.c_str(), O_RDONLY);
+
+        if (file_descriptor < 0)
+            return false;
+
+        struct stat status{};
+        bool const is_regular_file = (::fstat(file_descriptor, &status) == 0) && S_ISREG(status.st_mode);
+
+        if (is_regular_file && status.st_size > 0)
+        {
+            void * address = ::mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+            if (address != MAP_FAILED)
+            {
+                ::posix_madvise(address, status.st_size, POSIX_MADV_SEQUENTIAL);
+                data = static_cast<char *>(address);
+                size = status.st_size;
+            }
+        }
+
+        ::close(file_descriptor); // the mapping stays valid
+
+        if (!is_regular_file || (status.st_size > 0 && data == nullptr))
+            return false;
+
+        setg(data, data, data + size);
+        is_open_ = true;
+        return true;
+    }
+
+    //!\brief Whether a file is mapped.
+    bool is_open() const noexcept
+    {
+        return is_open_;
+    }
+
+    //!\brief Unmaps the file.
+    void close() noexcept
+    {
+        if (data != nullptr)
+            ::munmap(data, size);
+
+        data = nullptr;
+        size = 0;
+        is_open_ = false;
+        setg(nullptr, nullptr, nullptr);
+    }
+
+protected:
+    //!\brief The whole file is buffered, so there is nothing to refill.
+    int_type underflow() override
+    {
+        return (gptr() == egptr()) ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+    //!\brief The number of characters left in the file.
+    std::streamsize showmanyc() override
+    {
+        return (gptr() == egptr()) ? -1 : egptr() - gptr();
+    }
+
+    //!\brief Copies characters from the mapping.
+    std::streamsize xsgetn(char_type * destination, std::streamsize count) override
+    {
+        count = std::min<std::streamsize>(count, egptr() - gptr());
+        std::memcpy(destination, gptr(), count);
+        setg(eback(), gptr() + count, egptr());
+        return count;
+    }
+
+    //!\brief Sets the read position relative to the beginning, the current position or the end.
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+    {
+        if (!is_open_ || !(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        off_type base = 0;
+
+        if (direction == std::ios_base::cur)
+            base = gptr() - eback();
+        else if (direction == std::ios_base::end)
+            base = size;
+
+        return seekpos(pos_type(base + offset), which);
+    }
+
+    //!\brief Sets the read position.
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        off_type const offset = position;
+
+        if (!is_open_ || !(which & std::ios_base::in) || offset < 0 || offset > static_cast<off_type>(size))
+            return pos_type(off_type(-1));
+
+        setg(data, data + offset, data + size);
+        return position;
+    }
+
+private:
+    //!\brief The beginning of the mapping.
+    char * data{nullptr};
+    //!\brief The size of the mapping.
+    size_t size{0};
+    //!\brief Whether a file was opened (empty files are open but not mapped).
+    bool is_open_{false};
+};
+
+/*!\brief An input stream over a memory-mapped file.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * The failbit is set if the file cannot be mapped, see seqan3::detail::mmap_istreambuf.
+ */
+class mmap_istream : public std::istream
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief Maps the given file.
+    explicit mmap_istream(std::filesystem::path const & filename) : std::istream{nullptr}
+    {
+        rdbuf(&buffer);
+
+        if (!buffer.open(filename))
+            setstate(std::ios_base::failbit);
+    }
+
+    mmap_istream(mmap_istream const &) = delete;                     //!< Deleted.
+    mmap_istream(mmap_istream &&) = delete;                          //!< Deleted.
+    mmap_istream & operator=(mmap_istream const &) = delete;         //!< Deleted.
+    mmap_istream & operator=(mmap_istream &&) = delete;              //!< Deleted.
+    ~mmap_istream() override = default;                              //!< Defaulted.
+    //!\}
+
+    //!\brief Whether the file is mapped.
+    bool is_open() const noexcept
+    {
+        return buffer.is_open();
+    }
+
+private:
+    //!\brief The stream buffer.
+    mmap_istreambuf buffer;
+};
+
+} // namespace seqan3::detail
+
+#endif // SEQAN3_HAS_MMAP
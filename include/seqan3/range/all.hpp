@@ -14,6 +14,8 @@
 
 #include <seqan3/range/container/all.hpp>
 #include <seqan3/range/decorator/all.hpp>
+#include <seqan3/range/minimiser_hash_parallel.hpp>
+#include <seqan3/range/reverse_complement.hpp>
 #include <seqan3/range/views/all.hpp>
 
 /*!\defgroup range Range
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 
+#include <sdsl/bits.hpp>
 #include <sdsl/int_vector.hpp>
 
 #include <seqan3/alphabet/detail/alphabet_proxy.hpp>
@@ -23,6 +25,7 @@
 #include <seqan3/range/views/to_char.hpp>
 #include <seqan3/range/views/to_rank.hpp>
 #include <seqan3/range/views/convert.hpp>
+#include <seqan3/std/bit>
 #include <seqan3/std/concepts>
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
@@ -744,6 +747,9 @@ public:
      * than capacity(), all iterators and references are invalidated. Otherwise, only the iterators and
      * references before the insertion point remain valid. The past-the-end iterator is also invalidated.
      *
+     * Appending at the end() does not go through the element proxies: the ranks are packed into whole words, and
+     * iterators of another seqan3::bitcompressed_vector are copied as shifted words without unpacking the letters.
+     *
      * ### Complexity
      *
      * Worst-case linear in size().
@@ -762,6 +768,15 @@ public:
     {
         auto const pos_as_num = std::distance(cbegin(), pos);
 
+        if constexpr (bits_per_letter > 0)
+        {
+            if (pos == cend())
+            {
+                append(begin_it, end_it);
+                return begin() + pos_as_num;
+            }
+        }
+
         auto v = std::ranges::subrange<begin_iterator_type, end_iterator_type>{begin_it, end_it}
                | views::convert<value_type>
                | views::to_rank;
@@ -999,28 +1014,139 @@ public:
     //!\brief Checks whether `*this` is less than `rhs`.
     constexpr bool operator<(bitcompressed_vector const & rhs) const noexcept
     {
-        return data < rhs.data;
+        return compare(rhs) < 0;
     }
 
     //!\brief Checks whether `*this` is greater than `rhs`.
     constexpr bool operator>(bitcompressed_vector const & rhs) const noexcept
     {
-        return data > rhs.data;
+        return compare(rhs) > 0;
     }
 
     //!\brief Checks whether `*this` is less than or equal to `rhs`.
     constexpr bool operator<=(bitcompressed_vector const & rhs) const noexcept
     {
-        return data <= rhs.data;
+        return compare(rhs) <= 0;
     }
 
     //!\brief Checks whether `*this` is greater than or equal to `rhs`.
     constexpr bool operator>=(bitcompressed_vector const & rhs) const noexcept
     {
-        return data >= rhs.data;
+        return compare(rhs) >= 0;
     }
     //!\}
 
+private:
+    /*!\brief Copies bits between packed words.
+     * \param[in]  source          The words to copy from.
+     * \param[in]  source_bit      The first bit to copy.
+     * \param[out] target          The words to copy to.
+     * \param[in]  target_bit      The first bit to overwrite.
+     * \param[in]  bit_count       The number of bits.
+     *
+     * \details
+     *
+     * The bits are moved 64 at a time, shifted by the difference of the offsets within their words.
+     */
+    static void copy_bits(uint64_t const * source,
+                          size_type source_bit,
+                          uint64_t * target,
+                          size_type target_bit,
+                          size_type bit_count) noexcept
+    {
+        while (bit_count > 0)
+        {
+            uint8_t const length = std::min<size_type>(bit_count, 64);
+            uint64_t const bits = sdsl::bits::read_int(source + (source_bit >> 6), source_bit & 63, length);
+            sdsl::bits::write_int(target + (target_bit >> 6), bits, target_bit & 63, length);
+
+            source_bit += length;
+            target_bit += length;
+            bit_count -= length;
+        }
+    }
+
+    /*!\brief Appends the elements of `[begin_it, end_it)` to the packed words.
+     * \details
+     *
+     * The iterators of a seqan3::bitcompressed_vector over the same alphabet are copied with
+     * seqan3::bitcompressed_vector::copy_bits. All other elements are converted to ranks, which are gathered into a
+     * word before the word is written.
+     */
+    template <typename begin_iterator_type, typename end_iterator_type>
+    void append(begin_iterator_type begin_it, end_iterator_type end_it)
+    {
+        size_type const count = std::ranges::distance(begin_it, end_it);
+        size_type bit = data.bit_size();
+
+        if constexpr (std::same_as<begin_iterator_type, iterator> || std::same_as<begin_iterator_type, const_iterator>)
+        {
+            bitcompressed_vector const & source = *begin_it.host_ptr();
+
+            data.resize(size() + count);
+            copy_bits(source.data.data(), begin_it.position() * bits_per_letter, data.data(), bit,
+                      count * bits_per_letter);
+        }
+        else
+        {
+            constexpr size_type letters_per_word = 64 / bits_per_letter;
+
+            data.resize(size() + count);
+
+            for (size_type remaining = count; remaining > 0;)
+            {
+                size_type const letters = std::min(remaining, letters_per_word);
+                uint64_t word = 0;
+
+                for (size_type i = 0; i < letters; ++i, ++begin_it)
+                {
+                    value_type const letter = static_cast<value_type>(*begin_it);
+                    word |= static_cast<uint64_t>(to_rank(letter)) << (i * bits_per_letter);
+                }
+
+                sdsl::bits::write_int(data.data() + (bit >> 6), word, bit & 63, letters * bits_per_letter);
+                bit += letters * bits_per_letter;
+                remaining -= letters;
+            }
+        }
+    }
+
+    /*!\brief Compares the letters lexicographically on the packed words.
+     * \returns A negative value if `*this` is less than `rhs`, 0 if both are equal and a positive value otherwise.
+     *
+     * \details
+     *
+     * The letters are stored from the least significant bit, so the lowest bit in which two words differ belongs to
+     * the first letter in which the vectors differ.
+     */
+    int compare(bitcompressed_vector const & rhs) const noexcept
+    {
+        if constexpr (bits_per_letter > 0)
+        {
+            size_type const common_bits = std::min(size(), rhs.size()) * bits_per_letter;
+            uint64_t const * lhs_words = data.data();
+            uint64_t const * rhs_words = rhs.data.data();
+
+            for (size_type bit = 0; bit < common_bits; bit += 64)
+            {
+                size_type const length = std::min<size_type>(common_bits - bit, 64);
+                uint64_t const mask = length == 64 ? ~uint64_t{0} : (uint64_t{1} << length) - 1;
+                uint64_t const difference = (lhs_words[bit >> 6] ^ rhs_words[bit >> 6]) & mask;
+
+                if (difference != 0)
+                {
+                    size_type const position = (bit + std::countr_zero(difference)) / bits_per_letter;
+                    return data[position] < rhs.data[position] ? -1 : 1;
+                }
+            }
+        }
+
+        // all common letters are equal (an alphabet of size 1 has no bits at all)
+        return (size() > rhs.size()) - (size() < rhs.size());
+    }
+
+public:
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
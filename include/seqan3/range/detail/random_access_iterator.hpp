@@ -281,6 +281,23 @@ public:
     }
     //!\}
 
+    /*!\name Access to the host range
+     * \brief Allows the host range to implement operations on ranges of its own iterators more efficiently.
+     * \{
+     */
+    //!\brief Returns a pointer to the range the iterator points into.
+    constexpr range_type * host_ptr() const noexcept
+    {
+        return host;
+    }
+
+    //!\brief Returns the position of the iterator in the host range.
+    constexpr position_type position() const noexcept
+    {
+        return pos;
+    }
+    //!\}
+
 private:
 
     //!\brief Cast this to derived type.
@@ -0,0 +1,328 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::minimiser_hash_parallel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3::detail
+{
+
+//!\brief The default number of windows per chunk of seqan3::minimiser_hash_parallel.
+//!\ingroup range
+inline constexpr size_t minimiser_hash_chunk_size = 1u << 16;
+
+/*!\brief Whether the sequences of a collection can be sliced by the worker threads of seqan3::minimiser_hash_parallel.
+ * \ingroup range
+ *
+ * \details
+ *
+ * If the collection and its sequences are random access ranges, a chunk only stores its position in the collection;
+ * otherwise the letters of the chunk are copied while reading the collection.
+ */
+template <typename sequences_t>
+constexpr bool minimiser_hash_chunk_by_position =
+    std::ranges::random_access_range<sequences_t> &&
+    std::ranges::random_access_range<std::ranges::range_reference_t<sequences_t>> &&
+    std::ranges::sized_range<std::ranges::range_reference_t<sequences_t>>;
+
+/*!\brief A piece of one sequence that is processed by a single thread of seqan3::minimiser_hash_parallel.
+ * \ingroup range
+ * \tparam letter_t The alphabet of the sequence.
+ */
+template <typename letter_t>
+struct minimiser_hash_chunk
+{
+    //!\brief The position of the sequence in the collection.
+    size_t sequence_index{};
+    //!\brief The position of the first letter of the chunk in the sequence.
+    size_t begin{};
+    //!\brief The position behind the last letter of the chunk in the sequence.
+    size_t end{};
+    //!\brief Whether the chunk starts with the last window of the previous chunk of the same sequence.
+    bool continued{};
+    //!\brief A copy of the letters; empty if the chunk is read from the collection by its position.
+    std::vector<letter_t> letters{};
+};
+
+/*!\brief Computes the minimisers of a collection of sequences on multiple threads.
+ * \ingroup range
+ * \tparam sequences_t The type of the collection; must model std::ranges::input_range over
+ *                     std::ranges::forward_range.
+ * \tparam callback_t  The type of the callback; must be invocable with `size_t` and `std::span<size_t const>`.
+ * \param[in] sequences    The collection of sequences.
+ * \param[in] shape        The seqan3::shape of the k-mers.
+ * \param[in] window_size  The number of letters of a window.
+ * \param[in] seed         The seed that is XORed with the k-mer hashes.
+ * \param[in] thread_count The number of worker threads.
+ * \param[in] chunk_size   The number of windows per chunk; must be greater than 0.
+ * \param[in] callback     Invoked with the position of a sequence and the minimisers of one of its chunks.
+ * \throws std::invalid_argument If the size of the shape is greater than the window size.
+ *
+ * \details
+ *
+ * The calling thread reads the collection and splits every sequence into chunks of `chunk_size` windows. A chunk
+ * contains the letters of its windows and, except for the first chunk of a sequence, of the last window of the
+ * previous chunk. The minimiser of that additional window is already reported by the previous chunk and is dropped.
+ * At most twice as many chunks as there are threads are buffered at any time.
+ *
+ * The callback is invoked concurrently from the worker threads. An exception thrown by a worker thread or while
+ * reading the collection stops the computation and is rethrown after all threads have been joined.
+ */
+template <std::ranges::input_range sequences_t, typename callback_t>
+//!\cond
+    requires std::ranges::forward_range<std::ranges::range_reference_t<sequences_t>> &&
+             std::invocable<callback_t &, size_t const, std::span<size_t const>>
+//!\endcond
+void minimiser_hash_parallel(sequences_t && sequences,
+                             shape const & shape,
+                             window_size const window_size,
+                             seed const seed,
+                             size_t const thread_count,
+                             size_t const chunk_size,
+                             callback_t & callback)
+{
+    using sequence_t = std::ranges::range_reference_t<sequences_t>;
+    using chunk_t = minimiser_hash_chunk<std::ranges::range_value_t<sequence_t>>;
+
+    constexpr bool by_position = minimiser_hash_chunk_by_position<sequences_t>;
+
+    if (shape.size() > window_size.get())
+        throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
+
+    assert(chunk_size > 0);
+
+    size_t const worker_count = std::max<size_t>(thread_count, 1u);
+    contrib::fixed_buffer_queue<chunk_t> queue{2 * worker_count};
+
+    std::atomic_bool failed{false};
+    std::mutex exception_mutex{};
+    std::exception_ptr exception{};
+
+    auto fail = [&] ()
+    {
+        std::lock_guard lock{exception_mutex};
+
+        if (!exception)
+            exception = std::current_exception();
+
+        failed = true;
+        queue.close();
+    };
+
+    // Only random access collections are iterated twice, i.e. by the reading thread and by the workers.
+    auto first_sequence = [&] ()
+    {
+        if constexpr (by_position)
+            return std::ranges::begin(sequences);
+        else
+            return 0;
+    }();
+
+    auto work = [&] ()
+    {
+        std::vector<size_t> minimisers{};
+        chunk_t chunk{};
+
+        while (queue.wait_pop(chunk) == contrib::queue_op_status::success)
+        {
+            if (failed)
+                continue;
+
+            try
+            {
+                minimisers.clear();
+
+                if constexpr (by_position)
+                {
+                    using difference_t = std::ranges::range_difference_t<sequence_t>;
+
+                    auto && sequence = first_sequence[chunk.sequence_index];
+                    auto letters = std::ranges::begin(sequence);
+
+                    seqan3::minimiser_hash_copy(std::ranges::subrange{letters + static_cast<difference_t>(chunk.begin),
+                                                                      letters + static_cast<difference_t>(chunk.end)},
+                                                std::back_inserter(minimisers), shape, window_size, seed);
+                }
+                else
+                {
+                    seqan3::minimiser_hash_copy(chunk.letters, std::back_inserter(minimisers), shape, window_size,
+                                                seed);
+                }
+
+                // The minimiser of the first window of a continued chunk is reported by the previous chunk.
+                size_t const skip = chunk.continued;
+
+                if (minimisers.size() > skip)
+                    callback(chunk.sequence_index, std::span<size_t const>{minimisers.data() + skip,
+                                                                           minimisers.size() - skip});
+            }
+            catch (...)
+            {
+                fail();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers{};
+    workers.reserve(worker_count);
+
+    for (size_t i = 0; i < worker_count; ++i)
+        workers.emplace_back(work);
+
+    // Returns false if the queue has been closed by a failing worker.
+    auto split = [&] (size_t const sequence_index, sequence_t & sequence)
+    {
+        size_t const size = std::ranges::distance(sequence);
+        [[maybe_unused]] auto letter = std::ranges::begin(sequence);
+        [[maybe_unused]] size_t letter_position = 0;
+
+        for (size_t window_begin = 0, chunk_begin = 0;;
+             window_begin += chunk_size, chunk_begin = window_begin - 1)
+        {
+            size_t const chunk_end = std::min(size, window_begin + chunk_size + window_size.get() - 1);
+            chunk_t chunk{sequence_index, chunk_begin, chunk_end, window_begin != 0, {}};
+
+            if constexpr (!by_position)
+            {
+                std::ranges::advance(letter, chunk_begin - letter_position);
+                letter_position = chunk_begin;
+                chunk.letters.resize(chunk_end - chunk_begin);
+                std::ranges::copy_n(letter, chunk_end - chunk_begin, chunk.letters.begin());
+            }
+
+            if (queue.wait_push(std::move(chunk)) != contrib::queue_op_status::success)
+                return false;
+
+            if (chunk_end == size)
+                return true;
+        }
+    };
+
+    try
+    {
+        size_t sequence_index = 0;
+
+        for (auto && sequence : sequences)
+        {
+            if (!split(sequence_index, sequence))
+                break;
+
+            ++sequence_index;
+        }
+    }
+    catch (...)
+    {
+        fail();
+    }
+
+    queue.close();
+
+    for (auto & worker : workers)
+        worker.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief Computes the minimisers of a collection of sequences on multiple threads and passes them to a sink.
+ * \ingroup range
+ * \tparam sequences_t The type of the collection; must model std::ranges::input_range over
+ *                     std::ranges::forward_range over a seqan3::nucleotide_alphabet.
+ * \tparam sink_t      The type of the sink; must be invocable with `size_t` and `std::span<size_t const>`.
+ * \param[in] sequences    The collection of sequences, e.g. seqan3::concatenated_sequences.
+ * \param[in] shape        The seqan3::shape of the k-mers.
+ * \param[in] window_size  The number of letters of a window.
+ * \param[in] sink         Invoked with the position of a sequence in the collection and some of its minimisers.
+ * \param[in] thread_count The number of threads that compute minimisers; defaults to the number of cores.
+ * \param[in] seed         The seed that is XORed with the k-mer hashes; defaults to the seed of
+ *                         seqan3::views::minimiser_hash.
+ * \throws std::invalid_argument If the size of the shape is greater than the window size.
+ *
+ * \details
+ *
+ * \header_file{seqan3/range/minimiser_hash_parallel.hpp}
+ *
+ * This is the parallel counterpart of applying seqan3::views::minimiser_hash to every sequence of a collection. Long
+ * sequences are split into chunks of consecutive windows that overlap by one window, so the threads are kept busy
+ * even if the collection contains a single chromosome. The sequences are read by the calling thread, so
+ * single-pass collections like the sequences of a seqan3::sequence_file_input are supported:
+ *
+ * \include test/snippet/range/minimiser_hash_parallel.cpp
+ *
+ * ### Output
+ *
+ * The sink is invoked once per chunk and never concurrently. The chunks of a sequence may be reported in any order
+ * and interleaved with the chunks of other sequences. Within a chunk, the minimisers are reported in the order of
+ * seqan3::views::minimiser_hash.
+ *
+ * For every sequence, the reported minimisers are the same set as the ones of seqan3::views::minimiser_hash. If a
+ * window contains the same minimal hash value more than once, e.g. in a low-complexity region, the sequential view
+ * reports it again depending on the windows that precede it. A chunk does not know these windows, so such a value
+ * may be reported a different number of times than by the view. This does not matter when the minimisers are
+ * inserted into a set-like data structure like the seqan3::interleaved_bloom_filter.
+ *
+ * ### Memory
+ *
+ * Instead of all minimisers of the collection, only the chunks that are waiting for or being processed by a thread
+ * are stored: at most three chunks per thread and the chunk that is being read.
+ *
+ * ### Exceptions
+ *
+ * An exception thrown by the sink or while reading the collection stops the computation and is rethrown after all
+ * threads have finished.
+ */
+template <std::ranges::input_range sequences_t, typename sink_t>
+//!\cond
+    requires std::ranges::forward_range<std::ranges::range_reference_t<sequences_t>> &&
+             nucleotide_alphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<sequences_t>>> &&
+             std::invocable<sink_t &, size_t const, std::span<size_t const>>
+//!\endcond
+void minimiser_hash_parallel(sequences_t && sequences,
+                             shape const & shape,
+                             window_size const window_size,
+                             sink_t && sink,
+                             size_t const thread_count = std::thread::hardware_concurrency(),
+                             seed const seed = seed{0x8F3F73B5CF1C9ADE})
+{
+    std::mutex sink_mutex{};
+
+    auto serialised_sink = [&] (size_t const sequence_index, std::span<size_t const> minimisers)
+    {
+        std::lock_guard lock{sink_mutex};
+        sink(sequence_index, minimisers);
+    };
+
+    detail::minimiser_hash_parallel(std::forward<sequences_t>(sequences), shape, window_size, seed, thread_count,
+                                    detail::minimiser_hash_chunk_size, serialised_sink);
+}
+
+} // namespace seqan3
@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::reverse_complement and seqan3::reverse_complement_copy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Reverses the order of the 2-bit groups in a 64-bit word.
+ * \ingroup range
+ */
+constexpr uint64_t reverse_2bit_groups(uint64_t word) noexcept
+{
+    word = ((word >> 2) & 0x3333'3333'3333'3333ULL) | ((word & 0x3333'3333'3333'3333ULL) << 2);
+    word = ((word >> 4) & 0x0F0F'0F0F'0F0F'0F0FULL) | ((word & 0x0F0F'0F0F'0F0F'0F0FULL) << 4);
+    return __builtin_bswap64(word);
+}
+
+/*!\brief Whether the complement of every rank of an alphabet with four letters is `rank ^ 3`, like for
+ *        seqan3::dna4 and seqan3::rna4.
+ * \ingroup range
+ */
+template <nucleotide_alphabet alphabet_t>
+bool complement_is_xor3()
+{
+    if constexpr (alphabet_size<alphabet_t> != 4)
+    {
+        return false;
+    }
+    else
+    {
+        for (size_t rank = 0; rank < 4; ++rank)
+        {
+            if (to_rank(seqan3::complement(assign_rank_to(rank, alphabet_t{}))) != (rank ^ 3))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+/*!\brief Reverse-complements a seqan3::bitcompressed_vector with two bits per letter on its packed words.
+ * \ingroup range
+ * \param[in,out] sequence The sequence; the complement of every rank must be `rank ^ 3`.
+ *
+ * \details
+ *
+ * Letter `i` is stored in the bits `[2i, 2i + 2)` of the packed 64-bit words. Reversing the order of the words and of
+ * the 2-bit groups within every word reverses the whole bit-vector including the unused bits of the last word;
+ * inverting all bits complements every letter. The result is then shifted down by the number of unused bits.
+ */
+template <typename alphabet_t>
+void reverse_complement_packed(bitcompressed_vector<alphabet_t> & sequence)
+{
+    auto & data = sequence.raw_data();
+    size_t const word_count = (data.bit_size() + 63) / 64;
+
+    if (word_count == 0)
+        return;
+
+    uint64_t * words = data.data();
+    size_t const shift = word_count * 64 - data.bit_size();
+
+    std::reverse(words, words + word_count);
+
+    for (size_t i = 0; i < word_count; ++i)
+        words[i] = ~reverse_2bit_groups(words[i]);
+
+    if (shift != 0)
+    {
+        for (size_t i = 0; i + 1 < word_count; ++i)
+            words[i] = (words[i] >> shift) | (words[i + 1] << (64 - shift));
+
+        words[word_count - 1] >>= shift;
+    }
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\name Reverse complement
+ * \{
+ */
+
+/*!\brief Reverse-complements a range of nucleotides in place.
+ * \ingroup range
+ * \tparam rng_t The type of the range; must model std::ranges::bidirectional_range and std::ranges::output_range over
+ *               its value type, which must model seqan3::nucleotide_alphabet.
+ * \param[in,out] sequence The nucleotides.
+ *
+ * \details
+ *
+ * \header_file{seqan3/range/reverse_complement.hpp}
+ *
+ * This is the eager counterpart of `sequence | std::views::reverse | seqan3::views::complement`: the sequence is
+ * reversed and every letter is replaced by its seqan3::complement in a single pass.
+ *
+ * Contiguous ranges of the single-byte nucleotide alphabets, e.g. `std::vector<seqan3::dna4>` or
+ * `std::vector<seqan3::dna5>`, are processed with SIMD instructions if the CPU supports them.
+ * seqan3::bitcompressed_vector over seqan3::dna4 or seqan3::rna4 is processed on its packed 64-bit words, i.e.
+ * 32 letters at once, without unpacking the letters. All other ranges are processed element-wise.
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the range.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/reverse_complement.cpp
+ */
+template <std::ranges::bidirectional_range rng_t>
+//!\cond
+    requires nucleotide_alphabet<std::ranges::range_value_t<rng_t>> &&
+             std::ranges::output_range<rng_t, std::ranges::range_value_t<rng_t>>
+//!\endcond
+void reverse_complement(rng_t && sequence)
+{
+    using value_t = std::ranges::range_value_t<rng_t>;
+
+    if constexpr (detail::is_type_specialisation_of_v<std::remove_cvref_t<rng_t>, bitcompressed_vector> &&
+                  alphabet_size<value_t> == 4)
+    {
+        if (detail::complement_is_xor3<value_t>())
+        {
+            detail::reverse_complement_packed(sequence);
+            return;
+        }
+    }
+
+    if constexpr (std::ranges::contiguous_range<rng_t> && std::ranges::sized_range<rng_t>)
+    {
+        value_t * data = std::ranges::data(sequence);
+        detail::reverse_complement_letters<value_t>(data, std::ranges::size(sequence), data);
+    }
+    else
+    {
+        auto first = std::ranges::begin(sequence);
+        auto last = std::ranges::next(first, std::ranges::end(sequence));
+
+        while (first != last)
+        {
+            --last;
+            value_t const front = *first;
+            value_t const back = *last;
+            *first = seqan3::complement(back);
+
+            if (first == last)
+                break;
+
+            *last = seqan3::complement(front);
+            ++first;
+        }
+    }
+}
+
+/*!\brief Writes the reverse complement of a range of nucleotides to an output iterator.
+ * \ingroup range
+ * \tparam rng_t The type of the range; must model std::ranges::bidirectional_range over a
+ *               seqan3::nucleotide_alphabet.
+ * \tparam out_t The type of the output iterator; the value type of `rng_t` must be writable to it.
+ * \param[in]  sequence The nucleotides.
+ * \param[out] out      The beginning of the destination; must not overlap `sequence`.
+ * \returns The end of the destination.
+ *
+ * \details
+ *
+ * \header_file{seqan3/range/reverse_complement.hpp}
+ *
+ * Writes the same letters as seqan3::reverse_complement, but leaves `sequence` unmodified. If both `sequence` and
+ * the destination are contiguous, the SIMD kernels of seqan3::reverse_complement are used.
+ */
+template <std::ranges::bidirectional_range rng_t, std::weakly_incrementable out_t>
+//!\cond
+    requires nucleotide_alphabet<std::ranges::range_value_t<rng_t>> &&
+             std::indirectly_writable<out_t, std::ranges::range_value_t<rng_t>>
+//!\endcond
+out_t reverse_complement_copy(rng_t && sequence, out_t out)
+{
+    using value_t = std::ranges::range_value_t<rng_t>;
+
+    if constexpr (std::ranges::contiguous_range<rng_t> && std::ranges::sized_range<rng_t> &&
+                  std::contiguous_iterator<out_t> && std::same_as<std::iter_value_t<out_t>, value_t>)
+    {
+        size_t const count = std::ranges::size(sequence);
+
+        if (count == 0)
+            return out;
+
+        detail::reverse_complement_letters<value_t>(std::ranges::data(sequence), count, std::addressof(*out));
+        return std::ranges::next(out, static_cast<std::iter_difference_t<out_t>>(count));
+    }
+    else
+    {
+        auto const first = std::ranges::begin(sequence);
+        auto last = std::ranges::next(first, std::ranges::end(sequence));
+
+        while (last != first)
+        {
+            --last;
+            value_t const letter = *last;
+            *out = seqan3::complement(letter);
+            ++out;
+        }
+
+        return out;
+    }
+}
+
+//!\}
+
+} // namespace seqan3
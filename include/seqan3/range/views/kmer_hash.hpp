@@ -12,20 +12,67 @@
 
 #pragma once
 
+#include <algorithm>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/utility/math.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
 #include <seqan3/range/hash.hpp>
+#include <seqan3/range/reverse_complement.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
 
 namespace seqan3::detail
 {
+
+/*!\brief Whether an iterator points into a seqan3::bitcompressed_vector that stores every letter in two bits.
+ * \ingroup views
+ */
+template <typename it_t>
+inline constexpr bool is_2bit_packed_iterator_v = false;
+
+//!\cond
+template <typename alphabet_t>
+inline constexpr bool is_2bit_packed_iterator_v<random_access_iterator<bitcompressed_vector<alphabet_t>>> =
+    alphabet_size<alphabet_t> == 4;
+
+template <typename alphabet_t>
+inline constexpr bool is_2bit_packed_iterator_v<random_access_iterator<bitcompressed_vector<alphabet_t> const>> =
+    alphabet_size<alphabet_t> == 4;
+//!\endcond
+
+/*!\brief Gathers the bits of `value` that are set in `mask` into the lowest bits, like the BMI2 instruction `pext`.
+ * \ingroup views
+ */
+inline uint64_t extract_bits(uint64_t const value, uint64_t mask) noexcept
+{
+#if defined(__BMI2__)
+    return _pext_u64(value, mask);
+#else
+    uint64_t result = 0;
+
+    for (uint64_t bit = 1; mask != 0; bit <<= 1, mask &= mask - 1)
+    {
+        if (value & mask & (~mask + 1)) // the lowest bit of the mask
+            result |= bit;
+    }
+
+    return result;
+#endif
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // kmer_hash_view class
 // ---------------------------------------------------------------------------------------------------------------------
 
-/*!\brief The type returned by seqan3::views::kmer_hash.
- * \tparam urng_t The type of the underlying ranges, must model std::forward_range, the reference type must model
- *                seqan3::semialphabet.
+/*!\brief The type returned by seqan3::views::kmer_hash and seqan3::views::canonical_kmer_hash.
+ * \tparam urng_t    The type of the underlying ranges, must model std::forward_range, the reference type must model
+ *                   seqan3::semialphabet.
+ * \tparam canonical Whether the minimum of the hash values of each k-mer and its reverse complement is returned;
+ *                   the reference type must model seqan3::nucleotide_alphabet in this case.
  * \implements std::ranges::view
  * \implements std::ranges::random_access_range
  * \implements std::ranges::sized_range
@@ -35,13 +82,16 @@ namespace seqan3::detail
  *
  * Note that most members of this class are generated by ranges::view_interface which is not yet documented here.
  */
-template <std::ranges::view urng_t>
-class kmer_hash_view : public std::ranges::view_interface<kmer_hash_view<urng_t>>
+template <std::ranges::view urng_t, bool canonical = false>
+class kmer_hash_view : public std::ranges::view_interface<kmer_hash_view<urng_t, canonical>>
 {
 private:
     static_assert(std::ranges::forward_range<urng_t>, "The kmer_hash_view only works on forward_ranges");
     static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
                   "The reference type of the underlying range must model seqan3::semialphabet.");
+    static_assert(!canonical || nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                  "The reference type of the underlying range must model seqan3::nucleotide_alphabet for canonical "
+                  "k-mers.");
 
     //!\brief The underlying range.
     urng_t urange;
@@ -49,6 +99,9 @@ private:
     //!\brief The shape to use.
     shape shape_;
 
+    //!\brief The value the hash values are XORed with.
+    size_t hash_seed{0};
+
     template <bool const_range>
     class basic_iterator;
 
@@ -64,10 +117,15 @@ public:
     ~kmer_hash_view()                                      = default; //!< Defaulted.
 
     /*!\brief Construct from a view and a given shape.
+     * \param[in] urange_ The underlying range.
+     * \param[in] s_      The seqan3::shape to use for hashing.
+     * \param[in] seed    The hash values are XORed with `seed`; for canonical k-mers before taking the minimum of both
+     *                    strands. Used by seqan3::views::minimiser_hash. \noapi
      * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
      *         `uint64_t`, i.e. \f$s>\frac{64}{\log_2\sigma}\f$ with shape size \f$s\f$ and alphabet size \f$\sigma\f$.
      */
-    kmer_hash_view(urng_t urange_, shape const & s_) : urange{std::move(urange_)}, shape_{s_}
+    kmer_hash_view(urng_t urange_, shape const & s_, size_t const seed = 0) :
+        urange{std::move(urange_)}, shape_{s_}, hash_seed{seed}
     {
         if (shape_.count() > (64 / std::log2(alphabet_size<std::ranges::range_reference_t<urng_t>>)))
         {
@@ -77,6 +135,10 @@ public:
     }
 
     /*!\brief Construct from a non-view that can be view-wrapped and a given shape.
+     * \param[in] urange_ The underlying range.
+     * \param[in] s_      The seqan3::shape to use for hashing.
+     * \param[in] seed    The hash values are XORed with `seed`; for canonical k-mers before taking the minimum of both
+     *                    strands. Used by seqan3::views::minimiser_hash. \noapi
      * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
      *         `uint64_t`, i.e. \f$s>\frac{64}{\log_2\sigma}\f$ with shape size \f$s\f$ and alphabet size \f$\sigma\f$.
      */
@@ -86,8 +148,8 @@ public:
               std::ranges::viewable_range<rng_t> &&
               std::constructible_from<urng_t, std::ranges::ref_view<std::remove_reference_t<rng_t>>>
     //!\endcond
-    kmer_hash_view(rng_t && urange_, shape const & s_) :
-        urange{std::views::all(std::forward<rng_t>(urange_))}, shape_{s_}
+    kmer_hash_view(rng_t && urange_, shape const & s_, size_t const seed = 0) :
+        urange{std::views::all(std::forward<rng_t>(urange_))}, shape_{s_}, hash_seed{seed}
     {
         if (shape_.count() > (64 / std::log2(alphabet_size<std::ranges::range_reference_t<urng_t>>)))
         {
@@ -115,7 +177,7 @@ public:
      */
     auto begin() noexcept
     {
-        return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), shape_};
+        return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), shape_, hash_seed};
     }
 
     //!\copydoc begin()
@@ -124,7 +186,7 @@ public:
         requires const_iterable_range<urng_t>
     //!\endcond
     {
-        return basic_iterator<true>{std::ranges::cbegin(urange), std::ranges::cend(urange), shape_};
+        return basic_iterator<true>{std::ranges::cbegin(urange), std::ranges::cend(urange), shape_, hash_seed};
     }
 
     /*!\brief Returns an iterator to the element following the last element of the range.
@@ -146,7 +208,7 @@ public:
     {
         // Assigning the end iterator to the text_right iterator of the basic_iterator only works for common ranges.
         if constexpr (std::ranges::common_range<urng_t>)
-            return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), shape_, true};
+            return basic_iterator<false>{std::ranges::begin(urange), std::ranges::end(urange), shape_, hash_seed, true};
         else
             return std::ranges::end(urange);
     }
@@ -159,7 +221,8 @@ public:
     {
         // Assigning the end iterator to the text_right iterator of the basic_iterator only works for common ranges.
         if constexpr (std::ranges::common_range<urng_t const>)
-            return basic_iterator<true>{std::ranges::cbegin(urange), std::ranges::cend(urange), shape_, true};
+            return basic_iterator<true>{std::ranges::cbegin(urange), std::ranges::cend(urange), shape_, hash_seed,
+                                        true};
         else
             return std::ranges::cend(urange);
     }
@@ -214,10 +277,18 @@ public:
  * To avoid dereferencing the sentinel when iterating, the basic_iterator computes the hash value up until
  * the second to last position and performs the addition of the last position upon
  * access (\ref operator* and \ref operator[]).
+ *
+ * If the alphabet size is a power of two and the ranks of all positions of the shape fit into 64 bits, e.g. for
+ * seqan3::dna4 and shapes of size up to 32, the ranks of the shape's span are kept in a word like in a
+ * 2-bit packed sequence. Moving the iterator then shifts the word instead of multiplying, and the positions of gapped
+ * shapes are gathered with seqan3::detail::extract_bits (`pext`) instead of hashing every position again. For a
+ * seqan3::bitcompressed_vector over seqan3::dna4 the ranks are read directly from the packed storage: the first window
+ * at once and the letters that enter the window 32 at a time, so moving forward only shifts words.
+ * For canonical k-mers, the word of the reverse complement is shifted in the opposite direction in the same pass.
  */
-template <std::ranges::view urng_t>
+template <std::ranges::view urng_t, bool canonical>
 template <bool const_range>
-class kmer_hash_view<urng_t>::basic_iterator
+class kmer_hash_view<urng_t, canonical>::basic_iterator
 {
 private:
     //!\brief The iterator type of the underlying range.
@@ -264,16 +335,22 @@ public:
         requires const_range
     //!\endcond
         : hash_value{std::move(it.hash_value)},
+          reverse_hash_value{std::move(it.reverse_hash_value)},
           roll_factor{std::move(it.roll_factor)},
+          shape_mask{std::move(it.shape_mask)},
+          hash_seed{std::move(it.hash_seed)},
           shape_{std::move(it.shape_)},
           text_left{std::move(it.text_left)},
-          text_right{std::move(it.text_right)}
+          text_right{std::move(it.text_right)},
+          incoming_ranks{std::move(it.incoming_ranks)},
+          incoming_count{std::move(it.incoming_count)}
     {}
 
     /*!\brief Construct from a given iterator on the text and a seqan3::shape.
     * /param[in] it_start Iterator pointing to the first position of the text.
     * /param[in] it_end   Sentinel pointing to the end of the text.
     * /param[in] s_       The seqan3::shape that determines which positions participate in hashing.
+    * /param[in] seed     The value the hash values are XORed with.
     *
     * \details
     *
@@ -281,8 +358,11 @@ public:
     *
     * Linear in size of shape.
     */
-    basic_iterator(it_t it_start, sentinel_t it_end, shape s_) :
-        shape_{s_}, text_left{it_start}, text_right{std::ranges::next(text_left, shape_.size() - 1, it_end)}
+    basic_iterator(it_t it_start, sentinel_t it_end, shape s_, size_t const seed) :
+        hash_seed{seed},
+        shape_{s_},
+        text_left{it_start},
+        text_right{std::ranges::next(text_left, shape_.size() - 1, it_end)}
     {
         assert(std::ranges::size(shape_) > 0);
 
@@ -293,7 +373,7 @@ public:
         // distance(text_left, text_right) = 2
         if (shape_.size() <= std::ranges::distance(text_left, text_right) + 1)
         {
-            roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_shape();
             hash_full();
         }
     }
@@ -302,6 +382,7 @@ public:
     * /param[in] it_start Iterator pointing to the first position of the text.
     * /param[in] it_end   Sentinel pointing to the end of the text.
     * /param[in] s_       The seqan3::shape that determines which positions participate in hashing.
+    * /param[in] seed     The value the hash values are XORed with.
     * /param[in] is_end   Indicates that this iterator should point to the end of the text.
     *
     * \details
@@ -321,7 +402,8 @@ public:
     *
     * Linear in size of shape.
     */
-    basic_iterator(it_t it_start, sentinel_t it_end, shape s_, bool SEQAN3_DOXYGEN_ONLY(is_end)) : shape_{s_}
+    basic_iterator(it_t it_start, sentinel_t it_end, shape s_, size_t const seed, bool SEQAN3_DOXYGEN_ONLY(is_end)) :
+        hash_seed{seed}, shape_{s_}
     {
         assert(std::ranges::size(shape_) > 0);
 
@@ -336,11 +418,12 @@ public:
         // distance(text_left, text_right) = 2
         if (shape_.size() <= std::ranges::distance(text_left, it_end) + 1)
         {
-            roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_shape();
             hash_full();
         }
 
         text_right = it_end;
+        load_incoming();
     }
     //!\}
 
@@ -566,10 +649,23 @@ public:
         return *(*this + n);
     }
 
-    //!\brief Return the hash value.
+    /*!\brief Return the hash value.
+     * \details
+     *
+     * For seqan3::views::canonical_kmer_hash, this is the minimum of the hash values of the k-mer and its reverse
+     * complement.
+     */
     value_type operator*() const noexcept
     {
-        return hash_value + to_rank(*text_right);
+        if (shape_mask != 0)
+            return window_hash();
+
+        size_t const hash = (hash_value + rank_at(text_right)) ^ hash_seed;
+
+        if constexpr (canonical)
+            return std::min(hash, (reverse_hash_value + complement_rank_at(text_right) * roll_factor) ^ hash_seed);
+        else
+            return hash;
     }
 
 private:
@@ -579,12 +675,26 @@ private:
     //!\brief The alphabet size.
     static constexpr auto const sigma{alphabet_size<alphabet_t>};
 
+    //!\brief The number of bits per rank if the alphabet size is a power of two, `0` otherwise.
+    static constexpr size_t bits_per_letter = ((sigma & (sigma - 1)) == 0) ? detail::ceil_log2(sigma) : 0;
+
     //!\brief The hash value.
     size_t hash_value{0};
 
+    //!\brief The hash value of the reverse complement; only used for canonical k-mers.
+    size_t reverse_hash_value{0};
+
     //!\brief The factor for the left most position of the hash value.
     size_t roll_factor{0};
 
+    /*!\brief The bits of the positions of the shape in a window of the k-mer's ranks, or `0` if the ranks of the
+     *        k-mer are not kept in a window.
+     */
+    size_t shape_mask{0};
+
+    //!\brief The value the hash values are XORed with.
+    size_t hash_seed{0};
+
     //!\brief The shape to use.
     shape shape_;
 
@@ -594,10 +704,123 @@ private:
     //!\brief Iterator to the rightmost position of the k-mer.
     it_t text_right;
 
+    /*!\brief The ranks of the letters from text_right on, as stored in the packed words; only used if `it_t` points
+     *        into a seqan3::bitcompressed_vector over an alphabet of size 4.
+     */
+    uint64_t incoming_ranks{0};
+
+    //!\brief The number of letters in #incoming_ranks.
+    size_t incoming_count{0};
+
+    //!\brief Returns a mask of the lowest `n` bits.
+    static constexpr size_t low_bits(size_t const n) noexcept
+    {
+        return (n >= 64) ? ~size_t{0} : (size_t{1} << n) - 1;
+    }
+
+    //!\brief Returns the rank of the letter the iterator points to.
+    static size_t rank_at(it_t const & it)
+    {
+        return to_rank(*it);
+    }
+
+    //!\brief Returns the rank of the complement of the letter the iterator points to.
+    static size_t complement_rank_at(it_t const & it)
+    {
+        alphabet_t const letter = *it;
+        return to_rank(seqan3::complement(letter));
+    }
+
+    //!\brief Returns the rank of the letter text_right points to.
+    size_t right_rank() const
+    {
+        if constexpr (is_2bit_packed_iterator_v<it_t>)
+            return incoming_ranks & 0b11u;
+        else
+            return rank_at(text_right);
+    }
+
+    //!\brief Returns the rank of the complement of the letter text_right points to.
+    size_t right_complement_rank() const
+    {
+        if constexpr (is_2bit_packed_iterator_v<it_t>)
+            return to_rank(seqan3::complement(assign_rank_to(right_rank(), alphabet_t{})));
+        else
+            return complement_rank_at(text_right);
+    }
+
+    /*!\brief Reads the ranks of up to 32 letters from text_right on from the packed storage.
+     * \details Does nothing if `it_t` does not point into a seqan3::bitcompressed_vector over an alphabet of size 4.
+     */
+    void load_incoming()
+    {
+        if constexpr (is_2bit_packed_iterator_v<it_t>)
+        {
+            size_t const position = text_right.position();
+            incoming_count = std::min<size_t>(32, text_right.host_ptr()->size() - position);
+            incoming_ranks = 0;
+
+            if (incoming_count != 0)
+                incoming_ranks = text_right.host_ptr()->raw_data().get_int(2 * position, 2 * incoming_count);
+        }
+    }
+
+    /*!\brief Initialises the members that only depend on the shape.
+     * \details
+     *
+     * Slot `j`, i.e. the bits `[j * b, j * b + b)` with `b` bits per letter, of a window holds the rank of the
+     * position `s - 1 - j` of a k-mer of span `s`, just as the most significant digit of the hash value is the rank of
+     * the first position. The shape mask has all bits of the slots of the shape's `1`s set.
+     * Like in operator*, the last position is always hashed.
+     */
+    void init_shape()
+    {
+        size_t const span = shape_.size();
+        roll_factor = pow(sigma, static_cast<size_t>(shape_.count() - shape_[span - 1]));
+
+        if (bits_per_letter == 0 || span * bits_per_letter > 64)
+            return;
+
+        for (size_t i = 0; i < span; ++i)
+        {
+            if (shape_[i] || i == span - 1)
+                shape_mask |= low_bits(bits_per_letter) << (bits_per_letter * (span - 1 - i));
+        }
+    }
+
+    //!\brief Extracts the ranks of the shape's positions from a window.
+    size_t extract(size_t const window) const noexcept
+    {
+        if ((shape_mask & (shape_mask + 1)) == 0) // ungapped
+            return window;
+
+        return extract_bits(window, shape_mask);
+    }
+
+    //!\brief Computes the hash value of the current window.
+    size_t window_hash() const
+    {
+        size_t const hash = extract(hash_value | right_rank()) ^ hash_seed;
+
+        if constexpr (canonical)
+        {
+            size_t const last = right_complement_rank() << (bits_per_letter * (shape_.size() - 1));
+            return std::min(hash, extract(reverse_hash_value | last) ^ hash_seed);
+        }
+        else
+        {
+            return hash;
+        }
+    }
+
     //!\brief Increments iterator by 1.
     void hash_forward()
     {
-        if (shape_.all())
+        if (shape_mask != 0)
+        {
+            window_roll_forward();
+        }
+        else if (shape_.all())
         {
             hash_roll_forward();
         }
@@ -629,7 +852,11 @@ private:
         requires std::bidirectional_iterator<it_t>
     //!\endcond
     {
-        if (shape_.all())
+        if (shape_mask != 0)
+        {
+            window_roll_backward();
+        }
+        else if (shape_.all())
         {
             hash_roll_backward();
         }
@@ -653,13 +880,30 @@ private:
     //!\brief Calculates a hash value by explicitly looking at each position.
     void hash_full()
     {
+        if (shape_mask != 0)
+            return window_full();
+
+        size_t const span = shape_.size();
+        [[maybe_unused]] size_t reverse_factor{1};
+
         text_right = text_left;
         hash_value = 0;
+        reverse_hash_value = 0;
 
-        for (size_t i{0}; i < shape_.size() - 1u; ++i)
+        for (size_t i{0}; i < span - 1u; ++i)
         {
             hash_value += shape_[i] * to_rank(*text_right);
             hash_value *= shape_[i] ? sigma : 1;
+
+            if constexpr (canonical)
+            {
+                if (shape_[span - 1 - i] || i == 0)
+                {
+                    reverse_hash_value += complement_rank_at(text_right) * reverse_factor;
+                    reverse_factor *= sigma;
+                }
+            }
+
             std::ranges::advance(text_right, 1);
         }
 
@@ -668,6 +912,16 @@ private:
     //!\brief Calculates the next hash value via rolling hash.
     void hash_roll_forward()
     {
+        if constexpr (canonical)
+        {
+            if (shape_.size() > 1)
+            {
+                reverse_hash_value -= complement_rank_at(text_left);
+                reverse_hash_value /= sigma;
+                reverse_hash_value += complement_rank_at(text_right) * (roll_factor / sigma);
+            }
+        }
+
         hash_value -= to_rank(*(text_left)) * roll_factor;
         hash_value += to_rank(*(text_right));
         hash_value *= sigma;
@@ -690,6 +944,117 @@ private:
         hash_value /= sigma;
         hash_value -= to_rank(*(text_right));
         hash_value += to_rank(*(text_left)) * roll_factor;
+
+        if constexpr (canonical)
+        {
+            if (shape_.size() > 1)
+            {
+                reverse_hash_value -= complement_rank_at(text_right) * (roll_factor / sigma);
+                reverse_hash_value *= sigma;
+                reverse_hash_value += complement_rank_at(text_left);
+            }
+        }
+    }
+
+    /*!\brief Fills the window with the ranks of all but the last position of the k-mer.
+     * \details
+     *
+     * For a seqan3::bitcompressed_vector over an alphabet of size 4, the ranks occupy consecutive bits of the packed
+     * storage and are read at once. The first letter is stored in the lowest bits there, so the order of the
+     * 2-bit groups is reversed.
+     */
+    void window_full()
+    {
+        size_t const span = shape_.size();
+
+        text_right = text_left;
+        hash_value = 0;
+        reverse_hash_value = 0;
+
+        if constexpr (is_2bit_packed_iterator_v<it_t> && !canonical)
+        {
+            if (span > 1)
+            {
+                uint64_t const prefix = text_left.host_ptr()->raw_data().get_int(2 * text_left.position(),
+                                                                                 2 * (span - 1));
+                hash_value = reverse_2bit_groups(prefix) >> (64 - 2 * span);
+                text_right = std::ranges::next(text_left, span - 1);
+            }
+        }
+        else
+        {
+            for (size_t i{0}; i < span - 1u; ++i)
+            {
+                hash_value = (hash_value | rank_at(text_right)) << bits_per_letter;
+
+                if constexpr (canonical)
+                    reverse_hash_value |= complement_rank_at(text_right) << (bits_per_letter * i);
+
+                std::ranges::advance(text_right, 1);
+            }
+        }
+
+        load_incoming();
+    }
+
+    /*!\brief Moves the window by one position to the right.
+     * \details For a seqan3::bitcompressed_vector over an alphabet of size 4, the rank of the next letter is shifted
+     *          out of #incoming_ranks, which is read again after 32 letters.
+     */
+    void window_roll_forward()
+    {
+        size_t const span = shape_.size();
+
+        hash_value = ((hash_value | right_rank()) << bits_per_letter) & low_bits(bits_per_letter * span);
+
+        if constexpr (canonical)
+        {
+            if (span > 1)
+            {
+                reverse_hash_value = (reverse_hash_value >> bits_per_letter) |
+                                     (right_complement_rank() << (bits_per_letter * (span - 2)));
+            }
+        }
+
+        std::ranges::advance(text_left,  1);
+        std::ranges::advance(text_right, 1);
+
+        if constexpr (is_2bit_packed_iterator_v<it_t>)
+        {
+            incoming_ranks >>= 2;
+
+            if (--incoming_count == 0)
+                load_incoming();
+        }
+    }
+
+    /*!\brief Moves the window by one position to the left.
+     * \attention This function is only available if `it_t` models std::bidirectional_iterator.
+     */
+    void window_roll_backward()
+    //!\cond
+        requires std::bidirectional_iterator<it_t>
+    //!\endcond
+    {
+        size_t const span = shape_.size();
+
+        std::ranges::advance(text_left,  -1);
+        std::ranges::advance(text_right, -1);
+
+        if (span > 1)
+        {
+            hash_value = ((hash_value >> bits_per_letter) & ~low_bits(bits_per_letter)) |
+                         (rank_at(text_left) << (bits_per_letter * (span - 1)));
+
+            if constexpr (canonical)
+            {
+                reverse_hash_value = ((reverse_hash_value << bits_per_letter) &
+                                      low_bits(bits_per_letter * (span - 1))) |
+                                     complement_rank_at(text_left);
+            }
+        }
+
+        load_incoming(); // moving backwards reads the letters from the new text_right again
     }
 };
 
@@ -702,7 +1067,10 @@ kmer_hash_view(rng_t &&, shape const & shape_) -> kmer_hash_view<std::views::all
 // ---------------------------------------------------------------------------------------------------------------------
 
 //![adaptor_def]
-//!\brief views::kmer_hash's range adaptor object type (non-closure).
+/*!\brief views::kmer_hash's range adaptor object type (non-closure).
+ * \tparam canonical Whether to hash canonical k-mers, see seqan3::views::canonical_kmer_hash.
+ */
+template <bool canonical = false>
 struct kmer_hash_fn
 {
     //!\brief Store the shape and return a range adaptor closure object.
@@ -727,8 +1095,10 @@ struct kmer_hash_fn
             "The range parameter to views::kmer_hash must model std::ranges::forward_range.");
         static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
             "The range parameter to views::kmer_hash must be over elements of seqan3::semialphabet.");
+        static_assert(!canonical || nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+            "The range parameter to views::canonical_kmer_hash must be over elements of seqan3::nucleotide_alphabet.");
 
-        return kmer_hash_view{std::forward<urng_t>(urange), shape_};
+        return kmer_hash_view<std::views::all_t<urng_t>, canonical>{std::forward<urng_t>(urange), shape_};
     }
 };
 //![adaptor_def]
@@ -785,7 +1155,31 @@ namespace seqan3::views
  *
  * \hideinitializer
  */
-inline constexpr auto kmer_hash = detail::kmer_hash_fn{};
+inline constexpr auto kmer_hash = detail::kmer_hash_fn<>{};
+
+/*!\brief               Computes hash values of canonical k-mers for each position of a range via a given shape.
+ * \tparam urng_t       The type of the range being processed. See below for requirements. [template parameter is
+ *                      omitted in pipe notation]
+ * \param[in] urange    The range being processed. [parameter is omitted in pipe notation]
+ * \param[in] shape     The seqan3::shape that determines how to compute the hash value.
+ * \returns             A range of std::size_t where each value is the minimum of the hashes of the resp. k-mer and of
+ *                      its reverse complement. See below for the properties of the returned range.
+ * \ingroup views
+ *
+ * \details
+ *
+ * The hash value at position `i` is the minimum of `(urange | seqan3::views::kmer_hash(shape))[i]` and the hash
+ * value of the reverse complement of the same k-mer, i.e. of the k-mer read from the other strand. Both are computed
+ * in a single pass over `urange`. The reference type of `urange` must model seqan3::nucleotide_alphabet; apart from
+ * that, the requirements and view properties are the same as for seqan3::views::kmer_hash.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/views/canonical_kmer_hash.cpp
+ *
+ * \hideinitializer
+ */
+inline constexpr auto canonical_kmer_hash = detail::kmer_hash_fn<true>{};
 
 //!\}
 
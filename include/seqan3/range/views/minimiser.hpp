@@ -13,7 +13,8 @@
 #pragma once
 
 #include <seqan3/std/algorithm>
-#include <deque>
+#include <seqan3/std/bit>
+#include <vector>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/range/concept.hpp>
@@ -22,6 +23,157 @@
 
 namespace seqan3::detail
 {
+// ---------------------------------------------------------------------------------------------------------------------
+// minimiser_window class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Maintains the minimiser of a window that is shifted over a sequence of values.
+ * \tparam value_t The type of the values, must model std::totally_ordered.
+ * \ingroup views
+ *
+ * \details
+ *
+ * The candidates for the minimum are stored in a ring buffer as a monotone queue: every candidate is strictly
+ * smaller than all values to its right in the window, so the first candidate is the rightmost minimum of the window.
+ * A new value removes all candidates from the back that are not smaller than itself and the first candidate is
+ * removed when it leaves the window. Since every value is added and removed at most once, shifting the window costs
+ * amortised constant time, independent of the window size.
+ *
+ * The minimiser follows the robust winnowing of seqan3::views::minimiser: it only changes if a strictly smaller value
+ * enters the window, or if it leaves the window, in which case the rightmost minimum of the window becomes the new
+ * minimiser.
+ */
+template <std::totally_ordered value_t>
+class minimiser_window
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    minimiser_window() = default; //!< Defaulted.
+    minimiser_window(minimiser_window const &) = default; //!< Defaulted.
+    minimiser_window(minimiser_window &&) = default; //!< Defaulted.
+    minimiser_window & operator=(minimiser_window const &) = default; //!< Defaulted.
+    minimiser_window & operator=(minimiser_window &&) = default; //!< Defaulted.
+    ~minimiser_window() = default; //!< Defaulted.
+
+    /*!\brief Construct an empty window.
+     * \param[in] window_size The number of values in one window.
+     */
+    explicit minimiser_window(size_t const window_size) :
+        candidates(std::bit_ceil(std::max<size_t>(window_size, 1u))),
+        window_size{window_size}
+    {}
+    //!\}
+
+    /*!\brief Adds one of the values of the first window.
+     * \param[in] value The value right of the current values.
+     *
+     * \details
+     *
+     * After the first window has been filled, the minimiser is its rightmost minimum.
+     */
+    void fill(value_t const & value)
+    {
+        push(value);
+        minimiser_value = front().value;
+        minimiser_position = front().position;
+    }
+
+    /*!\brief Shifts the window by one value.
+     * \param[in] value The value that enters the window.
+     * \returns `true` if the minimiser changed, `false` otherwise.
+     */
+    bool shift(value_t const & value)
+    {
+        push(value);
+
+        if (minimiser_position + window_size < next_position) // The minimiser left the window.
+        {
+            minimiser_value = front().value;
+            minimiser_position = front().position;
+            return true;
+        }
+
+        if (value < minimiser_value)
+        {
+            minimiser_value = value;
+            minimiser_position = next_position - 1;
+            return true;
+        }
+
+        return false;
+    }
+
+    //!\brief Returns the minimiser of the window.
+    value_t const & minimiser() const noexcept
+    {
+        return minimiser_value;
+    }
+
+    //!\brief Returns the number of values in one window.
+    size_t size() const noexcept
+    {
+        return window_size;
+    }
+
+private:
+    //!\brief A value of the window together with its position in the sequence.
+    struct candidate
+    {
+        //!\brief The value.
+        value_t value{};
+        //!\brief The position of the value in the sequence.
+        size_t position{};
+    };
+
+    //!\brief The ring buffer of the candidates; its size is a power of two.
+    std::vector<candidate> candidates{};
+    //!\brief The index of the first candidate in the ring buffer.
+    size_t first{};
+    //!\brief The number of candidates.
+    size_t count{};
+
+    //!\brief The number of values in one window.
+    size_t window_size{};
+    //!\brief The position of the next value.
+    size_t next_position{};
+
+    //!\brief The minimiser value.
+    value_t minimiser_value{};
+    //!\brief The position of the minimiser in the sequence.
+    size_t minimiser_position{};
+
+    //!\brief Returns the i-th candidate.
+    candidate & at(size_t const i) noexcept
+    {
+        return candidates[(first + i) & (candidates.size() - 1)];
+    }
+
+    //!\brief Returns the first candidate, i.e. the rightmost minimum of the window.
+    candidate & front() noexcept
+    {
+        return at(0);
+    }
+
+    //!\brief Adds a value to the right of the window and removes the value that leaves the window.
+    void push(value_t const & value)
+    {
+        if (count > 0 && front().position + window_size <= next_position) // The first candidate leaves the window.
+        {
+            first = (first + 1) & (candidates.size() - 1);
+            --count;
+        }
+
+        while (count > 0 && !(at(count - 1).value < value))
+            --count;
+
+        at(count) = candidate{value, next_position};
+        ++count;
+        ++next_position;
+    }
+};
+
 // ---------------------------------------------------------------------------------------------------------------------
 // minimiser_view class
 // ---------------------------------------------------------------------------------------------------------------------
@@ -277,11 +429,10 @@ public:
     //!\cond
         requires const_range
     //!\endcond
-        : minimiser_value{std::move(it.minimiser_value)},
-          urng1_iterator{std::move(it.urng1_iterator)},
+        : urng1_iterator{std::move(it.urng1_iterator)},
           urng1_sentinel{std::move(it.urng1_sentinel)},
           urng2_iterator{std::move(it.urng2_iterator)},
-          window_values{std::move(it.window_values)}
+          window{std::move(it.window)}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -320,8 +471,8 @@ public:
     friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
     {
         return (lhs.urng1_iterator == rhs.urng1_iterator) &&
-               (rhs.urng2_iterator == rhs.urng2_iterator) &&
-               (lhs.window_values.size() == rhs.window_values.size());
+               (lhs.urng2_iterator == rhs.urng2_iterator) &&
+               (lhs.window.size() == rhs.window.size());
     }
 
     //!\brief Compare to another basic_iterator.
@@ -373,16 +524,10 @@ public:
     //!\brief Return the minimiser.
     value_type operator*() const noexcept
     {
-        return minimiser_value;
+        return window.minimiser();
     }
 
 private:
-    //!\brief The minimiser value.
-    value_type minimiser_value{};
-
-    //!\brief The offset relative to the beginning of the window where the minimizer value is found.
-    size_t minimiser_position_offset{};
-
     //!\brief Iterator to the rightmost value of one window.
     urng1_iterator_t urng1_iterator{};
     //!brief Iterator to last element in range.
@@ -390,8 +535,8 @@ private:
     //!\brief Iterator to the rightmost value of one window of the second range.
     urng2_iterator_t urng2_iterator{};
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
-    std::deque<value_type> window_values{};
+    //!\brief The candidates for the minimiser of the current window.
+    minimiser_window<value_type> window{};
 
     //!\brief Increments iterator by 1.
     void next_unique_minimiser()
@@ -422,22 +567,21 @@ private:
         if (window_size == 0u)
             return;
 
+        window = minimiser_window<value_type>{window_size};
+
         for (size_t i = 0u; i < window_size - 1u; ++i)
         {
-            window_values.push_back(window_value());
+            window.fill(window_value());
             advance_window();
         }
-        window_values.push_back(window_value());
-        auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-        minimiser_value = *minimiser_it ;
-        minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+        window.fill(window_value());
     }
 
     /*!\brief Calculates the next minimiser value.
      * \returns True, if new minimiser is found or end is reached. Otherwise returns false.
      * \details
-     * For the following windows, we remove the first window value (is now not in window_values) and add the new
-     * value that results from the window shifting.
+     * For the following windows, the first window value leaves the window and the new value that results from the
+     * window shifting enters it. See seqan3::detail::minimiser_window.
      */
     bool next_minimiser()
     {
@@ -445,28 +589,7 @@ private:
         if (urng1_iterator == urng1_sentinel)
             return true;
 
-        value_type const new_value = window_value();
-
-        window_values.pop_front();
-        window_values.push_back(new_value);
-
-        if (minimiser_position_offset == 0)
-        {
-            auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-            minimiser_value = *minimiser_it ;
-            minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
-            return true;
-        }
-
-        if (new_value < minimiser_value)
-        {
-            minimiser_value = new_value;
-            minimiser_position_offset = window_values.size() - 1;
-            return true;
-        }
-
-        --minimiser_position_offset;
-        return false;
+        return window.shift(window_value());
     }
 };
 
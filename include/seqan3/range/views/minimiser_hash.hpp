@@ -85,18 +85,10 @@ struct minimiser_hash_fn
         if (shape.size() > window_size.get())
             throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
 
-        auto forward_strand = std::forward<urng_t>(urange) | seqan3::views::kmer_hash(shape)
-                                                           | std::views::transform([seed] (uint64_t i)
-                                                                                  {return i ^ seed.get();});
-
-        auto reverse_strand = std::forward<urng_t>(urange) | seqan3::views::complement
-                                                           | std::views::reverse
-                                                           | seqan3::views::kmer_hash(shape)
-                                                           | std::views::transform([seed] (uint64_t i)
-                                                                                  {return i ^ seed.get();})
-                                                           | std::views::reverse;
-
-        return seqan3::detail::minimiser_view(forward_strand, reverse_strand, window_size.get() - shape.size() + 1);
+        // The hashes of both strands are computed in one pass and the smaller one is passed to the minimiser.
+        kmer_hash_view<std::views::all_t<urng_t>, true> hashes{std::forward<urng_t>(urange), shape, seed.get()};
+
+        return seqan3::detail::minimiser_view(std::move(hashes), window_size.get() - shape.size() + 1);
     }
 };
 
@@ -185,3 +177,75 @@ inline constexpr auto minimiser_hash = detail::minimiser_hash_fn{};
 //!\}
 
 } // namespace seqan3::views
+
+namespace seqan3
+{
+
+/*!\brief Writes the minimisers of a sequence to an output iterator.
+ * \ingroup views
+ * \tparam rng_t The type of the sequence; must model std::ranges::viewable_range and std::ranges::forward_range over
+ *               a seqan3::nucleotide_alphabet.
+ * \tparam out_t The type of the output iterator; `size_t` must be writable to it.
+ * \param[in]  sequence    The sequence.
+ * \param[out] out         The beginning of the destination.
+ * \param[in]  shape       The seqan3::shape that determines how to compute the hash value.
+ * \param[in]  window_size The window size to use.
+ * \param[in]  seed        The seed used to skew the hash values. Default: 0x8F3F73B5CF1C9ADE.
+ * \throws std::invalid_argument if the size of the shape is greater than the `window_size`.
+ * \returns The end of the destination.
+ *
+ * \details
+ *
+ * \header_file{seqan3/range/views/minimiser_hash.hpp}
+ *
+ * Writes the same values as `std::ranges::copy(sequence | seqan3::views::minimiser_hash(shape, window_size, seed),
+ * out)`, but without the iterator and sentinel overhead of the view. This is useful to fill a preallocated buffer:
+ * at most one value per k-mer is written, i.e. a buffer of `std::ranges::size(sequence) - shape.size() + 1` values
+ * suffices.
+ */
+template <std::ranges::viewable_range rng_t, std::weakly_incrementable out_t>
+//!\cond
+    requires std::ranges::forward_range<rng_t> &&
+             nucleotide_alphabet<std::ranges::range_reference_t<rng_t>> &&
+             std::indirectly_writable<out_t, size_t>
+//!\endcond
+out_t minimiser_hash_copy(rng_t && sequence,
+                          out_t out,
+                          shape const & shape,
+                          window_size const window_size,
+                          seed const seed = seed{0x8F3F73B5CF1C9ADE})
+{
+    if (shape.size() > window_size.get())
+        throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
+
+    detail::kmer_hash_view<std::views::all_t<rng_t>, true> hashes{std::forward<rng_t>(sequence), shape, seed.get()};
+
+    auto it = std::ranges::begin(hashes);
+    auto const end = std::ranges::end(hashes);
+
+    if (it == end)
+        return out;
+
+    size_t const kmers_per_window = window_size.get() - shape.size() + 1;
+    detail::minimiser_window<size_t> window{kmers_per_window};
+
+    // If the sequence has fewer k-mers than a window, all of them form the only window.
+    for (size_t i = 0; i < kmers_per_window && it != end; ++i, ++it)
+        window.fill(*it);
+
+    *out = window.minimiser();
+    ++out;
+
+    for (; it != end; ++it)
+    {
+        if (window.shift(*it))
+        {
+            *out = window.minimiser();
+            ++out;
+        }
+    }
+
+    return out;
+}
+
+} // namespace seqan3
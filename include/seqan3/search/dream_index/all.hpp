@@ -16,4 +16,5 @@
 
  #pragma once
 
+ #include <seqan3/search/dream_index/emplace_minimisers.hpp>
  #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::emplace_minimisers.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/range/minimiser_hash_parallel.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3
+{
+
+/*!\brief Inserts the minimisers of every sequence of a collection into the bin of the same position in an
+ *        seqan3::interleaved_bloom_filter.
+ * \ingroup submodule_dream_index
+ * \tparam sequences_t The type of the collection; must model std::ranges::input_range over
+ *                     std::ranges::forward_range over a seqan3::nucleotide_alphabet.
+ * \param[in,out] ibf          The uncompressed seqan3::interleaved_bloom_filter.
+ * \param[in]     sequences    The collection of sequences; sequence `i` is inserted into bin `i`.
+ * \param[in]     shape        The seqan3::shape of the k-mers.
+ * \param[in]     window_size  The number of letters of a window.
+ * \param[in]     thread_count The number of threads that compute minimisers; defaults to the number of cores.
+ * \param[in]     seed         The seed that is XORed with the k-mer hashes; defaults to the seed of
+ *                             seqan3::views::minimiser_hash.
+ * \throws std::invalid_argument If the size of the shape is greater than the window size.
+ * \throws std::out_of_range If the collection contains more sequences than `ibf` has bins.
+ *
+ * \details
+ *
+ * \header_file{seqan3/search/dream_index/emplace_minimisers.hpp}
+ *
+ * Has the same effect as calling seqan3::interleaved_bloom_filter::emplace for every value of
+ * `sequence | seqan3::views::minimiser_hash(shape, window_size, seed)` of every sequence, but computes the minimisers
+ * with seqan3::minimiser_hash_parallel.
+ *
+ * Concurrent calls to seqan3::interleaved_bloom_filter::emplace are safe for bins that belong to different blocks of
+ * 64 bins. Hence, the minimisers are inserted by the threads that computed them and only threads that insert into the
+ * same block of 64 bins wait for each other.
+ */
+template <std::ranges::input_range sequences_t>
+//!\cond
+    requires std::ranges::forward_range<std::ranges::range_reference_t<sequences_t>> &&
+             nucleotide_alphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<sequences_t>>>
+//!\endcond
+void emplace_minimisers(interleaved_bloom_filter<data_layout::uncompressed> & ibf,
+                        sequences_t && sequences,
+                        shape const & shape,
+                        window_size const window_size,
+                        size_t const thread_count = std::thread::hardware_concurrency(),
+                        seed const seed = seed{0x8F3F73B5CF1C9ADE})
+{
+    size_t const bin_count = ibf.bin_count();
+    std::vector<std::mutex> block_mutexes((bin_count + 63) / 64);
+
+    auto emplace = [&] (size_t const sequence_index, std::span<size_t const> minimisers)
+    {
+        if (sequence_index >= bin_count)
+            throw std::out_of_range{"The collection contains more sequences than the Interleaved Bloom Filter has "
+                                    "bins."};
+
+        std::lock_guard lock{block_mutexes[sequence_index / 64]};
+
+        for (size_t const value : minimisers)
+            ibf.emplace(value, bin_index{sequence_index});
+    };
+
+    detail::minimiser_hash_parallel(std::forward<sequences_t>(sequences), shape, window_size, seed, thread_count,
+                                    detail::minimiser_hash_chunk_size, emplace);
+}
+
+} // namespace seqan3
@@ -166,6 +166,27 @@ void seqan3_edit_distance_dna4_collection_selector(benchmark::State & state)
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
 }
 
+void seqan3_edit_distance_dna4_collection_vectorised(benchmark::State & state)
+{
+    size_t sequence_length = state.range(0);
+    size_t set_size = 100;
+
+    auto vec = seqan3::test::generate_sequence_pairs<seqan3::dna4>(sequence_length, set_size);
+    int score = 0;
+
+    seqan3::configuration vectorised_cfg = edit_distance_cfg | seqan3::align_cfg::vectorised{};
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, vectorised_cfg))
+            score += rng.score();
+    }
+
+    state.counters["score"] = score;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, edit_distance_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
 #ifdef SEQAN3_HAS_SEQAN2
 void seqan2_edit_distance_dna4_collection(benchmark::State & state)
 {
@@ -224,6 +245,7 @@ BENCHMARK(seqan2_edit_distance_generic_dna4);
 #endif
 BENCHMARK(seqan3_edit_distance_dna4_collection);
 BENCHMARK(seqan3_edit_distance_dna4_collection_selector);
+BENCHMARK(seqan3_edit_distance_dna4_collection_vectorised)->Arg(50)->Arg(150)->Arg(500);
 #ifdef SEQAN3_HAS_SEQAN2
 BENCHMARK(seqan2_edit_distance_dna4_collection);
 BENCHMARK(seqan2_edit_distance_dna4_generic_collection);
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <random>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -252,6 +253,45 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; trace; dna4; many short pairs
+// ============================================================================
+
+// Aligns many short sequence pairs such that the allocation of the alignment matrices becomes visible.
+// The matrix memory is reused between the invocations on the same thread.
+template <typename ...execution_config_t>
+void seqan3_affine_dna4_trace_short_pairs(benchmark::State & state, execution_config_t && ...execution_config)
+{
+    size_t sequence_length = 150;
+    size_t set_size = 10'000;
+    using sequence_t = decltype(seqan3::test::generate_sequence<seqan3::dna4>());
+
+    std::vector<std::pair<sequence_t, sequence_t>> vec;
+    for (unsigned i = 0; i < set_size; ++i)
+    {
+        sequence_t seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, i);
+        sequence_t seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, i + set_size);
+        vec.push_back(std::pair{seq1, seq2});
+    }
+
+    auto const trace_cfg = affine_cfg | seqan3::align_cfg::output_alignment{};
+    auto cfg = (trace_cfg | ... | execution_config);
+
+    for (auto _ : state)
+    {
+        for (auto && rng : align_pairwise(vec, cfg))
+            rng.alignment();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(vec, affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_short_pairs, sequential);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_trace_short_pairs,
+                  parallel,
+                  seqan3::align_cfg::parallel{std::thread::hardware_concurrency()});
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
@@ -12,6 +12,8 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/all.hpp>
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/seqan2.hpp>
 
 #if SEQAN3_HAS_SEQAN2
@@ -61,6 +63,47 @@ BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna4, seqan3::phred42>
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred63>);
 BENCHMARK_TEMPLATE(assign_char, seqan3::qualified<seqan3::dna5, seqan3::phred94>);
 
+/* contiguous ranges */
+template <seqan3::alphabet alphabet_t, bool use_kernel>
+void assign_chars(benchmark::State & state)
+{
+    std::vector<char> chars{};
+    for (alphabet_t const a : seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0))
+        chars.push_back(seqan3::to_char(a));
+
+    std::vector<alphabet_t> letters(chars.size());
+
+    for (auto _ : state)
+    {
+        if constexpr (use_kernel)
+        {
+            seqan3::detail::assign_chars_to(chars.data(), chars.size(), letters.data());
+        }
+        else
+        {
+            for (size_t i = 0; i < chars.size(); ++i)
+                seqan3::assign_char_to(chars[i], letters[i]);
+        }
+
+        benchmark::DoNotOptimize(letters.data());
+    }
+
+    state.counters["bytes_per_second"] = benchmark::Counter(chars.size(),
+                                                            benchmark::Counter::kIsIterationInvariantRate,
+                                                            benchmark::Counter::OneK::kIs1024);
+}
+
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::rna4, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna15, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::dna15, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::phred42, false);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::phred42, true);
+BENCHMARK_TEMPLATE(assign_chars, seqan3::phred94, true);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 void assign_char_seqan2(benchmark::State & state)
@@ -11,6 +11,8 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/all.hpp>
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/seqan2.hpp>
 
 #if SEQAN3_HAS_SEQAN2
@@ -81,6 +83,44 @@ BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna4, seqan3::phred42>);
 BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna5, seqan3::phred63>);
 BENCHMARK_TEMPLATE(to_char, seqan3::qualified<seqan3::dna5, seqan3::phred94>);
 
+/* contiguous ranges */
+template <seqan3::alphabet alphabet_t, bool use_kernel>
+void to_chars(benchmark::State & state)
+{
+    std::vector<alphabet_t> letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    std::vector<char> chars(letters.size());
+
+    for (auto _ : state)
+    {
+        if constexpr (use_kernel)
+        {
+            seqan3::detail::to_chars(letters.data(), letters.size(), chars.data());
+        }
+        else
+        {
+            for (size_t i = 0; i < letters.size(); ++i)
+                chars[i] = seqan3::to_char(letters[i]);
+        }
+
+        benchmark::DoNotOptimize(chars.data());
+    }
+
+    state.counters["bytes_per_second"] = benchmark::Counter(letters.size(),
+                                                            benchmark::Counter::kIsIterationInvariantRate,
+                                                            benchmark::Counter::OneK::kIs1024);
+}
+
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna4, false);
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna4, true);
+BENCHMARK_TEMPLATE(to_chars, seqan3::rna4, true);
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna5, false);
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna5, true);
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna15, false);
+BENCHMARK_TEMPLATE(to_chars, seqan3::dna15, true);
+BENCHMARK_TEMPLATE(to_chars, seqan3::phred42, false);
+BENCHMARK_TEMPLATE(to_chars, seqan3::phred42, true);
+BENCHMARK_TEMPLATE(to_chars, seqan3::phred94, true);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename alphabet_t>
 void to_char_seqan2(benchmark::State & state)
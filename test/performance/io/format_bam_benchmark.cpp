@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/std/filesystem>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#if SEQAN3_HAS_ZLIB
+
+inline constexpr unsigned default_seed = 1234u;
+inline constexpr size_t read_size = 100u; // typical illumina read
+
+using bam_fields = seqan3::fields<seqan3::field::id,
+                                  seqan3::field::seq,
+                                  seqan3::field::qual,
+                                  seqan3::field::ref_id,
+                                  seqan3::field::ref_offset,
+                                  seqan3::field::cigar,
+                                  seqan3::field::mapq>;
+
+// ============================================================================
+// write a BAM file with randomly generated reads
+// ============================================================================
+
+void write_bam_file(std::filesystem::path const & path, size_t const n_queries, int const compression_level)
+{
+    using seqan3::operator""_cigar_op;
+
+    std::vector<std::string> const ref_ids{"reference_id"};
+    std::vector<size_t> const ref_lengths{n_queries + read_size};
+    std::vector<seqan3::cigar> const cigar_vector{seqan3::cigar{static_cast<uint32_t>(read_size), 'M'_cigar_op}};
+
+    seqan3::alignment_file_output fout{path, ref_ids, ref_lengths, bam_fields{}};
+    fout.options.compression_level = compression_level;
+
+    for (size_t i = 0; i < n_queries; ++i)
+    {
+        auto query = seqan3::test::generate_sequence<seqan3::dna5>(read_size, 0, default_seed + i);
+        auto qualities = seqan3::test::generate_sequence<seqan3::phred42>(read_size, 0, default_seed + i);
+
+        fout.emplace_back("query_" + std::to_string(i), query, qualities, 0, static_cast<int32_t>(i), cigar_vector,
+                          static_cast<uint8_t>(60));
+    }
+}
+
+// ============================================================================
+// seqan3
+// ============================================================================
+
+void bam_file_write_to_disk(benchmark::State & state)
+{
+    size_t const n_queries = state.range(0);
+    int const compression_level = state.range(1);
+    seqan3::test::tmp_filename file_name{"tmp.bam"};
+
+    for (auto _ : state)
+        write_bam_file(file_name.get_path(), n_queries, compression_level);
+
+    size_t const bytes_per_run = std::filesystem::file_size(file_name.get_path());
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(bytes_per_run);
+}
+
+void bam_file_read_from_disk(benchmark::State & state)
+{
+    size_t const n_queries = state.range(0);
+    int const compression_level = state.range(1);
+    seqan3::test::tmp_filename file_name{"tmp.bam"};
+
+    write_bam_file(file_name.get_path(), n_queries, compression_level);
+
+    for (auto _ : state)
+    {
+        seqan3::alignment_file_input fin{file_name.get_path(), bam_fields{}};
+
+        // read all records and store in internal buffer
+        auto it = fin.begin();
+        while (it != fin.end())
+            ++it;
+    }
+
+    size_t const bytes_per_run = std::filesystem::file_size(file_name.get_path());
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(bytes_per_run);
+}
+
+#ifndef NDEBUG
+static constexpr size_t query_count{100u};
+#else
+static constexpr size_t query_count{100'000u};
+#endif // NDEBUG
+
+BENCHMARK(bam_file_write_to_disk)->Args({query_count, 0})
+                                 ->Args({query_count, 1})
+                                 ->Args({query_count, 6})
+                                 ->Args({query_count, 9});
+
+BENCHMARK(bam_file_read_from_disk)->Args({query_count, 1})
+                                  ->Args({query_count, 9});
+
+#endif // SEQAN3_HAS_ZLIB
+
+BENCHMARK_MAIN();
@@ -135,6 +135,40 @@ void sam_file_read_from_disk(benchmark::State &state)
     }
 }
 
+// ============================================================================
+// seqan3 read the alignment as gap decorators or as CIGAR operations
+// ============================================================================
+
+struct cigar_alignment_traits : seqan3::alignment_file_input_default_traits<>
+{
+    static constexpr bool alignment_as_cigar = true;
+};
+
+template <typename traits_t>
+void sam_file_read_alignment_from_stream(benchmark::State &state)
+{
+    size_t const n_queries = state.range(0);
+
+    std::istringstream istream{create_sam_file_string(n_queries)};
+
+    using fields_t = seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::offset,
+                                    seqan3::field::ref_offset, seqan3::field::alignment>;
+
+    for (auto _ : state)
+    {
+        istream.clear();
+        istream.seekg(0, std::ios::beg);
+
+        seqan3::alignment_file_input<traits_t, fields_t, seqan3::type_list<seqan3::format_sam>> fin{istream,
+                                                                                                   seqan3::format_sam{}};
+
+        // read all records and store in internal buffer
+        auto it = fin.begin();
+        while (it != fin.end())
+            ++it;
+    }
+}
+
 #if SEQAN3_HAS_SEQAN2
 // ============================================================================
 // seqan2 read from stream
@@ -218,6 +252,10 @@ BENCHMARK(sam_file_read_from_stream)->Arg(high_query_count);
 BENCHMARK(sam_file_read_from_disk)->Arg(low_query_count);
 BENCHMARK(sam_file_read_from_disk)->Arg(high_query_count);
 
+BENCHMARK_TEMPLATE(sam_file_read_alignment_from_stream, seqan3::alignment_file_input_default_traits<>)
+    ->Arg(high_query_count);
+BENCHMARK_TEMPLATE(sam_file_read_alignment_from_stream, cigar_alignment_traits)->Arg(high_query_count);
+
 #if SEQAN3_HAS_SEQAN2
 BENCHMARK(seqan2_sam_file_read_from_stream)->Arg(low_query_count);
 BENCHMARK(seqan2_sam_file_read_from_stream)->Arg(high_query_count);
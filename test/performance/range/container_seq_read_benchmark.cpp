@@ -13,6 +13,7 @@
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/range/container/all.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 
 template <typename t>
@@ -137,6 +138,63 @@ BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::dna15, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::aa27, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::alphabet_variant<char, seqan3::dna4>, true);
 
+// ============================================================================
+//  bulk operations on whole sequences
+// ============================================================================
+
+template <template <typename> typename container_t, typename alphabet_t>
+void subrange_copy(benchmark::State & state)
+{
+    auto cont_rando = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    container_t<alphabet_t> const source(cont_rando.begin(), cont_rando.end());
+
+    for (auto _ : state)
+    {
+        container_t<alphabet_t> target(source.begin() + 3, source.end() - 5);
+        benchmark::DoNotOptimize(target.size());
+    }
+
+    state.counters["alph_size"] = seqan3::alphabet_size<alphabet_t>;
+}
+
+BENCHMARK_TEMPLATE(subrange_copy, std::vector, seqan3::dna4);
+BENCHMARK_TEMPLATE(subrange_copy, std::vector, seqan3::dna15);
+BENCHMARK_TEMPLATE(subrange_copy, seqan3::bitcompressed_vector, seqan3::dna4);
+BENCHMARK_TEMPLATE(subrange_copy, seqan3::bitcompressed_vector, seqan3::dna15);
+
+template <template <typename> typename container_t, typename alphabet_t>
+void lexicographical_compare(benchmark::State & state)
+{
+    auto cont_rando = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    container_t<alphabet_t> const lhs(cont_rando.begin(), cont_rando.end());
+    cont_rando.back() = seqan3::assign_rank_to(0, alphabet_t{});
+    container_t<alphabet_t> const rhs(cont_rando.begin(), cont_rando.end());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(lhs < rhs);
+
+    state.counters["alph_size"] = seqan3::alphabet_size<alphabet_t>;
+}
+
+BENCHMARK_TEMPLATE(lexicographical_compare, std::vector, seqan3::dna4);
+BENCHMARK_TEMPLATE(lexicographical_compare, std::vector, seqan3::dna15);
+BENCHMARK_TEMPLATE(lexicographical_compare, seqan3::bitcompressed_vector, seqan3::dna4);
+BENCHMARK_TEMPLATE(lexicographical_compare, seqan3::bitcompressed_vector, seqan3::dna15);
+
+template <template <typename> typename container_t>
+void kmer_hash(benchmark::State & state)
+{
+    auto cont_rando = seqan3::test::generate_sequence<seqan3::dna4>(10'000, 0, 0);
+    container_t<seqan3::dna4> const source(cont_rando.begin(), cont_rando.end());
+
+    for (auto _ : state)
+        for (size_t hash : source | seqan3::views::kmer_hash(seqan3::ungapped{20}))
+            benchmark::DoNotOptimize(hash);
+}
+
+BENCHMARK_TEMPLATE(kmer_hash, std::vector);
+BENCHMARK_TEMPLATE(kmer_hash, seqan3::bitcompressed_vector);
+
 // ============================================================================
 //  run
 // ============================================================================
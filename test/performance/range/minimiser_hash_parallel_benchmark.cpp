@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/minimiser_hash_parallel.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/search/dream_index/emplace_minimisers.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+inline constexpr size_t letter_count = 16'000'000;
+
+inline seqan3::shape const benchmark_shape{seqan3::ungapped{19}};
+inline seqan3::window_size const benchmark_window_size{23};
+
+// A single chromosome or many reads of 150 letters.
+enum class collection_tag
+{
+    chromosome,
+    reads
+};
+
+template <collection_tag tag>
+seqan3::concatenated_sequences<seqan3::dna4_vector> const & collection()
+{
+    static seqan3::concatenated_sequences<seqan3::dna4_vector> const sequences = [] ()
+    {
+        seqan3::concatenated_sequences<seqan3::dna4_vector> result{};
+        size_t const sequence_length = tag == collection_tag::chromosome ? letter_count : 150;
+
+        for (size_t i = 0; i < letter_count / sequence_length; ++i)
+            result.push_back(seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, i));
+
+        return result;
+    }();
+
+    return sequences;
+}
+
+// Thread counts 1, 2, 4, ... up to the number of cores.
+void thread_counts(benchmark::internal::Benchmark * benchmark)
+{
+    size_t const core_count = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+
+    for (size_t thread_count = 1; thread_count < core_count; thread_count *= 2)
+        benchmark->Arg(thread_count);
+
+    benchmark->Arg(core_count);
+}
+
+// ============================================================================
+//  sequential
+// ============================================================================
+
+template <collection_tag tag>
+void sequential(benchmark::State & state)
+{
+    auto const & sequences = collection<tag>();
+    std::vector<size_t> minimisers(std::ranges::size(sequences[0]));
+    size_t count{};
+
+    for (auto _ : state)
+    {
+        count = 0;
+
+        for (auto const & sequence : sequences)
+        {
+            auto end = seqan3::minimiser_hash_copy(sequence, minimisers.begin(), benchmark_shape,
+                                                   benchmark_window_size);
+            count += end - minimisers.begin();
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * letter_count);
+    state.counters["minimisers"] = count;
+}
+
+BENCHMARK_TEMPLATE(sequential, collection_tag::chromosome);
+BENCHMARK_TEMPLATE(sequential, collection_tag::reads);
+
+// ============================================================================
+//  parallel (scaling with the number of threads)
+// ============================================================================
+
+template <collection_tag tag>
+void parallel(benchmark::State & state)
+{
+    auto const & sequences = collection<tag>();
+    size_t const thread_count = state.range(0);
+    size_t count{};
+
+    for (auto _ : state)
+    {
+        count = 0;
+
+        seqan3::minimiser_hash_parallel(sequences, benchmark_shape, benchmark_window_size,
+                                        [&count] (size_t const, std::span<size_t const> minimisers)
+        {
+            count += minimisers.size();
+        }, thread_count);
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetBytesProcessed(state.iterations() * letter_count);
+    state.counters["minimisers"] = count;
+}
+
+BENCHMARK_TEMPLATE(parallel, collection_tag::chromosome)->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(parallel, collection_tag::reads)->Apply(thread_counts)->UseRealTime();
+
+// ============================================================================
+//  emplace into an Interleaved Bloom Filter with one bin per read
+// ============================================================================
+
+void emplace_minimisers(benchmark::State & state)
+{
+    auto const & sequences = collection<collection_tag::reads>();
+    size_t const thread_count = state.range(0);
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{std::ranges::size(sequences)},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{2u}};
+
+    for (auto _ : state)
+    {
+        seqan3::emplace_minimisers(ibf, sequences, benchmark_shape, benchmark_window_size, thread_count);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * letter_count);
+}
+
+BENCHMARK(emplace_minimisers)->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/reverse_complement.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// ============================================================================
+//  in_place
+// ============================================================================
+
+template <typename container_t>
+void in_place(benchmark::State & state)
+{
+    using alphabet_t = std::ranges::range_value_t<container_t>;
+
+    auto const sequence = seqan3::test::generate_sequence<alphabet_t>(state.range(0));
+    container_t container(sequence.begin(), sequence.end());
+
+    for (auto _ : state)
+    {
+        seqan3::reverse_complement(container);
+        benchmark::DoNotOptimize(container.size());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(in_place, std::vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(in_place, std::vector<seqan3::dna5>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(in_place, seqan3::bitcompressed_vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(in_place, seqan3::bitcompressed_vector<seqan3::dna5>)->Arg(1'000)->Arg(1'000'000);
+
+// ============================================================================
+//  copy (compared to the views)
+// ============================================================================
+
+template <typename alphabet_t, bool use_views>
+void copy(benchmark::State & state)
+{
+    auto const sequence = seqan3::test::generate_sequence<alphabet_t>(state.range(0));
+    std::vector<alphabet_t> target(sequence.size());
+
+    for (auto _ : state)
+    {
+        if constexpr (use_views)
+            std::ranges::copy(sequence | std::views::reverse | seqan3::views::complement, target.begin());
+        else
+            seqan3::reverse_complement_copy(sequence, target.begin());
+
+        benchmark::DoNotOptimize(target.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(copy, seqan3::dna4, true)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(copy, seqan3::dna4, false)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(copy, seqan3::dna5, true)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(copy, seqan3::dna5, false)->Arg(1'000)->Arg(1'000'000);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <numeric>
+
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/minimiser_hash.hpp>
 #include <seqan3/test/performance/naive_minimiser_hash.hpp>
@@ -43,7 +45,7 @@ static void arguments(benchmark::internal::Benchmark* b)
     {
         for (int32_t k : {8, /*16, 24,*/ 30})
         {
-            for (int32_t w : {k + 5, k + 20})
+            for (int32_t w : {k + 5, k + 20, k + 100})
             {
                 b->Args({sequence_length, k, w});
             }
@@ -55,6 +57,7 @@ enum class method_tag
 {
     seqan3_ungapped,
     seqan3_gapped,
+    seqan3_ungapped_copy,
     naive,
     seqan2_ungapped,
     seqan2_gapped
@@ -84,6 +87,7 @@ void compute_minimisers(benchmark::State & state)
     assert(k > 0);
     assert(w > k);
     auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    std::vector<size_t> buffer(sequence_length);
 
     size_t sum{0};
 
@@ -104,6 +108,14 @@ void compute_minimisers(benchmark::State & state)
             for (auto h : seq | seqan3::views::minimiser_hash(make_gapped_shape(k), seqan3::window_size{w}))
                 benchmark::DoNotOptimize(sum += h);
         }
+        else if constexpr (tag == method_tag::seqan3_ungapped_copy)
+        {
+            auto buffer_end = seqan3::minimiser_hash_copy(seq,
+                                                          buffer.begin(),
+                                                          seqan3::ungapped{static_cast<uint8_t>(k)},
+                                                          seqan3::window_size{w});
+            benchmark::DoNotOptimize(sum += std::accumulate(buffer.begin(), buffer_end, size_t{0}));
+        }
         #ifdef SEQAN3_HAS_SEQAN2
         else
         {
@@ -169,6 +181,7 @@ BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan2_gapped)->Apply(argumen
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::naive)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan3_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan3_gapped)->Apply(arguments);
+BENCHMARK_TEMPLATE(compute_minimisers, method_tag::seqan3_ungapped_copy)->Apply(arguments);
 
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_ungapped)->Apply(arguments);
 BENCHMARK_TEMPLATE(compute_minimisers_on_poly_A_sequence, method_tag::seqan3_gapped)->Apply(arguments);
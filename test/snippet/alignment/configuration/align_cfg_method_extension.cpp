@@ -0,0 +1,44 @@
+#include <seqan3/std/ranges>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    auto config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{10}} |
+                  seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{2},
+                                                                                      seqan3::mismatch_score{-3}}} |
+                  seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-5},
+                                                     seqan3::align_cfg::extension_score{-2}} |
+                  seqan3::align_cfg::output_score{} |
+                  seqan3::align_cfg::output_end_position{};
+
+    auto query = "TTACGTTAGCATGCATCGGATTTTTT"_dna4;
+    auto reference = "GGGACGTAGCATGCATCGGAGGGGG"_dna4;
+
+    // A seed of length 6 starts at position 9 in both sequences ("CATGCA").
+    size_t const seed_begin = 9;
+    size_t const seed_end = seed_begin + 6;
+
+    // Extend to the right, starting directly behind the seed.
+    auto right_query = query | std::views::drop(seed_end);
+    auto right_reference = reference | std::views::drop(seed_end);
+
+    for (auto const & res : seqan3::align_pairwise(std::tie(right_query, right_reference), config))
+        seqan3::debug_stream << "right: score " << res.score() << " end " << res.sequence1_end_position() << '\n';
+
+    // Extend to the left by aligning the reversed prefixes in front of the seed.
+    auto left_query = query | std::views::take(seed_begin) | std::views::reverse;
+    auto left_reference = reference | std::views::take(seed_begin) | std::views::reverse;
+
+    for (auto const & res : seqan3::align_pairwise(std::tie(left_query, left_reference), config))
+        seqan3::debug_stream << "left: score " << res.score() << " end " << res.sequence1_end_position() << '\n';
+}
@@ -0,0 +1,10 @@
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_trace_memory_limit.hpp>
+
+int main()
+{
+    // Use at most 1 GiB for the trace matrix of a single alignment.
+    // Larger alignments are computed in linear memory using a divide-and-conquer strategy.
+    seqan3::configuration config = seqan3::align_cfg::method_global{} |
+                                   seqan3::align_cfg::trace_memory_limit{1ull << 30};
+}
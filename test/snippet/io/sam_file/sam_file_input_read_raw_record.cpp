@@ -0,0 +1,36 @@
+#include <sstream>
+
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*
+r002	0	ref	29	10	5S6M	*	0	0	GCCTAAGCTAA	*
+r003	0	ref	37	30	9M	=	7	-39	CAGCGGCAT	*
+)";
+
+int main()
+{
+    auto bam_file = std::filesystem::temp_directory_path() / "my.bam";
+    auto filtered_file = std::filesystem::temp_directory_path() / "my_filtered.bam";
+
+    // Convert the SAM file to BAM.
+    seqan3::alignment_file_input{std::istringstream{sam_file_raw}, seqan3::format_sam{}}
+        | seqan3::alignment_file_output{bam_file};
+
+    {
+        seqan3::alignment_file_input fin{bam_file};
+        seqan3::alignment_file_output fout{filtered_file};
+
+        // Only the mapping quality is decoded; the bytes of r001 and r003 are copied to the output file unchanged.
+        decltype(fin)::raw_record_type record{};
+        while (fin.read_raw_record(record))
+            if (record.mapq() >= 30)
+                fout.push_back(record);
+    }
+
+    std::filesystem::remove(bam_file);
+    std::filesystem::remove(filtered_file);
+}
@@ -0,0 +1,42 @@
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+
+using seqan3::operator""_dna4;
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*
+r002	0	ref	29	30	5S6M	*	0	0	GCCTAAGCTAA	*
+r003	0	ref	37	30	9M	=	7	-39	CAGCGGCAT	*
+)";
+
+int main()
+{
+    auto bam_file = std::filesystem::temp_directory_path() / "my.bam";
+
+    std::vector<std::string> ref_ids{"ref"};
+    std::vector<seqan3::dna4_vector> ref_seqs{"AGAGTTCGAGATCGAGGACTAGCGACGAGGCAGCGAGCGATCGAT"_dna4};
+
+    {
+        // Convert the SAM file to BAM; the index my.bam.bai is written when the file is closed.
+        seqan3::alignment_file_output fout{bam_file};
+        fout.options.write_bam_index = true;
+
+        seqan3::alignment_file_input{std::istringstream{sam_file_raw}, ref_ids, ref_seqs, seqan3::format_sam{}} | fout;
+    }
+
+    seqan3::alignment_file_input fin{bam_file};
+
+    // Only the records that overlap the positions [20, 30) of the first reference sequence are read.
+    for (auto & record : fin.region(0, 20, 30))
+        seqan3::debug_stream << seqan3::get<seqan3::field::id>(record) << '\n'; // prints r001 and r002
+
+    std::filesystem::remove(bam_file);
+    std::filesystem::remove(bam_file.string() + ".bai");
+}
@@ -0,0 +1,41 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+
+using seqan3::operator""_dna5;
+
+int main()
+{
+    using record_type = seqan3::record<seqan3::type_list<std::string, seqan3::dna5_vector>,
+                                       seqan3::fields<seqan3::field::id, seqan3::field::seq>>;
+
+    seqan3::alignment_file_output fout{std::cout, seqan3::format_sam{},
+                                       seqan3::fields<seqan3::field::id, seqan3::field::seq>{}};
+
+    // Every thread encodes its own batches; the batches are written in the order of their indices.
+    auto produce = [&fout] (size_t const batch_index)
+    {
+        std::vector<record_type> batch{};
+
+        for (size_t i = 0; i < 2; ++i)
+            batch.emplace_back("read" + std::to_string(2 * batch_index + i), "ACGT"_dna5);
+
+        fout.push_back_batch(batch, batch_index);
+    };
+
+    std::thread second{produce, 1};
+    std::thread first{produce, 0};
+
+    second.join();
+    first.join();
+}
+
+// prints:
+// read0	0	*	0	0	*	*	0	0	ACGT	*
+// read1	0	*	0	0	*	*	0	0	ACGT	*
+// read2	0	*	0	0	*	*	0	0	ACGT	*
+// read3	0	*	0	0	*	*	0	0	ACGT	*
@@ -0,0 +1,33 @@
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    auto tmp_file = std::filesystem::temp_directory_path() / "sorted.bam";
+
+    std::vector<std::string> ref_ids{"chr1", "chr2"};
+    std::vector<size_t> ref_lengths{1234, 5678};
+
+    {
+        seqan3::alignment_file_output fout{tmp_file, ref_ids, ref_lengths,
+                                           seqan3::fields<seqan3::field::id,
+                                                          seqan3::field::ref_id,
+                                                          seqan3::field::ref_offset>{}};
+
+        // sort by coordinate, using at most 64 MiB for the records in memory, and write tmp_file.bai at the end
+        fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+        fout.options.sort_memory_limit = 64 * 1024 * 1024;
+        fout.options.write_bam_index = true;
+
+        fout.emplace_back("read1", std::optional<int32_t>{1}, std::optional<int32_t>{200});
+        fout.emplace_back("read2", std::optional<int32_t>{0}, std::optional<int32_t>{500});
+        fout.emplace_back("read3", std::optional<int32_t>{0}, std::optional<int32_t>{100});
+    } // the records are written in the order read3, read2, read1 when the file is closed
+
+    std::filesystem::remove(tmp_file);
+    std::filesystem::remove(tmp_file.string() + ".bai");
+}
@@ -0,0 +1,44 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
+
+auto sam_file_raw = R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:45
+r001	99	ref	7	30	8M2I4M1D3M	=	37	39	TTAGATAAAGGATACTG	*	NM:i:3	RG:Z:group1
+r002	0	ref	29	30	5S6M	*	0	0	GCCTAAGCTAA	*	NM:i:0
+)";
+
+// Read field::tags into a seqan3::sam_tag_buffer instead of a seqan3::sam_tag_dictionary.
+struct my_traits : seqan3::alignment_file_input_default_traits<>
+{
+    static constexpr bool tags_as_buffer = true;
+};
+
+int main()
+{
+    using seqan3::operator""_tag;
+
+    seqan3::alignment_file_input<my_traits, seqan3::fields<seqan3::field::id, seqan3::field::tags>,
+                                 seqan3::type_list<seqan3::format_sam>> fin{std::istringstream{sam_file_raw},
+                                                                            seqan3::format_sam{}};
+
+    for (auto & [id, tags] : fin)
+    {
+        seqan3::debug_stream << id << ": NM=" << tags.get<"NM"_tag>(); // the value is decoded on access
+
+        if (tags.contains("RG"_tag))
+            seqan3::debug_stream << " RG=" << tags.get<"RG"_tag>(); // a std::string_view into the buffer
+
+        seqan3::debug_stream << '\n';
+    }
+
+    seqan3::sam_tag_buffer buffer{};
+    buffer.set("NM"_tag, 2);
+    buffer.set("XA"_tag, std::vector<uint16_t>{1, 2, 3});
+    buffer.erase("NM"_tag);
+
+    seqan3::debug_stream << buffer.size() << '\n';                          // prints 1
+    seqan3::debug_stream << buffer.to_dictionary().count("XA"_tag) << '\n'; // prints 1
+}
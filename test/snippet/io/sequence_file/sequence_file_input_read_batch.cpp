@@ -0,0 +1,25 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(> TEST1
+ACGT
+> Test2
+AGGCTGA
+> Test3
+GGAGTATAATATATATATATATAT)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    // The batch is reused by every call, so no memory is allocated once it has grown large enough.
+    for (auto & batch = fin.read_batch(2); !batch.empty(); fin.read_batch(2))
+    {
+        seqan3::debug_stream << "Batch of " << batch.size() << " records\n";
+
+        for (size_t i = 0; i < batch.size(); ++i)
+            seqan3::debug_stream << batch.ids[i] << ": " << batch.sequences[i] << '\n';
+    }
+}
@@ -0,0 +1,30 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(@TEST1
+ACGT
++
+##!#
+@Test2
+AGGCTGA
++
+##!#!!!
+)";
+
+int main()
+{
+    using seqan3::get;
+
+    seqan3::sequence_file_input<seqan3::sequence_file_input_view_traits_dna> fin{std::istringstream{input},
+                                                                                seqan3::format_fastq{}};
+
+    for (auto & rec : fin)
+    {
+        // The ID is a std::string_view and the sequence is converted to seqan3::dna5 while it is printed.
+        // Both are only valid until the next record is read.
+        seqan3::debug_stream << "ID:  " << get<seqan3::field::id>(rec) << '\n';
+        seqan3::debug_stream << "SEQ: " << get<seqan3::field::seq>(rec) << '\n';
+    }
+}
@@ -0,0 +1,32 @@
+#include <sstream>
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/minimiser_hash_parallel.hpp>
+#include <seqan3/range/views/get.hpp>
+
+auto input = R"(>seq1
+ACGTAGCTAGCTAGCATCGACTGACTAGCTAGCTAGCTAGCAT
+>seq2
+GGAGTATAATATATATATATATATACGATCGATCGAC
+>seq3
+TTTTACGATCGATCGATTTTTTTTTTAGCTAGC)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+    std::vector<size_t> minimiser_count(3);
+
+    // The records are read by this thread, the minimisers are computed by four threads.
+    // The sink is never invoked concurrently.
+    seqan3::minimiser_hash_parallel(fin | seqan3::views::get<seqan3::field::seq>,
+                                    seqan3::ungapped{4},
+                                    seqan3::window_size{8},
+                                    [&] (size_t const sequence_index, std::span<size_t const> minimisers)
+    {
+        minimiser_count[sequence_index] += minimisers.size();
+    }, 4u);
+
+    seqan3::debug_stream << minimiser_count << '\n';
+}
@@ -0,0 +1,25 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/reverse_complement.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+    using seqan3::operator""_dna5;
+
+    seqan3::dna5_vector sequence{"ACGTAN"_dna5};
+    seqan3::reverse_complement(sequence);
+    seqan3::debug_stream << sequence << '\n'; // NTACGT
+
+    // bit-compressed dna4 is reverse-complemented on its packed words
+    seqan3::bitcompressed_vector<seqan3::dna4> packed{"AACGT"_dna4};
+    seqan3::reverse_complement(packed);
+    seqan3::debug_stream << packed << '\n'; // ACGTT
+
+    // write the reverse complement to another container and keep the original
+    seqan3::dna5_vector copy(sequence.size());
+    seqan3::reverse_complement_copy(sequence, copy.begin());
+    seqan3::debug_stream << copy << '\n'; // ACGTAN
+}
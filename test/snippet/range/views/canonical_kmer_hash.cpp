@@ -0,0 +1,16 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+int main()
+{
+    std::vector<seqan3::dna4> text{"ACGTAGC"_dna4};
+
+    // The reverse complements of the k-mers are CGT, ACG, TAC, CTA and GCT.
+    seqan3::debug_stream << (text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3})) << '\n'; // [6,6,44,28,9]
+
+    seqan3::debug_stream << (text | seqan3::views::canonical_kmer_hash(0b101_shape)) << '\n'; // [2,2,8,4,1]
+}
@@ -17,6 +17,7 @@
 #include <seqan3/alignment/configuration/align_config_parallel.hpp>
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_trace_memory_limit.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 
@@ -29,10 +30,12 @@ using alignment_result_t = seqan3::alignment_result<seqan3::detail::alignment_re
 using test_types = ::testing::Types<seqan3::align_cfg::band_fixed_size,
                                     seqan3::align_cfg::gap_cost_affine,
                                     seqan3::align_cfg::min_score,
+                                    seqan3::align_cfg::method_extension,
                                     seqan3::align_cfg::method_global,
                                     seqan3::align_cfg::method_local,
                                     seqan3::align_cfg::parallel,
                                     seqan3::align_cfg::scoring_scheme<seqan3::nucleotide_scoring_scheme<int8_t>>,
+                                    seqan3::align_cfg::trace_memory_limit,
                                     seqan3::align_cfg::vectorised,
                                     seqan3::align_cfg::detail::result_type<alignment_result_t>,
                                     seqan3::align_cfg::detail::debug>;
@@ -60,7 +63,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to seqan3::align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 18);
+    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 20);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
@@ -19,7 +20,8 @@
 // ---------------------------------------------------------------------------------------------------------------------
 
 using config_element_types = ::testing::Types<seqan3::align_cfg::method_global,
-                                              seqan3::align_cfg::method_local>;
+                                              seqan3::align_cfg::method_local,
+                                              seqan3::align_cfg::method_extension>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(method, pipeable_config_element_test, config_element_types, );
 
@@ -43,3 +45,46 @@ TEST(method_global, access_member_variables)
     EXPECT_TRUE(opt.free_end_gaps_sequence1_trailing);
     EXPECT_TRUE(opt.free_end_gaps_sequence2_trailing);
 }
+
+TEST(method_extension, access_member_variables)
+{
+    seqan3::align_cfg::method_extension opt{}; // default construction
+
+    EXPECT_EQ(opt.x_drop, std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(opt.z_drop, std::numeric_limits<int32_t>::max());
+    EXPECT_TRUE(opt.gapped_extension);
+
+    opt.x_drop = 20;
+    opt.z_drop = 15;
+    opt.gapped_extension = false;
+
+    EXPECT_EQ(opt.x_drop, 20);
+    EXPECT_EQ(opt.z_drop, 15);
+    EXPECT_FALSE(opt.gapped_extension);
+}
+
+TEST(method_extension, construct_with_strong_types)
+{
+    seqan3::align_cfg::method_extension gapped{seqan3::align_cfg::x_drop{30}};
+
+    EXPECT_EQ(gapped.x_drop, 30);
+    EXPECT_TRUE(gapped.gapped_extension);
+
+    seqan3::align_cfg::method_extension ungapped{seqan3::align_cfg::x_drop{10},
+                                                 seqan3::align_cfg::gapped_extension{false}};
+
+    EXPECT_EQ(ungapped.x_drop, 10);
+    EXPECT_FALSE(ungapped.gapped_extension);
+
+    seqan3::align_cfg::method_extension z_drop{seqan3::align_cfg::z_drop{40}};
+
+    EXPECT_EQ(z_drop.x_drop, std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(z_drop.z_drop, 40);
+    EXPECT_TRUE(z_drop.gapped_extension);
+
+    seqan3::align_cfg::method_extension ungapped_z_drop{seqan3::align_cfg::z_drop{25},
+                                                        seqan3::align_cfg::gapped_extension{false}};
+
+    EXPECT_EQ(ungapped_z_drop.z_drop, 25);
+    EXPECT_FALSE(ungapped_z_drop.gapped_extension);
+}
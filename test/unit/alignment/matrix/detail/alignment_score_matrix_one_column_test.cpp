@@ -101,3 +101,30 @@ struct iterator_fixture<inner_iterator> : alignment_matrix_base_test<test_type>
 INSTANTIATE_TYPED_TEST_SUITE_P(score_matrix_inner_iterator,
                                iterator_fixture,
                                inner_iterator, );
+
+TEST(alignment_score_matrix_one_column, resize)
+{
+    seqan3::detail::alignment_score_matrix_one_column<int32_t> matrix{std::string{"acgtacgt"},
+                                                                      std::string{"acgtacgt"},
+                                                                      -100};
+
+    // Shrinking the matrix reinitialises all cells with the new initial value.
+    matrix.resize(std::string{"acg"}, std::string{"ac"}, 5);
+
+    EXPECT_EQ(std::ranges::distance(matrix), 4);
+
+    auto column = *matrix.begin();
+    EXPECT_EQ(std::ranges::distance(column), 3);
+    for (auto && cell : column)
+        EXPECT_EQ(cell.current, 5);
+
+    // Growing the matrix again.
+    matrix.resize(std::string{"acgtacgtacgt"}, std::string{"acgtacgtacgt"});
+
+    EXPECT_EQ(std::ranges::distance(matrix), 13);
+
+    auto large_column = *matrix.begin();
+    EXPECT_EQ(std::ranges::distance(large_column), 13);
+    for (auto && cell : large_column)
+        EXPECT_EQ(cell.current, 0);
+}
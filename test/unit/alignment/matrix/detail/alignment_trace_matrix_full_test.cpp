@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -130,3 +131,27 @@ TEST(trace_matrix, trace_path)
 
     EXPECT_TRUE(path.empty());
 }
+
+TEST(trace_matrix, resize)
+{
+    using seqan3::detail::trace_directions;
+
+    seqan3::detail::alignment_trace_matrix_full<trace_directions> matrix{"acgtacgt", "acgtacgt"};
+
+    for (auto && cell : *matrix.begin())
+        cell.current = trace_directions::diagonal;
+
+    // Resizing reuses the memory but resets all traces.
+    matrix.resize(std::string{"acg"}, std::string{"ac"});
+
+    EXPECT_EQ(std::ranges::distance(matrix), 4);
+
+    auto column = *matrix.begin();
+    EXPECT_EQ(std::ranges::distance(column), 3);
+    for (auto && cell : column)
+        EXPECT_EQ(cell.current, trace_directions::none);
+
+    EXPECT_THROW((matrix.trace_path(seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{3u},
+                                                                      seqan3::detail::column_index_type{3u}})),
+                 std::invalid_argument);
+}
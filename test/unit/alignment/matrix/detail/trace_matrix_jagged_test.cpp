@@ -0,0 +1,105 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/trace_matrix_jagged.hpp>
+
+using seqan3::operator|;
+
+struct trace_matrix_jagged_test : public ::testing::Test
+{
+    static constexpr seqan3::detail::trace_directions N = seqan3::detail::trace_directions::none;
+    static constexpr seqan3::detail::trace_directions D = seqan3::detail::trace_directions::diagonal;
+    static constexpr seqan3::detail::trace_directions U = seqan3::detail::trace_directions::up;
+    static constexpr seqan3::detail::trace_directions L = seqan3::detail::trace_directions::left;
+    static constexpr seqan3::detail::trace_directions UO = seqan3::detail::trace_directions::up_open;
+    static constexpr seqan3::detail::trace_directions LO = seqan3::detail::trace_directions::left_open;
+
+    seqan3::detail::trace_matrix_jagged matrix{};
+
+    // Stores the following cells, where '.' marks cells that are not stored:
+    //    0      1      2      3
+    // 0  N      L|LO   L      .
+    // 1  U|UO   D      D      .
+    // 2  .      U|UO   L|LO   .
+    // 3  .      .      L|LO   D
+    void SetUp()
+    {
+        matrix.add_column(0);
+        matrix.push_back(N);
+        matrix.push_back(U | UO);
+
+        matrix.add_column(0);
+        matrix.push_back(L | LO);
+        matrix.push_back(D);
+        matrix.push_back(U | UO);
+
+        matrix.add_column(0);
+        matrix.push_back(L);
+        matrix.push_back(D);
+        matrix.push_back(L | LO);
+        matrix.push_back(L | LO);
+
+        matrix.add_column(3);
+        matrix.push_back(D);
+    }
+
+    static seqan3::detail::matrix_coordinate coordinate(size_t const row, size_t const col)
+    {
+        return seqan3::detail::matrix_coordinate{seqan3::detail::row_index_type{row},
+                                                 seqan3::detail::column_index_type{col}};
+    }
+};
+
+TEST_F(trace_matrix_jagged_test, at)
+{
+    EXPECT_EQ(matrix.at(coordinate(0, 0)), N);
+    EXPECT_EQ(matrix.at(coordinate(1, 0)), U | UO);
+    EXPECT_EQ(matrix.at(coordinate(2, 0)), N);
+    EXPECT_EQ(matrix.at(coordinate(2, 1)), U | UO);
+    EXPECT_EQ(matrix.at(coordinate(3, 2)), L | LO);
+    EXPECT_EQ(matrix.at(coordinate(0, 3)), N);
+    EXPECT_EQ(matrix.at(coordinate(3, 3)), D);
+    EXPECT_EQ(matrix.at(coordinate(4, 3)), N);
+    EXPECT_EQ(matrix.at(coordinate(0, 4)), N);
+}
+
+TEST_F(trace_matrix_jagged_test, trace_path)
+{
+    std::vector<seqan3::detail::trace_directions> path{};
+    for (auto direction : matrix.trace_path(coordinate(3, 3)))
+        path.push_back(direction);
+
+    EXPECT_EQ(path, (std::vector{D, L, U, D}));
+
+    path.clear();
+    for (auto direction : matrix.trace_path(coordinate(0, 2)))
+        path.push_back(direction);
+
+    EXPECT_EQ(path, (std::vector{L, L}));
+}
+
+TEST_F(trace_matrix_jagged_test, trace_path_origin)
+{
+    auto path = matrix.trace_path(coordinate(0, 0));
+    EXPECT_TRUE(path.begin() == path.end());
+}
+
+TEST_F(trace_matrix_jagged_test, trace_path_invalid_coordinate)
+{
+    EXPECT_THROW(matrix.trace_path(coordinate(0, 3)), std::invalid_argument);
+    EXPECT_THROW(matrix.trace_path(coordinate(5, 5)), std::invalid_argument);
+}
+
+TEST_F(trace_matrix_jagged_test, clear)
+{
+    matrix.clear();
+    EXPECT_EQ(matrix.at(coordinate(1, 0)), N);
+}
@@ -113,7 +113,7 @@ TEST(alignment_configurator, configure_affine_global)
     EXPECT_EQ(run_test(cfg).score(), 0);
 }
 
-TEST(alignment_configurator, configure_affine_global_max_error)
+TEST(alignment_configurator, configure_affine_global_min_score)
 {
     auto cfg = seqan3::align_cfg::method_global{} |
                seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
@@ -121,7 +121,7 @@ TEST(alignment_configurator, configure_affine_global_max_error)
                seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
                seqan3::align_cfg::min_score{-5};
 
-    EXPECT_THROW(run_test(cfg), seqan3::invalid_alignment_configuration);
+    EXPECT_EQ(run_test(cfg).score(), 0);
 }
 
 TEST(alignment_configurator, configure_affine_global_end_position)
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+// The vectorised edit distance must compute the same scores and end positions as the scalar edit distance.
+struct edit_distance_unbanded_simd_test : public ::testing::Test
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequence_pairs{};
+
+    void SetUp()
+    {
+        std::mt19937_64 engine{42};
+        std::uniform_int_distribution<uint8_t> rank_distribution{0, 3};
+
+        auto generate = [&] (size_t const size)
+        {
+            seqan3::dna4_vector sequence(size);
+            for (auto & symbol : sequence)
+                symbol.assign_rank(rank_distribution(engine));
+            return sequence;
+        };
+
+        // Different lengths, including empty sequences and queries that span several machine words.
+        std::vector<size_t> const sizes{0, 1, 7, 33, 63, 64, 65, 100, 150, 200};
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            for (size_t j = 0; j < sizes.size(); ++j)
+            {
+                seqan3::dna4_vector database = generate(sizes[i]);
+                seqan3::dna4_vector query = generate(sizes[j]);
+
+                // Make every second query similar to the database to get small edit distances.
+                if ((i + j) % 2 == 0)
+                {
+                    query = database;
+                    for (size_t k = 0; k < query.size(); k += 17)
+                        query[k] = seqan3::dna4{}.assign_rank((query[k].to_rank() + 1) % 4);
+                }
+
+                sequence_pairs.emplace_back(std::move(database), std::move(query));
+            }
+        }
+    }
+
+    template <typename config_t>
+    void expect_same_results(config_t const & config)
+    {
+        using result_t = std::ranges::range_value_t<decltype(seqan3::align_pairwise(sequence_pairs, config))>;
+
+        std::vector<result_t> scalar_results{};
+        for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+            scalar_results.push_back(std::move(result));
+
+        std::vector<result_t> simd_results{};
+        for (auto && result : seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{}))
+            simd_results.push_back(std::move(result));
+
+        ASSERT_EQ(simd_results.size(), sequence_pairs.size());
+        ASSERT_EQ(scalar_results.size(), sequence_pairs.size());
+
+        for (size_t i = 0; i < sequence_pairs.size(); ++i)
+        {
+            EXPECT_EQ(simd_results[i].sequence1_id(), scalar_results[i].sequence1_id());
+            EXPECT_EQ(simd_results[i].score(), scalar_results[i].score());
+            EXPECT_EQ(simd_results[i].sequence1_end_position(), scalar_results[i].sequence1_end_position());
+            EXPECT_EQ(simd_results[i].sequence2_end_position(), scalar_results[i].sequence2_end_position());
+        }
+    }
+};
+
+static constexpr auto output_config = seqan3::align_cfg::output_score{} |
+                                      seqan3::align_cfg::output_end_position{} |
+                                      seqan3::align_cfg::output_sequence1_id{};
+
+TEST_F(edit_distance_unbanded_simd_test, global)
+{
+    expect_same_results(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, semi_global)
+{
+    auto method = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    expect_same_results(method | seqan3::align_cfg::edit_scheme | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, global_max_errors)
+{
+    expect_same_results(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme |
+                        seqan3::align_cfg::min_score{-10} | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, semi_global_max_errors)
+{
+    auto method = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    expect_same_results(method | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::min_score{-10} | output_config);
+}
+
+TEST_F(edit_distance_unbanded_simd_test, score_only)
+{
+    auto config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme |
+                  seqan3::align_cfg::output_score{};
+
+    std::vector<int32_t> scalar_scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        scalar_scores.push_back(result.score());
+
+    std::vector<int32_t> simd_scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{}))
+        simd_scores.push_back(result.score());
+
+    EXPECT_EQ(simd_scores, scalar_scores);
+}
@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+template <typename alphabet_t>
+using sequence_pairs_t = std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>;
+
+// Pairs of similar sequences with mismatches and indels, unrelated pairs and pairs with empty sequences of
+// different lengths, such that the lanes of a batch are dropped at different columns.
+template <typename alphabet_t>
+sequence_pairs_t<alphabet_t> generate_pairs()
+{
+    sequence_pairs_t<alphabet_t> pairs{};
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        std::vector<alphabet_t> sequence1 = seqan3::test::generate_sequence<alphabet_t>(100, 60, i);
+        std::vector<alphabet_t> sequence2{};
+
+        if (i % 5 == 0) // unrelated
+        {
+            sequence2 = seqan3::test::generate_sequence<alphabet_t>(100, 60, i + 1000);
+        }
+        else
+        {
+            auto noise = seqan3::test::generate_sequence<alphabet_t>(sequence1.size(), 0, i + 2000);
+
+            for (size_t j = 0; j < sequence1.size(); ++j)
+            {
+                if (j % (7 + i % 13) == 0) // mismatch or insertion
+                    sequence2.push_back(noise[j]);
+                if (j % (11 + i % 17) != 0) // deletion
+                    sequence2.push_back(sequence1[j]);
+            }
+        }
+
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    pairs[3].first.clear();
+    pairs[17].second.clear();
+    pairs[42].first.clear();
+    pairs[42].second.clear();
+
+    return pairs;
+}
+
+template <typename scoring_scheme_t>
+auto extension_config(scoring_scheme_t const & scheme, seqan3::align_cfg::method_extension const & method)
+{
+    return method |
+           seqan3::align_cfg::scoring_scheme{scheme} |
+           seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}} |
+           seqan3::align_cfg::output_score{} |
+           seqan3::align_cfg::output_end_position{};
+}
+
+template <typename scoring_scheme_t>
+auto extension_config(scoring_scheme_t const & scheme, int32_t const x_drop, bool const gapped)
+{
+    return extension_config(scheme, seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{x_drop},
+                                                                        seqan3::align_cfg::gapped_extension{gapped}});
+}
+
+// The score and the end positions of every alignment in the order of the sequence pairs.
+template <typename alphabet_t, typename config_t>
+std::vector<std::tuple<int32_t, size_t, size_t>> extend(sequence_pairs_t<alphabet_t> const & pairs,
+                                                        config_t const & config)
+{
+    std::vector<std::tuple<int32_t, size_t, size_t>> results{};
+
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+        results.emplace_back(result.score(), result.sequence1_end_position(), result.sequence2_end_position());
+
+    return results;
+}
+
+template <typename alphabet_t, typename config_t>
+void compare_with_scalar(sequence_pairs_t<alphabet_t> const & pairs, config_t const & config)
+{
+    auto const scalar_results = extend(pairs, config);
+
+    EXPECT_EQ(scalar_results.size(), pairs.size());
+    EXPECT_EQ(extend(pairs, config | seqan3::align_cfg::vectorised{}), scalar_results);
+}
+
+TEST(extension_affine_x_drop_simd, gapped)
+{
+    auto const pairs = generate_pairs<seqan3::dna4>();
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+
+    for (int32_t const x_drop : {0, 5, 20, 100})
+        compare_with_scalar(pairs, extension_config(scheme, x_drop, true));
+}
+
+TEST(extension_affine_x_drop_simd, ungapped)
+{
+    auto const pairs = generate_pairs<seqan3::dna4>();
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+
+    for (int32_t const x_drop : {0, 5, 20, 100})
+        compare_with_scalar(pairs, extension_config(scheme, x_drop, false));
+}
+
+TEST(extension_affine_x_drop_simd, int16_score)
+{
+    auto const pairs = generate_pairs<seqan3::dna4>();
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+
+    for (bool const gapped : {true, false})
+        compare_with_scalar(pairs, extension_config(scheme, 20, gapped) | seqan3::align_cfg::score_type<int16_t>{});
+}
+
+TEST(extension_affine_x_drop_simd, aminoacid_scoring_scheme)
+{
+    auto const pairs = generate_pairs<seqan3::aa27>();
+    seqan3::aminoacid_scoring_scheme scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+
+    for (bool const gapped : {true, false})
+        compare_with_scalar(pairs, extension_config(scheme, 20, gapped));
+}
+
+TEST(extension_affine_x_drop_simd, z_drop)
+{
+    auto const pairs = generate_pairs<seqan3::dna4>();
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+
+    for (bool const gapped : {true, false})
+    {
+        for (int32_t const z_drop : {0, 5, 20, 100})
+        {
+            seqan3::align_cfg::method_extension method{seqan3::align_cfg::z_drop{z_drop},
+                                                       seqan3::align_cfg::gapped_extension{gapped}};
+            compare_with_scalar(pairs, extension_config(scheme, method));
+
+            method.x_drop = 15; // Combined with an X-drop value.
+            compare_with_scalar(pairs, extension_config(scheme, method));
+            compare_with_scalar(pairs, extension_config(scheme, method) | seqan3::align_cfg::score_type<int16_t>{});
+        }
+    }
+}
+
+TEST(extension_affine_x_drop_simd, invalid_configuration)
+{
+    auto const pairs = generate_pairs<seqan3::dna4>();
+    seqan3::nucleotide_scoring_scheme scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    auto simd_config = extension_config(scheme, 20, true) | seqan3::align_cfg::vectorised{};
+
+    // The trace is not computed in vectorised mode.
+    EXPECT_THROW(seqan3::align_pairwise(pairs, simd_config | seqan3::align_cfg::output_begin_position{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(pairs, simd_config | seqan3::align_cfg::output_alignment{}),
+                 seqan3::invalid_alignment_configuration);
+
+    // The discarded cells must stay below the optimum of every lane.
+    EXPECT_THROW(seqan3::align_pairwise(pairs, extension_config(scheme, 10'000, true) |
+                                               seqan3::align_cfg::score_type<int16_t>{} |
+                                               seqan3::align_cfg::vectorised{}),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(pairs, extension_config(scheme, seqan3::align_cfg::method_extension{
+                                                                    seqan3::align_cfg::z_drop{10'000}}) |
+                                               seqan3::align_cfg::score_type<int16_t>{} |
+                                               seqan3::align_cfg::vectorised{}),
+                 seqan3::invalid_alignment_configuration);
+
+    // Without any drop value, the extension is not bounded.
+    EXPECT_THROW(seqan3::align_pairwise(pairs, extension_config(scheme, seqan3::align_cfg::method_extension{}) |
+                                               seqan3::align_cfg::vectorised{}),
+                 seqan3::invalid_alignment_configuration);
+}
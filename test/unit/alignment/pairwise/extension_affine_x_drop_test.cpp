@@ -0,0 +1,292 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/ranges>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/detail/debug_stream_alphabet.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_dna4;
+
+auto extension_config(seqan3::align_cfg::method_extension const & method)
+{
+    return method |
+           seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+           seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                              seqan3::align_cfg::extension_score{-1}} |
+           seqan3::align_cfg::output_score{} |
+           seqan3::align_cfg::output_begin_position{} |
+           seqan3::align_cfg::output_end_position{};
+}
+
+auto extension_config(int32_t const x_drop, bool const gapped)
+{
+    return extension_config(seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{x_drop},
+                                                                seqan3::align_cfg::gapped_extension{gapped}});
+}
+
+auto z_drop_config(int32_t const z_drop, bool const gapped)
+{
+    return extension_config(seqan3::align_cfg::method_extension{seqan3::align_cfg::z_drop{z_drop},
+                                                                seqan3::align_cfg::gapped_extension{gapped}});
+}
+
+TEST(extension_affine_x_drop, identical_sequences)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTAC"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTAC"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(20, true)).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_begin_position(), 0u);
+    EXPECT_EQ(res.sequence2_begin_position(), 0u);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+}
+
+TEST(extension_affine_x_drop, stops_at_divergent_suffix)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTACTTTTTTTTTT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGGGGGGGGGG"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(10, true)).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+}
+
+TEST(extension_affine_x_drop, gapped_alignment)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTACGGATCCATGCATGCATGCAT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGGTCCATGCATGCATGCAT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2),
+                                       extension_config(30, true) | seqan3::align_cfg::output_alignment{}).begin();
+
+    EXPECT_EQ(res.score(), 105);
+    EXPECT_EQ(res.sequence1_begin_position(), 0u);
+    EXPECT_EQ(res.sequence2_begin_position(), 0u);
+    EXPECT_EQ(res.sequence1_end_position(), 30u);
+    EXPECT_EQ(res.sequence2_end_position(), 29u);
+    EXPECT_RANGE_EQ(std::get<0>(res.alignment()) | seqan3::views::to_char,
+                    std::string{"ACGTACGTACGGATCCATGCATGCATGCAT"});
+    EXPECT_RANGE_EQ(std::get<1>(res.alignment()) | seqan3::views::to_char,
+                    std::string{"ACGTACGTACGG-TCCATGCATGCATGCAT"});
+}
+
+TEST(extension_affine_x_drop, gap_exceeds_x_drop)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTACGGATCCATGCATGCATGCAT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGGTCCATGCATGCATGCAT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(5, true)).begin();
+
+    EXPECT_EQ(res.score(), 48);
+    EXPECT_EQ(res.sequence1_end_position(), 12u);
+    EXPECT_EQ(res.sequence2_end_position(), 12u);
+}
+
+TEST(extension_affine_x_drop, ungapped)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTACGGATCCATGCATGCATGCAT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGGTCCATGCATGCATGCAT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(30, false)).begin();
+
+    EXPECT_EQ(res.score(), 48);
+    EXPECT_EQ(res.sequence1_end_position(), 12u);
+    EXPECT_EQ(res.sequence2_end_position(), 12u);
+}
+
+TEST(extension_affine_x_drop, ungapped_mismatch)
+{
+    seqan3::dna4_vector seq1 = "ACGTTACGATT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTAACGATT"_dna4;
+
+    // The mismatch lowers the score by 5, which is tolerated with an x-drop of 5 but not of 4.
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(5, false)).begin();
+    EXPECT_EQ(res.score(), 35);
+    EXPECT_EQ(res.sequence1_end_position(), 11u);
+    EXPECT_EQ(res.sequence2_end_position(), 11u);
+
+    res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(4, false)).begin();
+    EXPECT_EQ(res.score(), 16);
+    EXPECT_EQ(res.sequence1_end_position(), 4u);
+    EXPECT_EQ(res.sequence2_end_position(), 4u);
+}
+
+TEST(extension_affine_x_drop, zero_x_drop)
+{
+    seqan3::dna4_vector seq1 = "ACGTTACGATT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTAACGATT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(0, true)).begin();
+
+    EXPECT_EQ(res.score(), 16);
+    EXPECT_EQ(res.sequence1_end_position(), 4u);
+    EXPECT_EQ(res.sequence2_end_position(), 4u);
+}
+
+TEST(extension_affine_x_drop, empty_sequences)
+{
+    seqan3::dna4_vector seq1{};
+    seqan3::dna4_vector seq2 = "ACGT"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(10, true)).begin();
+
+    EXPECT_EQ(res.score(), 0);
+    EXPECT_EQ(res.sequence1_end_position(), 0u);
+    EXPECT_EQ(res.sequence2_end_position(), 0u);
+}
+
+TEST(extension_affine_x_drop, z_drop_tolerates_long_gap)
+{
+    // The insertion of 20 letters costs 30, i.e. the alignment behind it is only reached if 30 is tolerated.
+    seqan3::dna4_vector seq1 = "ACGTACGTACTTTTTTTTTTTTTTTTTTTTGCAGCCAGGACGCAGGCCAG"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGCAGCCAGGACGCAGGCCAG"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(25, true)).begin();
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+
+    // The Z-drop value grows by the gap extension costs along the gap, so only the gap open costs must be tolerated.
+    res = *seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(12, true)).begin();
+    EXPECT_EQ(res.score(), 90);
+    EXPECT_EQ(res.sequence1_begin_position(), 0u);
+    EXPECT_EQ(res.sequence2_begin_position(), 0u);
+    EXPECT_EQ(res.sequence1_end_position(), 50u);
+    EXPECT_EQ(res.sequence2_end_position(), 30u);
+
+    res = *seqan3::align_pairwise(std::tie(seq2, seq1), z_drop_config(12, true)).begin();
+    EXPECT_EQ(res.score(), 90);
+    EXPECT_EQ(res.sequence1_end_position(), 30u);
+    EXPECT_EQ(res.sequence2_end_position(), 50u);
+
+    res = *seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(9, true)).begin();
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+
+    // If both values are set, a cell is discarded as soon as it fails one of the criteria.
+    seqan3::align_cfg::method_extension method{seqan3::align_cfg::z_drop{12}};
+    method.x_drop = 25;
+
+    res = *seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(method)).begin();
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+}
+
+TEST(extension_affine_x_drop, z_drop_stops_at_divergent_suffix)
+{
+    seqan3::dna4_vector seq1 = "ACGTACGTACTTTTTTTTTT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTACGTACGGGGGGGGGG"_dna4;
+
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(12, true)).begin();
+
+    EXPECT_EQ(res.score(), 40);
+    EXPECT_EQ(res.sequence1_end_position(), 10u);
+    EXPECT_EQ(res.sequence2_end_position(), 10u);
+}
+
+TEST(extension_affine_x_drop, z_drop_ungapped)
+{
+    seqan3::dna4_vector seq1 = "ACGTTACGATT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGTAACGATT"_dna4;
+
+    // On the main diagonal, the Z-drop value is not adjusted.
+    auto res = *seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(5, false)).begin();
+    EXPECT_EQ(res.score(), 35);
+    EXPECT_EQ(res.sequence1_end_position(), 11u);
+    EXPECT_EQ(res.sequence2_end_position(), 11u);
+
+    res = *seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(4, false)).begin();
+    EXPECT_EQ(res.score(), 16);
+    EXPECT_EQ(res.sequence1_end_position(), 4u);
+    EXPECT_EQ(res.sequence2_end_position(), 4u);
+}
+
+TEST(extension_affine_x_drop, two_sided_seed_extension)
+{
+    // The seed "ACGTTGCA" starts at position 14 in the first and at position 11 in the second sequence.
+    seqan3::dna4_vector seq1 = "CCCCGGTACCTAGTACGTTGCATCAGGATCCATTTTTTTT"_dna4;
+    seqan3::dna4_vector seq2 = "AAGGTACTAGTACGTTGCATCAGCATCCAGGGGGGGG"_dna4;
+
+    size_t const seed_begin1 = 14;
+    size_t const seed_begin2 = 11;
+    size_t const seed_size = 8;
+
+    // Extend to the right, starting directly behind the seed.
+    auto right1 = seq1 | std::views::drop(seed_begin1 + seed_size);
+    auto right2 = seq2 | std::views::drop(seed_begin2 + seed_size);
+    auto right = *seqan3::align_pairwise(std::tie(right1, right2), extension_config(20, true)).begin();
+
+    // Extend to the left by aligning the reversed prefixes in front of the seed.
+    auto left1 = seq1 | std::views::take(seed_begin1) | std::views::reverse;
+    auto left2 = seq2 | std::views::take(seed_begin2) | std::views::reverse;
+    auto left = *seqan3::align_pairwise(std::tie(left1, left2), extension_config(20, true)).begin();
+
+    EXPECT_EQ(right.score(), 31); // one mismatch
+    EXPECT_EQ(left.score(), 25); // one deletion
+    EXPECT_EQ(right.sequence1_begin_position(), 0u);
+    EXPECT_EQ(right.sequence2_begin_position(), 0u);
+    EXPECT_EQ(left.sequence1_begin_position(), 0u);
+    EXPECT_EQ(left.sequence2_begin_position(), 0u);
+
+    // The end positions of the left extension are relative to the reversed prefixes.
+    EXPECT_EQ(seed_begin1 - left.sequence1_end_position(), 4u);
+    EXPECT_EQ(seed_begin2 - left.sequence2_end_position(), 2u);
+    EXPECT_EQ(seed_begin1 + seed_size + right.sequence1_end_position(), 32u);
+    EXPECT_EQ(seed_begin2 + seed_size + right.sequence2_end_position(), 29u);
+    EXPECT_EQ(left.score() + 4 * static_cast<int>(seed_size) + right.score(), 88);
+
+    // The Z-drop criterion yields the same alignment, since the deletion costs less than the Z-drop value.
+    right = *seqan3::align_pairwise(std::tie(right1, right2), z_drop_config(12, true)).begin();
+    left = *seqan3::align_pairwise(std::tie(left1, left2), z_drop_config(12, true)).begin();
+
+    EXPECT_EQ(seed_begin1 - left.sequence1_end_position(), 4u);
+    EXPECT_EQ(seed_begin2 - left.sequence2_end_position(), 2u);
+    EXPECT_EQ(seed_begin1 + seed_size + right.sequence1_end_position(), 32u);
+    EXPECT_EQ(seed_begin2 + seed_size + right.sequence2_end_position(), 29u);
+}
+
+TEST(extension_affine_x_drop, invalid_configuration)
+{
+    seqan3::dna4_vector seq1 = "ACGT"_dna4;
+    seqan3::dna4_vector seq2 = "ACGT"_dna4;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), extension_config(-1, true)),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), z_drop_config(-1, true)),
+                 seqan3::invalid_alignment_configuration);
+
+    auto banded_cfg = extension_config(10, true) |
+                      seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-2},
+                                                         seqan3::align_cfg::upper_diagonal{2}};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), banded_cfg), seqan3::invalid_alignment_configuration);
+
+    // The begin positions require the trace, which is not computed in vectorised mode.
+    auto vectorised_cfg = extension_config(10, true) | seqan3::align_cfg::vectorised{};
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), vectorised_cfg),
+                 seqan3::invalid_alignment_configuration);
+}
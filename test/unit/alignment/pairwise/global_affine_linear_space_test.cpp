@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_trace_memory_limit.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+#include "fixture/global_affine_banded.hpp"
+#include "fixture/global_affine_unbanded.hpp"
+
+// Global alignments computed in linear space may differ from the ones computed with the full trace matrix if
+// several optimal alignments exist. Hence, the aligned sequences are checked to be a valid alignment of the
+// input sequences that achieves the optimal score.
+template <auto _fixture>
+struct linear_space_fixture : public ::testing::Test
+{
+    auto fixture() -> decltype(seqan3::test::alignment::fixture::alignment_fixture{*_fixture}) const &
+    {
+        return *_fixture;
+    }
+};
+
+template <typename fixture_t>
+class global_affine_linear_space_test : public fixture_t
+{};
+
+using global_affine_linear_space_types = ::testing::Types<
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_01>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_02>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_03>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_04>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_part_05>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq1_empty>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_seq2_empty>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::unbanded::dna4_match_4_mismatch_5_gap_1_open_10_both_empty>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_01>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_same_sequence_upper_diagonal_0>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_same_sequence_lower_diagonal_0>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_small_band>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_single_diagonal>,
+    linear_space_fixture<&seqan3::test::alignment::fixture::global::affine::banded::dna4_large_band>
+>;
+
+TYPED_TEST_SUITE(global_affine_linear_space_test, global_affine_linear_space_types, );
+
+// Recomputes the score of the given alignment with the configured scoring scheme and gap costs.
+template <typename alignment_t, typename config_t>
+int32_t score_of(alignment_t const & alignment, config_t const & config)
+{
+    using seqan3::get;
+
+    auto const & scheme = get<seqan3::align_cfg::scoring_scheme>(config).scheme;
+    auto const & gap_cost = get<seqan3::align_cfg::gap_cost_affine>(config);
+
+    int32_t score = 0;
+    bool in_gap1 = false;
+    bool in_gap2 = false;
+    for (size_t i = 0; i < std::ranges::size(std::get<0>(alignment)); ++i)
+    {
+        auto const & value1 = std::get<0>(alignment)[i];
+        auto const & value2 = std::get<1>(alignment)[i];
+        bool const gap1 = (value1 == seqan3::gap{});
+        bool const gap2 = (value2 == seqan3::gap{});
+
+        if (gap1 || gap2)
+        {
+            score += gap_cost.extension_score;
+            if ((gap1 && !in_gap1) || (gap2 && !in_gap2))
+                score += gap_cost.open_score;
+        }
+        else
+        {
+            score += scheme.score(seqan3::assign_char_to(seqan3::to_char(value1), seqan3::dna4{}),
+                                  seqan3::assign_char_to(seqan3::to_char(value2), seqan3::dna4{}));
+        }
+
+        in_gap1 = gap1;
+        in_gap2 = gap2;
+    }
+
+    return score;
+}
+
+TYPED_TEST(global_affine_linear_space_test, alignment)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::output_score{} |
+                                                       seqan3::align_cfg::output_begin_position{} |
+                                                       seqan3::align_cfg::output_end_position{} |
+                                                       seqan3::align_cfg::output_alignment{} |
+                                                       seqan3::align_cfg::trace_memory_limit{0};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_EQ(res.sequence1_begin_position(), fixture.begin_positions.first);
+    EXPECT_EQ(res.sequence2_begin_position(), fixture.begin_positions.second);
+    EXPECT_EQ(res.sequence1_end_position(), fixture.end_positions.first);
+    EXPECT_EQ(res.sequence2_end_position(), fixture.end_positions.second);
+
+    auto const & [gapped_database, gapped_query] = res.alignment();
+    EXPECT_EQ(std::ranges::size(gapped_database), std::ranges::size(gapped_query));
+    EXPECT_RANGE_EQ(gapped_database | std::views::filter([] (auto const & v) { return v != seqan3::gap{}; })
+                                    | seqan3::views::to_char,
+                    database | seqan3::views::to_char);
+    EXPECT_RANGE_EQ(gapped_query | std::views::filter([] (auto const & v) { return v != seqan3::gap{}; })
+                                 | seqan3::views::to_char,
+                    query | seqan3::views::to_char);
+    EXPECT_EQ(score_of(res.alignment(), align_cfg), fixture.score);
+}
+
+TYPED_TEST(global_affine_linear_space_test, limit_not_exceeded)
+{
+    auto const & fixture = this->fixture();
+    seqan3::configuration align_cfg = fixture.config | seqan3::align_cfg::output_alignment{} |
+                                                       seqan3::align_cfg::output_score{} |
+                                                       seqan3::align_cfg::trace_memory_limit{1ull << 30};
+
+    std::vector database = fixture.sequence1;
+    std::vector query = fixture.sequence2;
+
+    auto alignment_rng = seqan3::align_pairwise(std::tie(database, query), align_cfg);
+    auto res = *alignment_rng.begin();
+
+    // The full trace matrix is used, which always reproduces the expected alignment.
+    EXPECT_EQ(res.score(), fixture.score);
+    EXPECT_RANGE_EQ(std::get<0>(res.alignment()) | seqan3::views::to_char, fixture.aligned_sequence1);
+    EXPECT_RANGE_EQ(std::get<1>(res.alignment()) | seqan3::views::to_char, fixture.aligned_sequence2);
+}
@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+struct global_affine_min_score : public ::testing::Test
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences
+    {
+        {"ACGTGACTGACTAGCTAGCATCGACTAGCTACGACTAGCATCGAT"_dna4, "ACGTGACTGACTAGCTAGCATCGACTAGCTACGACTAGCATCGAT"_dna4},
+        {"ACGTGACTGACTAGCTAGCATCGACTAGCTACGACTAGCATCGAT"_dna4, "ACGTGACTGACTTGCTAGCATCGACGAGCTACGACTAGCATCGAT"_dna4},
+        {"ACGTGACTGACTAGCTAGCATCGACTAGCTACGACTAGCATCGAT"_dna4, "TTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT"_dna4},
+        {"ACGTGACTGACTAGCTAGCATCG"_dna4, "ACGTGACTGACTAGCTAGCATCGACTAGCTACGACTAGCATCGAT"_dna4},
+        {"GGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGGG"_dna4, "CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC"_dna4},
+        {"ACGTACGTACGTACGT"_dna4, "ACGTACGTTACGTACGT"_dna4},
+        {""_dna4, "ACGT"_dna4},
+        {"AGCTAGCTAGCATCGACTAGCTACG"_dna4, "AGCTAGCTAGCATCGACTAGCTACG"_dna4}
+    };
+
+    template <typename method_t = seqan3::align_cfg::method_global>
+    auto base_config(method_t const & method = {},
+                     seqan3::align_cfg::gap_cost_affine const & gap_cost =
+                         seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                            seqan3::align_cfg::extension_score{-1}}) const
+    {
+        return method |
+               seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}}} |
+               gap_cost |
+               seqan3::align_cfg::output_sequence1_id{} |
+               seqan3::align_cfg::output_score{};
+    }
+
+    template <typename config_t>
+    std::vector<std::pair<size_t, int32_t>> compute(config_t const & config)
+    {
+        std::vector<std::pair<size_t, int32_t>> id_and_score{};
+
+        for (auto && result : seqan3::align_pairwise(sequences, config))
+            id_and_score.emplace_back(result.sequence1_id(), result.score());
+
+        std::sort(id_and_score.begin(), id_and_score.end());
+        return id_and_score;
+    }
+
+    // Runs the given configuration with and without the minimal score and compares the reported results.
+    template <typename config_t>
+    void check(config_t const & config, int32_t const min_score)
+    {
+        std::vector<std::pair<size_t, int32_t>> expected{};
+        for (auto && [id, score] : compute(config))
+            if (score >= min_score)
+                expected.emplace_back(id, score);
+
+        auto filtered = compute(config | seqan3::align_cfg::min_score{min_score});
+
+        EXPECT_EQ(filtered, expected);
+    }
+};
+
+TEST_F(global_affine_min_score, unbanded)
+{
+    for (int32_t min_score : {-1000, -100, 0, 50, 100, 180, 1000})
+        check(base_config(), min_score);
+
+    // Without any threshold all sequence pairs are reported.
+    EXPECT_EQ(compute(base_config() | seqan3::align_cfg::min_score{-1000}).size(), sequences.size());
+    // The identical sequence pair of length 45 is the only one reaching a score of 180.
+    EXPECT_EQ(compute(base_config() | seqan3::align_cfg::min_score{180}),
+              (std::vector<std::pair<size_t, int32_t>>{{0u, 180}}));
+}
+
+TEST_F(global_affine_min_score, free_end_gaps)
+{
+    seqan3::align_cfg::method_global method{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                            seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}};
+    auto config = base_config(method);
+
+    for (int32_t min_score : {-100, 0, 50, 92, 100, 180})
+        check(config, min_score);
+}
+
+TEST_F(global_affine_min_score, banded)
+{
+    auto config = base_config() | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-25},
+                                                                     seqan3::align_cfg::upper_diagonal{25}};
+
+    for (int32_t min_score : {-1000, -100, 0, 50, 100, 180})
+        check(config, min_score);
+}
+
+TEST_F(global_affine_min_score, vectorised)
+{
+    auto config = base_config() | seqan3::align_cfg::vectorised{};
+
+    for (int32_t min_score : {-1000, -100, 0, 50, 100, 180, 1000})
+        check(config, min_score);
+}
+
+TEST_F(global_affine_min_score, vectorised_banded)
+{
+    auto config = base_config() |
+                  seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-25},
+                                                     seqan3::align_cfg::upper_diagonal{25}} |
+                  seqan3::align_cfg::vectorised{};
+
+    for (int32_t min_score : {-1000, -100, 0, 50, 100, 180})
+        check(config, min_score);
+}
+
+TEST_F(global_affine_min_score, with_alignment)
+{
+    auto config = base_config() | seqan3::align_cfg::output_alignment{};
+
+    for (int32_t min_score : {-1000, 0, 100, 1000})
+        check(config, min_score);
+}
+
+TEST_F(global_affine_min_score, positive_gap_scores)
+{
+    // Gaps increasing the score disable the early rejection but the results are still filtered.
+    auto config = base_config(seqan3::align_cfg::method_global{},
+                              seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                 seqan3::align_cfg::extension_score{1}});
+
+    for (int32_t min_score : {-100, 0, 100, 200})
+        check(config, min_score);
+}
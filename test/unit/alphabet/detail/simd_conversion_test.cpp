@@ -0,0 +1,107 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/detail/simd_conversion.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/all.hpp>
+#include <seqan3/alphabet/quality/all.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+template <typename alphabet_t>
+class simd_conversion : public ::testing::Test
+{
+public:
+    // all characters, followed by letters only, so that both the SIMD kernels and the fallback are used
+    std::string chars = [] ()
+    {
+        std::string result{};
+
+        for (size_t i = 0; i < 3 * 256; ++i)
+            result.push_back(static_cast<char>(i));
+
+        for (alphabet_t const letter : seqan3::test::generate_sequence<alphabet_t>(1000, 0, 0))
+            result.push_back(seqan3::to_char(letter));
+
+        result.push_back('\n');
+        return result;
+    }();
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::rna4, seqan3::dna5, seqan3::rna5, seqan3::dna15,
+                                        seqan3::rna15, seqan3::phred42, seqan3::phred63, seqan3::phred94,
+                                        seqan3::aa27, seqan3::gapped<seqan3::dna4>>;
+
+TYPED_TEST_SUITE(simd_conversion, alphabet_types, );
+
+TYPED_TEST(simd_conversion, assign_chars_to)
+{
+    for (size_t offset : {0, 1, 7}) // unaligned begin
+    {
+        std::vector<TypeParam> expected(this->chars.size() - offset);
+        std::vector<TypeParam> letters(expected.size());
+
+        for (size_t i = 0; i < expected.size(); ++i)
+            seqan3::assign_char_to(this->chars[offset + i], expected[i]);
+
+        seqan3::detail::assign_chars_to(this->chars.data() + offset, letters.size(), letters.data());
+        EXPECT_EQ(letters, expected);
+    }
+}
+
+TYPED_TEST(simd_conversion, to_chars)
+{
+    std::vector<TypeParam> const letters = seqan3::test::generate_sequence<TypeParam>(1001, 0, 0);
+    std::string expected{};
+    std::string chars(letters.size(), ' ');
+
+    for (TypeParam const letter : letters)
+        expected.push_back(seqan3::to_char(letter));
+
+    seqan3::detail::to_chars(letters.data(), letters.size(), chars.data());
+    EXPECT_EQ(chars, expected);
+}
+
+TYPED_TEST(simd_conversion, complement_letters)
+{
+    if constexpr (seqan3::nucleotide_alphabet<TypeParam>)
+    {
+        std::vector<TypeParam> letters = seqan3::test::generate_sequence<TypeParam>(1001, 0, 0);
+        std::vector<TypeParam> expected{};
+
+        for (TypeParam const letter : letters)
+            expected.push_back(seqan3::complement(letter));
+
+        seqan3::detail::complement_letters(letters.data(), letters.size(), letters.data()); // in place
+        EXPECT_EQ(letters, expected);
+    }
+}
+
+TEST(simd_conversion_tables, applicable_kernels)
+{
+    if constexpr (seqan3::detail::simd_conversion_block_size > 0)
+    {
+        auto const & dna4_tables = seqan3::detail::alphabet_simd_conversion<seqan3::dna4>::get();
+        EXPECT_TRUE(dna4_tables.letter_ranks_are_valid);
+        EXPECT_TRUE(dna4_tables.rank_chars_are_valid);
+        EXPECT_TRUE(dna4_tables.complement_ranks_are_valid);
+
+        auto const & phred42_tables = seqan3::detail::alphabet_simd_conversion<seqan3::phred42>::get();
+        EXPECT_TRUE(phred42_tables.char_offset_is_valid);
+        EXPECT_EQ(phred42_tables.char_offset, '!');
+    }
+
+    // the ranks do not fit into a byte, so no kernel is used
+    EXPECT_FALSE(seqan3::detail::alphabet_simd_conversion<seqan3::qualified<seqan3::dna5,
+                                                                            seqan3::phred94>>::is_byte_alphabet);
+}
@@ -7,6 +7,12 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
 #include <seqan3/contrib/stream/bgzf_ostream.hpp>
 
 #include "../../io/stream/ostream_test_template.hpp"
@@ -32,3 +38,107 @@ public:
 using test_types = ::testing::Types<seqan3::contrib::bgzf_ostream>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, ostream, test_types, );
+
+TEST(bgzf_ostream, compression_level)
+{
+    std::string text{};
+    for (size_t i = 0; i < 100'000; ++i)
+        text += std::to_string(i * i % 1'000);
+
+    auto compress = [&text] (int const level)
+    {
+        std::ostringstream compressed{};
+        {
+            seqan3::contrib::bgzf_ostream bgzf_stream{compressed};
+            bgzf_stream.compression_level(level);
+            EXPECT_EQ(bgzf_stream.compression_level(), level);
+            bgzf_stream << text;
+        }
+        return compressed.str();
+    };
+
+    std::string const level_0 = compress(0);
+    std::string const level_1 = compress(1);
+    std::string const level_9 = compress(9);
+
+    EXPECT_GT(level_0.size(), text.size());   // stored blocks
+    EXPECT_GT(level_0.size(), level_1.size());
+    EXPECT_GE(level_1.size(), level_9.size());
+
+    for (std::string const & compressed : {level_0, level_1, level_9})
+    {
+        std::istringstream istream{compressed};
+        seqan3::contrib::bgzf_istream bgzf_stream{istream};
+        std::string decompressed{std::istreambuf_iterator<char>{bgzf_stream}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(decompressed, text);
+    }
+
+    std::ostringstream compressed{};
+    seqan3::contrib::bgzf_ostream bgzf_stream{compressed};
+    EXPECT_THROW(bgzf_stream.compression_level(-1), std::invalid_argument);
+    EXPECT_THROW(bgzf_stream.compression_level(10), std::invalid_argument);
+}
+
+TEST(bgzf_ostream, thread_count)
+{
+    std::string text{};
+    for (size_t i = 0; i < 100'000; ++i)
+        text += std::to_string(i * i % 1'000);
+
+    for (size_t thread_count : {1, 3})
+    {
+        for (size_t jobs_per_thread : {1, 2})
+        {
+            std::ostringstream compressed{};
+            {
+                seqan3::contrib::bgzf_ostream bgzf_stream{compressed, thread_count, jobs_per_thread};
+                bgzf_stream << text;
+            }
+
+            std::istringstream istream{compressed.str()};
+            seqan3::contrib::bgzf_istream bgzf_stream{istream, thread_count, jobs_per_thread};
+            std::string decompressed{std::istreambuf_iterator<char>{bgzf_stream}, std::istreambuf_iterator<char>{}};
+            EXPECT_EQ(decompressed, text);
+        }
+    }
+}
+
+TEST(bgzf_ostream, record_blocks)
+{
+    std::string text{};
+    for (size_t i = 0; i < 100'000; ++i)
+        text += std::to_string(i * i % 1'000);
+
+    std::ostringstream compressed{};
+    std::string observed{};
+    size_t observed_blocks{};
+    {
+        seqan3::contrib::bgzf_ostream bgzf_stream{compressed, 3};
+        bgzf_stream.rdbuf()->record_blocks([&] (char const * data, size_t const size)
+        {
+            observed.append(data, size);
+            ++observed_blocks;
+        });
+
+        bgzf_stream << text;
+        bgzf_stream.flush();
+
+        EXPECT_EQ(observed, text);
+
+        // the blocks are recorded in the order of the file
+        std::vector<size_t> const & block_sizes = bgzf_stream.rdbuf()->block_sizes();
+        EXPECT_EQ(block_sizes.size(), observed_blocks);
+        EXPECT_GT(block_sizes.size(), 1u);
+
+        size_t compressed_size{};
+        for (size_t const size : block_sizes)
+            compressed_size += size;
+
+        EXPECT_EQ(compressed_size, compressed.str().size());
+    }
+
+    std::istringstream istream{compressed.str()};
+    seqan3::contrib::bgzf_istream bgzf_stream{istream};
+    std::string decompressed{std::istreambuf_iterator<char>{bgzf_stream}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(decompressed, text);
+}
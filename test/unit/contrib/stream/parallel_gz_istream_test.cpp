@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+
+#include <seqan3/contrib/stream/gz_ostream.hpp>
+#include <seqan3/contrib/stream/parallel_gz_istream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+template <>
+class istream<seqan3::contrib::parallel_gz_istream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed
+    {
+        '\x1f','\x8b','\x08','\x00','\x00','\x00','\x00','\x00','\x00','\x03','\x0b','\xc9','\x48','\x55','\x28','\x2c',
+        '\xcd','\x4c','\xce','\x56','\x48','\x2a','\xca','\x2f','\xcf','\x53','\x48','\xcb','\xaf','\x50','\xc8','\x2a',
+        '\xcd','\x2d','\x28','\x56','\xc8','\x2f','\x4b','\x2d','\x52','\x28','\x01','\x4a','\xe7','\x24','\x56','\x55',
+        '\x2a','\xa4','\xe4','\xa7','\x03','\x00','\x39','\xa3','\x4f','\x41','\x2b','\x00','\x00','\x00'
+    };
+
+    // FASTQ-like text that is large enough to be split into many chunks.
+    static std::string generate_text(size_t const size)
+    {
+        std::mt19937 generator{42};
+        std::string text{};
+
+        while (text.size() < size)
+        {
+            text += "@read" + std::to_string(generator() % 100000) + '\n';
+            for (size_t i = 0; i < 100; ++i)
+                text += "ACGT"[generator() % 4];
+            text += "\n+\n";
+            for (size_t i = 0; i < 100; ++i)
+                text += static_cast<char>('!' + generator() % 40);
+            text += '\n';
+        }
+
+        return text;
+    }
+
+    static std::string compress(std::string const & text,
+                                size_t const level = Z_DEFAULT_COMPRESSION,
+                                seqan3::contrib::EStrategy const strategy = seqan3::contrib::DefaultStrategy)
+    {
+        std::ostringstream compressed_stream{};
+
+        {
+            seqan3::contrib::gz_ostream compressor{compressed_stream, level, strategy};
+            compressor << text;
+        }
+
+        return compressed_stream.str();
+    }
+
+    static std::string decompress(std::string const & input, size_t const thread_count, size_t const chunk_size)
+    {
+        std::istringstream compressed_stream{input};
+        seqan3::contrib::parallel_gz_istream decompressor{compressed_stream, thread_count, chunk_size};
+
+        return std::string{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+    }
+};
+
+using test_types = ::testing::Types<seqan3::contrib::parallel_gz_istream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, istream, test_types, );
+
+using parallel_gz_istream_test = istream<seqan3::contrib::parallel_gz_istream>;
+
+TEST_F(parallel_gz_istream_test, many_chunks)
+{
+    std::string const text = generate_text(2'000'000);
+
+    for (size_t level : {1, 6, 9})
+    {
+        std::string const input = compress(text, level);
+
+        for (size_t thread_count : {1, 4})
+            for (size_t chunk_size : {4096, 65536})
+                EXPECT_EQ(decompress(input, thread_count, chunk_size), text);
+    }
+}
+
+TEST_F(parallel_gz_istream_test, block_types)
+{
+    std::string const text = generate_text(1'000'000);
+
+    // Literal-only and filtered blocks, highly compressible runs and stored blocks.
+    EXPECT_EQ(decompress(compress(text, 6, seqan3::contrib::StrategyHuffmanOnly), 4, 4096), text);
+    EXPECT_EQ(decompress(compress(text, 6, seqan3::contrib::StrategyFiltered), 4, 4096), text);
+    EXPECT_EQ(decompress(compress(std::string(1'000'000, 'A'), 9), 4, 4096), std::string(1'000'000, 'A'));
+    EXPECT_EQ(decompress(compress(text, 0), 4, 4096), text);
+}
+
+TEST_F(parallel_gz_istream_test, concatenated_members)
+{
+    std::string const text = generate_text(300'000);
+
+    EXPECT_EQ(decompress(compress(text) + compressed + compress(text), 4, 4096), text + uncompressed + text);
+    EXPECT_EQ(decompress(compressed + compressed, 4, 4096), uncompressed + uncompressed);
+}
+
+TEST_F(parallel_gz_istream_test, empty)
+{
+    EXPECT_EQ(decompress("", 4, 4096), "");
+    EXPECT_EQ(decompress(compress(""), 4, 4096), "");
+}
+
+TEST_F(parallel_gz_istream_test, truncated_input)
+{
+    std::string const input = compress(generate_text(300'000));
+
+    for (size_t size : {size_t{5}, input.size() / 2, input.size() - 3})
+    {
+        std::istringstream compressed_stream{input.substr(0, size)};
+        seqan3::contrib::parallel_gz_istream decompressor{compressed_stream, 4, 4096};
+        std::string buffer{};
+        while (std::getline(decompressor, buffer)) {} // The stream reports the error by setting the badbit.
+
+        EXPECT_TRUE(decompressor.bad());
+    }
+}
+
+TEST_F(parallel_gz_istream_test, checksum_mismatch)
+{
+    std::string input = compress(generate_text(300'000));
+    input[input.size() - 6] ^= 1; // The CRC32 is stored in the 8 bytes before the end.
+
+    std::istringstream compressed_stream{input};
+    seqan3::contrib::parallel_gz_istream decompressor{compressed_stream, 4, 4096};
+    std::string buffer{};
+    while (std::getline(decompressor, buffer)) {}
+
+    EXPECT_TRUE(decompressor.bad());
+}
+
+TEST_F(parallel_gz_istream_test, sequential_fallback)
+{
+    std::string const text = generate_text(300'000);
+    std::mt19937 generator{7};
+    std::string random_bytes(200'000, '\0');
+    for (char & c : random_bytes)
+        c = static_cast<char>(generator());
+
+    // Incompressible data in the middle of a member and a stored member between well-compressed ones.
+    std::string const expected = text + random_bytes + text;
+    std::string const inputs[] = {compress(expected),
+                                  compress(text) + compress(random_bytes, 0) + compress(text) + compressed};
+
+    for (std::string const & input : inputs)
+    {
+        for (size_t thread_count : {1, 4})
+        {
+            for (size_t chunk_size : {4096, 65536})
+            {
+                std::istringstream compressed_stream{input};
+                seqan3::contrib::parallel_gz_istream decompressor{compressed_stream, thread_count, chunk_size};
+                std::string const result{std::istreambuf_iterator<char>{decompressor},
+                                         std::istreambuf_iterator<char>{}};
+                auto & base = static_cast<seqan3::contrib::basic_parallel_gz_istreambase<char> &>(decompressor);
+
+                EXPECT_EQ(result, (&input == inputs) ? expected : expected + uncompressed);
+                EXPECT_TRUE(base.rdbuf()->is_sequential());
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+
+#include "../../io/stream/istream_test_template.hpp"
+
+template <>
+class istream<seqan3::contrib::zstd_istream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed
+    {
+        '\x28','\xb5','\x2f','\xfd','\x04','\x58','\x59','\x01','\x00','\x54','\x68','\x65','\x20','\x71','\x75','\x69',
+        '\x63','\x6b','\x20','\x62','\x72','\x6f','\x77','\x6e','\x20','\x66','\x6f','\x78','\x20','\x6a','\x75','\x6d',
+        '\x70','\x73','\x20','\x6f','\x76','\x65','\x72','\x20','\x74','\x68','\x65','\x20','\x6c','\x61','\x7a','\x79',
+        '\x20','\x64','\x6f','\x67','\xbc','\x71','\xda','\x1f'
+    };
+
+    // The same text split into three frames of at most 16 bytes, followed by the seek table in a skippable frame.
+    static inline std::string compressed_seekable
+    {
+        '\x28','\xb5','\x2f','\xfd','\x04','\x58','\x81','\x00','\x00','\x54','\x68','\x65','\x20','\x71','\x75','\x69',
+        '\x63','\x6b','\x20','\x62','\x72','\x6f','\x77','\x6e','\x20','\x11','\xa3','\x43','\x49','\x28','\xb5','\x2f',
+        '\xfd','\x04','\x58','\x81','\x00','\x00','\x66','\x6f','\x78','\x20','\x6a','\x75','\x6d','\x70','\x73','\x20',
+        '\x6f','\x76','\x65','\x72','\x20','\x74','\x79','\x5c','\xe9','\x9a','\x28','\xb5','\x2f','\xfd','\x04','\x58',
+        '\x59','\x00','\x00','\x68','\x65','\x20','\x6c','\x61','\x7a','\x79','\x20','\x64','\x6f','\x67','\x23','\x51',
+        '\xc2','\x91','\x5e','\x2a','\x4d','\x18','\x21','\x00','\x00','\x00','\x1d','\x00','\x00','\x00','\x10','\x00',
+        '\x00','\x00','\x1d','\x00','\x00','\x00','\x10','\x00','\x00','\x00','\x18','\x00','\x00','\x00','\x0b','\x00',
+        '\x00','\x00','\x03','\x00','\x00','\x00','\x00','\xb1','\xea','\x92','\x8f'
+    };
+};
+
+using test_types = ::testing::Types<seqan3::contrib::zstd_istream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, istream, test_types, );
+
+using zstd_istream_test = istream<seqan3::contrib::zstd_istream>;
+
+TEST_F(zstd_istream_test, seekable_format)
+{
+    std::istringstream compressed_stream{compressed_seekable};
+    seqan3::contrib::zstd_istream decompressor{compressed_stream};
+    std::string buffer{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(buffer, uncompressed);
+}
+
+TEST_F(zstd_istream_test, seek)
+{
+    for (std::string const & input : {compressed, compressed_seekable})
+    {
+        std::istringstream compressed_stream{input};
+        seqan3::contrib::zstd_istream decompressor{compressed_stream, 8u, 8u}; // small buffers to cross frames
+        std::string buffer(5, ' ');
+
+        decompressor.seekg(20);
+        EXPECT_EQ(static_cast<size_t>(decompressor.tellg()), 20u);
+        decompressor.read(buffer.data(), 5);
+        EXPECT_EQ(buffer, uncompressed.substr(20, 5));
+
+        decompressor.seekg(-15, std::ios_base::cur); // backwards
+        decompressor.read(buffer.data(), 5);
+        EXPECT_EQ(buffer, uncompressed.substr(10, 5));
+
+        decompressor.seekg(uncompressed.size() + 1); // behind the end
+        EXPECT_TRUE(decompressor.fail());
+        decompressor.clear();
+
+        // The uncompressed size is only known from the seek table.
+        decompressor.seekg(-4, std::ios_base::end);
+        EXPECT_EQ(decompressor.fail(), input == compressed);
+        decompressor.clear();
+
+        if (input == compressed_seekable)
+        {
+            decompressor.read(buffer.data(), 4);
+            EXPECT_EQ(buffer.substr(0, 4), uncompressed.substr(uncompressed.size() - 4));
+        }
+    }
+}
+
+TEST_F(zstd_istream_test, concatenated_frames)
+{
+    std::istringstream compressed_stream{compressed + compressed};
+    seqan3::contrib::zstd_istream decompressor{compressed_stream};
+    std::string buffer{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+
+    EXPECT_EQ(buffer, uncompressed + uncompressed);
+}
+
+TEST_F(zstd_istream_test, truncated_input)
+{
+    std::istringstream compressed_stream{compressed.substr(0, compressed.size() - 10)};
+    seqan3::contrib::zstd_istream decompressor{compressed_stream};
+    std::string buffer{};
+    std::getline(decompressor, buffer); // The stream reports the decompression error by setting the badbit.
+
+    EXPECT_TRUE(decompressor.bad());
+}
@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#include <seqan3/contrib/stream/zstd_ostream.hpp>
+
+#include "../../io/stream/ostream_test_template.hpp"
+
+template <>
+class ostream<seqan3::contrib::zstd_ostream> : public ::testing::Test
+{
+public:
+    static constexpr bool zero_out_os_byte = false;
+
+    static inline std::string compressed
+    {
+        '\x28','\xb5','\x2f','\xfd','\x04','\x58','\x59','\x01','\x00','\x54','\x68','\x65','\x20','\x71','\x75','\x69',
+        '\x63','\x6b','\x20','\x62','\x72','\x6f','\x77','\x6e','\x20','\x66','\x6f','\x78','\x20','\x6a','\x75','\x6d',
+        '\x70','\x73','\x20','\x6f','\x76','\x65','\x72','\x20','\x74','\x68','\x65','\x20','\x6c','\x61','\x7a','\x79',
+        '\x20','\x64','\x6f','\x67','\xbc','\x71','\xda','\x1f'
+    };
+};
+
+using test_types = ::testing::Types<seqan3::contrib::zstd_ostream>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(contrib_streams, ostream, test_types, );
+
+std::string decompress(std::string const & compressed)
+{
+    std::istringstream compressed_stream{compressed};
+    seqan3::contrib::zstd_istream decompressor{compressed_stream};
+    return std::string{std::istreambuf_iterator<char>{decompressor}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(zstd_ostream_test, multi_threaded)
+{
+    std::string text{};
+    for (size_t i = 0; i < 100000; ++i)
+        text += "ACGTTGCA"[(i * 7) % 8];
+
+    std::ostringstream compressed_stream{};
+    {
+        seqan3::contrib::zstd_ostream compressor{compressed_stream, 3, 4u};
+        compressor << text;
+    }
+
+    EXPECT_EQ(decompress(compressed_stream.str()), text);
+}
+
+TEST(zstd_ostream_test, seekable_format)
+{
+    std::ostringstream compressed_stream{};
+    {
+        seqan3::contrib::zstd_ostream compressor{compressed_stream, 3, 1u, 16u};
+        compressor << uncompressed;
+    }
+
+    std::string const compressed = compressed_stream.str();
+    ASSERT_GE(compressed.size(), 17u);
+
+    auto read_uint32 = [&compressed] (size_t const pos)
+    {
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; ++i)
+            value |= static_cast<uint32_t>(static_cast<unsigned char>(compressed[pos + i])) << (8 * i);
+        return value;
+    };
+
+    // The footer of the seek table: number of frames, descriptor and the seekable magic number.
+    size_t const footer = compressed.size() - 9;
+    EXPECT_EQ(read_uint32(compressed.size() - 4), 0x8F92EAB1u);
+    EXPECT_EQ(compressed[footer + 4], '\x00');
+    ASSERT_EQ(read_uint32(footer), 3u); // 43 characters are split into frames of 16, 16 and 11 characters.
+
+    // The seek table entries sum up to the compressed and decompressed size.
+    size_t const seek_table_begin = footer - 3 * 8;
+    EXPECT_EQ(read_uint32(seek_table_begin - 8), 0x184D2A5Eu);
+    EXPECT_EQ(read_uint32(seek_table_begin - 4), 3u * 8u + 9u);
+
+    size_t compressed_size = 0;
+    size_t decompressed_size = 0;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        compressed_size += read_uint32(seek_table_begin + 8 * i);
+        decompressed_size += read_uint32(seek_table_begin + 8 * i + 4);
+    }
+
+    EXPECT_EQ(compressed_size, seek_table_begin - 8);
+    EXPECT_EQ(decompressed_size, uncompressed.size());
+
+    // Any zstd decoder can read the file.
+    EXPECT_EQ(decompress(compressed), uncompressed);
+}
+
+TEST(zstd_ostream_test, frame_size)
+{
+    std::ostringstream compressed_stream{};
+    {
+        seqan3::contrib::zstd_ostream compressor{compressed_stream, 3, 1u};
+        compressor << uncompressed.substr(0, 10);
+        compressor.frame_size(8u); // ends the first frame and writes the seek table at the end
+        EXPECT_EQ(compressor.frame_size(), 8u);
+        compressor << uncompressed.substr(10);
+    }
+
+    std::istringstream input{compressed_stream.str()};
+    seqan3::contrib::zstd_istream decompressor{input};
+    std::string buffer(6, ' ');
+
+    decompressor.seekg(-6, std::ios_base::end);
+    decompressor.read(buffer.data(), 6);
+    EXPECT_EQ(buffer, uncompressed.substr(uncompressed.size() - 6));
+    EXPECT_EQ(decompress(compressed_stream.str()), uncompressed);
+}
+
+TEST(zstd_ostream_test, empty_output)
+{
+    std::ostringstream compressed_stream{};
+    {
+        seqan3::contrib::zstd_ostream compressor{compressed_stream};
+    }
+
+    EXPECT_FALSE(compressed_stream.str().empty());
+    EXPECT_EQ(decompress(compressed_stream.str()), std::string{});
+}
@@ -293,6 +293,27 @@ TEST_F(alignment_file_input_f, record_reading_custom_fields)
     EXPECT_EQ(counter, 3u);
 }
 
+TEST_F(alignment_file_input_f, read_batch)
+{
+    seqan3::alignment_file_input fin{std::istringstream{input},
+                                     seqan3::format_sam{},
+                                     seqan3::fields<seqan3::field::id, seqan3::field::seq>{}};
+
+    auto & batch = fin.read_batch(2);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_RANGE_EQ(batch.sequences, (std::vector<seqan3::dna5_vector>{seq_comp[0], seq_comp[1]}));
+    EXPECT_RANGE_EQ(batch.ids, (std::vector<std::string>{id_comp[0], id_comp[1]}));
+    EXPECT_EQ(batch.base_qualities.size(), 2u); // not selected, hence empty
+    EXPECT_TRUE(batch.base_qualities.concat().empty());
+
+    fin.read_batch(2);
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_RANGE_EQ(batch.sequences[0], seq_comp[2]);
+    EXPECT_RANGE_EQ(batch.ids[0], id_comp[2]);
+
+    EXPECT_TRUE(fin.read_batch(2).empty());
+}
+
 TEST_F(alignment_file_input_f, file_view)
 {
     seqan3::alignment_file_input fin{std::istringstream{input}, seqan3::format_sam{}};
@@ -6,6 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <sstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -15,10 +16,12 @@
 #include <seqan3/io/alignment_file/input.hpp>
 #include <seqan3/io/alignment_file/output.hpp>
 #include <seqan3/test/tmp_filename.hpp>
+#include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
 
 using seqan3::operator""_dna4;
 using seqan3::operator""_dna5;
+using seqan3::operator""_tag;
 
 using default_fields = seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::qual>;
 
@@ -577,6 +580,280 @@ TEST(rows, convert_sam_to_blast)
     // TODO when blast format is implemented
 }
 
+// ----------------------------------------------------------------------------
+// batches
+// ----------------------------------------------------------------------------
+
+using batch_record_type = seqan3::record<seqan3::type_list<seqan3::dna5_vector, std::string>,
+                                         seqan3::fields<seqan3::field::seq, seqan3::field::id>>;
+
+TEST(batches, push_back_batch)
+{
+    seqan3::alignment_file_output fout{std::ostringstream{}, seqan3::format_sam{}};
+
+    std::vector<std::thread> producers{};
+
+    for (size_t i : {2, 0, 1})
+    {
+        producers.emplace_back([&fout, i] ()
+        {
+            std::vector<batch_record_type> batch{batch_record_type{seqs[i], ids[i]}};
+            fout.push_back_batch(batch, i);
+        });
+    }
+
+    for (auto & producer : producers)
+        producer.join();
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(), output_comp);
+}
+
+TEST(batches, push_back_batch_of_tuples)
+{
+    seqan3::alignment_file_output fout{std::ostringstream{}, seqan3::format_sam{}};
+
+    std::vector<std::tuple<seqan3::dna5_vector, std::string>> batch{{seqs[1], ids[1]}, {seqs[2], ids[2]}};
+    fout.push_back_batch(batch, 1);
+    fout.push_back_batch(std::vector<std::tuple<seqan3::dna5_vector, std::string>>{}, 0); // empty batch
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(),
+              output_comp.substr(output_comp.find("read2")));
+}
+
+TEST(batches, bam)
+{
+    std::vector<std::string> const ref_ids{"ref"};
+    std::vector<size_t> const ref_lengths{100};
+
+    using fields_t = seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::ref_id,
+                                    seqan3::field::ref_offset, seqan3::field::tags>;
+    using bam_record_type = seqan3::record<seqan3::type_list<seqan3::dna5_vector, std::string, int32_t,
+                                                             std::optional<int32_t>, seqan3::sam_tag_dictionary>,
+                                           fields_t>;
+
+    std::vector<bam_record_type> records{};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        seqan3::sam_tag_dictionary tags{};
+        tags.get<"NM"_tag>() = i;
+        records.emplace_back(seqs[i], ids[i], 0, 10 * i, tags);
+    }
+
+    seqan3::alignment_file_output expected{std::ostringstream{}, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+    expected = records;
+
+    seqan3::alignment_file_output fout{std::ostringstream{}, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+    fout.push_back_batch(std::vector<bam_record_type>{records.begin() + 2, records.end()}, 1);
+    fout.push_back_batch(std::vector<bam_record_type>{records.begin(), records.begin() + 2}, 0);
+
+    expected.get_stream().flush();
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(),
+              reinterpret_cast<std::ostringstream &>(expected.get_stream()).str());
+}
+
+TEST(batches, errors_and_missing_batches)
+{
+    std::ostringstream stream{};
+
+    {
+        seqan3::alignment_file_output fout{stream, seqan3::format_sam{}};
+
+        std::vector<batch_record_type> batch{batch_record_type{seqs[2], ids[2]}};
+        fout.push_back_batch(batch, 2);
+        EXPECT_THROW(fout.push_back_batch(batch, 2), std::logic_error);
+
+        batch[0] = batch_record_type{seqs[0], ids[0]};
+        fout.push_back_batch(batch, 0);
+        EXPECT_THROW(fout.push_back_batch(batch, 0), std::logic_error);
+
+        EXPECT_EQ(stream.str(), output_comp.substr(0, output_comp.find("read2")));
+    } // batch 1 is missing; batch 2 is written on destruction
+
+    EXPECT_EQ(stream.str(), output_comp.substr(0, output_comp.find("read2")) +
+                            output_comp.substr(output_comp.find("read3")));
+}
+
+// ----------------------------------------------------------------------------
+// sorting
+// ----------------------------------------------------------------------------
+
+using sort_fields_type = seqan3::fields<seqan3::field::id, seqan3::field::ref_id, seqan3::field::ref_offset,
+                                        seqan3::field::flag>;
+using sort_record_type = seqan3::record<seqan3::type_list<std::string, std::optional<int32_t>, std::optional<int32_t>,
+                                                          seqan3::sam_flag>,
+                                        sort_fields_type>;
+
+std::vector<sort_record_type> const unsorted_records{{"r4", 1, 5, seqan3::sam_flag::none},
+                                                     {"r2", 0, 7, seqan3::sam_flag::none},
+                                                     {"r5", std::nullopt, std::nullopt, seqan3::sam_flag::unmapped},
+                                                     {"r1", 1, 5, seqan3::sam_flag::none},
+                                                     {"r3", 0, 2, seqan3::sam_flag::on_reverse_strand},
+                                                     {"r0", 0, 2, seqan3::sam_flag::none}};
+
+std::vector<std::string> sorted_ids(seqan3::sam_sort_order const order, size_t const memory_limit, size_t const threads)
+{
+    std::vector<std::string> const ref_ids{"ref0", "ref1"};
+    std::vector<size_t> const ref_lengths{100, 100};
+    std::ostringstream stream{};
+
+    {
+        seqan3::alignment_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, sort_fields_type{}};
+        fout.options.sort_order = order;
+        fout.options.sort_memory_limit = memory_limit;
+        fout.options.sort_threads = threads;
+
+        fout = unsorted_records;
+        EXPECT_TRUE(stream.str().find("r4") == std::string::npos); // the records wait to be sorted
+    }
+
+    seqan3::alignment_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::id>{}};
+
+    std::vector<std::string> result{};
+    for (auto & record : fin)
+        result.push_back(seqan3::get<seqan3::field::id>(record));
+
+    EXPECT_EQ(fin.header().sorting, order == seqan3::sam_sort_order::coordinate ? "coordinate" : "queryname");
+    return result;
+}
+
+TEST(sorting, coordinate)
+{
+    std::vector<std::string> const expected{"r0", "r3", "r2", "r4", "r1", "r5"};
+
+    EXPECT_EQ(sorted_ids(seqan3::sam_sort_order::coordinate, 1u << 20, 1), expected); // in memory
+    EXPECT_EQ(sorted_ids(seqan3::sam_sort_order::coordinate, 1, 1), expected);       // one temporary file per record
+    EXPECT_EQ(sorted_ids(seqan3::sam_sort_order::coordinate, 100, 4), expected);
+}
+
+TEST(sorting, query_name)
+{
+    std::vector<std::string> const expected{"r0", "r1", "r2", "r3", "r4", "r5"};
+
+    EXPECT_EQ(sorted_ids(seqan3::sam_sort_order::query_name, 1u << 20, 2), expected);
+    EXPECT_EQ(sorted_ids(seqan3::sam_sort_order::query_name, 1, 1), expected);
+}
+
+TEST(sorting, many_runs)
+{
+    std::vector<std::string> const ref_ids{"ref0", "ref1"};
+    std::vector<size_t> const ref_lengths{100, 100};
+    std::vector<sort_record_type> records{};
+
+    for (int32_t i = 0; i < 100; ++i)
+        records.push_back({"r" + std::to_string(i), i % 2, i * 7 % 10, seqan3::sam_flag::none});
+
+    std::ostringstream stream{};
+
+    {
+        seqan3::alignment_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, sort_fields_type{}};
+        fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+        fout.options.sort_memory_limit = 1; // one run per record, which are merged over several levels
+        fout = records;
+    }
+
+    std::ranges::stable_sort(records, std::less<>{}, [] (auto const & record)
+    {
+        return std::pair{seqan3::get<seqan3::field::ref_id>(record), seqan3::get<seqan3::field::ref_offset>(record)};
+    });
+
+    seqan3::alignment_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::id>{}};
+
+    size_t i = 0;
+    for (auto & record : fin)
+        EXPECT_EQ(seqan3::get<seqan3::field::id>(record), seqan3::get<seqan3::field::id>(records[i++]));
+
+    EXPECT_EQ(i, records.size());
+}
+
+TEST(sorting, const_header)
+{
+    using header_type = seqan3::alignment_file_header<std::vector<std::string>>;
+    using fields_type = seqan3::fields<seqan3::field::header_ptr, seqan3::field::id, seqan3::field::ref_id,
+                                       seqan3::field::ref_offset, seqan3::field::flag>;
+
+    std::vector<std::string> ref_ids{"ref0", "ref1"};
+    header_type header{ref_ids};
+    header.sorting = "unsorted";
+
+    for (int32_t idx = 0; idx < 2; ++idx)
+    {
+        header.ref_id_info.emplace_back(100, "");
+        header.ref_dict[std::span{std::ranges::data(ref_ids[idx]), std::ranges::size(ref_ids[idx])}] = idx;
+    }
+
+    header_type const & const_header = header;
+    std::ostringstream stream{};
+
+    {
+        seqan3::alignment_file_output fout{stream, seqan3::format_bam{}, fields_type{}};
+        fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+
+        for (auto & record : unsorted_records)
+        {
+            fout.emplace_back(&const_header,
+                              seqan3::get<seqan3::field::id>(record),
+                              seqan3::get<seqan3::field::ref_id>(record),
+                              seqan3::get<seqan3::field::ref_offset>(record),
+                              seqan3::get<seqan3::field::flag>(record));
+        }
+    }
+
+    EXPECT_EQ(header.sorting, "unsorted"); // the header of the records is not changed
+    EXPECT_TRUE(stream.str().find("@HD\tVN:1.6\tSO:coordinate\n") != std::string::npos);
+
+    seqan3::alignment_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::id>{}};
+
+    std::vector<std::string> result{};
+    for (auto & record : fin)
+        result.push_back(seqan3::get<seqan3::field::id>(record));
+
+    EXPECT_EQ(fin.header().sorting, "coordinate");
+    EXPECT_EQ(fin.header().ref_ids(), ref_ids);
+    EXPECT_EQ(result, (std::vector<std::string>{"r0", "r3", "r2", "r4", "r1", "r5"}));
+}
+
+TEST(sorting, close)
+{
+    std::vector<std::string> const ref_ids{"ref0", "ref1"};
+    std::vector<size_t> const ref_lengths{100, 100};
+    std::ostringstream stream{};
+
+    seqan3::alignment_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, sort_fields_type{}};
+    fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+    fout = unsorted_records;
+
+    EXPECT_TRUE(stream.str().find("r4") == std::string::npos);
+    fout.close();
+    EXPECT_TRUE(stream.str().find("r4") != std::string::npos); // the sorted records are written on close
+    EXPECT_NO_THROW(fout.close());
+}
+
+TEST(sorting, errors)
+{
+    std::vector<std::string> const ref_ids{"ref0", "ref1"};
+    std::vector<size_t> const ref_lengths{100, 100};
+
+    {
+        seqan3::alignment_file_output fout{std::ostringstream{}, ref_ids, ref_lengths, seqan3::format_sam{},
+                                           sort_fields_type{}};
+        fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+        EXPECT_THROW(fout.push_back(unsorted_records[0]), std::logic_error); // only BAM files can be sorted
+    }
+
+    seqan3::alignment_file_output fout{std::ostringstream{}, ref_ids, ref_lengths, seqan3::format_bam{},
+                                       sort_fields_type{}};
+    fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+    fout.push_back(unsorted_records[0]);
+    fout.write_sorted_records();
+    EXPECT_THROW(fout.push_back(unsorted_records[1]), std::logic_error);
+}
+
 // ----------------------------------------------------------------------------
 // compression
 // ----------------------------------------------------------------------------
@@ -0,0 +1,284 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/filesystem>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/bam_index.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#if SEQAN3_HAS_ZLIB
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna5;
+
+struct bam_index_test : public ::testing::Test
+{
+    struct expected_record
+    {
+        std::string id;
+        int32_t ref_id;
+        int32_t begin;
+        int32_t end;
+    };
+
+    using fields_type = seqan3::fields<seqan3::field::id,
+                                       seqan3::field::seq,
+                                       seqan3::field::ref_id,
+                                       seqan3::field::ref_offset,
+                                       seqan3::field::cigar,
+                                       seqan3::field::flag>;
+
+    std::vector<std::string> const ref_ids{"ref1", "ref2"};
+    std::vector<size_t> const ref_lengths{1'000'000, 300'000};
+
+    seqan3::test::tmp_filename bam_file{"bam_index_test.bam"};
+    std::vector<expected_record> records{};
+
+    void SetUp() override
+    {
+        seqan3::alignment_file_output fout{bam_file.get_path(), ref_ids, ref_lengths, fields_type{}};
+        fout.options.write_bam_index = true;
+
+        auto add = [&] (int32_t const ref_id, int32_t const position, uint32_t const length)
+        {
+            records.push_back(expected_record{"r" + std::to_string(records.size()), ref_id, position,
+                                              position + static_cast<int32_t>(length)});
+
+            std::vector<seqan3::cigar> cigar{{length, 'M'_cigar_op}};
+            fout.emplace_back(records.back().id, seqan3::dna5_vector(length, 'A'_dna5), std::optional<int32_t>{ref_id},
+                              std::optional<int32_t>{position}, cigar, seqan3::sam_flag::none);
+        };
+
+        // short records and some that span several bins
+        for (int32_t i = 0; i < 5000; ++i)
+            add(0, i * 150, (i % 500 == 0) ? 40'000 : 100);
+
+        for (int32_t i = 0; i < 200; ++i)
+            add(1, i * 1000, 50);
+
+        // unplaced records are stored at the end
+        for (size_t i = 0; i < 3; ++i)
+        {
+            fout.emplace_back(std::string{"unplaced"}, seqan3::dna5_vector(10, 'C'_dna5), std::optional<int32_t>{},
+                              std::optional<int32_t>{}, std::vector<seqan3::cigar>{}, seqan3::sam_flag::unmapped);
+        }
+    }
+
+    std::vector<std::string> expected_ids(int32_t const ref_id, int32_t const begin, int32_t const end) const
+    {
+        std::vector<std::string> ids{};
+
+        for (expected_record const & record : records)
+            if (record.ref_id == ref_id && record.begin < end && record.end > begin)
+                ids.push_back(record.id);
+
+        return ids;
+    }
+
+    template <typename file_t>
+    static std::vector<std::string> region_ids(file_t & fin, int32_t const ref_id, int32_t const begin, int32_t const end)
+    {
+        std::vector<std::string> ids{};
+
+        for (auto & record : fin.region(ref_id, begin, end))
+            ids.push_back(seqan3::get<seqan3::field::id>(record));
+
+        return ids;
+    }
+};
+
+TEST_F(bam_index_test, index_is_written_on_close)
+{
+    EXPECT_TRUE(std::filesystem::exists(bam_file.get_path().string() + ".bai"));
+
+    seqan3::bam_index index{bam_file.get_path().string() + ".bai"};
+    EXPECT_EQ(index.reference_count(), 2u);
+    EXPECT_EQ(index.unplaced_count(), 3u);
+}
+
+TEST_F(bam_index_test, region)
+{
+    seqan3::alignment_file_input fin{bam_file.get_path(), seqan3::fields<seqan3::field::id>{}};
+
+    for (auto [ref_id, begin, end] : std::vector<std::tuple<int32_t, int32_t, int32_t>>{{0, 0, 1},
+                                                                                          {0, 1000, 1100},
+                                                                                          {0, 74'900, 75'100},
+                                                                                          {0, 123'456, 234'567},
+                                                                                          {0, 0, 1'000'000},
+                                                                                          {0, 760'000, 1'000'000},
+                                                                                          {1, 4'000, 4'050},
+                                                                                          {1, 4'050, 4'999},
+                                                                                          {1, 0, 300'000}})
+    {
+        EXPECT_EQ(region_ids(fin, ref_id, begin, end), expected_ids(ref_id, begin, end))
+            << "region " << ref_id << ':' << begin << '-' << end;
+    }
+
+    // the whole file can still be read after the region queries of another file
+    seqan3::alignment_file_input fin2{bam_file.get_path(), seqan3::fields<seqan3::field::id>{}};
+    EXPECT_EQ(static_cast<size_t>(std::ranges::distance(fin2)), records.size() + 3);
+}
+
+TEST_F(bam_index_test, region_with_all_fields)
+{
+    seqan3::alignment_file_input fin{bam_file.get_path()};
+
+    size_t count = 0;
+    for (auto & record : fin.region(0, 300'000, 300'200))
+    {
+        EXPECT_EQ(seqan3::get<seqan3::field::ref_id>(record), 0);
+        EXPECT_LT(seqan3::get<seqan3::field::ref_offset>(record).value(), 300'200);
+        ++count;
+    }
+
+    EXPECT_EQ(count, expected_ids(0, 300'000, 300'200).size());
+}
+
+TEST_F(bam_index_test, csi)
+{
+    seqan3::test::tmp_filename csi_file{"bam_index_test.csi"};
+
+    seqan3::bam_index const built = seqan3::bam_index::build(bam_file.get_path(), 12, 6);
+    built.write(csi_file.get_path());
+    EXPECT_THROW(built.write(bam_file.get_path().string() + ".bai"), seqan3::format_error); // BAI needs 14 and 5
+
+    seqan3::bam_index const loaded{csi_file.get_path()};
+    EXPECT_EQ(loaded.unplaced_count(), 3u);
+
+    seqan3::alignment_file_input fin{bam_file.get_path(), seqan3::fields<seqan3::field::id>{}};
+    fin.load_index(csi_file.get_path());
+
+    for (auto [ref_id, begin, end] : std::vector<std::tuple<int32_t, int32_t, int32_t>>{{0, 1000, 1100},
+                                                                                          {0, 500'000, 500'001},
+                                                                                          {1, 10'000, 20'000}})
+    {
+        EXPECT_EQ(region_ids(fin, ref_id, begin, end), expected_ids(ref_id, begin, end));
+    }
+}
+
+TEST_F(bam_index_test, bai_round_trip)
+{
+    seqan3::bam_index const built = seqan3::bam_index::build(bam_file.get_path());
+    seqan3::bam_index const loaded{bam_file.get_path().string() + ".bai"};
+
+    EXPECT_EQ(loaded.chunks(0, 0, 1'000'000), built.chunks(0, 0, 1'000'000));
+    EXPECT_EQ(loaded.chunks(0, 70'000, 80'000), built.chunks(0, 70'000, 80'000));
+    EXPECT_EQ(loaded.chunks(1, 0, 1), built.chunks(1, 0, 1));
+    EXPECT_TRUE(loaded.chunks(2, 0, 1).empty());
+    EXPECT_TRUE(loaded.chunks(0, 10, 10).empty());
+}
+
+TEST_F(bam_index_test, index_is_built_while_writing)
+{
+    seqan3::bam_index const built = seqan3::bam_index::build(bam_file.get_path());
+    seqan3::bam_index const written{bam_file.get_path().string() + ".bai"};
+
+    for (int32_t begin = 0; begin < 1'000'000; begin += 10'000)
+        EXPECT_EQ(written.chunks(0, begin, begin + 10'000), built.chunks(0, begin, begin + 10'000));
+
+    for (int32_t begin = 0; begin < 300'000; begin += 3'000)
+        EXPECT_EQ(written.chunks(1, begin, begin + 3'000), built.chunks(1, begin, begin + 3'000));
+}
+
+TEST(bam_index, sorted_or_late_option)
+{
+    using fields_type = seqan3::fields<seqan3::field::id, seqan3::field::ref_id, seqan3::field::ref_offset>;
+
+    for (bool const sort : {true, false})
+    {
+        seqan3::test::tmp_filename bam_file{"sorted.bam"};
+
+        {
+            seqan3::alignment_file_output fout{bam_file.get_path(),
+                                               std::vector<std::string>{"ref"},
+                                               std::vector<size_t>{100'000},
+                                               fields_type{}};
+
+            if (sort) // the sorted records are written through the same stream
+            {
+                fout.options.sort_order = seqan3::sam_sort_order::coordinate;
+                fout.options.sort_memory_limit = 1'000;
+                fout.options.write_bam_index = true;
+            }
+
+            for (int32_t i = 0; i < 1000; ++i)
+            {
+                int32_t const position = sort ? (i * 7919) % 100'000 : i * 100;
+                fout.emplace_back("r" + std::to_string(i), std::optional<int32_t>{0}, std::optional<int32_t>{position});
+
+                if (i == 0) // too late to build the index while writing; the file is read again
+                    fout.options.write_bam_index = true;
+            }
+
+            fout.close();
+        }
+
+        seqan3::bam_index const built = seqan3::bam_index::build(bam_file.get_path());
+        seqan3::bam_index const written{bam_file.get_path().string() + ".bai"};
+
+        for (int32_t begin = 0; begin < 100'000; begin += 5'000)
+            EXPECT_EQ(written.chunks(0, begin, begin + 5'000), built.chunks(0, begin, begin + 5'000));
+    }
+}
+
+TEST(bam_index, unsorted_file)
+{
+    seqan3::test::tmp_filename bam_file{"unsorted.bam"};
+
+    {
+        seqan3::alignment_file_output fout{bam_file.get_path(),
+                                           std::vector<std::string>{"ref"},
+                                           std::vector<size_t>{1000},
+                                           seqan3::fields<seqan3::field::id, seqan3::field::ref_id,
+                                                          seqan3::field::ref_offset>{}};
+        fout.options.write_bam_index = true;
+
+        fout.emplace_back(std::string{"r1"}, std::optional<int32_t>{0}, std::optional<int32_t>{100});
+        fout.emplace_back(std::string{"r2"}, std::optional<int32_t>{0}, std::optional<int32_t>{10});
+
+        EXPECT_THROW(fout.close(), seqan3::format_error); // the destructor cannot report the error
+        EXPECT_NO_THROW(fout.close());                    // the file is already closed
+    }
+
+    EXPECT_FALSE(std::filesystem::exists(bam_file.get_path().string() + ".bai"));
+    EXPECT_THROW(seqan3::bam_index::build(bam_file.get_path()), seqan3::format_error);
+
+    seqan3::alignment_file_input fin{bam_file.get_path()};
+    EXPECT_THROW(fin.region(0, 0, 100), seqan3::file_open_error); // no index
+}
+
+TEST(bam_index, region_on_sam)
+{
+    seqan3::alignment_file_input fin{std::istringstream{"@SQ\tSN:ref\tLN:10\nr1\t0\tref\t1\t60\t1M\t*\t0\t0\tA\t*\n"},
+                                     seqan3::format_sam{}};
+
+    EXPECT_THROW(fin.region(0, 0, 10), seqan3::format_error);
+}
+
+TEST(bam_index, invalid_index_file)
+{
+    seqan3::test::tmp_filename index_file{"invalid.bai"};
+
+    {
+        std::ofstream file{index_file.get_path()};
+        file << "not an index";
+    }
+
+    EXPECT_THROW(seqan3::bam_index{index_file.get_path()}, seqan3::format_error);
+    EXPECT_THROW(seqan3::bam_index{index_file.get_path().string() + ".missing"}, seqan3::file_open_error);
+}
+
+#endif // SEQAN3_HAS_ZLIB
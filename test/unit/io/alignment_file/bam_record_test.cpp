@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/alignment_file/bam_record.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#if SEQAN3_HAS_ZLIB
+
+using fields_type = seqan3::fields<seqan3::field::id,
+                                   seqan3::field::seq,
+                                   seqan3::field::qual,
+                                   seqan3::field::ref_id,
+                                   seqan3::field::ref_offset,
+                                   seqan3::field::cigar,
+                                   seqan3::field::flag,
+                                   seqan3::field::mapq,
+                                   seqan3::field::mate,
+                                   seqan3::field::tags,
+                                   seqan3::field::header_ptr>;
+
+struct bam_record_test : public ::testing::Test
+{
+    std::string const sam_input =
+R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:34
+read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$	AS:i:2	NM:i:7
+read2	42	ref	2	62	7M1D1M1S	ref	10	300	AGGCTGNAG	!##$&'()*	xy:B:S,3,4,5
+read3	43	ref	3	63	1S1M1D1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
+read4	4	*	0	0	*	*	0	0	ACGT	*
+)";
+
+    seqan3::test::tmp_filename bam_file{"bam_record_test.bam"};
+
+    void SetUp() override
+    {
+        seqan3::alignment_file_input fin{std::istringstream{sam_input}, seqan3::format_sam{}, fields_type{}};
+        seqan3::alignment_file_output fout{bam_file.get_path()};
+
+        fout = fin;
+    }
+
+    template <typename file_t>
+    static std::vector<typename file_t::raw_record_type> read_raw_records(file_t & fin)
+    {
+        std::vector<typename file_t::raw_record_type> records{};
+
+        for (typename file_t::raw_record_type record{}; fin.read_raw_record(record);)
+            records.push_back(record);
+
+        return records;
+    }
+};
+
+TEST_F(bam_record_test, fields)
+{
+    seqan3::alignment_file_input raw_fin{bam_file.get_path(), fields_type{}};
+    auto raw_records = read_raw_records(raw_fin);
+
+    seqan3::alignment_file_input fin{bam_file.get_path(), fields_type{}};
+
+    size_t i = 0;
+    for (auto & record : fin)
+    {
+        ASSERT_LT(i, raw_records.size());
+        auto const & raw = raw_records[i++];
+
+        EXPECT_EQ(raw.header_ptr, &raw_fin.header());
+        EXPECT_EQ(raw.id(), seqan3::get<seqan3::field::id>(record));
+        EXPECT_EQ(raw.ref_id(), seqan3::get<seqan3::field::ref_id>(record));
+        EXPECT_EQ(raw.ref_offset(), seqan3::get<seqan3::field::ref_offset>(record));
+        EXPECT_EQ(raw.flag(), seqan3::get<seqan3::field::flag>(record));
+        EXPECT_EQ(raw.mapq(), seqan3::get<seqan3::field::mapq>(record));
+        EXPECT_EQ(raw.mate(), seqan3::get<seqan3::field::mate>(record));
+        EXPECT_EQ(raw.cigar_vector(), seqan3::get<seqan3::field::cigar>(record));
+        EXPECT_EQ(raw.tags(), seqan3::get<seqan3::field::tags>(record));
+        EXPECT_EQ(raw.sequence() | seqan3::views::to_char | seqan3::views::to<std::string>,
+                  seqan3::get<seqan3::field::seq>(record) | seqan3::views::to_char | seqan3::views::to<std::string>);
+        EXPECT_EQ(raw.base_qualities() | seqan3::views::to_char | seqan3::views::to<std::string>,
+                  seqan3::get<seqan3::field::qual>(record) | seqan3::views::to_char | seqan3::views::to<std::string>);
+    }
+
+    EXPECT_EQ(i, 4u);
+    EXPECT_EQ(raw_records.size(), 4u);
+    EXPECT_FALSE(raw_records[3].ref_id().has_value());
+    EXPECT_TRUE(std::ranges::empty(raw_records[3].base_qualities()));
+}
+
+TEST_F(bam_record_test, bam_passthrough)
+{
+    seqan3::test::tmp_filename copy_file{"bam_record_test_copy.bam"};
+
+    std::vector<seqan3::bam_record<seqan3::alignment_file_header<>>> raw_records{};
+
+    {
+        seqan3::alignment_file_input fin{bam_file.get_path()};
+        seqan3::alignment_file_output fout{copy_file.get_path()};
+
+        EXPECT_EQ(fin.header().ref_ids().size(), 1u); // only the header is read
+
+        for (auto record = decltype(fin)::raw_record_type{}; fin.read_raw_record(record);)
+        {
+            raw_records.push_back(record);
+            fout.push_back(record);
+        }
+    }
+
+    seqan3::alignment_file_input fin{copy_file.get_path()};
+    auto copied_records = read_raw_records(fin);
+
+    ASSERT_EQ(copied_records.size(), raw_records.size());
+
+    for (size_t i = 0; i < raw_records.size(); ++i)
+        EXPECT_EQ(copied_records[i].bytes, raw_records[i].bytes);
+}
+
+TEST_F(bam_record_test, sam_output)
+{
+    seqan3::alignment_file_input raw_fin{bam_file.get_path()};
+    seqan3::alignment_file_output raw_fout{std::ostringstream{}, seqan3::format_sam{}};
+
+    for (auto record = decltype(raw_fin)::raw_record_type{}; raw_fin.read_raw_record(record);)
+        raw_fout.push_back(record);
+
+    seqan3::alignment_file_input fin{bam_file.get_path(), fields_type{}};
+    seqan3::alignment_file_output fout{std::ostringstream{}, seqan3::format_sam{}};
+
+    fout = fin;
+
+    raw_fout.get_stream().flush();
+    fout.get_stream().flush();
+
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(raw_fout.get_stream()).str(),
+              reinterpret_cast<std::ostringstream &>(fout.get_stream()).str());
+}
+
+TEST_F(bam_record_test, cannot_mix_with_iteration)
+{
+    seqan3::alignment_file_input fin{bam_file.get_path()};
+    decltype(fin)::raw_record_type record{};
+
+    EXPECT_NE(fin.begin(), fin.end());
+    EXPECT_THROW(fin.read_raw_record(record), std::logic_error);
+}
+
+TEST_F(bam_record_test, only_bam)
+{
+    seqan3::alignment_file_input fin{std::istringstream{sam_input}, seqan3::format_sam{}};
+    decltype(fin)::raw_record_type record{};
+
+    EXPECT_THROW(fin.read_raw_record(record), seqan3::format_error);
+}
+
+#endif // SEQAN3_HAS_ZLIB
@@ -0,0 +1,158 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/expect_same_type.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/utility/tuple/concept.hpp>
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna5;
+
+using slice_type = decltype(std::declval<seqan3::dna5_vector &>() | seqan3::views::slice(0, 0));
+using alignment_type = seqan3::cigar_alignment<slice_type, slice_type>;
+
+seqan3::dna5_vector reference{"ACTGATCGAGAGGATCTAGAGGAGATCGTAGGAC"_dna5};
+seqan3::dna5_vector query{"GGAGTATA"_dna5};
+
+// 1S1M1P1M1I1M1I1D1M1S from the SAM test files
+std::vector<seqan3::cigar> const cigar_vector{{1, 'S'_cigar_op}, {1, 'M'_cigar_op}, {1, 'P'_cigar_op},
+                                              {1, 'M'_cigar_op}, {1, 'I'_cigar_op}, {1, 'M'_cigar_op},
+                                              {1, 'I'_cigar_op}, {1, 'D'_cigar_op}, {1, 'M'_cigar_op},
+                                              {1, 'S'_cigar_op}};
+
+alignment_type make_alignment()
+{
+    return alignment_type{reference | seqan3::views::slice(2, 7), query | seqan3::views::slice(1, 7), cigar_vector};
+}
+
+TEST(cigar_alignment, concepts)
+{
+    EXPECT_TRUE(seqan3::tuple_like<alignment_type>);
+    EXPECT_TRUE(std::ranges::random_access_range<typename alignment_type::reference_row_type>);
+    EXPECT_TRUE(std::ranges::sized_range<typename alignment_type::query_row_type>);
+    EXPECT_SAME_TYPE(std::ranges::range_value_t<typename alignment_type::query_row_type>,
+                     seqan3::gapped<seqan3::dna5>);
+}
+
+TEST(cigar_alignment, rows)
+{
+    alignment_type const alignment = make_alignment();
+
+    using seqan3::get;
+    std::vector<seqan3::gapped<seqan3::dna5>> const reference_row{'T'_dna5, seqan3::gap{}, 'G'_dna5, seqan3::gap{},
+                                                                  'A'_dna5, seqan3::gap{}, 'T'_dna5, 'C'_dna5};
+    std::vector<seqan3::gapped<seqan3::dna5>> const query_row{'G'_dna5, seqan3::gap{}, 'A'_dna5, 'G'_dna5,
+                                                              'T'_dna5, 'A'_dna5, seqan3::gap{}, 'T'_dna5};
+
+    EXPECT_EQ(alignment.size(), 8u);
+    EXPECT_RANGE_EQ(get<0>(alignment), reference_row);
+    EXPECT_RANGE_EQ(get<1>(alignment), query_row);
+    EXPECT_EQ(get<1>(alignment)[6], seqan3::gap{});
+    EXPECT_EQ(alignment.value_at<0>(7), 'C'_dna5);
+
+    // the same alignment as the gap decorators built from the CIGAR string
+    auto gapped_alignment = alignment.materialise();
+    EXPECT_RANGE_EQ(get<0>(alignment), std::get<0>(gapped_alignment));
+    EXPECT_RANGE_EQ(get<1>(alignment), std::get<1>(gapped_alignment));
+}
+
+TEST(cigar_alignment, cigar_vector)
+{
+    alignment_type const alignment = make_alignment();
+
+    // soft clipping is not part of the alignment
+    EXPECT_EQ(alignment.cigar_operations().size(), 8u);
+    EXPECT_EQ(alignment.cigar_vector(1, 1), cigar_vector);
+    EXPECT_EQ(seqan3::detail::get_cigar_string(alignment.cigar_vector()), "1M1P1M1I1M1I1D1M");
+}
+
+TEST(cigar_alignment, clear)
+{
+    alignment_type alignment = make_alignment();
+    alignment.clear();
+
+    EXPECT_TRUE(alignment.empty());
+    EXPECT_TRUE(std::ranges::empty(alignment.query()));
+    EXPECT_TRUE(alignment.cigar_operations().empty());
+    EXPECT_TRUE(std::ranges::empty(seqan3::get<0>(alignment)));
+    EXPECT_TRUE(std::ranges::empty(std::get<1>(alignment.materialise())));
+}
+
+template <typename ref_sequences_t = seqan3::ref_info_not_given, typename ref_ids_t = std::deque<std::string>>
+struct cigar_traits : seqan3::alignment_file_input_default_traits<ref_sequences_t, ref_ids_t>
+{
+    static constexpr bool alignment_as_cigar = true;
+};
+
+std::string const sam_input{
+R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:34
+read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$
+read2	42	ref	2	62	1H7M1D1M1S2H	ref	10	300	AGGCTGNAG	!##$&'()*
+read3	43	ref	3	63	1S1M1P1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
+)"};
+
+TEST(cigar_alignment, alignment_file)
+{
+    std::vector<seqan3::dna5_vector> ref_sequences{reference};
+    std::vector<std::string> ref_ids{"ref"};
+
+    using fields_type = seqan3::fields<seqan3::field::id, seqan3::field::seq, seqan3::field::offset,
+                                       seqan3::field::ref_id, seqan3::field::ref_offset, seqan3::field::alignment>;
+    using traits_type = cigar_traits<std::vector<seqan3::dna5_vector>, std::vector<std::string>>;
+    using input_type = seqan3::alignment_file_input<traits_type, fields_type, seqan3::type_list<seqan3::format_sam>>;
+
+    EXPECT_TRUE(seqan3::detail::is_cigar_alignment_v<typename input_type::alignment_type>);
+
+    std::istringstream cigar_stream{sam_input};
+    input_type cigar_fin{cigar_stream, ref_ids, ref_sequences, seqan3::format_sam{}};
+
+    std::istringstream gapped_stream{sam_input};
+    seqan3::alignment_file_input gapped_fin{gapped_stream, ref_ids, ref_sequences, seqan3::format_sam{}, fields_type{}};
+
+    seqan3::alignment_file_output fout{std::ostringstream{}, ref_ids, std::vector<size_t>{34}, seqan3::format_sam{},
+                                       fields_type{}};
+    fout.options.sam_require_header = false;
+
+    auto gapped_it = gapped_fin.begin();
+    size_t count{0};
+
+    for (auto & record : cigar_fin)
+    {
+        auto & alignment = seqan3::get<seqan3::field::alignment>(record);
+        auto & gapped_alignment = seqan3::get<seqan3::field::alignment>(*gapped_it);
+
+        // the rows are the same as the rows of the gap decorators
+        EXPECT_RANGE_EQ(seqan3::get<0>(alignment), std::get<0>(gapped_alignment));
+        EXPECT_RANGE_EQ(seqan3::get<1>(alignment), std::get<1>(gapped_alignment));
+
+        fout.push_back(record);
+        ++gapped_it;
+        ++count;
+    }
+
+    EXPECT_EQ(count, 3u);
+
+    // the CIGAR strings are written as they were read (without hard clipping)
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(),
+              "read1\t0\tref\t1\t0\t1S1M1D1M1I\t*\t0\t0\tACGT\t*\n"
+              "read2\t0\tref\t2\t0\t7M1D1M1S\t*\t0\t0\tAGGCTGNAG\t*\n"
+              "read3\t0\tref\t3\t0\t1S1M1P1M1I1M1I1D1M1S\t*\t0\t0\tGGAGTATA\t*\n");
+}
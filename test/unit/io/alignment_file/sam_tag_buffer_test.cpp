@@ -0,0 +1,265 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/io/alignment_file/sam_tag_buffer.hpp>
+#include <seqan3/test/expect_same_type.hpp>
+
+using seqan3::operator""_tag;
+
+seqan3::sam_tag_dictionary example_dictionary()
+{
+    seqan3::sam_tag_dictionary dict{};
+
+    dict["NM"_tag] = 7;
+    dict["AS"_tag] = -300;
+    dict["xi"_tag] = 100'000;
+    dict["xa"_tag] = 'Q';
+    dict["xf"_tag] = 1.5f;
+    dict["CO"_tag] = std::string{"comment"};
+    dict["xb"_tag] = std::vector<uint16_t>{3, 4, 5};
+    dict["xc"_tag] = std::vector<int8_t>{-1, 1};
+    dict["xh"_tag] = std::vector<std::byte>{std::byte{0x1a}, std::byte{0xff}};
+
+    return dict;
+}
+
+TEST(sam_tag_buffer, dictionary_round_trip)
+{
+    seqan3::sam_tag_dictionary const dict = example_dictionary();
+    seqan3::sam_tag_buffer const buffer{dict};
+
+    EXPECT_EQ(buffer.size(), dict.size());
+    EXPECT_EQ(buffer.to_dictionary(), dict);
+
+    seqan3::sam_tag_buffer copy{};
+    copy.assign_binary(buffer.binary());
+    EXPECT_EQ(copy, buffer);
+    EXPECT_EQ(copy.tag_entries().size(), buffer.tag_entries().size());
+}
+
+TEST(sam_tag_buffer, get)
+{
+    seqan3::sam_tag_buffer const buffer{example_dictionary()};
+
+    EXPECT_EQ(buffer.get<int32_t>("NM"_tag), 7);
+    EXPECT_EQ(buffer.get<int64_t>("AS"_tag), -300);
+    EXPECT_EQ(buffer.get<uint32_t>("xi"_tag), 100'000u);
+    EXPECT_EQ(buffer.get<char>("xa"_tag), 'Q');
+    EXPECT_EQ(buffer.get<float>("xf"_tag), 1.5f);
+    EXPECT_EQ(buffer.get<std::string_view>("CO"_tag), "comment");
+    EXPECT_EQ(buffer.get<std::vector<uint16_t>>("xb"_tag), (std::vector<uint16_t>{3, 4, 5}));
+    EXPECT_EQ(buffer.get<std::vector<int8_t>>("xc"_tag), (std::vector<int8_t>{-1, 1}));
+    EXPECT_EQ(buffer.get<std::string_view>("xh"_tag), "1AFF");
+    EXPECT_EQ(buffer.get<std::vector<std::byte>>("xh"_tag), (std::vector<std::byte>{std::byte{0x1a}, std::byte{0xff}}));
+
+    // known tags are returned by their type, strings as std::string_view
+    EXPECT_SAME_TYPE(decltype(buffer.get<"NM"_tag>()), int32_t);
+    EXPECT_SAME_TYPE(decltype(buffer.get<"CO"_tag>()), std::string_view);
+    EXPECT_EQ(buffer.get<"NM"_tag>(), 7);
+    EXPECT_EQ(buffer.get<"CO"_tag>(), "comment");
+
+    // integers are stored in the smallest type
+    EXPECT_EQ(buffer.find("NM"_tag)->type, 'C');
+    EXPECT_EQ(buffer.find("AS"_tag)->type, 's');
+    EXPECT_EQ(buffer.find("xi"_tag)->type, 'i');
+
+    EXPECT_TRUE(buffer.contains("NM"_tag));
+    EXPECT_FALSE(buffer.contains("MD"_tag));
+    EXPECT_EQ(buffer.find("MD"_tag), nullptr);
+    EXPECT_THROW(buffer.get<int32_t>("MD"_tag), std::out_of_range);
+    EXPECT_THROW(buffer.get<float>("NM"_tag), std::bad_variant_access);
+    EXPECT_THROW(buffer.get<std::vector<int16_t>>("xb"_tag), std::bad_variant_access);
+    EXPECT_THROW(buffer.get<int32_t>("CO"_tag), std::bad_variant_access);
+}
+
+TEST(sam_tag_buffer, set_and_erase)
+{
+    seqan3::sam_tag_buffer buffer{};
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.set("NM"_tag, 3);
+    buffer.set("CO"_tag, std::string_view{"comment"});
+    buffer.set("xb"_tag, std::vector<float>{0.5f, 1.5f});
+    buffer.set("NM"_tag, 70'000); // replaces and appends the tag
+    buffer.set("xa"_tag, 'A');
+
+    EXPECT_EQ(buffer.size(), 4u);
+    EXPECT_EQ(buffer.tag_entries()[2].tag, "NM"_tag);
+    EXPECT_EQ(buffer.get<int32_t>("NM"_tag), 70'000);
+
+    EXPECT_TRUE(buffer.erase("CO"_tag));
+    EXPECT_FALSE(buffer.erase("CO"_tag));
+    EXPECT_EQ(buffer.size(), 3u);
+
+    // the remaining tags are still found after the bytes were moved
+    EXPECT_EQ(buffer.get<std::vector<float>>("xb"_tag), (std::vector<float>{0.5f, 1.5f}));
+    EXPECT_EQ(buffer.get<int32_t>("NM"_tag), 70'000);
+    EXPECT_EQ(buffer.get<char>("xa"_tag), 'A');
+
+    seqan3::sam_tag_buffer indexed{};
+    indexed.assign_binary(buffer.binary());
+    EXPECT_EQ(indexed, buffer);
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.binary().empty());
+    EXPECT_NE(indexed, buffer);
+}
+
+TEST(sam_tag_buffer, push_back)
+{
+    seqan3::sam_tag_buffer buffer{};
+
+    buffer.push_back("NM"_tag, -7);
+    buffer.push_back("xa"_tag, 'Q');
+    buffer.push_back("xf"_tag, 1.5f);
+    buffer.push_back_string("CO"_tag);
+    for (char const chr : std::string_view{"comment"})
+        buffer.push_back_char(chr);
+    buffer.push_back_string("xh"_tag, 'H');
+    for (char const chr : std::string_view{"1AFF"})
+        buffer.push_back_char(chr);
+    buffer.push_back_array<uint16_t>("xb"_tag);
+    for (uint16_t const value : {3, 4, 500})
+        buffer.push_back_element(value);
+    buffer.push_back_array<float>("xe"_tag); // empty array
+
+    // Appending the values piece by piece yields the same bytes as setting them at once.
+    seqan3::sam_tag_buffer expected{};
+    expected.set("NM"_tag, -7);
+    expected.set("xa"_tag, 'Q');
+    expected.set("xf"_tag, 1.5f);
+    expected.set("CO"_tag, std::string_view{"comment"});
+    expected.set("xh"_tag, std::vector<std::byte>{std::byte{0x1a}, std::byte{0xff}});
+    expected.set("xb"_tag, std::vector<uint16_t>{3, 4, 500});
+    expected.set("xe"_tag, std::vector<float>{});
+
+    EXPECT_EQ(buffer, expected);
+    EXPECT_EQ(buffer.size(), 7u);
+
+    seqan3::sam_tag_buffer indexed{};
+    indexed.assign_binary(buffer.binary());
+    EXPECT_EQ(indexed, buffer);
+
+    auto const & entry = *buffer.find("xb"_tag);
+    EXPECT_EQ(entry.length, 3u);
+    EXPECT_EQ(buffer.get_element<uint16_t>(entry, 0), 3u);
+    EXPECT_EQ(buffer.get_element<uint16_t>(entry, 2), 500u);
+    EXPECT_THROW(buffer.get_element<int16_t>(entry, 0), std::bad_variant_access);
+    EXPECT_EQ(buffer.get<std::string_view>("CO"_tag), "comment");
+}
+
+TEST(sam_tag_buffer, invalid_binary)
+{
+    seqan3::sam_tag_buffer buffer{};
+
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"NM"}), seqan3::format_error);          // truncated
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"NMi\x01", 4}), seqan3::format_error);  // value truncated
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"NMq\x01", 4}), seqan3::format_error);  // unknown type
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"COZabc"}), seqan3::format_error);      // no null character
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"CGBY\x01\0\0\0a", 9}), seqan3::format_error); // array type
+    EXPECT_THROW(buffer.assign_binary(std::string_view{"CGBC\x05\0\0\0a", 9}), seqan3::format_error); // array length
+}
+
+struct buffer_traits : seqan3::alignment_file_input_default_traits<>
+{
+    static constexpr bool tags_as_buffer = true;
+};
+
+std::string const sam_input{
+R"(@HD	VN:1.6	SO:coordinate
+@SQ	SN:ref	LN:34
+read1	41	ref	1	61	1S1M1D1M1I	ref	10	300	ACGT	!##$	AS:i:2	NM:i:7
+read2	42	ref	2	62	1H7M1D1M1S2H	ref	10	300	AGGCTGNAG	!##$&'()*	xy:B:S,3,4,5
+read3	43	ref	3	63	1S1M1P1M1I1M1I1D1M1S	ref	10	300	GGAGTATA	!!*+,-./
+)"};
+
+TEST(sam_tag_buffer, alignment_file)
+{
+    using fields_type = seqan3::fields<seqan3::field::id, seqan3::field::tags>;
+    using input_type = seqan3::alignment_file_input<buffer_traits, fields_type,
+                                                    seqan3::type_list<seqan3::format_sam, seqan3::format_bam>>;
+
+    EXPECT_SAME_TYPE(typename input_type::tag_dictionary_type, seqan3::sam_tag_buffer);
+
+    // SAM -> BAM
+    std::ostringstream bam_stream{};
+    {
+        input_type fin{std::istringstream{sam_input}, seqan3::format_sam{}};
+        seqan3::alignment_file_output fout{bam_stream, std::vector<std::string>{"ref"}, std::vector<size_t>{34},
+                                           seqan3::format_bam{}, fields_type{}};
+
+        for (auto & record : fin)
+            fout.push_back(record);
+    }
+
+    // BAM -> SAM
+    input_type fin{std::istringstream{bam_stream.str()}, seqan3::format_bam{}};
+    seqan3::alignment_file_output fout{std::ostringstream{}, seqan3::format_sam{}, fields_type{}};
+    std::vector<seqan3::sam_tag_buffer> tags{};
+
+    for (auto & record : fin)
+    {
+        tags.push_back(seqan3::get<seqan3::field::tags>(record));
+        fout.push_back(record);
+    }
+
+    ASSERT_EQ(tags.size(), 3u);
+    EXPECT_EQ(tags[0].get<"NM"_tag>(), 7);
+    EXPECT_EQ(tags[0].get<"AS"_tag>(), 2);
+    EXPECT_EQ(tags[1].get<std::vector<uint16_t>>("xy"_tag), (std::vector<uint16_t>{3, 4, 5}));
+    EXPECT_TRUE(tags[2].empty());
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(),
+              "read1\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\tAS:i:2\tNM:i:7\n"
+              "read2\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\txy:B:S,3,4,5\n"
+              "read3\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\n");
+}
+
+TEST(sam_tag_buffer, sam_round_trip)
+{
+    std::string const sam_tags{"NM:i:-7\tAS:i:70000\txa:A:Q\txf:f:1.5\tCO:Z:two words\txh:H:1AFF\t"
+                               "xc:B:c,-1,2\txs:B:S,3,500\txe:B:f,0.5,2"};
+
+    using fields_type = seqan3::fields<seqan3::field::id, seqan3::field::tags>;
+    seqan3::alignment_file_input<buffer_traits, fields_type, seqan3::type_list<seqan3::format_sam>> fin{
+        std::istringstream{"read1\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\t" + sam_tags + "\tNM:i:3\n"},
+        seqan3::format_sam{}};
+    seqan3::alignment_file_output fout{std::ostringstream{}, seqan3::format_sam{}, fields_type{}};
+
+    for (auto & record : fin)
+    {
+        seqan3::sam_tag_buffer const & tags = seqan3::get<seqan3::field::tags>(record);
+
+        EXPECT_EQ(tags.size(), 9u);
+        EXPECT_EQ(tags.get<"NM"_tag>(), 3); // the last value of a tag is kept
+        EXPECT_EQ(tags.get<std::string_view>("CO"_tag), "two words");
+        EXPECT_EQ(tags.get<std::vector<std::byte>>("xh"_tag),
+                  (std::vector<std::byte>{std::byte{0x1a}, std::byte{0xff}}));
+        EXPECT_EQ(tags.get<std::vector<int8_t>>("xc"_tag), (std::vector<int8_t>{-1, 2}));
+        EXPECT_EQ(tags.get<std::vector<float>>("xe"_tag), (std::vector<float>{0.5f, 2.0f}));
+
+        fout.push_back(record);
+    }
+
+    fout.get_stream().flush();
+    EXPECT_EQ(reinterpret_cast<std::ostringstream &>(fout.get_stream()).str(),
+              "read1\t0\t*\t0\t0\t*\t*\t0\t0\t*\t*\t" + sam_tags.substr(std::string_view{"NM:i:-7\t"}.size()) +
+              "\tNM:i:3\n");
+}
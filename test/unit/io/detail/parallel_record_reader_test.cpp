@@ -0,0 +1,83 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <seqan3/io/detail/parallel_record_reader.hpp>
+
+// Every line is a record; the last record of a chunk begins after the last line break.
+size_t find_last_line(std::string_view chunk)
+{
+    size_t const position = chunk.rfind('\n', chunk.size() - 2);
+    return (position == std::string_view::npos) ? 0 : position + 1;
+}
+
+void parse_line(std::istream & stream, std::string & record)
+{
+    std::getline(stream, record);
+
+    if (record == "error")
+        throw std::runtime_error{"error"};
+}
+
+std::vector<std::string> read_all(std::istream & stream, size_t const threads, size_t const chunk_size)
+{
+    seqan3::detail::parallel_record_reader<std::string> reader{stream, threads, find_last_line, parse_line, chunk_size};
+    std::vector<std::string> records{};
+
+    while (!reader.at_end())
+    {
+        auto batch = reader.next_batch();
+        EXPECT_FALSE(batch.error);
+        records.insert(records.end(), batch.records.begin(), batch.records.end());
+    }
+
+    return records;
+}
+
+TEST(parallel_record_reader, records_in_file_order)
+{
+    std::string text{};
+    std::vector<std::string> expected{};
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        expected.push_back("record" + std::to_string(i) + std::string(i % 13, 'x'));
+        text += expected.back() + '\n';
+    }
+
+    for (size_t const threads : {1u, 2u, 4u})
+    {
+        for (size_t const chunk_size : {1u, 7u, 64u, 100000u})
+        {
+            std::istringstream stream{text};
+            EXPECT_EQ(read_all(stream, threads, chunk_size), expected);
+        }
+    }
+}
+
+TEST(parallel_record_reader, empty_stream)
+{
+    std::istringstream stream{};
+    EXPECT_TRUE(read_all(stream, 2, 16).empty());
+}
+
+TEST(parallel_record_reader, error)
+{
+    std::istringstream stream{"a\nb\nerror\nc\n"};
+    seqan3::detail::parallel_record_reader<std::string> reader{stream, 2, find_last_line, parse_line};
+
+    auto batch = reader.next_batch();
+    EXPECT_EQ(batch.records, (std::vector<std::string>{"a", "b"}));
+    ASSERT_TRUE(batch.error);
+    EXPECT_THROW(std::rethrow_exception(batch.error), std::runtime_error);
+}
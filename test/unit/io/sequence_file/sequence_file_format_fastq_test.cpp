@@ -5,7 +5,9 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <istream>
 #include <sstream>
+#include <streambuf>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -109,6 +111,11 @@ struct read : public sequence_file_data
     void do_read_test(std::string const & input)
     {
         std::stringstream istream{input};
+        do_read_test(istream);
+    }
+
+    void do_read_test(std::istream & istream)
+    {
         seqan3::sequence_file_input fin{istream, seqan3::format_fastq{}};
         fin.options = options;
 
@@ -166,6 +173,52 @@ TEST_F(read, whitespace_in_seq_qual)
     do_read_test(input);
 }
 
+// A stream buffer that hands out only a few characters at a time, so that records span many buffer refills.
+struct small_buffer : public std::streambuf
+{
+    small_buffer(std::string data_, size_t chunk_size_) : data{std::move(data_)}, chunk_size{chunk_size_}
+    {
+        setg(data.data(), data.data(), data.data());
+    }
+
+    int_type underflow() override
+    {
+        if (gptr() == egptr() && egptr() != data.data() + data.size())
+            setg(data.data(), egptr(), std::min(egptr() + chunk_size, data.data() + data.size()));
+
+        return (gptr() == egptr()) ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+    std::string data;
+    size_t chunk_size;
+};
+
+TEST_F(read, small_stream_buffer)
+{
+    input =
+    {
+        "@ID1\n"
+        "ACGTTTTTTTT\nTTTTTTT\n"
+        "+\n"
+        "!##$\n%&'()*+,-./++-\n"
+        "@ID2\r\n"
+        "ACGTTTTTTTTTT\r\nTTTTTT\r\nTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT\r\nTTTTTTTTTTTTTTTTTTTTTTT\r\n"
+        "+ID2\r\n"
+        "!##$&'()*+,-./+)*+,-)*+,-)*+,-)*+,BDEBDEBD\r\nEBDEB\r\nDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDEBDE\r\n"
+        "@ID3 lala\n"
+        "ACGTT\nTA\n"
+        "+\n"
+        "!!!!!\n!!"
+    };
+
+    for (size_t chunk_size : {1, 2, 3, 7})
+    {
+        small_buffer buffer{input, chunk_size};
+        std::istream istream{&buffer};
+        do_read_test(istream);
+    }
+}
+
 TEST_F(read, double_id_style)
 {
     input =
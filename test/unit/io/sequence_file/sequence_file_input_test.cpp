@@ -11,14 +11,19 @@
 #include <seqan3/std/iterator>
 #include <seqan3/std/ranges>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/core/detail/debug_stream_alphabet.hpp>
 #include <seqan3/range/views/convert.hpp>
+#include <seqan3/range/views/to_char.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 
 using seqan3::operator""_dna5;
+using seqan3::operator""_phred42;
 
 using default_fields = seqan3::fields<seqan3::field::seq, seqan3::field::id, seqan3::field::qual>;
 
@@ -310,6 +315,151 @@ TEST_F(sequence_file_input_f, record_reading_custom_options)
     EXPECT_EQ((*it).id(), "ID3");
 }
 
+TEST_F(sequence_file_input_f, record_reading_as_views)
+{
+    using file_t = seqan3::sequence_file_input<seqan3::sequence_file_input_view_traits_dna>;
+
+    EXPECT_TRUE((std::same_as<typename file_t::id_type, std::string_view>));
+    EXPECT_TRUE(std::ranges::view<typename file_t::sequence_type>);
+    EXPECT_TRUE(std::ranges::view<typename file_t::quality_type>);
+
+    // The first two records are viewed in the stream buffer, the last one and the multi-line one are copied.
+    std::string const fastq_input
+    {
+        "@TEST 1\n"
+        "ACGT\n"
+        "+\n"
+        "!!!!\n"
+        "@Test2\r\n"
+        "AGGCTGN\r\n"
+        "+\r\n"
+        "##!!!!#\r\n"
+        "@Test3\n"
+        "GGAGTATAATATATA\nTATATATAT\n"
+        "+\n"
+        "IIIIIIIIIIIIIII\nIIIIIIIII\n"
+    };
+
+    auto read_as_views = [&] (std::string const & format_input, auto const & format, bool const has_qualities)
+    {
+        file_t fin{std::istringstream{format_input}, format};
+        fin.options.truncate_ids = true;
+
+        size_t counter = 0;
+        for (auto & rec : fin)
+        {
+            EXPECT_RANGE_EQ(rec.sequence(), seq_comp[counter]);
+            EXPECT_EQ(rec.id(), id_comp[counter].substr(0, id_comp[counter].find(' ')));
+            EXPECT_EQ(size(rec.base_qualities()), has_qualities ? size(seq_comp[counter]) : 0u);
+
+            counter++;
+        }
+
+        EXPECT_EQ(counter, 3u);
+    };
+
+    read_as_views(input, seqan3::format_fasta{}, false);
+    read_as_views(fastq_input, seqan3::format_fastq{}, true);
+}
+
+TEST_F(sequence_file_input_f, record_reading_as_views_invalid)
+{
+    seqan3::sequence_file_input<seqan3::sequence_file_input_view_traits_dna> fin{std::istringstream{"> ID\nACGPT\n>"},
+                                                                                seqan3::format_fasta{}};
+
+    EXPECT_THROW(fin.begin(), seqan3::parse_error);
+}
+
+TEST_F(sequence_file_input_f, record_reading_in_parallel)
+{
+    // Large enough to be cut into several chunks.
+    std::string fasta_input{};
+    std::string fastq_input{};
+    std::vector<std::string> ids{};
+    std::vector<std::string> sequences{};
+
+    for (size_t i = 0; i < 60000; ++i)
+    {
+        ids.push_back("read" + std::to_string(i));
+        sequences.push_back(std::string(50 + i % 100, "ACGTN"[i % 5]));
+        fasta_input += ">" + ids.back() + "\n" + sequences.back() + "\n";
+        // The qualities start with '@' to exercise the detection of record boundaries.
+        fastq_input += "@" + ids.back() + "\n" + sequences.back() + "\n+\n@" + std::string(size(sequences.back()) - 1,
+                                                                                          '!') + "\n";
+    }
+
+    auto read_in_parallel = [&] (std::string const & format_input, auto const & format)
+    {
+        seqan3::sequence_file_input fin{std::istringstream{format_input}, format};
+        fin.options.parsing_threads = 4;
+
+        size_t counter = 0;
+        for (auto & rec : fin)
+        {
+            ASSERT_LT(counter, size(ids));
+            EXPECT_EQ(rec.id(), ids[counter]);
+            EXPECT_RANGE_EQ(rec.sequence() | seqan3::views::to_char, sequences[counter]);
+            counter++;
+        }
+
+        EXPECT_EQ(counter, size(ids));
+    };
+
+    read_in_parallel(fasta_input, seqan3::format_fasta{});
+    read_in_parallel(fastq_input, seqan3::format_fastq{});
+}
+
+TEST_F(sequence_file_input_f, record_reading_in_parallel_invalid)
+{
+    seqan3::sequence_file_input fin{std::istringstream{"> ID1\nACGT\n> ID2\nACGPT\n"}, seqan3::format_fasta{}};
+    fin.options.parsing_threads = 2;
+
+    auto it = fin.begin();
+    EXPECT_EQ((*it).id(), "ID1");
+    EXPECT_THROW(++it, seqan3::parse_error);
+}
+
+TEST_F(sequence_file_input_f, read_batch)
+{
+    std::string const fastq_input
+    {
+        "@TEST 1\nACGT\n+\n!!!!\n"
+        "@Test2\nAGGCTGN\n+\n##!!!!#\n"
+        "@Test3\nGGAGTATAATATATATATATATAT\n+\nIIIIIIIIIIIIIIIIIIIIIIII\n"
+    };
+
+    seqan3::sequence_file_input fin{std::istringstream{fastq_input}, seqan3::format_fastq{}};
+
+    auto & batch = fin.read_batch(2);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_RANGE_EQ(batch.sequences, (std::vector<seqan3::dna5_vector>{seq_comp[0], seq_comp[1]}));
+    EXPECT_RANGE_EQ(batch.ids, (std::vector<std::string>{id_comp[0], id_comp[1]}));
+    EXPECT_RANGE_EQ(batch.base_qualities[1], "##!!!!#"_phred42);
+
+    // The batch is reused.
+    EXPECT_EQ(&fin.read_batch(2), &batch);
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_RANGE_EQ(batch.sequences[0], seq_comp[2]);
+    EXPECT_RANGE_EQ(batch.ids[0], id_comp[2]);
+    EXPECT_EQ(size(batch.base_qualities[0]), size(seq_comp[2]));
+
+    EXPECT_TRUE(fin.read_batch(2).empty());
+}
+
+TEST_F(sequence_file_input_f, read_batch_after_iteration)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    auto it = fin.begin();
+    EXPECT_RANGE_EQ((*it).id(), id_comp[0]);
+
+    // The batch starts with the current record.
+    auto & batch = fin.read_batch(10);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_RANGE_EQ(batch.ids, id_comp);
+    EXPECT_EQ(fin.begin(), fin.end());
+}
+
 TEST_F(sequence_file_input_f, file_view)
 {
     seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
@@ -519,3 +669,36 @@ TEST_F(sequence_file_input_f, read_empty_bz2_file)
     EXPECT_TRUE(fin.begin() == fin.end());
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+std::string input_zstd
+{
+    '\x28','\xB5','\x2F','\xFD','\x04','\x58','\xBD','\x01','\x00','\x04','\x03','\x3E','\x20','\x54','\x45','\x53',
+    '\x54','\x20','\x31','\x0A','\x41','\x43','\x47','\x54','\x0A','\x3E','\x54','\x65','\x73','\x74','\x32','\x0A',
+    '\x41','\x47','\x47','\x43','\x54','\x47','\x4E','\x0A','\x3E','\x20','\x54','\x65','\x73','\x74','\x33','\x0A',
+    '\x47','\x47','\x41','\x47','\x54','\x41','\x54','\x41','\x41','\x54','\x0A','\x01','\x00','\x4F','\x76','\x65',
+    '\xFA','\x2E','\x51','\xFF'
+};
+
+TEST_F(sequence_file_input_f, decompression_by_filename_zstd)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    {
+        std::ofstream of{filename.get_path(), std::ios::binary};
+
+        std::copy(begin(input_zstd), end(input_zstd), std::ostreambuf_iterator<char>{of});
+    }
+
+    seqan3::sequence_file_input fin{filename.get_path()};
+
+    decompression_impl(*this, fin);
+}
+
+TEST_F(sequence_file_input_f, decompression_by_stream_zstd)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input_zstd}, seqan3::format_fasta{}};
+
+    decompression_impl(*this, fin);
+}
+#endif
@@ -13,6 +13,12 @@
 #include <range/v3/view/filter.hpp>
 
 #include <seqan3/alphabet/quality/phred42.hpp>
+#ifdef SEQAN3_HAS_ZLIB
+#include <seqan3/contrib/stream/bgzf_istream.hpp>
+#endif
+#ifdef SEQAN3_HAS_ZSTD
+#include <seqan3/contrib/stream/zstd_istream.hpp>
+#endif
 #include <seqan3/io/sequence_file/output.hpp>
 #include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/std/iterator>
@@ -568,6 +574,38 @@ TEST(compression, by_stream_bgzf)
     EXPECT_EQ(buffer, expected_bgzf);
 }
 
+TEST(compression, compression_level)
+{
+    auto compress = [] (int const level)
+    {
+        std::ostringstream out;
+
+        {
+            seqan3::contrib::bgzf_ostream compout{out};
+            seqan3::sequence_file_output fout{compout, seqan3::format_fasta{}};
+            fout.options.fasta_letters_per_line = 0;
+            fout.options.compression_level = level;
+
+            for (size_t i = 0; i < 3; ++i)
+                fout.emplace_back(seqs[i], ids[i]);
+
+            EXPECT_EQ(compout.compression_level(), level);
+        }
+
+        return out.str();
+    };
+
+    std::string const stored = compress(0);
+    EXPECT_GT(stored.size(), expected_bgzf.size());
+
+    std::istringstream in{stored};
+    seqan3::contrib::bgzf_istream decompressed{in};
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}}),
+              output_comp);
+
+    EXPECT_THROW(compress(10), std::invalid_argument);
+}
+
 #endif
 
 #ifdef SEQAN3_HAS_BZIP2
@@ -601,3 +639,62 @@ TEST(compression, by_stream_bz2)
     EXPECT_EQ(out.str(), expected_bz2);
 }
 #endif
+
+#ifdef SEQAN3_HAS_ZSTD
+std::string expected_zstd
+{
+    '\x28','\xB5','\x2F','\xFD','\x04','\x58','\xB5','\x01','\x00','\xA4','\x02','\x3E','\x20','\x54','\x45','\x53',
+    '\x54','\x20','\x31','\x0A','\x41','\x43','\x47','\x54','\x0A','\x3E','\x20','\x54','\x65','\x73','\x74','\x32',
+    '\x0A','\x41','\x47','\x47','\x43','\x54','\x47','\x4E','\x33','\x0A','\x47','\x47','\x41','\x47','\x54','\x41',
+    '\x54','\x41','\x41','\x54','\x0A','\x03','\x00','\xB9','\xCC','\x33','\xB8','\xA0','\xD0','\x54','\x9C','\x56',
+    '\xA6','\x0E','\x82'
+};
+
+TEST(compression, by_filename_zstd)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    std::string buffer = compression_by_filename_impl(filename);
+    EXPECT_EQ(buffer, expected_zstd);
+}
+
+TEST(compression, by_stream_zstd)
+{
+    std::ostringstream out;
+
+    {
+        seqan3::contrib::zstd_ostream compout{out};
+        compression_by_stream_impl(compout);
+    }
+
+    EXPECT_EQ(out.str(), expected_zstd);
+}
+
+TEST(compression, zstd_frame_size)
+{
+    seqan3::test::tmp_filename filename{"sequence_file_output_test.fasta.zst"};
+
+    {
+        seqan3::sequence_file_output fout{filename.get_path()};
+        fout.options.fasta_letters_per_line = 0;
+        fout.options.zstd_frame_size = 16;
+
+        for (size_t i = 0; i < 3; ++i)
+            fout.emplace_back(seqs[i], ids[i]);
+    }
+
+    std::ifstream compressed{filename.get_path(), std::ios::binary};
+    seqan3::contrib::zstd_istream decompressed{compressed};
+    std::string buffer(24, ' ');
+
+    // The seek table of the seekable format gives the uncompressed size and the frame of every position.
+    decompressed.seekg(-25, std::ios_base::end);
+    EXPECT_EQ(static_cast<size_t>(decompressed.tellg()), output_comp.size() - 25);
+    decompressed.read(buffer.data(), buffer.size());
+    EXPECT_EQ(buffer, "GGAGTATAATATATATATATATAT");
+
+    decompressed.seekg(0);
+    EXPECT_EQ((std::string{std::istreambuf_iterator<char>{decompressed}, std::istreambuf_iterator<char>{}}),
+              output_comp);
+}
+#endif
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/std/algorithm>
 #include <seqan3/std/iterator>
+#include <streambuf>
+#include <string>
+#include <vector>
 
 #include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
 
@@ -54,3 +58,79 @@ TEST(fast_istreambuf_iterator, comparison)
     EXPECT_TRUE(it != std::default_sentinel);
     EXPECT_TRUE(std::default_sentinel != it);
 }
+
+// A stream buffer that hands out at most `chunk_size` characters per underflow.
+struct small_buffer : public std::streambuf
+{
+    small_buffer(std::string data_, size_t chunk_size_) : data{std::move(data_)}, chunk_size{chunk_size_}
+    {
+        setg(data.data(), data.data(), data.data());
+    }
+
+    int_type underflow() override
+    {
+        if (gptr() == egptr() && egptr() != data.data() + data.size())
+            setg(data.data(), egptr(), std::min(egptr() + chunk_size, data.data() + data.size()));
+
+        return (gptr() == egptr()) ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+    std::string data;
+    size_t chunk_size;
+};
+
+TEST(fast_istreambuf_iterator, consume_chunks)
+{
+    small_buffer buffer{"test\nline", 3};
+    seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+    std::vector<std::string> chunks{};
+
+    // consume everything
+    EXPECT_FALSE(it.consume_chunks([&] (std::string_view const chunk)
+    {
+        chunks.emplace_back(chunk);
+        return chunk.size();
+    }));
+    EXPECT_EQ(chunks, (std::vector<std::string>{"tes", "t\nl", "ine"}));
+    EXPECT_TRUE(it == std::default_sentinel);
+}
+
+TEST(fast_istreambuf_iterator, consume_chunks_partially)
+{
+    small_buffer buffer{"test\nline", 3};
+    seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+
+    // stop after the fourth character
+    size_t remaining = 4;
+    EXPECT_TRUE(it.consume_chunks([&] (std::string_view const chunk)
+    {
+        size_t const consumed = std::min(remaining, chunk.size());
+        remaining -= consumed;
+        return consumed;
+    }));
+    EXPECT_EQ(*it, '\n');
+}
+
+TEST(fast_istreambuf_iterator, read_until)
+{
+    small_buffer buffer{"test\r\nline;end", 4};
+    seqan3::detail::fast_istreambuf_iterator<char> it{buffer};
+    std::string result{};
+    auto append = [&] (std::string_view const chunk) { result += chunk; };
+
+    EXPECT_TRUE(it.read_until(append, '\n', '\r'));
+    EXPECT_EQ(result, "test");
+    EXPECT_EQ(*it, '\r');
+
+    result.clear();
+    ++it;
+    ++it;
+    EXPECT_TRUE(it.read_until(append, ';'));
+    EXPECT_EQ(result, "line");
+    EXPECT_EQ(*it, ';');
+
+    result.clear();
+    EXPECT_FALSE(it.read_until(append, '\n'));
+    EXPECT_EQ(result, ";end");
+    EXPECT_TRUE(it == std::default_sentinel);
+}
@@ -0,0 +1,124 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/io/stream/detail/mmap_istream.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+#ifdef SEQAN3_HAS_MMAP
+
+struct mmap_istream_test : public ::testing::Test
+{
+    std::string const content{"@read1\nACGT\n+\n!!!!\n"};
+
+    seqan3::test::tmp_filename filename{"mmap_istream_test.fastq"};
+
+    void write_file(std::string const & text)
+    {
+        std::ofstream file{filename.get_path(), std::ios::binary};
+        file << text;
+    }
+};
+
+TEST_F(mmap_istream_test, read)
+{
+    write_file(content);
+
+    seqan3::detail::mmap_istream stream{filename.get_path()};
+    ASSERT_TRUE(stream.good());
+    EXPECT_TRUE(stream.is_open());
+
+    std::string line{};
+    std::getline(stream, line);
+    EXPECT_EQ(line, "@read1");
+
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}),
+              content.substr(7));
+}
+
+TEST_F(mmap_istream_test, whole_file_is_buffered)
+{
+    write_file(content);
+
+    seqan3::detail::mmap_istream stream{filename.get_path()};
+    seqan3::detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()};
+
+    size_t chunk_count = 0;
+    EXPECT_FALSE(it.consume_chunks([&] (std::string_view const chunk)
+    {
+        EXPECT_EQ(chunk, content);
+        ++chunk_count;
+        return chunk.size();
+    }));
+    EXPECT_EQ(chunk_count, 1u);
+}
+
+TEST_F(mmap_istream_test, seek)
+{
+    write_file(content);
+
+    seqan3::detail::mmap_istream stream{filename.get_path()};
+
+    stream.seekg(7);
+    EXPECT_EQ(stream.tellg(), 7);
+    EXPECT_EQ(stream.get(), 'A');
+
+    stream.seekg(-5, std::ios_base::end);
+    EXPECT_EQ(stream.get(), '!');
+
+    stream.seekg(-2, std::ios_base::cur);
+    EXPECT_EQ(stream.get(), '\n');
+
+    std::string buffer(4, ' ');
+    stream.read(buffer.data(), 4);
+    EXPECT_EQ(buffer, "!!!!");
+
+    stream.seekg(100);
+    EXPECT_TRUE(stream.fail());
+}
+
+TEST_F(mmap_istream_test, unget)
+{
+    write_file(content);
+
+    seqan3::detail::mmap_istream stream{filename.get_path()};
+
+    EXPECT_EQ(stream.get(), '@');
+    EXPECT_EQ(stream.get(), 'r');
+    stream.unget();
+    stream.unget();
+    EXPECT_EQ(stream.get(), '@');
+}
+
+TEST_F(mmap_istream_test, empty_file)
+{
+    write_file("");
+
+    seqan3::detail::mmap_istream stream{filename.get_path()};
+    EXPECT_TRUE(stream.good());
+    EXPECT_TRUE(stream.is_open());
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(mmap_istream_test, not_mappable)
+{
+    seqan3::detail::mmap_istream missing{filename.get_path()}; // file does not exist
+    EXPECT_TRUE(missing.fail());
+    EXPECT_FALSE(missing.is_open());
+
+    seqan3::detail::mmap_istream directory{filename.get_path().parent_path()};
+    EXPECT_TRUE(directory.fail());
+}
+
+#endif // SEQAN3_HAS_MMAP
@@ -7,12 +7,16 @@
 
 #include <gtest/gtest.h>
 
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
 #include <seqan3/range/views/complement.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 
 #include "container_test_template.hpp"
 
@@ -39,3 +43,72 @@ TEST(bitcompressed_vector_test, issue1743_view_combinability)
     EXPECT_EQ(v.size(), complement.size());
     EXPECT_RANGE_EQ(complement, (seqan3::dna4_vector{'T'_dna4, 'G'_dna4, 'C'_dna4, 'A'_dna4}));
 }
+
+template <typename alphabet_t>
+class bitcompressed_vector_words_test : public ::testing::Test
+{};
+
+// 2, 3, 4 and 5 bits per letter: the letters of the latter cross word boundaries
+using word_alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27>;
+
+TYPED_TEST_SUITE(bitcompressed_vector_words_test, word_alphabet_types, );
+
+TYPED_TEST(bitcompressed_vector_words_test, append)
+{
+    auto const sequence = seqan3::test::generate_sequence<TypeParam>(1000);
+    seqan3::bitcompressed_vector<TypeParam> v{};
+
+    // append slices of different lengths, so that they start at every offset within a word
+    size_t appended = 0;
+    for (size_t length = 0; appended + length <= sequence.size(); appended += length, ++length)
+        v.insert(v.cend(), sequence.begin() + appended, sequence.begin() + appended + length);
+
+    EXPECT_RANGE_EQ(v, (std::vector<TypeParam>(sequence.begin(), sequence.begin() + appended)));
+
+    // copy subranges of another bitcompressed_vector
+    for (size_t begin : {0, 1, 13, 64, 100})
+    {
+        for (size_t end : {100, 101, 164, 999})
+        {
+            seqan3::bitcompressed_vector<TypeParam> prefix{sequence.begin(), sequence.begin() + 7};
+            prefix.insert(prefix.cend(), v.cbegin() + begin, v.cbegin() + end);
+            prefix.insert(prefix.cend(), v.begin() + begin, v.begin() + end);
+
+            std::vector<TypeParam> expected(sequence.begin(), sequence.begin() + 7);
+            expected.insert(expected.end(), sequence.begin() + begin, sequence.begin() + end);
+            expected.insert(expected.end(), sequence.begin() + begin, sequence.begin() + end);
+            EXPECT_RANGE_EQ(prefix, expected);
+
+            seqan3::bitcompressed_vector<TypeParam> copy{v.begin() + begin, v.begin() + end};
+            EXPECT_RANGE_EQ(copy, (std::vector<TypeParam>(sequence.begin() + begin, sequence.begin() + end)));
+        }
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_words_test, compare)
+{
+    auto const sequence = seqan3::test::generate_sequence<TypeParam>(200);
+
+    for (size_t position : {0, 1, 31, 32, 63, 64, 150, 199})
+    {
+        for (size_t size : {0, 1, 64, 150, 200})
+        {
+            std::vector<TypeParam> lhs(sequence.begin(), sequence.begin() + size);
+            std::vector<TypeParam> rhs(sequence.begin(), sequence.end());
+            seqan3::assign_rank_to((seqan3::to_rank(rhs[position]) + 1) % seqan3::alphabet_size<TypeParam>,
+                                   rhs[position]);
+
+            seqan3::bitcompressed_vector<TypeParam> const packed_lhs{lhs};
+            seqan3::bitcompressed_vector<TypeParam> const packed_rhs{rhs};
+
+            EXPECT_EQ(packed_lhs < packed_rhs, lhs < rhs);
+            EXPECT_EQ(packed_lhs > packed_rhs, lhs > rhs);
+            EXPECT_EQ(packed_lhs <= packed_rhs, lhs <= rhs);
+            EXPECT_EQ(packed_lhs >= packed_rhs, lhs >= rhs);
+            EXPECT_EQ(packed_lhs == packed_rhs, lhs == rhs);
+            EXPECT_EQ(packed_rhs < packed_lhs, rhs < lhs);
+            EXPECT_FALSE(packed_lhs < packed_lhs);
+            EXPECT_TRUE(packed_lhs <= packed_lhs);
+        }
+    }
+}
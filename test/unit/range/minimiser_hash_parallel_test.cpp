@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/minimiser_hash_parallel.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/range/views/single_pass_input.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+using minimiser_sets_t = std::vector<std::set<size_t>>;
+
+static seqan3::seed const test_seed{0x8F3F73B5CF1C9ADE};
+
+std::vector<seqan3::dna4_vector> generate_sequences()
+{
+    std::vector<seqan3::dna4_vector> sequences{};
+
+    sequences.push_back(seqan3::test::generate_sequence<seqan3::dna4>(10'000, 0, 0));
+    sequences.push_back(""_dna4);
+    sequences.push_back("ACGT"_dna4); // shorter than the shapes
+    sequences.push_back(seqan3::test::generate_sequence<seqan3::dna4>(100, 0, 1));
+    sequences.push_back(seqan3::dna4_vector(1'000, 'A'_dna4)); // every window contains the same minimiser
+
+    seqan3::dna4_vector repeat{};
+    for (size_t i = 0; i < 200; ++i)
+        repeat.insert(repeat.end(), {'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'T'_dna4, 'G'_dna4});
+    sequences.push_back(std::move(repeat));
+
+    sequences.push_back(seqan3::test::generate_sequence<seqan3::dna4>(5'000, 0, 2));
+
+    return sequences;
+}
+
+minimiser_sets_t expected_minimisers(std::vector<seqan3::dna4_vector> const & sequences,
+                                     seqan3::shape const & shape,
+                                     seqan3::window_size const window_size)
+{
+    minimiser_sets_t expected{};
+
+    for (auto const & sequence : sequences)
+    {
+        auto minimisers = sequence | seqan3::views::minimiser_hash(shape, window_size, test_seed);
+        expected.emplace_back(minimisers.begin(), minimisers.end());
+    }
+
+    return expected;
+}
+
+template <typename sequences_t>
+minimiser_sets_t parallel_minimisers(sequences_t && sequences,
+                                     size_t const sequence_count,
+                                     seqan3::shape const & shape,
+                                     seqan3::window_size const window_size,
+                                     size_t const thread_count,
+                                     size_t const chunk_size)
+{
+    minimiser_sets_t result(sequence_count);
+    std::mutex result_mutex{};
+
+    // The callback of the detail interface is invoked concurrently.
+    auto callback = [&] (size_t const sequence_index, std::span<size_t const> minimisers)
+    {
+        std::lock_guard lock{result_mutex};
+        result[sequence_index].insert(minimisers.begin(), minimisers.end());
+    };
+
+    seqan3::detail::minimiser_hash_parallel(std::forward<sequences_t>(sequences), shape, window_size, test_seed,
+                                            thread_count, chunk_size, callback);
+    return result;
+}
+
+template <typename sequences_t>
+void check_chunks(sequences_t & sequences, std::vector<seqan3::dna4_vector> const & reference)
+{
+    for (seqan3::shape const & shape : {seqan3::shape{seqan3::ungapped{12}}, 0b1101101_shape})
+    {
+        minimiser_sets_t const expected = expected_minimisers(reference, shape, seqan3::window_size{20});
+
+        for (size_t const thread_count : {1u, 4u})
+        {
+            for (size_t const chunk_size : {1u, 7u, 1000u})
+            {
+                EXPECT_EQ(parallel_minimisers(sequences, reference.size(), shape, seqan3::window_size{20},
+                                              thread_count, chunk_size),
+                          expected);
+            }
+        }
+    }
+}
+
+TEST(minimiser_hash_parallel, vector_of_vectors)
+{
+    std::vector<seqan3::dna4_vector> sequences = generate_sequences();
+    check_chunks(sequences, sequences);
+}
+
+TEST(minimiser_hash_parallel, concatenated_sequences)
+{
+    std::vector<seqan3::dna4_vector> const reference = generate_sequences();
+    seqan3::concatenated_sequences<seqan3::dna4_vector> sequences{reference};
+    check_chunks(sequences, reference);
+}
+
+TEST(minimiser_hash_parallel, vector_of_lists)
+{
+    std::vector<seqan3::dna4_vector> const reference = generate_sequences();
+    std::vector<std::list<seqan3::dna4>> sequences{};
+
+    for (auto const & sequence : reference)
+        sequences.emplace_back(sequence.begin(), sequence.end());
+
+    check_chunks(sequences, reference);
+}
+
+TEST(minimiser_hash_parallel, single_pass_input)
+{
+    std::vector<seqan3::dna4_vector> const reference = generate_sequences();
+    seqan3::shape const shape{seqan3::ungapped{12}};
+    minimiser_sets_t const expected = expected_minimisers(reference, shape, seqan3::window_size{20});
+
+    for (size_t const chunk_size : {1u, 7u, 1000u})
+    {
+        std::vector<seqan3::dna4_vector> sequences{reference};
+        EXPECT_EQ(parallel_minimisers(sequences | seqan3::views::single_pass_input, reference.size(), shape,
+                                      seqan3::window_size{20}, 4u, chunk_size),
+                  expected);
+    }
+}
+
+TEST(minimiser_hash_parallel, sink)
+{
+    std::vector<seqan3::dna4_vector> const sequences = generate_sequences();
+    std::vector<std::vector<size_t>> result(sequences.size());
+
+    // The sink is never invoked concurrently.
+    seqan3::minimiser_hash_parallel(sequences, seqan3::ungapped{12}, seqan3::window_size{20},
+                                    [&] (size_t const sequence_index, std::span<size_t const> minimisers)
+    {
+        result[sequence_index].insert(result[sequence_index].end(), minimisers.begin(), minimisers.end());
+    }, 4u, test_seed);
+
+    // Every sequence is shorter than a chunk, so the minimisers are reported in the order of the view.
+    for (size_t i = 0; i < sequences.size(); ++i)
+    {
+        EXPECT_EQ(result[i],
+                  sequences[i] | seqan3::views::minimiser_hash(seqan3::ungapped{12}, seqan3::window_size{20}, test_seed)
+                               | seqan3::views::to<std::vector<size_t>>);
+    }
+}
+
+TEST(minimiser_hash_parallel, empty_collection)
+{
+    std::vector<seqan3::dna4_vector> sequences{};
+    size_t calls{0};
+
+    seqan3::minimiser_hash_parallel(sequences, seqan3::ungapped{4}, seqan3::window_size{8},
+                                    [&] (size_t const, std::span<size_t const>) { ++calls; });
+
+    EXPECT_EQ(calls, 0u);
+}
+
+TEST(minimiser_hash_parallel, exceptions)
+{
+    std::vector<seqan3::dna4_vector> const sequences = generate_sequences();
+    auto ignore = [] (size_t const, std::span<size_t const>) {};
+
+    EXPECT_THROW(seqan3::minimiser_hash_parallel(sequences, seqan3::ungapped{21}, seqan3::window_size{20}, ignore),
+                 std::invalid_argument);
+
+    auto throw_on_last = [&] (size_t const sequence_index, std::span<size_t const>)
+    {
+        if (sequence_index + 1 == sequences.size())
+            throw std::runtime_error{"Sink failed."};
+    };
+
+    EXPECT_THROW(seqan3::minimiser_hash_parallel(sequences, seqan3::ungapped{12}, seqan3::window_size{20},
+                                                 throw_on_last, 4u),
+                 std::runtime_error);
+}
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/reverse_complement.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+template <typename container_t>
+class reverse_complement_test : public ::testing::Test
+{};
+
+using container_types = ::testing::Types<std::vector<seqan3::dna4>,
+                                         std::vector<seqan3::dna5>,
+                                         std::vector<seqan3::rna4>,
+                                         std::vector<seqan3::dna15>,
+                                         std::deque<seqan3::dna4>,
+                                         std::list<seqan3::dna5>,
+                                         seqan3::bitcompressed_vector<seqan3::dna4>,
+                                         seqan3::bitcompressed_vector<seqan3::rna4>,
+                                         seqan3::bitcompressed_vector<seqan3::dna5>>;
+
+TYPED_TEST_SUITE(reverse_complement_test, container_types, );
+
+TYPED_TEST(reverse_complement_test, in_place)
+{
+    using alphabet_t = std::ranges::range_value_t<TypeParam>;
+
+    // cover the SIMD blocks, the packed words and the remainders in between
+    for (size_t size : {0, 1, 2, 3, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 127, 128, 129, 1000})
+    {
+        auto const sequence = seqan3::test::generate_sequence<alphabet_t>(size, 0, size);
+        auto const expected = sequence | std::views::reverse | seqan3::views::complement
+                                       | seqan3::views::to<std::vector>;
+
+        TypeParam container(sequence.begin(), sequence.end());
+        seqan3::reverse_complement(container);
+        EXPECT_RANGE_EQ(container, expected);
+
+        // the reverse complement of the reverse complement is the original sequence
+        seqan3::reverse_complement(container);
+        EXPECT_RANGE_EQ(container, sequence);
+    }
+}
+
+TYPED_TEST(reverse_complement_test, copy)
+{
+    using alphabet_t = std::ranges::range_value_t<TypeParam>;
+
+    for (size_t size : {0, 1, 2, 31, 32, 33, 64, 65, 1000})
+    {
+        auto const sequence = seqan3::test::generate_sequence<alphabet_t>(size, 0, size);
+        auto const expected = sequence | std::views::reverse | seqan3::views::complement
+                                       | seqan3::views::to<std::vector>;
+
+        TypeParam const container(sequence.begin(), sequence.end());
+
+        std::vector<alphabet_t> contiguous(size);
+        EXPECT_EQ(seqan3::reverse_complement_copy(container, contiguous.begin()), contiguous.end());
+        EXPECT_RANGE_EQ(contiguous, expected);
+
+        std::vector<alphabet_t> appended{};
+        seqan3::reverse_complement_copy(container, std::back_inserter(appended));
+        EXPECT_RANGE_EQ(appended, expected);
+
+        // the input is not modified
+        EXPECT_RANGE_EQ(container, sequence);
+    }
+}
+
+TEST(reverse_complement, view)
+{
+    using seqan3::operator""_dna5;
+
+    seqan3::dna5_vector sequence{"AACGTNACCGT"_dna5};
+    seqan3::reverse_complement(sequence | std::views::drop(2) | std::views::take(5));
+
+    EXPECT_RANGE_EQ(sequence, "AATNACGCCGT"_dna5);
+}
+
+TEST(reverse_complement, packed_words)
+{
+    using seqan3::operator""_dna4;
+
+    seqan3::bitcompressed_vector<seqan3::dna4> sequence{"ACGTTGCAAAAC"_dna4};
+    seqan3::reverse_complement(sequence);
+    EXPECT_RANGE_EQ(sequence, "GTTTTGCAACGT"_dna4);
+
+    // the container stays usable after the words have been rewritten
+    sequence.push_back('G'_dna4);
+    sequence.erase(sequence.begin());
+    EXPECT_RANGE_EQ(sequence, "TTTTGCAACGTG"_dna4);
+    seqan3::reverse_complement(sequence);
+    EXPECT_RANGE_EQ(sequence, "CACGTTGCAAAA"_dna4);
+}
@@ -5,6 +5,7 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <forward_list>
 #include <list>
 #include <type_traits>
@@ -335,3 +336,181 @@ TYPED_TEST(kmer_hash_gapped_test, issue2415)
         EXPECT_RANGE_EQ(gapped, v);
     }
 }
+
+TEST(kmer_hash_ungapped_test, packed_words)
+{
+    std::vector<seqan3::dna4> text{};
+    for (size_t i = 0; i < 300; ++i)
+        text.push_back(seqan3::assign_rank_to((i * 7 + i / 5) % 4, seqan3::dna4{}));
+
+    seqan3::bitcompressed_vector<seqan3::dna4> const packed{text};
+
+    // cover k-mers within a word, across two words and of the maximal size
+    for (uint8_t k : {1, 5, 17, 31, 32})
+    {
+        auto expected = text | seqan3::views::kmer_hash(seqan3::ungapped{k});
+        auto v = packed | seqan3::views::kmer_hash(seqan3::ungapped{k});
+        EXPECT_RANGE_EQ(expected, v);
+        EXPECT_RANGE_EQ(expected | std::views::reverse, v | std::views::reverse);
+
+        // random access
+        EXPECT_EQ(expected[100], v[100]);
+        EXPECT_EQ(*(std::ranges::begin(expected) + 250), *(std::ranges::begin(v) + 250));
+    }
+
+    // the incoming letters are read 32 at a time and again after moving backwards
+    auto expected = text | seqan3::views::kmer_hash(0b1101_shape);
+    auto v = packed | seqan3::views::kmer_hash(0b1101_shape);
+    auto expected_it = std::ranges::begin(expected);
+    auto it = std::ranges::begin(v);
+
+    for (size_t i = 0; i < 200; ++i)
+    {
+        if (i % 7 == 6)
+        {
+            --expected_it;
+            --it;
+        }
+        else
+        {
+            ++expected_it;
+            ++it;
+        }
+
+        EXPECT_EQ(*expected_it, *it);
+    }
+}
+
+TYPED_TEST(kmer_hash_ungapped_test, canonical)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4, 'C'_dna4}; // ACGTAGC
+    result_t canonical{6, 6, 44, 28, 9};
+    EXPECT_RANGE_EQ(canonical, text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3}));
+
+    if constexpr (std::ranges::bidirectional_range<TypeParam>)
+    {
+        EXPECT_RANGE_EQ(canonical | std::views::reverse,
+                        text | seqan3::views::canonical_kmer_hash(seqan3::ungapped{3}) | std::views::reverse);
+    }
+}
+
+TYPED_TEST(kmer_hash_gapped_test, canonical)
+{
+    TypeParam text{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4, 'A'_dna4, 'G'_dna4, 'C'_dna4}; // ACGTAGC
+    result_t canonical{2, 2, 8, 4, 1};
+    EXPECT_RANGE_EQ(canonical, text | seqan3::views::canonical_kmer_hash(0b101_shape));
+
+    if constexpr (std::ranges::bidirectional_range<TypeParam>)
+    {
+        EXPECT_RANGE_EQ(canonical | std::views::reverse,
+                        text | seqan3::views::canonical_kmer_hash(0b101_shape) | std::views::reverse);
+    }
+}
+
+// Computes the hash values by the definition.
+template <typename text_t>
+result_t expected_hashes(text_t const & text, seqan3::shape const & shape)
+{
+    using alphabet_t = std::ranges::range_value_t<text_t>;
+    result_t result{};
+
+    for (size_t pos = 0; pos + shape.size() <= text.size(); ++pos)
+    {
+        size_t hash{0};
+
+        for (size_t i = 0; i < shape.size(); ++i)
+        {
+            if (shape[i])
+                hash = hash * seqan3::alphabet_size<alphabet_t> + seqan3::to_rank(text[pos + i]);
+        }
+
+        result.push_back(hash);
+    }
+
+    return result;
+}
+
+template <typename alphabet_t>
+std::vector<alphabet_t> generate_text()
+{
+    std::vector<alphabet_t> text{};
+    for (size_t i = 0; i < 300; ++i)
+        text.push_back(seqan3::assign_rank_to((i * 7 + i / 5) % seqan3::alphabet_size<alphabet_t>, alphabet_t{}));
+
+    return text;
+}
+
+TEST(kmer_hash_gapped_test, window)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>();
+    std::list<seqan3::dna4> const list_text{text.begin(), text.end()};
+    seqan3::bitcompressed_vector<seqan3::dna4> const packed{text};
+
+    // gapped and ungapped shapes that fit into one word and a shape with a span that exceeds a word
+    for (seqan3::shape const & shape : {0b1_shape, 0b11_shape, 0b1101_shape, 0b1001011_shape,
+                                        seqan3::shape{seqan3::ungapped{32}},
+                                        0b1111111111111111000000001111111111111111_shape})
+    {
+        result_t const expected = expected_hashes(text, shape);
+        EXPECT_RANGE_EQ(expected, text | seqan3::views::kmer_hash(shape));
+        EXPECT_RANGE_EQ(expected, list_text | seqan3::views::kmer_hash(shape));
+        EXPECT_RANGE_EQ(expected, packed | seqan3::views::kmer_hash(shape));
+        EXPECT_RANGE_EQ(expected | std::views::reverse, text | seqan3::views::kmer_hash(shape) | std::views::reverse);
+        EXPECT_RANGE_EQ(expected | std::views::reverse, packed | seqan3::views::kmer_hash(shape) | std::views::reverse);
+
+        // random access
+        auto v = packed | seqan3::views::kmer_hash(shape);
+        EXPECT_EQ(expected[100], v[100]);
+        EXPECT_EQ(expected[200], *(std::ranges::begin(v) + 200));
+    }
+}
+
+template <typename alphabet_t>
+void test_canonical_against_reverse_complement()
+{
+    std::vector<alphabet_t> const text = generate_text<alphabet_t>();
+    std::list<alphabet_t> const list_text{text.begin(), text.end()};
+
+    for (seqan3::shape const & shape : {0b1_shape, 0b111_shape, 0b1101_shape, 0b1001011_shape,
+                                        seqan3::shape{seqan3::ungapped{20}},
+                                        0b1111111100000000000000000000000000000000011111111_shape})
+    {
+        result_t const forward = expected_hashes(text, shape);
+        auto reverse = text | seqan3::views::complement
+                                  | std::views::reverse
+                                  | seqan3::views::kmer_hash(shape)
+                                  | std::views::reverse;
+
+        result_t expected{};
+        for (size_t i = 0; i < forward.size(); ++i)
+            expected.push_back(std::min<size_t>(forward[i], reverse[i]));
+
+        EXPECT_RANGE_EQ(expected, text | seqan3::views::canonical_kmer_hash(shape));
+        EXPECT_RANGE_EQ(expected, list_text | seqan3::views::canonical_kmer_hash(shape));
+        EXPECT_RANGE_EQ(expected | std::views::reverse,
+                        text | seqan3::views::canonical_kmer_hash(shape) | std::views::reverse);
+
+        // random access
+        auto v = text | seqan3::views::canonical_kmer_hash(shape);
+        EXPECT_EQ(expected[100], v[100]);
+        EXPECT_EQ(expected[200], *(std::ranges::begin(v) + 200));
+    }
+}
+
+TEST(kmer_hash_ungapped_test, canonical_against_reverse_complement)
+{
+    test_canonical_against_reverse_complement<seqan3::dna4>();
+    test_canonical_against_reverse_complement<seqan3::dna5>();
+}
+
+TEST(kmer_hash_ungapped_test, canonical_packed)
+{
+    std::vector<seqan3::dna4> const text = generate_text<seqan3::dna4>();
+    seqan3::bitcompressed_vector<seqan3::dna4> const packed{text};
+
+    for (seqan3::shape const & shape : {0b1101_shape, seqan3::shape{seqan3::ungapped{31}}})
+    {
+        EXPECT_RANGE_EQ(text | seqan3::views::canonical_kmer_hash(shape),
+                        packed | seqan3::views::canonical_kmer_hash(shape));
+    }
+}
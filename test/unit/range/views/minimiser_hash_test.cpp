@@ -59,7 +59,9 @@ using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
                                                 seqan3::bitcompressed_vector<seqan3::dna4>,
                                                 seqan3::bitcompressed_vector<seqan3::dna4> const,
                                                 std::list<seqan3::dna4>,
-                                                std::list<seqan3::dna4> const>;
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
 
 TYPED_TEST_SUITE(minimiser_hash_properties_test, underlying_range_types, );
 class minimiser_hash_test : public ::testing::Test
@@ -123,3 +125,50 @@ TEST_F(minimiser_hash_test, shape_bigger_than_window)
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(ungapped_shape, seqan3::window_size{3}), std::invalid_argument);
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(gapped_shape, seqan3::window_size{3}), std::invalid_argument);
 }
+
+TEST_F(minimiser_hash_test, copy)
+{
+    for (std::vector<seqan3::dna4> const & text : {text1, text1_short, text2, text3})
+    {
+        for (seqan3::shape const & shape : {ungapped_shape, gapped_shape})
+        {
+            result_t buffer(text.size());
+            auto buffer_end = seqan3::minimiser_hash_copy(text, buffer.begin(), shape, seqan3::window_size{8});
+            buffer.erase(buffer_end, buffer.end());
+            EXPECT_RANGE_EQ(text | seqan3::views::minimiser_hash(shape, seqan3::window_size{8}), buffer);
+        }
+    }
+
+    result_t buffer(text1.size());
+    EXPECT_THROW(seqan3::minimiser_hash_copy(text1, buffer.begin(), ungapped_shape, seqan3::window_size{3}),
+                 std::invalid_argument);
+}
+
+TEST_F(minimiser_hash_test, large_window)
+{
+    std::vector<seqan3::dna4> text{};
+    for (size_t i = 0; i < 2000; ++i)
+        text.push_back(seqan3::assign_rank_to((i * 7 + i / 5 + i / 37) % 4, seqan3::dna4{}));
+
+    seqan3::shape const shape{seqan3::ungapped{12}};
+    uint64_t const seed{0x8F3F73B5CF1C9ADE};
+    auto skew = std::views::transform([seed] (uint64_t const i) { return i ^ seed; });
+
+    for (uint32_t w : {12u, 13u, 40u, 250u})
+    {
+        // Both strands hashed separately, as seqan3::views::minimiser_hash did before computing canonical hashes.
+        auto expected = seqan3::detail::minimiser_view{text | seqan3::views::kmer_hash(shape) | skew,
+                                                       text | seqan3::views::complement
+                                                            | std::views::reverse
+                                                            | seqan3::views::kmer_hash(shape)
+                                                            | skew
+                                                            | std::views::reverse,
+                                                       w - shape.size() + 1};
+
+        EXPECT_RANGE_EQ(expected, text | seqan3::views::minimiser_hash(shape, seqan3::window_size{w}));
+
+        result_t buffer(text.size());
+        buffer.erase(seqan3::minimiser_hash_copy(text, buffer.begin(), shape, seqan3::window_size{w}), buffer.end());
+        EXPECT_RANGE_EQ(expected, buffer);
+    }
+}
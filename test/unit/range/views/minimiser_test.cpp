@@ -227,6 +227,15 @@ TEST_F(minimiser_test, combinability)
                                                                    5}));
 }
 
+TEST_F(minimiser_test, robust_winnowing)
+{
+    // Ties keep the current minimiser; when it leaves the window, the rightmost minimum of the window is chosen.
+    std::vector<size_t> values{3, 1, 2, 1, 5, 1, 4, 4, 4, 4, 0, 6, 6, 6, 6};
+    EXPECT_RANGE_EQ((result_t{1, 1, 1, 4, 0, 6}), values | seqan3::views::minimiser(3));
+    EXPECT_RANGE_EQ((result_t{1, 1, 4, 0, 6}), values | seqan3::views::minimiser(4));
+    EXPECT_RANGE_EQ((result_t{0}), values | seqan3::views::minimiser(20));
+}
+
 TEST_F(minimiser_test, non_arithmetic_value)
 {
     // just compute the minimizer directly on the alphabet
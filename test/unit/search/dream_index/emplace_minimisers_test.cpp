@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/views/minimiser_hash.hpp>
+#include <seqan3/search/dream_index/emplace_minimisers.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+static seqan3::shape const test_shape{seqan3::ungapped{12}};
+static seqan3::window_size const test_window_size{20};
+
+seqan3::concatenated_sequences<seqan3::dna4_vector> generate_sequences(size_t const count)
+{
+    seqan3::concatenated_sequences<seqan3::dna4_vector> sequences{};
+
+    for (size_t i = 0; i < count; ++i)
+        sequences.push_back(seqan3::test::generate_sequence<seqan3::dna4>(1'000 + 100 * i, 0, i));
+
+    return sequences;
+}
+
+seqan3::interleaved_bloom_filter<> sequential_ibf(seqan3::concatenated_sequences<seqan3::dna4_vector> const & sequences,
+                                                  size_t const bin_count)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count}, seqan3::bin_size{1024u}};
+
+    for (size_t i = 0; i < sequences.size(); ++i)
+        for (size_t const value : sequences[i] | seqan3::views::minimiser_hash(test_shape, test_window_size))
+            ibf.emplace(value, seqan3::bin_index{i});
+
+    return ibf;
+}
+
+TEST(emplace_minimisers, same_as_sequential)
+{
+    // 130 bins span three blocks of 64 bins.
+    for (size_t const bin_count : {5u, 130u})
+    {
+        auto const sequences = generate_sequences(bin_count);
+
+        for (size_t const thread_count : {1u, 4u})
+        {
+            seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count}, seqan3::bin_size{1024u}};
+            seqan3::emplace_minimisers(ibf, sequences, test_shape, test_window_size, thread_count);
+
+            EXPECT_TRUE(ibf == sequential_ibf(sequences, bin_count));
+        }
+    }
+}
+
+TEST(emplace_minimisers, fewer_sequences_than_bins)
+{
+    auto const sequences = generate_sequences(3);
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    seqan3::emplace_minimisers(ibf, sequences, test_shape, test_window_size);
+
+    EXPECT_TRUE(ibf == sequential_ibf(sequences, 64u));
+}
+
+TEST(emplace_minimisers, exceptions)
+{
+    auto const sequences = generate_sequences(3);
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{2u}, seqan3::bin_size{1024u}};
+
+    EXPECT_THROW(seqan3::emplace_minimisers(ibf, sequences, test_shape, test_window_size), std::out_of_range);
+    EXPECT_THROW(seqan3::emplace_minimisers(ibf, sequences, seqan3::ungapped{21}, test_window_size),
+                 std::invalid_argument);
+}